@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstdint>
 #include <cstdio>
 #include <string>
 #ifdef __linux__
@@ -31,18 +32,31 @@
 #endif
 
 #include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/ArrayArena.h"
+#include "Corrade/Containers/ArrayMmapAllocator.h"
 #include "Corrade/Containers/ArrayTuple.h"
 #include "Corrade/Containers/BigEnumSet.hpp"
+#include "Corrade/Containers/BitArray.h"
+#include "Corrade/Containers/ConcurrentQueue.h"
+#include "Corrade/Containers/FlatMap.h"
 #include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/HashMap.h"
+#include "Corrade/Containers/HashSet.h"
 #include "Corrade/Containers/EnumSet.hpp"
 #include "Corrade/Containers/LinkedList.h"
 #include "Corrade/Containers/Optional.h"
 #include "Corrade/Containers/Pointer.h"
 #include "Corrade/Containers/Reference.h"
+#include "Corrade/Containers/RingBuffer.h"
 #include "Corrade/Containers/ScopeGuard.h"
+#include "Corrade/Containers/SmallArray.h"
 #include "Corrade/Containers/StaticArray.h"
+#include "Corrade/Containers/StaticStrideArrayView.h"
 #include "Corrade/Containers/StridedArrayView.h"
+#include "Corrade/Containers/StridedBitArrayView.h"
 #include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringBuilder.h"
+#include "Corrade/Containers/StringPool.h"
 #include "Corrade/Containers/StringView.h"
 #include "Corrade/Utility/Debug.h"
 #include "Corrade/Utility/Directory.h"
@@ -253,6 +267,22 @@ for(Foo& f: e) new(&f) Foo(index++);
 /* [Array-initialization] */
 }
 
+{
+/* [Array-initialization-aligned] */
+// 1024 zero-initialized floats, the first one on a 64-byte boundary
+Containers::Array<float> a{Containers::ValueInit, 1024, 64};
+
+// Per-thread counters, each on its own cache line
+struct Counter {
+    std::size_t value;
+    char padding[64 - sizeof(std::size_t)];
+};
+Containers::Array<Counter> counters{Containers::ValueInit, 8, 64};
+/* [Array-initialization-aligned] */
+static_cast<void>(a);
+static_cast<void>(counters);
+}
+
 /* [Array-wrapping] */
 {
     int* data = reinterpret_cast<int*>(std::malloc(25*sizeof(int)));
@@ -330,6 +360,273 @@ a[80] = 5; // Even though the memory is there, this causes ASan to complain
 /* [Array-growable-sanitizer] */
 }
 
+{
+struct Request { Containers::ArrayView<const float> values; };
+Containers::ArrayView<const Request> requests;
+float sum{};
+/* [ArrayArena-usage] */
+/* Keeping the arena alive across requests to have the memory reused */
+Containers::ArrayArena arena;
+for(const Request& request: requests) {
+    {
+        Containers::Array<float> scratch;
+        for(float value: request.values) if(value > 0.0f)
+            Containers::arrayAppend<Containers::ArrayArenaAllocator>(scratch, value);
+
+        for(float value: scratch) sum += value;
+    }
+
+    /* All arrays from the arena are destroyed at this point, reclaim the
+       memory for the next request */
+    arena.reset();
+}
+/* [ArrayArena-usage] */
+}
+
+{
+/* [SmallArray-usage] */
+/* Up to four elements are stored inline, without any allocation */
+Containers::SmallArray<4, int> a;
+Containers::arrayAppend(a, {1, 2, 3});
+Containers::arrayAppend(a, 4);
+
+/* Appending the fifth moves the contents to the heap */
+Containers::arrayAppend(a, 5);
+
+/* Convertible to a view like any other array */
+Containers::ArrayView<int> view = a;
+/* [SmallArray-usage] */
+static_cast<void>(view);
+}
+
+{
+using namespace Containers::Literals;
+/* [HashMap-usage] */
+Containers::HashMap<Containers::String, int> counts;
+for(Containers::StringView word: "the quick brown fox jumps over the lazy dog"_s.splitWithoutEmptyParts())
+    ++counts.emplace(word, 0);
+
+/* Lookup with a view, no temporary string gets allocated */
+if(const int* count = counts.find("the"_s))
+    Utility::Debug{} << "Found" << *count << "occurences";
+
+for(const Containers::HashMapEntry<Containers::String, int>& entry: counts)
+    Utility::Debug{} << entry.key() << entry.value();
+/* [HashMap-usage] */
+}
+
+{
+/* [HashSet-usage] */
+Containers::HashSet<int> visited;
+for(int i: {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5})
+    if(visited.insert(i)) Utility::Debug{} << "Seen" << i << "for the first time";
+/* [HashSet-usage] */
+}
+
+{
+using namespace Containers::Literals;
+/* [FlatMap-usage] */
+/* Sorted once on construction */
+Containers::FlatMap<Containers::String, int> sizes{
+    Containers::array<Containers::String>({"tiny"_s, "huge"_s, "small"_s}),
+    Containers::array<int>({1, 1000, 10})};
+
+/* Binary search with a view, no temporary string gets allocated */
+if(const int* size = sizes.find("small"_s))
+    Utility::Debug{} << "Small is" << *size;
+
+/* Iteration goes in a sorted order */
+for(std::size_t i = 0; i != sizes.size(); ++i)
+    Utility::Debug{} << sizes.keys()[i] << sizes.values()[i];
+/* [FlatMap-usage] */
+}
+
+{
+/* [StringPool-usage] */
+Containers::StringPool pool;
+
+Containers::String name = "CgltfImporter";
+Containers::StringView a = pool.intern(name);
+Containers::StringView b = pool.intern("CgltfImporter");
+
+/* Both point to the same memory, so comparing the pointers is enough */
+CORRADE_INTERNAL_ASSERT(a.data() == b.data());
+
+/* No copy is made as the view is marked as global and null-terminated */
+Containers::String c = Containers::String::nullTerminatedGlobalView(a);
+/* [StringPool-usage] */
+static_cast<void>(c);
+}
+
+{
+using namespace Containers::Literals;
+Containers::StringView directory, name;
+/* [String-concat] */
+Containers::String path = Containers::String::concat({directory, "/"_s, name, ".conf"_s});
+/* [String-concat] */
+static_cast<void>(path);
+}
+
+{
+/* [StringBuilder-usage] */
+Containers::StringBuilder builder;
+for(int i = 0; i != 1000; ++i) {
+    if(i) builder.append(", ");
+    builder.append(i % 2 ? "odd" : "even");
+}
+
+Containers::String out = builder.release();
+/* [StringBuilder-usage] */
+static_cast<void>(out);
+}
+
+{
+/* [BitArrayView-usage] */
+char data[]{'\x0f', '\xf0', '\x3c'};
+
+/* Bits 3 to 18 of the data */
+Containers::MutableBitArrayView view{data, 3, 16};
+view.slice(2, 6).resetAll();
+std::size_t set = view.count();
+/* [BitArrayView-usage] */
+static_cast<void>(set);
+}
+
+{
+Containers::BitArrayView visible;
+/* [BitArrayView-setBitIndices] */
+for(std::size_t i: visible.setBitIndices()) {
+    Utility::Debug{} << "Entry" << i << "is visible";
+}
+/* [BitArrayView-setBitIndices] */
+}
+
+{
+std::size_t objectCount{};
+/* [BitArray-usage] */
+Containers::BitArray visible{Containers::DirectInit, objectCount, true};
+Containers::BitArray occluded{Containers::ValueInit, objectCount};
+Containers::BitArray lit{Containers::ValueInit, objectCount};
+
+/* Objects that are visible, lit and not occluded */
+Containers::bitArrayAndNot(visible, occluded, visible);
+Containers::bitArrayAnd(visible, lit, visible);
+Utility::Debug{} << visible.count() << "objects to draw";
+/* [BitArray-usage] */
+}
+
+{
+/* [StridedBitArrayView-usage] */
+Containers::BitArray bits{Containers::ValueInit, 64};
+
+/* Every fourth bit, in reverse order */
+Containers::MutableStridedBitArrayView view =
+    Containers::MutableStridedBitArrayView{Containers::MutableBitArrayView{bits}}
+        .every(4).flipped();
+view.set(0); /* sets bit 60 */
+/* [StridedBitArrayView-usage] */
+}
+
+{
+struct Packet { std::size_t size; char data[1500]; };
+auto receive = []() { return Packet{}; };
+auto process = [](const Packet&) {};
+bool running = false;
+/* [RingBuffer-usage] */
+Containers::RingBuffer<Packet> packets{256};
+
+/* Producer thread */
+while(running) {
+    Packet packet = receive();
+    while(!packets.push(packet)) {} /* Busy-wait until there's space */
+}
+
+/* Consumer thread */
+while(running) {
+    if(Containers::Optional<Packet> packet = packets.pop())
+        process(*packet);
+}
+/* [RingBuffer-usage] */
+}
+
+{
+struct Job { void(*function)(void*); void* state; };
+bool running = false;
+/* [ConcurrentQueue-usage] */
+Containers::ConcurrentQueue<Job> jobs{1024};
+
+/* Any number of worker threads */
+while(running) {
+    Job batch[16];
+    std::size_t count = jobs.pop(batch);
+    for(std::size_t i = 0; i != count; ++i)
+        batch[i].function(batch[i].state);
+}
+/* [ConcurrentQueue-usage] */
+}
+
+{
+/* [ArrayAlignedAllocator] */
+Containers::Array<float> data;
+for(float i = 0.0f; i < 1000.0f; i += 1.0f)
+    Containers::arrayAppend<float, Containers::ArrayAlignedAllocator<float, 64>>(data, i);
+
+// The data stay 64-byte aligned across all reallocations
+float* aligned = Containers::arrayView(data).alignedData<64>();
+/* [ArrayAlignedAllocator] */
+static_cast<void>(aligned);
+}
+
+{
+/* [arrayRemoveUnordered] */
+Containers::Array<int> a;
+Containers::arrayAppend(a, {1, 2, 3, 4, 5});
+
+/* The gap is filled with the last element, a is now {1, 5, 3, 4} */
+Containers::arrayRemoveUnordered(a, 1);
+/* [arrayRemoveUnordered] */
+}
+
+#ifdef __linux__
+{
+auto read = [](Containers::ArrayView<char>) -> std::size_t { return 0; };
+/* [ArrayMmapAllocator] */
+/* Reading an unknown amount of data, possibly several gigabytes. Growing
+   the array doesn't copy anything. */
+Containers::Array<char> data;
+for(;;) {
+    Containers::ArrayView<char> chunk =
+        Containers::arrayAppend<Containers::ArrayMmapAllocator>(data, Containers::NoInit, 65536);
+    std::size_t size = read(chunk);
+    Containers::arrayRemoveSuffix<Containers::ArrayMmapAllocator>(data, 65536 - size);
+    if(!size) break;
+}
+
+/* Releases the unused capacity without copying the data */
+Containers::arrayShrink<Containers::ArrayMmapAllocator>(data);
+/* [ArrayMmapAllocator] */
+}
+
+{
+struct Event {
+    std::uint64_t timestamp;
+    std::uint32_t type, value;
+};
+/* [ArrayMappedFileAllocator] */
+/* Open an existing log or create a new one */
+Containers::Array<Event> log = Containers::arrayMapFile<Event>("events.bin");
+if(!log) log = Containers::arrayMapFileWrite<Event>("events.bin", 0);
+
+/* Appending grows the file */
+Containers::arrayAppend<Containers::ArrayMappedFileAllocator>(log,
+    Event{1614556800, 3, 42});
+
+/* Make sure everything is on disk at this point */
+Containers::arrayMapFileFlush(log);
+/* [ArrayMappedFileAllocator] */
+}
+#endif
+
 {
 /* [arrayAllocatorCast] */
 Containers::Array<char> data;
@@ -851,6 +1148,28 @@ static_cast<void>(a);
 static_cast<void>(b);
 }
 
+{
+/* [StaticStrideArrayView-usage] */
+struct Vertex {
+    float position[3];
+    float weight;
+};
+
+Vertex vertices[]{{{-0.5f, -0.5f, 0.0f}, 1.0f}, {{0.5f, -0.5f, 0.0f}, 0.5f}};
+
+/* Stride of 16 bytes is known at compile time, so the loop can get
+   vectorized */
+Containers::StaticStrideArrayView<sizeof(Vertex), float> weights =
+    Containers::StaticStrideArrayView<sizeof(Vertex), Vertex>{vertices}
+        .slice(&Vertex::weight);
+for(std::size_t i = 0; i != weights.size(); ++i) weights[i] *= 0.5f;
+
+/* Can be passed to APIs taking a runtime stride as well */
+Containers::StridedArrayView1D<const float> view = weights;
+/* [StaticStrideArrayView-usage] */
+static_cast<void>(view);
+}
+
 {
 /* [StridedArrayView-usage] */
 struct Position {
@@ -1072,6 +1391,26 @@ view[5] = '\0';
 static_cast<void>(a);
 }
 
+{
+Containers::StringView csv;
+/* [StringView-splitLazy] */
+std::size_t nonEmptyFields = 0;
+for(Containers::StringView field: csv.splitLazy(','))
+    if(!field.isEmpty()) ++nonEmptyFields;
+/* [StringView-splitLazy] */
+static_cast<void>(nonEmptyFields);
+}
+
+{
+Containers::StringView file;
+/* [StringView-lines] */
+std::size_t nonEmptyLines = 0;
+for(Containers::StringView line: file.lines())
+    if(!line.trimmed().isEmpty()) ++nonEmptyLines;
+/* [StringView-lines] */
+static_cast<void>(nonEmptyLines);
+}
+
 {
 using namespace Containers::Literals;
 /* [String-literal-null] */
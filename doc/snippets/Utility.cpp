@@ -30,9 +30,11 @@
 #include <sstream>
 
 #include "Corrade/Containers/Array.h"
+#include "Corrade/Utility/Algorithms.h"
 #include "Corrade/Utility/Arguments.h"
 #include "Corrade/Utility/Assert.h"
 #include "Corrade/Utility/Configuration.h"
+#include "Corrade/Utility/Cpu.h"
 #include "Corrade/Utility/DebugStl.h"
 #include "Corrade/Utility/Directory.h"
 #include "Corrade/Utility/Endianness.h"
@@ -42,7 +44,9 @@
 #include "Corrade/Utility/Format.h"
 #include "Corrade/Utility/FormatStl.h"
 #include "Corrade/Utility/Macros.h"
+#include "Corrade/Utility/MurmurHash2.h"
 #include "Corrade/Utility/Sha1.h"
+#include "Corrade/Utility/XxHash3.h"
 
 /* [Tweakable-disable-header] */
 #define CORRADE_TWEAKABLE
@@ -231,6 +235,57 @@ constexpr int divide(int a, int b) {
 /* [CORRADE_INTERNAL_CONSTEXPR_ASSERT] */
 }
 
+namespace { namespace CpuTags {
+/* [Cpu-tags] */
+void transform(Utility::Cpu::ScalarT, Containers::ArrayView<float> data) {
+    for(float& i: data) i *= 2.0f;
+}
+
+void transform(Utility::Cpu::Sse2T, Containers::ArrayView<float> data) {
+    // multiply four floats at a time with _mm_mul_ps(), then the remainder
+    transform(Utility::Cpu::Scalar, data.suffix(data.size()/4*4));
+}
+
+void transform(Utility::Cpu::Avx2T, Containers::ArrayView<float> data) {
+    // multiply eight floats at a time with _mm256_mul_ps(), then the remainder
+    transform(Utility::Cpu::Scalar, data.suffix(data.size()/8*8));
+}
+
+void transform(Containers::ArrayView<float> data) {
+    transform(Utility::Cpu::DefaultBase, data);
+}
+/* [Cpu-tags] */
+}}
+
+#ifdef CORRADE_ENABLE_AVX2
+namespace { namespace CpuDispatch {
+/* [Cpu-dispatch] */
+void transformScalar(Containers::ArrayView<float> data) {
+    for(float& i: data) i *= 2.0f;
+}
+
+CORRADE_ENABLE_AVX2 void transformAvx2(Containers::ArrayView<float> data) {
+    // multiply eight floats at a time with _mm256_mul_ps(), then the remainder
+    transformScalar(data.suffix(data.size()/8*8));
+}
+
+using TransformFunction = void(*)(Containers::ArrayView<float>);
+
+TransformFunction transformImplementation(Utility::Cpu::ScalarT) {
+    return transformScalar;
+}
+
+TransformFunction transformImplementation(Utility::Cpu::Avx2T) {
+    return transformAvx2;
+}
+
+CORRADE_CPU_DISPATCHER(transformDispatcher, transformImplementation)
+CORRADE_CPU_DISPATCHED_POINTER(transformDispatcher,
+    void(*transform)(Containers::ArrayView<float>))
+/* [Cpu-dispatch] */
+}}
+#endif
+
 /* [CORRADE_HAS_TYPE-type] */
 CORRADE_HAS_TYPE(HasKeyType, typename T::key_type);
 
@@ -348,6 +403,51 @@ args.addOption("input")
 };
 
 int main() {
+{
+float data[3]{};
+CpuTags::transform(data);
+CpuTags::transform(Utility::Cpu::Sse2, data);
+CpuTags::transform(Utility::Cpu::Avx2, data);
+#ifdef CORRADE_ENABLE_AVX2
+CpuDispatch::transform(Containers::arrayView(data));
+#endif
+}
+
+{
+/* [copy-indexed] */
+const float values[]{1.5f, 0.0f, -2.0f, 3.0f};
+const std::uint8_t indices[]{3, 3, 0, 2};
+float out[4];
+
+/* out is {3.0f, 3.0f, 1.5f, -2.0f} */
+Utility::copy(Containers::stridedArrayView(values),
+              Containers::stridedArrayView(indices),
+              Containers::stridedArrayView(out));
+/* [copy-indexed] */
+}
+
+{
+/* [interleave] */
+struct Vector3 { float x, y, z; };
+Containers::ArrayView<const Vector3> positions;
+Containers::ArrayView<const Vector3> normals;
+Containers::ArrayView<const std::uint32_t> colors;
+
+struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+    std::uint32_t color;
+};
+Containers::Array<Vertex> vertices{Containers::NoInit, positions.size()};
+
+Utility::interleave({
+    Containers::arrayCast<2, const char>(Containers::stridedArrayView(positions)),
+    Containers::arrayCast<2, const char>(Containers::stridedArrayView(normals)),
+    Containers::arrayCast<2, const char>(Containers::stridedArrayView(colors))
+}, Containers::arrayCast<2, char>(Containers::stridedArrayView(vertices)));
+/* [interleave] */
+}
+
 {
 /* [Configuration-usage] */
 Utility::Configuration conf{"my.conf"};
@@ -763,6 +863,49 @@ Utility::Debug{} << sha1.digest().hexString();
 Utility::Debug{} << Utility::Sha1::digest("corrade");
 /* [Sha1-usage] */
 }
+
+{
+/* [Sha1-digestBatch] */
+Containers::Array<Containers::Array<char>> files;
+// populate with file contents ...
+
+Containers::Array<Containers::ArrayView<const char>> inputs{files.size()};
+for(std::size_t i = 0; i != files.size(); ++i)
+    inputs[i] = files[i];
+
+Containers::Array<Utility::Sha1::Digest> digests = Utility::Sha1::digestBatch(inputs);
+/* [Sha1-digestBatch] */
+}
+
+{
+std::ifstream file;
+std::size_t fileSize{};
+char block[4096];
+/* [MurmurHash2-incremental] */
+Utility::MurmurHash2 hash;
+hash.setDataSize(fileSize);
+while(file.read(block, sizeof(block)) || file.gcount())
+    hash << Containers::ArrayView<const char>{block, std::size_t(file.gcount())};
+
+Utility::MurmurHash2::Digest digest = hash.digest();
+/* [MurmurHash2-incremental] */
+static_cast<void>(digest);
+}
+
+{
+Containers::ArrayView<const char> header, body;
+/* [XxHash3-usage] */
+Utility::XxHash3 hash{0x1337};
+
+/* Hash everything at once */
+Utility::XxHash3::Digest a = hash(std::string{"hello world!"});
+
+/* Or add the data piece by piece */
+Utility::XxHash3::Digest b = (hash << header << body).digest();
+/* [XxHash3-usage] */
+static_cast<void>(a);
+static_cast<void>(b);
+}
 }
 
 typedef std::pair<int, int> T;
@@ -81,6 +81,10 @@
 #  CORRADE_BUILD_MULTITHREADED  - Defined if compiled in a way that makes it
 #   possible to safely use certain Corrade features simultaneously in multiple
 #   threads
+#  CORRADE_BUILD_CPU_RUNTIME_DISPATCH - Defined if built with all SIMD variants
+#   of performance-critical code, picking the best one at runtime
+#  CORRADE_CPU_USE_IFUNC        - Defined if runtime CPU dispatch is done
+#   using GNU IFUNC
 #  CORRADE_TARGET_UNIX          - Defined if compiled for some Unix flavor
 #   (Linux, BSD, macOS)
 #  CORRADE_TARGET_APPLE         - Defined if compiled for Apple platforms
@@ -319,6 +323,8 @@ set(_corradeFlags
     BUILD_STATIC
     BUILD_STATIC_UNIQUE_GLOBALS
     BUILD_MULTITHREADED
+    BUILD_CPU_RUNTIME_DISPATCH
+    CPU_USE_IFUNC
     TARGET_UNIX
     TARGET_APPLE
     TARGET_IOS
@@ -541,6 +547,13 @@ foreach(_component ${Corrade_FIND_COMPONENTS})
                 set_property(TARGET Corrade::${_component} APPEND PROPERTY
                     INTERFACE_LINK_LIBRARIES "log")
             endif()
+            # Parallel Utility::copy() needs this. Used only internally, so
+            # needed just when linking to a static library.
+            if(CORRADE_BUILD_STATIC AND NOT CORRADE_TARGET_EMSCRIPTEN)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Corrade::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Threads::Threads)
+            endif()
         endif()
 
         # Find library includes
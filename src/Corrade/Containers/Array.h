@@ -29,6 +29,7 @@
  * @brief Class @ref Corrade::Containers::Array
  */
 
+#include <cstdlib>
 #include <initializer_list>
 #include <new>
 #include <type_traits>
@@ -78,6 +79,37 @@ namespace Implementation {
             delete[] reinterpret_cast<char*>(data);
         };
     }
+
+    /* Aligned allocations store capacity and offset from the std::malloc()'d
+       pointer right before the data. Shared with ArrayAlignedAllocator, which
+       makes use of the capacity, here it's equal to the size. */
+    inline std::size_t arrayAlignment(std::size_t alignment, std::size_t typeAlignment) {
+        if(alignment < typeAlignment) alignment = typeAlignment;
+        return alignment < sizeof(std::size_t) ? sizeof(std::size_t) : alignment;
+    }
+    template<class T> T* arrayAlignedAllocate(const std::size_t capacity, std::size_t alignment) {
+        alignment = arrayAlignment(alignment, alignof(T));
+        char* const memory = static_cast<char*>(std::malloc(capacity*sizeof(T) + 2*sizeof(std::size_t) + alignment - 1));
+        char* const data = reinterpret_cast<char*>((reinterpret_cast<std::size_t>(memory) + 2*sizeof(std::size_t) + alignment - 1) & ~(alignment - 1));
+        reinterpret_cast<std::size_t*>(data)[-2] = capacity;
+        reinterpret_cast<std::size_t*>(data)[-1] = data - memory;
+        return reinterpret_cast<T*>(data);
+    }
+    template<class T> inline void arrayAlignedDeallocate(T* const data) {
+        if(data) std::free(reinterpret_cast<char*>(data) - reinterpret_cast<std::size_t*>(data)[-1]);
+    }
+    template<class T> void arrayAlignedConstruct(DefaultInitT, T* it, T* const end) {
+        /* No (), we want trivial types non-initialized */
+        for(; it != end; ++it) new(it) T;
+    }
+    template<class T> void arrayAlignedConstruct(ValueInitT, T* it, T* const end) {
+        /* Using () instead of {} so explicit default constructors work */
+        for(; it != end; ++it) new(it) T();
+    }
+    template<class T> void arrayAlignedDeleter(T* const data, const std::size_t size) {
+        for(T *it = data, *end = data + size; it != end; ++it) it->~T();
+        arrayAlignedDeallocate(data);
+    }
 }
 
 /**
@@ -126,6 +158,23 @@ Example:
 
 @snippet Containers.cpp Array-initialization
 
+@subsection Containers-Array-initialization-aligned Aligned allocations
+
+The @ref Array(DefaultInitT, std::size_t, std::size_t),
+@ref Array(ValueInitT, std::size_t, std::size_t) and
+@ref Array(NoInitT, std::size_t, std::size_t) variants additionally take an
+alignment, which has to be a power of two. The memory is allocated with
+@ref std::malloc() with enough extra space to align the data pointer and a
+custom deleter frees it again, which is useful for example for aligned SIMD
+loads or for placing per-thread data on separate cache lines:
+
+@snippet Containers.cpp Array-initialization-aligned
+
+Such arrays aren't growable. To keep the alignment when using
+@ref arrayAppend() and other growable array utilities, use an
+@ref ArrayAlignedAllocator with the same alignment, see
+@ref Containers-Array-growable-allocators for details.
+
 @section Containers-Array-wrapping Wrapping externally allocated arrays
 
 By default the class makes all allocations using @cpp operator new[] @ce and
@@ -194,6 +243,21 @@ memory copies when growing the array. The typeless nature of
 instance with @ref arrayAllocatorCast(), an operation not easily doable using
 typed allocators.
 
+For many short-lived arrays, such as per-request scratch storage, the
+@ref ArrayArenaAllocator can be used to allocate from an @ref ArrayArena
+instead of the global heap. Arrays that are appended to one after another are
+then grown in-place with no copying, and all memory gets reclaimed at once with
+@ref ArrayArena::reset().
+
+If the data need a particular alignment, for example for aligned SIMD loads or
+to put per-thread slots on separate cache lines, use the
+@ref ArrayAlignedAllocator. It aligns the data to a compile-time alignment
+and keeps it aligned across reallocations. Arrays created with the aligned
+@ref Array(NoInitT, std::size_t, std::size_t) and related constructors use
+their own deleter and so aren't growable. The first @ref arrayAppend() with an
+@ref ArrayAlignedAllocator moves their contents to a new allocation, and from
+then on it stays growable.
+
 @subsection Containers-Array-growable-sanitizer AddressSanitizer container annotations
 
 Because the alloacted growable arrays have an area between @ref size() and
@@ -340,6 +404,46 @@ class Array {
          */
         explicit Array(NoInitT, std::size_t size): _data{size ? Implementation::noInitAllocate<T>(size) : nullptr}, _size{size}, _deleter{Implementation::noInitDeleter<T>()} {}
 
+        /**
+         * @brief Construct an aligned default-initialized array
+         * @m_since_latest
+         *
+         * Like @ref Array(DefaultInitT, std::size_t), but with the data
+         * pointer aligned to @p alignment bytes. Expects that @p alignment is
+         * a power of two, values smaller than @cpp alignof(T) @ce or
+         * @cpp sizeof(std::size_t) @ce are rounded up to the larger of the
+         * two. The array has a custom @ref deleter() that calls destructors
+         * on all elements and then frees the memory. If the size is zero, no
+         * allocation is done.
+         * @see @ref Containers-Array-initialization-aligned,
+         *      @ref ArrayView::alignedData()
+         */
+        explicit Array(DefaultInitT, std::size_t size, std::size_t alignment);
+
+        /**
+         * @brief Construct an aligned value-initialized array
+         * @m_since_latest
+         *
+         * Like @ref Array(ValueInitT, std::size_t), but with the data pointer
+         * aligned to @p alignment bytes. See
+         * @ref Array(DefaultInitT, std::size_t, std::size_t) for more
+         * information.
+         */
+        explicit Array(ValueInitT, std::size_t size, std::size_t alignment);
+
+        /**
+         * @brief Construct an aligned array without initializing its contents
+         * @m_since_latest
+         *
+         * Like @ref Array(NoInitT, std::size_t), but with the data pointer
+         * aligned to @p alignment bytes. The custom @ref deleter() calls
+         * destructors on *all elements* regardless of whether they were
+         * properly constructed or not. See
+         * @ref Array(DefaultInitT, std::size_t, std::size_t) for more
+         * information.
+         */
+        explicit Array(NoInitT, std::size_t size, std::size_t alignment);
+
         /**
          * @brief Construct a direct-initialized array
          *
@@ -725,6 +829,21 @@ template<class T, class D> template<class ...Args> Array<T, D>::Array(DirectInit
         Implementation::construct(_data[i], std::forward<Args>(args)...);
 }
 
+template<class T, class D> Array<T, D>::Array(NoInitT, const std::size_t size, const std::size_t alignment): _data{}, _size{}, _deleter{Implementation::arrayAlignedDeleter<T>} {
+    CORRADE_ASSERT(alignment && !(alignment & (alignment - 1)),
+        "Containers::Array: alignment expected to be a power of two, got" << alignment, );
+    if(size) _data = Implementation::arrayAlignedAllocate<T>(size, alignment);
+    _size = size;
+}
+
+template<class T, class D> Array<T, D>::Array(DefaultInitT, const std::size_t size, const std::size_t alignment): Array{NoInit, size, alignment} {
+    Implementation::arrayAlignedConstruct(DefaultInit, _data, _data + _size);
+}
+
+template<class T, class D> Array<T, D>::Array(ValueInitT, const std::size_t size, const std::size_t alignment): Array{NoInit, size, alignment} {
+    Implementation::arrayAlignedConstruct(ValueInit, _data, _data + _size);
+}
+
 template<class T, class D> Array<T, D>::Array(InPlaceInitT, std::initializer_list<T> list): Array{NoInit, list.size()} {
     std::size_t i = 0;
     for(const T& item: list)
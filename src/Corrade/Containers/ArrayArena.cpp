@@ -0,0 +1,104 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ArrayArena.h"
+
+#include <cstdlib>
+
+#include "Corrade/Utility/Macros.h"
+
+namespace Corrade { namespace Containers {
+
+/* The chunk header is followed directly by the chunk data. It's padded to
+   the allocation alignment so the data are aligned as well. */
+struct ArrayArena::Chunk {
+    Chunk* next;
+    std::size_t size;
+};
+
+namespace {
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    CORRADE_THREAD_LOCAL
+    #endif
+    ArrayArena* currentArena = nullptr;
+}
+
+ArrayArena* ArrayArena::current() { return currentArena; }
+
+ArrayArena::ArrayArena(const std::size_t chunkSize): _previous{currentArena}, _first{}, _current{}, _ptr{}, _end{}, _chunkSize{chunkSize} {
+    currentArena = this;
+}
+
+ArrayArena::~ArrayArena() {
+    CORRADE_ASSERT(currentArena == this,
+        "Containers::ArrayArena: arenas have to be destroyed in reverse order of their creation", );
+    currentArena = _previous;
+
+    for(Chunk* chunk = _first; chunk; ) {
+        Chunk* const next = chunk->next;
+        std::free(chunk);
+        chunk = next;
+    }
+}
+
+std::size_t ArrayArena::chunkCount() const {
+    std::size_t count = 0;
+    for(Chunk* chunk = _first; chunk; chunk = chunk->next) ++count;
+    return count;
+}
+
+void* ArrayArena::allocateSlow(const std::size_t size) {
+    static_assert(sizeof(Chunk) == Alignment, "chunk header not aligned");
+
+    /* If the next chunk (left over from before a reset()) is large enough,
+       continue there. Otherwise allocate a new one and insert it after the
+       current, leaving the possibly too small next chunk for later. */
+    Chunk* next = _current ? _current->next : _first;
+    if(!next || next->size < size) {
+        const std::size_t chunkSize = size > _chunkSize ? size : _chunkSize;
+        Chunk* const chunk = static_cast<Chunk*>(std::malloc(sizeof(Chunk) + chunkSize));
+        chunk->next = next;
+        chunk->size = chunkSize;
+        if(_current) _current->next = chunk;
+        else _first = chunk;
+        next = chunk;
+    }
+
+    _current = next;
+    char* const data = reinterpret_cast<char*>(next + 1);
+    _ptr = data + size;
+    _end = data + next->size;
+    #ifdef _CORRADE_CONTAINERS_SANITIZER_ENABLED
+    __asan_unpoison_memory_region(data, size);
+    #endif
+    return data;
+}
+
+void ArrayArena::reset() {
+    _current = nullptr;
+    _ptr = _end = nullptr;
+}
+
+}}
@@ -0,0 +1,371 @@
+#ifndef Corrade_Containers_ArrayArena_h
+#define Corrade_Containers_ArrayArena_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::ArrayArena, @ref Corrade::Containers::ArrayArenaAllocator
+ * @m_since_latest
+ */
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/visibility.h"
+
+#ifdef _CORRADE_CONTAINERS_SANITIZER_ENABLED
+/* https://github.com/llvm-mirror/compiler-rt/blob/master/include/sanitizer/asan_interface.h */
+extern "C" void __asan_unpoison_memory_region(void const volatile *addr, std::size_t size);
+#endif
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief Arena for growable arrays
+@m_since_latest
+
+A bump allocator over a list of fixed-size memory chunks. Allocation is just a
+pointer increment, individual deallocations are (apart from the most recent
+allocation, which gets rolled back) a no-op and all memory is reclaimed at once
+in @f$ \mathcal{O}(1) @f$ by calling @ref reset(). The chunks are kept around
+after a reset and reused by subsequent allocations, so a long-lived arena that
+gets reset after each unit of work --- for example a request or a frame ---
+stops hitting the heap entirely once it warms up.
+
+The arena is meant to be used through the @ref ArrayArenaAllocator with the
+@ref Containers-Array-growable "growable array utilities". Creating an arena
+makes it *current* for the calling thread and all arrays subsequently made
+growable with @ref ArrayArenaAllocator get allocated from it; destroying it
+makes the previously current arena current again, similarly to how scoped
+output redirection works in @ref Utility::Debug :
+
+@snippet Containers.cpp ArrayArena-usage
+
+@attention All arrays allocated from the arena have to be destroyed before the
+    arena is @ref reset() or destroyed, as their deleters refer to memory owned
+    by the arena. Similarly, arenas have to be destroyed in the reverse order
+    of their creation on given thread.
+
+If @ref CORRADE_BUILD_MULTITHREADED is enabled, the current arena is tracked
+separately for each thread. Apart from that the class isn't thread-safe, so
+one arena instance shouldn't be used from multiple threads at the same time.
+*/
+class CORRADE_UTILITY_EXPORT ArrayArena {
+    public:
+        /**
+         * @brief Alignment of all allocations
+         *
+         * Same as the minimal alignment guaranteed by @ref std::malloc() on
+         * common platforms, i.e. 16 bytes on 64-bit and 8 bytes on 32-bit
+         * systems.
+         */
+        enum: std::size_t { Alignment = 2*sizeof(std::size_t) };
+
+        /**
+         * @brief Currently active arena
+         *
+         * Returns the last arena created on the calling thread that's not yet
+         * destroyed or @cpp nullptr @ce if there's no such arena.
+         */
+        static ArrayArena* current();
+
+        /**
+         * @brief Constructor
+         * @param chunkSize     Size of each memory chunk in bytes
+         *
+         * Makes the arena current for the calling thread. No memory is
+         * allocated until the first call to @ref allocate(). Allocations
+         * larger than @p chunkSize get a dedicated chunk.
+         */
+        explicit ArrayArena(std::size_t chunkSize = 65536);
+
+        /** @brief Copying is not allowed */
+        ArrayArena(const ArrayArena&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * Allocations remember the arena they came from, so the instance has
+         * to stay at a fixed address.
+         */
+        ArrayArena(ArrayArena&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all chunks and makes the previously current arena current
+         * again. Expects that the arena is current.
+         */
+        ~ArrayArena();
+
+        /** @brief Copying is not allowed */
+        ArrayArena& operator=(const ArrayArena&) = delete;
+
+        /** @brief Moving is not allowed */
+        ArrayArena& operator=(ArrayArena&&) = delete;
+
+        /** @brief Chunk size */
+        std::size_t chunkSize() const { return _chunkSize; }
+
+        /**
+         * @brief Count of allocated chunks
+         *
+         * Includes also chunks that are unused after a @ref reset().
+         */
+        std::size_t chunkCount() const;
+
+        /**
+         * @brief Allocate memory
+         *
+         * Returns memory of at least @p size bytes, aligned to
+         * @ref Alignment. If there's not enough space left in the current
+         * chunk, continues in a next chunk, allocating it if needed.
+         */
+        void* allocate(std::size_t size) {
+            size = (size + Alignment - 1) & ~std::size_t(Alignment - 1);
+            if(std::size_t(_end - _ptr) < size) return allocateSlow(size);
+            char* const out = _ptr;
+            _ptr += size;
+            #ifdef _CORRADE_CONTAINERS_SANITIZER_ENABLED
+            /* The memory may be a leftover of an annotated array from before
+               a reset() */
+            __asan_unpoison_memory_region(out, size);
+            #endif
+            return out;
+        }
+
+        /**
+         * @brief Try to resize an allocation in-place
+         *
+         * If @p data is the most recent allocation and the current chunk has
+         * enough space left, resizes it to @p newSize bytes and returns
+         * @cpp true @ce. Otherwise does nothing and returns @cpp false @ce.
+         * The @p size is expected to be the size the memory was allocated
+         * or last resized with.
+         */
+        bool resize(void* data, std::size_t size, std::size_t newSize) {
+            size = (size + Alignment - 1) & ~std::size_t(Alignment - 1);
+            newSize = (newSize + Alignment - 1) & ~std::size_t(Alignment - 1);
+            char* const begin = static_cast<char*>(data);
+            if(begin + size != _ptr || std::size_t(_end - begin) < newSize)
+                return false;
+            _ptr = begin + newSize;
+            #ifdef _CORRADE_CONTAINERS_SANITIZER_ENABLED
+            __asan_unpoison_memory_region(begin, newSize);
+            #endif
+            return true;
+        }
+
+        /**
+         * @brief Deallocate memory
+         *
+         * If @p data is the most recent allocation, the space is given back
+         * to the arena. Otherwise it's reclaimed only on the next
+         * @ref reset(). The @p size is expected to be the size the memory was
+         * allocated or last resized with.
+         */
+        void deallocate(void* data, std::size_t size) {
+            size = (size + Alignment - 1) & ~std::size_t(Alignment - 1);
+            if(static_cast<char*>(data) + size == _ptr)
+                _ptr = static_cast<char*>(data);
+        }
+
+        /**
+         * @brief Reset the arena
+         *
+         * Makes all chunks available for reuse. No memory is freed and no
+         * destructors are called. Expects that there are no live allocations
+         * anymore, which isn't checked.
+         */
+        void reset();
+
+    private:
+        struct Chunk;
+
+        void* allocateSlow(std::size_t size);
+
+        ArrayArena* _previous;
+        Chunk *_first, *_current;
+        char *_ptr, *_end;
+        std::size_t _chunkSize;
+};
+
+/**
+@brief Arena allocator for growable arrays
+@m_since_latest
+
+An @ref ArrayAllocator that allocates memory from an @ref ArrayArena. Newly
+growable arrays get allocated from @ref ArrayArena::current(), reallocations
+happen in the arena the array was originally allocated from. Similarly to
+@ref ArrayNewAllocator and @ref ArrayMallocAllocator it's reserving an extra
+space *before* the array, containing a pointer to the arena and the array
+capacity.
+
+Since the arena allocates by bumping a pointer, growing the array that was
+allocated last is done in-place without any copying as long as the current
+chunk has enough space left, which is the common case when filling a single
+array with @ref arrayAppend(). Non-trivially-copyable types are supported as
+well, with elements being move-constructed on reallocation like with
+@ref ArrayNewAllocator. As memory of the previous allocation can't be reused
+until a @ref ArrayArena::reset(), the capacity is always doubled in
+@ref grow() to keep the total amount of abandoned memory bounded by the final
+array size.
+
+@snippet Containers.cpp ArrayArena-usage
+@see @ref Containers-Array-growable
+*/
+template<class T> struct ArrayArenaAllocator {
+    typedef T Type; /**< Pointer type */
+
+    /**
+     * @brief Allocate (but not construct) an array of given capacity
+     *
+     * Allocates from @ref ArrayArena::current(), with an extra space to
+     * store the arena pointer and @p capacity *before* the front. Expects
+     * that an arena is active.
+     */
+    static T* allocate(std::size_t capacity) {
+        ArrayArena* const arena = ArrayArena::current();
+        CORRADE_ASSERT(arena,
+            "Containers::ArrayArenaAllocator::allocate(): no arena is active", nullptr);
+        return allocate(*arena, capacity);
+    }
+
+    /**
+     * @brief Reallocate an array to given capacity
+     *
+     * If the @p array was the last allocation done in its arena, it's grown
+     * in-place. Otherwise a new memory is allocated from the same arena,
+     * @p prevSize elements are move-constructed there, the original elements
+     * destructed and the original memory deallocated. The @p array reference
+     * is then updated to point to the new array.
+     */
+    static void reallocate(T*& array, std::size_t prevSize, std::size_t newCapacity);
+
+    /**
+     * @brief Deallocate an array
+     *
+     * Gives the memory back to the arena if it was the most recent
+     * allocation, otherwise does nothing.
+     */
+    static void deallocate(T* data) {
+        if(data) header(data).arena->deallocate(base(data), header(data).capacity*sizeof(T) + sizeof(Header));
+    }
+
+    /**
+     * @brief Grow the array
+     *
+     * Doubles the capacity, or returns @p desired if it's larger. Empty
+     * arrays are grown to fill at least @ref ArrayArena::Alignment bytes,
+     * excluding the header.
+     */
+    static std::size_t grow(T* array, std::size_t desired);
+
+    /**
+     * @brief Array capacity
+     *
+     * Retrieves the capacity that's stored *before* the front of the
+     * @p array.
+     */
+    static std::size_t capacity(T* array) {
+        return header(array).capacity;
+    }
+
+    /**
+     * @brief Array base address
+     *
+     * Returns the address with the header size subtracted.
+     */
+    static void* base(T* array) {
+        return reinterpret_cast<char*>(array) - sizeof(Header);
+    }
+
+    /**
+     * @brief Array arena
+     *
+     * Returns the arena the @p array was allocated from.
+     */
+    static ArrayArena& arena(T* array) {
+        return *header(array).arena;
+    }
+
+    /**
+     * @brief Array deleter
+     *
+     * Calls a destructor on @p size elements and then delegates into
+     * @ref deallocate().
+     */
+    static void deleter(T* data, std::size_t size) {
+        Implementation::arrayDestruct<T>(data, data + size);
+        deallocate(data);
+    }
+
+    private:
+        /* Has the same size as ArrayArena::Alignment, so the data stay
+           aligned */
+        struct Header {
+            ArrayArena* arena;
+            std::size_t capacity;
+        };
+
+        static Header& header(T* array) {
+            return *reinterpret_cast<Header*>(reinterpret_cast<char*>(array) - sizeof(Header));
+        }
+
+        static T* allocate(ArrayArena& arena, std::size_t capacity) {
+            static_assert(alignof(T) <= ArrayArena::Alignment,
+                "over-aligned types are not supported by this allocator");
+            Header* const memory = static_cast<Header*>(arena.allocate(capacity*sizeof(T) + sizeof(Header)));
+            memory->arena = &arena;
+            memory->capacity = capacity;
+            return reinterpret_cast<T*>(memory + 1);
+        }
+};
+
+template<class T> void ArrayArenaAllocator<T>::reallocate(T*& array, const std::size_t prevSize, const std::size_t newCapacity) {
+    Header& h = header(array);
+    if(h.arena->resize(base(array), h.capacity*sizeof(T) + sizeof(Header), newCapacity*sizeof(T) + sizeof(Header))) {
+        h.capacity = newCapacity;
+        return;
+    }
+
+    T* const newArray = allocate(*h.arena, newCapacity);
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+        "noexcept move-constructible type is required");
+    Implementation::arrayMoveConstruct<T>(array, newArray, prevSize);
+    Implementation::arrayDestruct<T>(array, array + prevSize);
+    deallocate(array);
+    array = newArray;
+}
+
+template<class T> std::size_t ArrayArenaAllocator<T>::grow(T* const array, const std::size_t desired) {
+    const std::size_t current = array ? capacity(array) : 0;
+    const std::size_t candidate = current ? current*2 :
+        (ArrayArena::Alignment + sizeof(T) - 1)/sizeof(T);
+    return desired > candidate ? desired : candidate;
+}
+
+}}
+
+#endif
@@ -0,0 +1,271 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ArrayMmapAllocator.h"
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Corrade/Containers/String.h"
+#include "Corrade/Utility/Debug.h"
+
+namespace Corrade { namespace Containers { namespace Implementation {
+
+namespace {
+
+std::size_t pageSize() {
+    static const std::size_t size = sysconf(_SC_PAGESIZE);
+    return size;
+}
+
+/* Mapping size for given data size, including the header */
+std::size_t mappingSize(const std::size_t size) {
+    const std::size_t page = pageSize();
+    return (size + ArrayMmapHeaderSize + page - 1)/page*page;
+}
+
+/* File mapping size for given data size, at least one page so there's
+   always something to map */
+std::size_t fileMappingSize(const std::size_t size) {
+    const std::size_t page = pageSize();
+    return size ? (size + page - 1)/page*page : page;
+}
+
+ArrayMappedFileHeader& fileHeader(char* const data) {
+    return *reinterpret_cast<ArrayMappedFileHeader*>(data - ArrayMappedFileHeaderSize);
+}
+
+/* Reserves an anonymous page for the header together with space for the
+   file and then maps the file over the reservation, right after the header
+   page */
+char* mapFile(const int fd, const std::size_t mapped) {
+    const std::size_t page = pageSize();
+    void* const reserved = mmap(nullptr, page + mapped, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if(reserved == MAP_FAILED) return nullptr;
+
+    char* const data = static_cast<char*>(reserved) + page;
+    if(mmap(data, mapped, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(reserved, page + mapped);
+        return nullptr;
+    }
+
+    ArrayMappedFileHeader& header = fileHeader(data);
+    header.size = mapped;
+    header.fd = fd;
+    return data;
+}
+
+void adviseHugePages(char* const memory, const std::size_t size, const bool hugePages) {
+    #ifdef MADV_HUGEPAGE
+    /* Failure isn't fatal, it just means transparent huge pages are disabled
+       in the kernel */
+    if(hugePages) madvise(memory, size, MADV_HUGEPAGE);
+    #else
+    static_cast<void>(memory);
+    static_cast<void>(size);
+    static_cast<void>(hugePages);
+    #endif
+}
+
+}
+
+char* arrayMmapAllocate(const std::size_t size, const bool hugePages) {
+    const std::size_t mapped = mappingSize(size);
+    void* const memory = mmap(nullptr, mapped, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if(memory == MAP_FAILED)
+        Utility::Fatal{} << "Containers::ArrayMmapAllocator: can't map" << mapped << "bytes:" << std::strerror(errno);
+
+    char* const base = static_cast<char*>(memory);
+    adviseHugePages(base, mapped, hugePages);
+    *reinterpret_cast<std::size_t*>(base) = mapped;
+    return base + ArrayMmapHeaderSize;
+}
+
+void arrayMmapReallocate(char*& data, const std::size_t size, const bool hugePages) {
+    char* const base = data - ArrayMmapHeaderSize;
+    const std::size_t previous = *reinterpret_cast<std::size_t*>(base);
+    const std::size_t mapped = mappingSize(size);
+    if(mapped == previous) return;
+
+    /* The kernel moves the page table entries if the mapping can't be
+       extended in place, the data themselves are never copied */
+    void* const memory = mremap(base, previous, mapped, MREMAP_MAYMOVE);
+    if(memory == MAP_FAILED)
+        Utility::Fatal{} << "Containers::ArrayMmapAllocator: can't remap" << previous << "bytes to" << mapped << Utility::Debug::nospace << ":" << std::strerror(errno);
+
+    char* const newBase = static_cast<char*>(memory);
+    adviseHugePages(newBase, mapped, hugePages);
+    *reinterpret_cast<std::size_t*>(newBase) = mapped;
+    data = newBase + ArrayMmapHeaderSize;
+}
+
+void arrayMmapDeallocate(char* const data) {
+    char* const base = data - ArrayMmapHeaderSize;
+    munmap(base, *reinterpret_cast<std::size_t*>(base));
+}
+
+void arrayMmapDiscard(char* const data, const std::size_t size) {
+    char* const base = data - ArrayMmapHeaderSize;
+    const std::size_t mapped = *reinterpret_cast<std::size_t*>(base);
+    const std::size_t used = mappingSize(size);
+    if(used < mapped) madvise(base + used, mapped - used, MADV_DONTNEED);
+}
+
+char* arrayMappedFileOpen(const StringView filename, const std::size_t typeSize, std::size_t& size) {
+    const int fd = open(String::nullTerminatedView(filename).data(), O_RDWR);
+    if(fd == -1) {
+        Utility::Error{} << "Containers::arrayMapFile(): can't open" << filename << Utility::Debug::nospace << ":" << std::strerror(errno);
+        return nullptr;
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) == -1) {
+        close(fd);
+        Utility::Error{} << "Containers::arrayMapFile(): can't get size of" << filename << Utility::Debug::nospace << ":" << std::strerror(errno);
+        return nullptr;
+    }
+
+    size = st.st_size;
+    if(size % typeSize) {
+        close(fd);
+        Utility::Error{} << "Containers::arrayMapFile(): size of" << filename << "is" << size << "bytes, which is not a multiple of" << typeSize;
+        return nullptr;
+    }
+
+    /* The file is always as large as the mapping so all mapped pages are
+       backed by it */
+    const std::size_t mapped = fileMappingSize(size);
+    if(ftruncate(fd, mapped) == -1) {
+        close(fd);
+        Utility::Error{} << "Containers::arrayMapFile(): can't resize" << filename << "to" << mapped << "bytes:" << std::strerror(errno);
+        return nullptr;
+    }
+
+    char* const data = mapFile(fd, mapped);
+    if(!data) {
+        close(fd);
+        Utility::Error{} << "Containers::arrayMapFile(): can't map" << filename << Utility::Debug::nospace << ":" << std::strerror(errno);
+        return nullptr;
+    }
+
+    return data;
+}
+
+char* arrayMappedFileCreate(const StringView filename, const std::size_t size) {
+    /* Create if it doesn't exist, truncate it if it does */
+    const int fd = open(String::nullTerminatedView(filename).data(), O_RDWR|O_CREAT|O_TRUNC, mode_t(0600));
+    if(fd == -1) {
+        Utility::Error{} << "Containers::arrayMapFileWrite(): can't open" << filename << Utility::Debug::nospace << ":" << std::strerror(errno);
+        return nullptr;
+    }
+
+    const std::size_t mapped = fileMappingSize(size);
+    if(ftruncate(fd, mapped) == -1) {
+        close(fd);
+        Utility::Error{} << "Containers::arrayMapFileWrite(): can't resize" << filename << "to" << mapped << "bytes:" << std::strerror(errno);
+        return nullptr;
+    }
+
+    char* const data = mapFile(fd, mapped);
+    if(!data) {
+        close(fd);
+        Utility::Error{} << "Containers::arrayMapFileWrite(): can't map" << filename << Utility::Debug::nospace << ":" << std::strerror(errno);
+        return nullptr;
+    }
+
+    return data;
+}
+
+void arrayMappedFileReallocate(char*& data, const std::size_t size) {
+    ArrayMappedFileHeader& header = fileHeader(data);
+    const std::size_t previous = header.size;
+    const std::size_t mapped = fileMappingSize(size);
+    if(mapped == previous) return;
+
+    const int fd = header.fd;
+    if(ftruncate(fd, mapped) == -1)
+        Utility::Fatal{} << "Containers::ArrayMappedFileAllocator: can't resize the file to" << mapped << "bytes:" << std::strerror(errno);
+
+    /* Try to resize the mapping in place first */
+    if(mremap(data, previous, mapped, 0) != MAP_FAILED) {
+        header.size = mapped;
+        return;
+    }
+
+    /* Otherwise map the file again elsewhere. Both mappings share the same
+       pages in the page cache, so the data aren't copied. */
+    char* const newData = mapFile(fd, mapped);
+    if(!newData)
+        Utility::Fatal{} << "Containers::ArrayMappedFileAllocator: can't map" << mapped << "bytes:" << std::strerror(errno);
+
+    munmap(data - pageSize(), pageSize() + previous);
+    data = newData;
+}
+
+void arrayMappedFileShrink(char* const data, const std::size_t size) {
+    ArrayMappedFileHeader& header = fileHeader(data);
+    if(ftruncate(header.fd, size) == -1)
+        Utility::Fatal{} << "Containers::ArrayMappedFileAllocator: can't resize the file to" << size << "bytes:" << std::strerror(errno);
+
+    /* Unmap pages that are now completely past the end of the file */
+    const std::size_t mapped = fileMappingSize(size);
+    if(mapped < header.size) {
+        munmap(data + mapped, header.size - mapped);
+        header.size = mapped;
+    }
+}
+
+void arrayMappedFileDeallocate(char* const data, const std::size_t size) {
+    /* Copy the header out as it gets unmapped together with the file */
+    const ArrayMappedFileHeader header = fileHeader(data);
+    if(ftruncate(header.fd, size) == -1)
+        Utility::Error{} << "Containers::ArrayMappedFileAllocator: can't resize the file to" << size << "bytes:" << std::strerror(errno);
+    munmap(data - pageSize(), pageSize() + header.size);
+    close(header.fd);
+}
+
+}
+
+bool arrayMapFileFlush(const ArrayView<const void> data) {
+    if(data.empty()) return true;
+
+    /* msync() expects a page-aligned address */
+    const std::size_t begin = reinterpret_cast<std::size_t>(data.data()) & ~(Implementation::pageSize() - 1);
+    const std::size_t end = reinterpret_cast<std::size_t>(data.data()) + data.size();
+    if(msync(reinterpret_cast<void*>(begin), end - begin, MS_SYNC) == -1) {
+        Utility::Error{} << "Containers::arrayMapFileFlush(): can't flush" << end - begin << "bytes:" << std::strerror(errno);
+        return false;
+    }
+
+    return true;
+}
+
+}}
+#endif
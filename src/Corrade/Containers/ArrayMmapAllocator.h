@@ -0,0 +1,483 @@
+#ifndef Corrade_Containers_ArrayMmapAllocator_h
+#define Corrade_Containers_ArrayMmapAllocator_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if defined(__linux__) || defined(DOXYGEN_GENERATING_OUTPUT)
+/** @file
+ * @brief Class @ref Corrade::Containers::ArrayMmapAllocator, @ref Corrade::Containers::ArrayMmapHugePageAllocator, @ref Corrade::Containers::ArrayMappedFileAllocator, function @ref Corrade::Containers::arrayMapFile(), @ref Corrade::Containers::arrayMapFileWrite(), @ref Corrade::Containers::arrayMapFileFlush()
+ * @m_since_latest
+ */
+#endif
+
+#include "Corrade/configure.h"
+
+#if defined(__linux__) || defined(DOXYGEN_GENERATING_OUTPUT)
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/StringView.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    /* Size of the header storing the mapping size, keeping the data aligned
+       to 16 bytes */
+    enum: std::size_t { ArrayMmapHeaderSize = 16 };
+
+    /* All these operate on bytes, take and return a pointer to the data
+       right after the header */
+    CORRADE_UTILITY_EXPORT char* arrayMmapAllocate(std::size_t size, bool hugePages);
+    CORRADE_UTILITY_EXPORT void arrayMmapReallocate(char*& data, std::size_t size, bool hugePages);
+    CORRADE_UTILITY_EXPORT void arrayMmapDeallocate(char* data);
+    CORRADE_UTILITY_EXPORT void arrayMmapDiscard(char* data, std::size_t size);
+
+    inline std::size_t arrayMmapCapacity(const char* data) {
+        return *reinterpret_cast<const std::size_t*>(data - ArrayMmapHeaderSize) - ArrayMmapHeaderSize;
+    }
+
+    template<class T, bool hugePages> struct ArrayMmapAllocatorBase {
+        static_assert(
+            #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+            std::is_trivially_copyable<T>::value
+            #else
+            Implementation::IsTriviallyCopyableOnOldGcc<T>::value
+            #endif
+            , "only trivially copyable types are usable with this allocator");
+
+        typedef T Type;
+
+        static T* allocate(std::size_t capacity) {
+            return reinterpret_cast<T*>(arrayMmapAllocate(capacity*sizeof(T), hugePages));
+        }
+
+        static void reallocate(T*& array, std::size_t, std::size_t newCapacity) {
+            char* data = reinterpret_cast<char*>(array);
+            arrayMmapReallocate(data, newCapacity*sizeof(T), hugePages);
+            array = reinterpret_cast<T*>(data);
+        }
+
+        static void deallocate(T* data) {
+            if(data) arrayMmapDeallocate(reinterpret_cast<char*>(data));
+        }
+
+        static std::size_t grow(T* array, std::size_t desired) {
+            /* Growing doesn't copy anything, so doubling just to minimize
+               the count of syscalls */
+            const std::size_t current = array ? capacity(array) : 0;
+            return desired > 2*current ? desired : 2*current;
+        }
+
+        static std::size_t capacity(T* array) {
+            return arrayMmapCapacity(reinterpret_cast<const char*>(array))/sizeof(T);
+        }
+
+        static void* base(T* array) {
+            return reinterpret_cast<char*>(array) - ArrayMmapHeaderSize;
+        }
+    };
+
+    /* Deleter for arrays that went through arrayShrink(). Different from
+       the allocator deleters so the array isn't treated as growable anymore
+       and its capacity is reported to be equal to its size. */
+    template<class T> void arrayMmapShrunkDeleter(T* data, std::size_t) {
+        arrayMmapDeallocate(reinterpret_cast<char*>(data));
+    }
+
+    /* File-backed arrays have the file mapped at a page boundary with an
+       anonymous page right before it. The header with the file mapping size
+       and the file descriptor is at the end of that page. */
+    struct ArrayMappedFileHeader {
+        std::size_t size;
+        int fd;
+    };
+    enum: std::size_t { ArrayMappedFileHeaderSize = 16 };
+    static_assert(sizeof(ArrayMappedFileHeader) <= ArrayMappedFileHeaderSize, "header too large");
+
+    /* All these operate on bytes. The open and create functions return
+       nullptr and print a message on error, the rest exits on error as
+       there's no way to report a failure from arrayAppend(). */
+    CORRADE_UTILITY_EXPORT char* arrayMappedFileOpen(StringView filename, std::size_t typeSize, std::size_t& size);
+    CORRADE_UTILITY_EXPORT char* arrayMappedFileCreate(StringView filename, std::size_t size);
+    CORRADE_UTILITY_EXPORT void arrayMappedFileReallocate(char*& data, std::size_t size);
+    CORRADE_UTILITY_EXPORT void arrayMappedFileShrink(char* data, std::size_t size);
+    CORRADE_UTILITY_EXPORT void arrayMappedFileDeallocate(char* data, std::size_t size);
+
+    inline std::size_t arrayMappedFileCapacity(const char* data) {
+        return reinterpret_cast<const ArrayMappedFileHeader*>(data - ArrayMappedFileHeaderSize)->size;
+    }
+
+    /* Deleter for arrays that went through arrayShrink(), for the same
+       reason as arrayMmapShrunkDeleter() above */
+    template<class T> void arrayMappedFileShrunkDeleter(T* data, std::size_t size) {
+        arrayMappedFileDeallocate(reinterpret_cast<char*>(data), size*sizeof(T));
+    }
+}
+
+/**
+@brief Mmap-based allocator for growable arrays
+@m_since_latest
+
+An @ref ArrayAllocator that allocates memory with anonymous @cb{.sh} mmap() @ce
+and grows it with @cb{.sh} mremap() @ce, which moves the pages to a new
+virtual address instead of copying them if they can't be extended in place.
+Compared to @ref ArrayMallocAllocator, where @ref std::realloc() of large
+arrays usually means allocating a new block, copying all data and freeing the
+old block, growing an array by hundreds of megabytes thus doesn't need twice
+the memory and doesn't touch the existing data at all. Expects that @p T is
+trivially copyable.
+
+Similarly to @ref ArrayMallocAllocator, a size of the mapping is stored
+*before* the array data. Since allocations are always whole pages, the
+allocator is meant to be used for large arrays only. The capacity is doubled
+on every growth to keep the syscall count low, the untouched part of the
+capacity doesn't occupy any physical memory.
+
+Calling @ref arrayShrink(Array<T>&, NoInitT) on an array using this allocator
+doesn't reallocate. Instead, the pages after the array end are released with
+@cb{.sh} MADV_DONTNEED @ce and the array only gets a different deleter,
+making it non-growable:
+
+@snippet Containers.cpp ArrayMmapAllocator
+
+@partialsupport Available only on Linux and Android.
+@see @ref ArrayMmapHugePageAllocator, @ref Containers-Array-growable
+*/
+template<class T> struct ArrayMmapAllocator
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    : Implementation::ArrayMmapAllocatorBase<T, false>
+    #endif
+{
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    typedef T Type; /**< Pointer type */
+
+    /**
+     * @brief Allocate an array of given capacity
+     *
+     * Maps enough pages to fit @p capacity items together with the space
+     * to store the mapping size *before* the front.
+     */
+    static T* allocate(std::size_t capacity);
+
+    /**
+     * @brief Reallocate an array to given capacity
+     *
+     * Calls @cb{.sh} mremap() @ce with @cb{.sh} MREMAP_MAYMOVE @ce on the
+     * mapping and updates the @p array reference to point to the new
+     * location, in case the reallocation wasn't done in-place. The
+     * @p prevSize parameter is ignored, as no data are copied.
+     */
+    static void reallocate(T*& array, std::size_t prevSize, std::size_t newCapacity);
+
+    /**
+     * @brief Deallocate an array
+     *
+     * Calls @cb{.sh} munmap() @ce on the whole mapping.
+     */
+    static void deallocate(T* data);
+
+    /**
+     * @brief Grow the array
+     *
+     * Doubles the capacity or uses @p desired if it's larger.
+     */
+    static std::size_t grow(T* array, std::size_t desired);
+
+    /**
+     * @brief Array capacity
+     *
+     * Calculated from the mapping size stored *before* the front of the
+     * @p array. As the mapping is always whole pages, the capacity is
+     * usually larger than what was requested in @ref allocate().
+     */
+    static std::size_t capacity(T* array);
+
+    /**
+     * @brief Array base address
+     *
+     * Returns the start of the mapping.
+     */
+    static void* base(T* array);
+    #endif
+
+    /**
+     * @brief Array deleter
+     *
+     * Since the types have trivial destructors, directly delegates into
+     * @ref deallocate(). The @p size parameter is unused.
+     */
+    static void deleter(T* data, std::size_t size) {
+        static_cast<void>(size);
+        Implementation::ArrayMmapAllocatorBase<T, false>::deallocate(data);
+    }
+};
+
+/**
+@brief Mmap-based allocator for growable arrays using huge pages
+@m_since_latest
+
+Same as @ref ArrayMmapAllocator, except that every mapping is additionally
+marked with @cb{.sh} MADV_HUGEPAGE @ce, so the kernel backs it with
+transparent huge pages if the system has them enabled. That reduces TLB
+pressure when randomly accessing very large arrays, at the cost of memory
+being committed in 2 MB chunks.
+
+@partialsupport Available only on Linux and Android.
+@see @ref Containers-Array-growable
+*/
+template<class T> struct ArrayMmapHugePageAllocator
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    : Implementation::ArrayMmapAllocatorBase<T, true>
+    #endif
+{
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    typedef T Type; /**< Pointer type */
+
+    /** @brief Allocate an array of given capacity */
+    static T* allocate(std::size_t capacity);
+
+    /** @brief Reallocate an array to given capacity */
+    static void reallocate(T*& array, std::size_t prevSize, std::size_t newCapacity);
+
+    /** @brief Deallocate an array */
+    static void deallocate(T* data);
+
+    /** @brief Grow the array */
+    static std::size_t grow(T* array, std::size_t desired);
+
+    /** @brief Array capacity */
+    static std::size_t capacity(T* array);
+
+    /** @brief Array base address */
+    static void* base(T* array);
+    #endif
+
+    /** @brief Array deleter */
+    static void deleter(T* data, std::size_t size) {
+        static_cast<void>(size);
+        Implementation::ArrayMmapAllocatorBase<T, true>::deallocate(data);
+    }
+};
+
+/**
+@brief File-backed allocator for growable arrays
+@m_since_latest
+
+An @ref ArrayAllocator for arrays that live in a file. Unlike
+@ref Utility::Directory::mapWrite(), which maps a file of a fixed size, the
+array can be grown with @ref arrayAppend() and related functions. Every growth
+enlarges the file with @cb{.sh} ftruncate() @ce and maps it again. The data are
+never copied, as both the old and the new mapping share the same pages in the
+page cache. Expects that @p T is trivially copyable.
+
+The allocator can't allocate new arrays on its own, since it needs a file to
+map. Create the array with @ref arrayMapFileWrite() or @ref arrayMapFile()
+first and then use this allocator for all growable operations on it:
+
+@snippet Containers.cpp ArrayMappedFileAllocator
+
+While the array is being grown, the file size is the array capacity, not its
+size, so a file left after a crash may have zero bytes at the end. When the
+array is destroyed or @ref arrayShrink(Array<T>&, NoInitT) "shrunk", the file
+is truncated to the actual array size, the memory is unmapped and the file is
+closed, same as with the @ref Utility::Directory::MapDeleter "MapDeleter"
+used by @ref Utility::Directory::mapWrite(). Shrinking doesn't reallocate,
+the array only gets a different deleter, making it non-growable. Writes go to
+the page cache and reach the disk when the kernel decides to write them, call
+@ref arrayMapFileFlush() to write them out at a particular point.
+
+Because the allocations are whole pages and each growth maps the file again,
+the capacity is doubled on every growth.
+
+@partialsupport Available only on Linux and Android.
+@see @ref Containers-Array-growable
+*/
+template<class T> struct ArrayMappedFileAllocator {
+    static_assert(
+        #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+        std::is_trivially_copyable<T>::value
+        #else
+        Implementation::IsTriviallyCopyableOnOldGcc<T>::value
+        #endif
+        , "only trivially copyable types are usable with this allocator");
+
+    typedef T Type; /**< Pointer type */
+
+    /**
+     * @brief Allocate an array of given capacity
+     *
+     * Not supported, as there's no file to map. Use @ref arrayMapFile() or
+     * @ref arrayMapFileWrite() to create the array instead. Expects that
+     * it's not called.
+     */
+    static T* allocate(std::size_t capacity) {
+        static_cast<void>(capacity);
+        CORRADE_ASSERT(false,
+            "Containers::ArrayMappedFileAllocator: can only grow arrays created with arrayMapFile() or arrayMapFileWrite()", nullptr);
+        return nullptr;
+    }
+
+    /**
+     * @brief Reallocate an array to given capacity
+     *
+     * Enlarges the file to fit @p newCapacity items and maps it again,
+     * updating the @p array reference to point to the new location. The
+     * @p prevSize parameter is ignored, as no data are copied.
+     */
+    static void reallocate(T*& array, std::size_t prevSize, std::size_t newCapacity) {
+        static_cast<void>(prevSize);
+        char* data = reinterpret_cast<char*>(array);
+        Implementation::arrayMappedFileReallocate(data, newCapacity*sizeof(T));
+        array = reinterpret_cast<T*>(data);
+    }
+
+    /**
+     * @brief Deallocate an array
+     *
+     * Truncates the file to zero size, unmaps it and closes it. Not used
+     * by the growable array utilities, as those always go through
+     * @ref deleter().
+     */
+    static void deallocate(T* data) {
+        if(data) Implementation::arrayMappedFileDeallocate(reinterpret_cast<char*>(data), 0);
+    }
+
+    /**
+     * @brief Grow the array
+     *
+     * Doubles the capacity or uses @p desired if it's larger.
+     */
+    static std::size_t grow(T* array, std::size_t desired) {
+        const std::size_t current = array ? capacity(array) : 0;
+        return desired > 2*current ? desired : 2*current;
+    }
+
+    /**
+     * @brief Array capacity
+     *
+     * Calculated from the file mapping size stored *before* the front of the
+     * @p array. As the mapping is always whole pages, the capacity is
+     * usually larger than the file size requested when creating the array.
+     */
+    static std::size_t capacity(T* array) {
+        return Implementation::arrayMappedFileCapacity(reinterpret_cast<const char*>(array))/sizeof(T);
+    }
+
+    /**
+     * @brief Array base address
+     *
+     * Returns the start of the header before the file mapping.
+     */
+    static void* base(T* array) {
+        return reinterpret_cast<char*>(array) - Implementation::ArrayMappedFileHeaderSize;
+    }
+
+    /**
+     * @brief Array deleter
+     *
+     * Truncates the file to @p size items, unmaps it and closes it.
+     */
+    static void deleter(T* data, std::size_t size) {
+        if(data) Implementation::arrayMappedFileDeallocate(reinterpret_cast<char*>(data), size*sizeof(T));
+    }
+};
+
+/**
+@brief Map a file as a growable array
+@m_since_latest
+
+Maps an existing file for reading and writing, keeping its contents. The array
+size is the file size divided by @cpp sizeof(T) @ce, grow it with
+@ref ArrayMappedFileAllocator. If the file doesn't exist, its size isn't a
+multiple of @cpp sizeof(T) @ce or an error occurs while mapping,
+@cpp nullptr @ce is returned and a message is printed to
+@ref Utility::Error. Expects that the filename is in UTF-8.
+@partialsupport Available only on Linux and Android.
+@see @ref arrayMapFileWrite(), @ref Utility::Directory::map()
+*/
+template<class T> Array<T> arrayMapFile(StringView filename) {
+    std::size_t size;
+    char* const data = Implementation::arrayMappedFileOpen(filename, sizeof(T), size);
+    if(!data) return nullptr;
+    return Array<T>{reinterpret_cast<T*>(data), size/sizeof(T), ArrayMappedFileAllocator<T>::deleter};
+}
+
+/**
+@brief Map a file for writing as a growable array
+@m_since_latest
+
+Creates a file for @p size items of type @p T and maps it for reading and
+writing. If the file exists, it's truncated --- thus no data is preserved.
+Grow the array with @ref ArrayMappedFileAllocator. If an error occurs,
+@cpp nullptr @ce is returned and a message is printed to @ref Utility::Error.
+Expects that the filename is in UTF-8.
+@partialsupport Available only on Linux and Android.
+@see @ref arrayMapFile(), @ref Utility::Directory::mapWrite()
+*/
+template<class T> Array<T> arrayMapFileWrite(StringView filename, std::size_t size) {
+    char* const data = Implementation::arrayMappedFileCreate(filename, size*sizeof(T));
+    if(!data) return nullptr;
+    return Array<T>{reinterpret_cast<T*>(data), size, ArrayMappedFileAllocator<T>::deleter};
+}
+
+/**
+@brief Flush a memory-mapped file to disk
+@m_since_latest
+
+Calls @cb{.sh} msync() @ce with @cb{.sh} MS_SYNC @ce on pages covering
+@p data, waiting until they're written to the file. Works with arrays created
+with @ref arrayMapFile() and @ref arrayMapFileWrite() as well as with
+@ref Utility::Directory::map() and @ref Utility::Directory::mapWrite(). If
+the flush fails, returns @cpp false @ce and prints a message to
+@ref Utility::Error.
+@partialsupport Available only on Linux and Android.
+*/
+CORRADE_UTILITY_EXPORT bool arrayMapFileFlush(ArrayView<const void> data);
+
+namespace Implementation {
+
+template<class T> struct ArrayShrinkInPlace<ArrayMappedFileAllocator<T>> {
+    static bool shrink(ArrayGuts<T>& guts) {
+        arrayMappedFileShrink(reinterpret_cast<char*>(guts.data), guts.size*sizeof(T));
+        guts.deleter = arrayMappedFileShrunkDeleter<T>;
+        return true;
+    }
+};
+
+template<class T> struct ArrayShrinkInPlace<ArrayMmapAllocator<T>> {
+    static bool shrink(ArrayGuts<T>& guts) {
+        arrayMmapDiscard(reinterpret_cast<char*>(guts.data), guts.size*sizeof(T));
+        guts.deleter = arrayMmapShrunkDeleter<T>;
+        return true;
+    }
+};
+
+template<class T> struct ArrayShrinkInPlace<ArrayMmapHugePageAllocator<T>>: ArrayShrinkInPlace<ArrayMmapAllocator<T>> {};
+
+}
+
+}}
+#endif
+
+#endif
@@ -51,6 +51,20 @@ namespace Implementation {
         return view._size;
     }
     #endif
+
+    /* Used by ArrayView::alignedData() and StridedArrayView::alignedData() */
+    template<std::size_t alignment, class T> inline T* assumeAligned(T* const data) {
+        static_assert(alignment && !(alignment & (alignment - 1)),
+            "alignment expected to be a power of two");
+        #ifdef CORRADE_TARGET_GCC
+        return static_cast<T*>(__builtin_assume_aligned(data, alignment));
+        #elif defined(CORRADE_TARGET_MSVC)
+        __assume(!(reinterpret_cast<std::size_t>(data) & (alignment - 1)));
+        return data;
+        #else
+        return data;
+        #endif
+    }
 }
 
 /**
@@ -287,6 +301,22 @@ template<class T> class ArrayView {
         /** @brief View data */
         constexpr T* data() const { return _data; }
 
+        /**
+         * @brief View data with an alignment hint
+         * @m_since_latest
+         *
+         * Expects that @ref data() is aligned to @p alignment bytes, which has
+         * to be a power of two. The returned pointer is annotated with
+         * @cpp __builtin_assume_aligned() @ce on GCC and Clang or
+         * @cpp __assume() @ce on MSVC, allowing the compiler to use aligned
+         * loads and stores in code operating on it. Only the data pointer is
+         * assumed to be aligned, the view size doesn't need to be a multiple
+         * of the alignment.
+         * @see @ref Array(NoInitT, std::size_t, std::size_t),
+         *      @ref ArrayAlignedAllocator
+         */
+        template<std::size_t alignment> T* alignedData() const;
+
         /** @brief View size */
         constexpr std::size_t size() const { return _size; }
 
@@ -1170,6 +1200,12 @@ template<class U, std::size_t size, class T> StaticArrayView<size*sizeof(T)/size
     return arrayCast<U>(StaticArrayView<size, T>{data});
 }
 
+template<class T> template<std::size_t alignment> T* ArrayView<T>::alignedData() const {
+    CORRADE_ASSERT(!(reinterpret_cast<std::size_t>(_data) & (alignment - 1)),
+        "Containers::ArrayView::alignedData(): expected data to be aligned to" << alignment << "bytes but got" << reinterpret_cast<const void*>(_data), {});
+    return Implementation::assumeAligned<alignment>(_data);
+}
+
 template<class T> T& ArrayView<T>::front() const {
     CORRADE_ASSERT(_size, "Containers::ArrayView::front(): view is empty", _data[0]);
     return _data[0];
@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Class @ref Corrade::Containers::BigEnumSet
+ * @brief Class @ref Corrade::Containers::BigEnumSet, @ref Corrade::Containers::BigEnumSetIterator
  * @m_since_latest
  *
  * @see @ref Corrade/Containers/BigEnumSet.hpp
@@ -35,6 +35,7 @@
 #include <cstdint>
 
 #include "Corrade/Containers/EnumSet.h" /* reusing the macros */
+#include "Corrade/Containers/bitHelpers.h"
 #include "Corrade/Containers/sequenceHelpers.h"
 #include "Corrade/Utility/Assert.h"
 
@@ -46,6 +47,58 @@ namespace Implementation {
     }
 }
 
+/**
+@brief Iterator over values in a big enum set
+@tparam T           Enum type
+@tparam size        How many 64-bit integers are used to store the value
+@m_since_latest
+
+Returned from @ref BigEnumSet::begin() and @ref BigEnumSet::end(). Skips
+zero 64-bit words and picks set bits in the non-zero ones by counting
+trailing zeros, so the cost is proportional to the count of set values and
+not to the count of all possible values.
+*/
+template<class T, std::size_t size> class BigEnumSetIterator {
+    public:
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        explicit BigEnumSetIterator(const std::uint64_t* data, std::size_t word) noexcept: _data{data}, _word{word}, _bits{word < size ? data[word] : 0} {
+            if(_word < size && !_bits) next();
+        }
+        #endif
+
+        /** @brief Current value */
+        T operator*() const {
+            return T(typename std::underlying_type<T>::type(_word*64 + Implementation::bitCountTrailingZeros(_bits)));
+        }
+
+        /** @brief Move to the next value */
+        BigEnumSetIterator<T, size>& operator++() {
+            /* Clear the lowest set bit */
+            _bits &= _bits - 1;
+            if(!_bits) next();
+            return *this;
+        }
+
+        /** @brief Equality comparison */
+        bool operator==(const BigEnumSetIterator<T, size>& other) const {
+            return _word == other._word && _bits == other._bits;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const BigEnumSetIterator<T, size>& other) const {
+            return !operator==(other);
+        }
+
+    private:
+        void next() {
+            while(!_bits && ++_word < size) _bits = _data[_word];
+        }
+
+        const std::uint64_t* _data;
+        std::size_t _word;
+        std::uint64_t _bits;
+};
+
 /**
 @brief Set of more than 64 enum values
 @tparam T           Enum type
@@ -138,6 +191,26 @@ class BigEnumSet {
          */
         constexpr const std::uint64_t* data() const { return +_data; }
 
+        /**
+         * @brief Iterator to the first value in the set
+         * @m_since_latest
+         *
+         * Together with @ref end() allows iterating over values in the set in
+         * a range-for loop, from the smallest to the largest. See
+         * @ref BigEnumSetIterator for details.
+         */
+        BigEnumSetIterator<T, size> begin() const {
+            return BigEnumSetIterator<T, size>{_data, 0};
+        }
+
+        /**
+         * @brief Iterator to (one item after) the last value in the set
+         * @m_since_latest
+         */
+        BigEnumSetIterator<T, size> end() const {
+            return BigEnumSetIterator<T, size>{_data, size};
+        }
+
         /**
          * @brief Whether @p other is a subset of this (@f$ a \supseteq o @f$)
          *
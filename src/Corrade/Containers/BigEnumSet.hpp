@@ -55,25 +55,18 @@ The output is then as follows:
 
 @snippet Containers.cpp bigEnumSetDebugOutput-usage
 */
-/* The set has to be taken by value because it gets modified in the process */
 template<class T, std::size_t size> Utility::Debug& bigEnumSetDebugOutput(Utility::Debug& debug, BigEnumSet<T, size> value, const char* empty) {
     /* Print the empty value in case there is nothing */
     if(!value) return debug << empty;
 
-    /* Go through all bits in the range and print each of them, if set. This
-       will mean known and unknown values will be interleaved, but better than
-       forcing users to supply a list of 100+ values like with EnumSet. */
+    /* Go through all set bits and print each of them. This will mean known
+       and unknown values will be interleaved, but better than forcing users
+       to supply a list of 100+ values like with EnumSet. */
     bool separate = false;
-    for(std::size_t i = 0; value && i != size*64; ++i) {
-        if(!(value & T(i))) continue;
-
+    for(const T i: value) {
         if(separate) debug << Utility::Debug::nospace << "|" << Utility::Debug::nospace;
         else separate = true;
-        debug << T(i);
-
-        /* Clear the value from the enum so we can do an early exit if there's
-           no more bits set */
-        value &= ~T(i);
+        debug << i;
     }
 
     return debug;
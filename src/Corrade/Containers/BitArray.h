@@ -0,0 +1,188 @@
+#ifndef Corrade_Containers_BitArray_h
+#define Corrade_Containers_BitArray_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::BitArray
+ * @m_since_latest
+ */
+
+#include <cstdint>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/BitArrayView.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief Bit array
+@m_since_latest
+
+Owning counterpart to @ref BitArrayView, storing one bit per value with the
+same layout. The memory is allocated in 64-bit words, which means it's
+always aligned for the fast paths in @ref BitArrayView::count(), @ref bitArrayAnd() and other bulk
+operations. The class is implicitly convertible to a @ref BitArrayView and a
+@ref MutableBitArrayView, operations not provided directly on the array are
+available through those:
+
+@snippet Containers.cpp BitArray-usage
+*/
+class BitArray {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty array. Doesn't allocate.
+         */
+        /*implicit*/ BitArray() noexcept: _size{} {}
+
+        /**
+         * @brief Construct a zero-initialized array
+         * @param size      Size in bits
+         */
+        explicit BitArray(ValueInitT, std::size_t size): _data{ValueInit, wordCount(size)}, _size{size} {}
+
+        /**
+         * @brief Construct an array without initializing its contents
+         * @param size      Size in bits
+         */
+        explicit BitArray(NoInitT, std::size_t size): _data{NoInit, wordCount(size)}, _size{size} {}
+
+        /**
+         * @brief Construct an array with all bits set to given value
+         * @param size      Size in bits
+         * @param value     Bit value
+         */
+        explicit BitArray(DirectInitT, std::size_t size, bool value): _data{DirectInit, wordCount(size), value ? ~std::uint64_t{} : std::uint64_t{}}, _size{size} {}
+
+        /**
+         * @brief Construct a zero-initialized array
+         *
+         * Alias to @ref BitArray(ValueInitT, std::size_t).
+         */
+        explicit BitArray(std::size_t size): BitArray{ValueInit, size} {}
+
+        /** @brief Copying is not allowed */
+        BitArray(const BitArray&) = delete;
+
+        /** @brief Move constructor */
+        BitArray(BitArray&& other) noexcept: _data{std::move(other._data)}, _size{other._size} {
+            other._size = 0;
+        }
+
+        /** @brief Copying is not allowed */
+        BitArray& operator=(const BitArray&) = delete;
+
+        /** @brief Move assignment */
+        BitArray& operator=(BitArray&& other) noexcept {
+            using std::swap;
+            swap(_data, other._data);
+            swap(_size, other._size);
+            return *this;
+        }
+
+        /** @brief Convert to a @ref BitArrayView */
+        /*implicit*/ operator BitArrayView() const {
+            return {reinterpret_cast<const char*>(_data.data()), 0, _size};
+        }
+
+        /** @brief Convert to a @ref MutableBitArrayView */
+        /*implicit*/ operator MutableBitArrayView() {
+            return {reinterpret_cast<char*>(_data.data()), 0, _size};
+        }
+
+        /** @brief Data */
+        char* data() { return reinterpret_cast<char*>(_data.data()); }
+        const char* data() const { return reinterpret_cast<const char*>(_data.data()); } /**< @overload */
+
+        /** @brief Size in bits */
+        std::size_t size() const { return _size; }
+
+        /** @brief Whether the array is empty */
+        bool isEmpty() const { return !_size; }
+
+        /**
+         * @brief Bit at given position
+         *
+         * No bounds checking is done.
+         */
+        bool operator[](std::size_t i) const {
+            return BitArrayView{*this}[i];
+        }
+
+        /**
+         * @brief Set a bit at given position
+         *
+         * No bounds checking is done.
+         */
+        void set(std::size_t i) {
+            MutableBitArrayView{*this}.set(i);
+        }
+
+        /**
+         * @brief Reset a bit at given position
+         *
+         * No bounds checking is done.
+         */
+        void reset(std::size_t i) {
+            MutableBitArrayView{*this}.reset(i);
+        }
+
+        /**
+         * @brief Set or reset a bit at given position
+         *
+         * No bounds checking is done.
+         */
+        void set(std::size_t i, bool value) {
+            MutableBitArrayView{*this}.set(i, value);
+        }
+
+        /** @brief Set all bits */
+        void setAll() { MutableBitArrayView{*this}.setAll(); }
+
+        /** @brief Reset all bits */
+        void resetAll() { MutableBitArrayView{*this}.resetAll(); }
+
+        /** @brief Count of set bits */
+        std::size_t count() const { return BitArrayView{*this}.count(); }
+
+        /**
+         * @brief Indices of set bits
+         *
+         * See @ref BasicBitArrayView::setBitIndices() for more information.
+         */
+        BitIndices setBitIndices() const { return BitArrayView{*this}.setBitIndices(); }
+
+    private:
+        static std::size_t wordCount(std::size_t size) { return (size + 63) >> 6; }
+
+        Array<std::uint64_t> _data;
+        std::size_t _size;
+};
+
+}}
+
+#endif
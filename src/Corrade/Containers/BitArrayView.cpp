@@ -0,0 +1,482 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BitArrayView.h"
+
+#include <cstring>
+
+#include "Corrade/Containers/Implementation/bitArrayView.h"
+#include "Corrade/Utility/Cpu.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef CORRADE_ENABLE_POPCNT
+#include <nmmintrin.h>
+#endif
+#ifdef CORRADE_ENABLE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace Corrade { namespace Containers {
+
+namespace {
+
+/* Operations applied by bitArrayAnd() and friends, with overloads for each
+   SIMD width so the kernels below can be shared by all of them */
+struct BitAnd {
+    std::uint64_t operator()(const std::uint64_t a, const std::uint64_t b) const {
+        return a & b;
+    }
+    #ifdef CORRADE_ENABLE_SSE2
+    CORRADE_ENABLE_SSE2 __m128i operator()(const __m128i a, const __m128i b) const {
+        return _mm_and_si128(a, b);
+    }
+    #endif
+    #ifdef CORRADE_ENABLE_AVX2
+    CORRADE_ENABLE_AVX2 __m256i operator()(const __m256i a, const __m256i b) const {
+        return _mm256_and_si256(a, b);
+    }
+    #endif
+};
+
+struct BitOr {
+    std::uint64_t operator()(const std::uint64_t a, const std::uint64_t b) const {
+        return a | b;
+    }
+    #ifdef CORRADE_ENABLE_SSE2
+    CORRADE_ENABLE_SSE2 __m128i operator()(const __m128i a, const __m128i b) const {
+        return _mm_or_si128(a, b);
+    }
+    #endif
+    #ifdef CORRADE_ENABLE_AVX2
+    CORRADE_ENABLE_AVX2 __m256i operator()(const __m256i a, const __m256i b) const {
+        return _mm256_or_si256(a, b);
+    }
+    #endif
+};
+
+struct BitXor {
+    std::uint64_t operator()(const std::uint64_t a, const std::uint64_t b) const {
+        return a ^ b;
+    }
+    #ifdef CORRADE_ENABLE_SSE2
+    CORRADE_ENABLE_SSE2 __m128i operator()(const __m128i a, const __m128i b) const {
+        return _mm_xor_si128(a, b);
+    }
+    #endif
+    #ifdef CORRADE_ENABLE_AVX2
+    CORRADE_ENABLE_AVX2 __m256i operator()(const __m256i a, const __m256i b) const {
+        return _mm256_xor_si256(a, b);
+    }
+    #endif
+};
+
+/* The andnot instructions negate the first operand, not the second */
+struct BitAndNot {
+    std::uint64_t operator()(const std::uint64_t a, const std::uint64_t b) const {
+        return a & ~b;
+    }
+    #ifdef CORRADE_ENABLE_SSE2
+    CORRADE_ENABLE_SSE2 __m128i operator()(const __m128i a, const __m128i b) const {
+        return _mm_andnot_si128(b, a);
+    }
+    #endif
+    #ifdef CORRADE_ENABLE_AVX2
+    CORRADE_ENABLE_AVX2 __m256i operator()(const __m256i a, const __m256i b) const {
+        return _mm256_andnot_si256(b, a);
+    }
+    #endif
+};
+
+/* Scalar variant of the word kernels, also used for the remainder that
+   didn't fit into a full SIMD block. The operations are bitwise, so no need
+   to care about endianness. Each block is loaded before it's stored, so the
+   output can be the same memory as one of the inputs. */
+template<class Op> void bitArrayOperationScalar(const char* const a, const char* const b, char* const out, const std::size_t wordCount) {
+    for(std::size_t i = 0; i != wordCount; ++i) {
+        std::uint64_t aWord, bWord;
+        std::memcpy(&aWord, a + i*8, 8);
+        std::memcpy(&bWord, b + i*8, 8);
+        const std::uint64_t outWord = Op{}(aWord, bWord);
+        std::memcpy(out + i*8, &outWord, 8);
+    }
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+template<class Op> CORRADE_ENABLE_SSE2 void bitArrayOperationSse2(const char* const a, const char* const b, char* const out, const std::size_t wordCount) {
+    /* Indexing instead of advancing three pointers keeps the loop as tight
+       as what the compiler would autovectorize the scalar variant to */
+    const std::size_t vectorCount = wordCount/2;
+    for(std::size_t i = 0; i != vectorCount; ++i)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i*16), Op{}(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i*16)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i*16))));
+    bitArrayOperationScalar<Op>(a + vectorCount*16, b + vectorCount*16, out + vectorCount*16, wordCount - vectorCount*2);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+template<class Op> CORRADE_ENABLE_AVX2 void bitArrayOperationAvx2(const char* const a, const char* const b, char* const out, const std::size_t wordCount) {
+    const std::size_t vectorCount = wordCount/4;
+    for(std::size_t i = 0; i != vectorCount; ++i)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i*32), Op{}(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i*32)),
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i*32))));
+    bitArrayOperationScalar<Op>(a + vectorCount*32, b + vectorCount*32, out + vectorCount*32, wordCount - vectorCount*4);
+}
+#endif
+
+/* The population count doesn't depend on the byte order, so no need to care
+   about endianness in any of these */
+std::size_t bitArrayCountScalar(const char* const data, const std::size_t wordCount) {
+    std::size_t out = 0;
+    for(std::size_t i = 0; i != wordCount; ++i) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i*8, 8);
+        out += Implementation::bitCount(word);
+    }
+    return out;
+}
+
+#ifdef CORRADE_ENABLE_POPCNT
+CORRADE_ENABLE_POPCNT inline std::size_t bitCountPopcnt(const std::uint64_t value) {
+    #ifdef CORRADE_TARGET_GCC
+    return __builtin_popcountll(value);
+    #elif defined(_M_X64)
+    return __popcnt64(value);
+    #else
+    /* __popcnt64() isn't available on 32-bit targets */
+    return __popcnt(std::uint32_t(value)) + __popcnt(std::uint32_t(value >> 32));
+    #endif
+}
+
+CORRADE_ENABLE_POPCNT std::size_t bitArrayCountPopcnt(const char* const data, const std::size_t wordCount) {
+    std::size_t out = 0;
+    for(std::size_t i = 0; i != wordCount; ++i) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i*8, 8);
+        out += bitCountPopcnt(word);
+    }
+    return out;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_POPCNT)
+/* Counts bits in each nibble using a 16-entry lookup table in a byte
+   shuffle, sums the per-byte counts into 64-bit lanes using SAD against
+   zero and adds those together at the end. The remainder that doesn't fit
+   into a 32-byte block goes through POPCNT, which all CPUs with AVX2 have. */
+CORRADE_ENABLE_AVX2 CORRADE_ENABLE_POPCNT std::size_t bitArrayCountAvx2(const char* data, const std::size_t wordCount) {
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibble = _mm256_set1_epi8(0x0f);
+    const __m256i zero = _mm256_setzero_si256();
+
+    const char* const end = data + wordCount*8;
+    __m256i sum = zero;
+    for(; end - data >= 32; data += 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        const __m256i counts = _mm256_add_epi8(
+            _mm256_shuffle_epi8(lookup, _mm256_and_si256(block, lowNibble)),
+            _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(block, 4), lowNibble)));
+        sum = _mm256_add_epi64(sum, _mm256_sad_epu8(counts, zero));
+    }
+
+    std::uint64_t sums[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(sums), sum);
+    return sums[0] + sums[1] + sums[2] + sums[3] +
+        bitArrayCountPopcnt(data, (end - data)/8);
+}
+#endif
+
+/* POPCNT is an extension on top of the regular instruction sets, so it can't
+   be picked by CORRADE_CPU_DISPATCHER() and the dispatcher is written by
+   hand. It's used for picking the variant for a build without runtime
+   dispatch as well, with just the compile-time features. */
+Implementation::BitArrayCountFunction bitArrayCountDispatcher(const Utility::Cpu::Features features) {
+    #if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_POPCNT)
+    if(features >= (Utility::Cpu::Feature::Avx2|Utility::Cpu::Feature::Popcnt))
+        return bitArrayCountAvx2;
+    #endif
+    #ifdef CORRADE_ENABLE_POPCNT
+    if(features & Utility::Cpu::Feature::Popcnt)
+        return bitArrayCountPopcnt;
+    #else
+    static_cast<void>(features);
+    #endif
+    return bitArrayCountScalar;
+}
+
+}
+
+namespace Implementation {
+
+BitArrayCountFunction bitArrayCountImplementation(const Utility::Cpu::Features features) {
+    return bitArrayCountDispatcher(features);
+}
+
+BitArrayOperationFunction bitArrayAndImplementation(Utility::Cpu::ScalarT) {
+    return bitArrayOperationScalar<BitAnd>;
+}
+
+BitArrayOperationFunction bitArrayOrImplementation(Utility::Cpu::ScalarT) {
+    return bitArrayOperationScalar<BitOr>;
+}
+
+BitArrayOperationFunction bitArrayXorImplementation(Utility::Cpu::ScalarT) {
+    return bitArrayOperationScalar<BitXor>;
+}
+
+BitArrayOperationFunction bitArrayAndNotImplementation(Utility::Cpu::ScalarT) {
+    return bitArrayOperationScalar<BitAndNot>;
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+BitArrayOperationFunction bitArrayAndImplementation(Utility::Cpu::Sse2T) {
+    return bitArrayOperationSse2<BitAnd>;
+}
+
+BitArrayOperationFunction bitArrayOrImplementation(Utility::Cpu::Sse2T) {
+    return bitArrayOperationSse2<BitOr>;
+}
+
+BitArrayOperationFunction bitArrayXorImplementation(Utility::Cpu::Sse2T) {
+    return bitArrayOperationSse2<BitXor>;
+}
+
+BitArrayOperationFunction bitArrayAndNotImplementation(Utility::Cpu::Sse2T) {
+    return bitArrayOperationSse2<BitAndNot>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+BitArrayOperationFunction bitArrayAndImplementation(Utility::Cpu::Avx2T) {
+    return bitArrayOperationAvx2<BitAnd>;
+}
+
+BitArrayOperationFunction bitArrayOrImplementation(Utility::Cpu::Avx2T) {
+    return bitArrayOperationAvx2<BitOr>;
+}
+
+BitArrayOperationFunction bitArrayXorImplementation(Utility::Cpu::Avx2T) {
+    return bitArrayOperationAvx2<BitXor>;
+}
+
+BitArrayOperationFunction bitArrayAndNotImplementation(Utility::Cpu::Avx2T) {
+    return bitArrayOperationAvx2<BitAndNot>;
+}
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+CORRADE_CPU_DISPATCHER(bitArrayAndDispatcher, Containers::Implementation::bitArrayAndImplementation)
+CORRADE_CPU_DISPATCHER(bitArrayOrDispatcher, Containers::Implementation::bitArrayOrImplementation)
+CORRADE_CPU_DISPATCHER(bitArrayXorDispatcher, Containers::Implementation::bitArrayXorImplementation)
+CORRADE_CPU_DISPATCHER(bitArrayAndNotDispatcher, Containers::Implementation::bitArrayAndNotImplementation)
+#ifdef CORRADE_CPU_USE_IFUNC
+CORRADE_CPU_DISPATCHED_IFUNC(bitArrayCountDispatcher, std::size_t bitArrayCountWords(const char*, std::size_t))
+CORRADE_CPU_DISPATCHED_IFUNC(bitArrayAndDispatcher, void bitArrayAndWords(const char*, const char*, char*, std::size_t))
+CORRADE_CPU_DISPATCHED_IFUNC(bitArrayOrDispatcher, void bitArrayOrWords(const char*, const char*, char*, std::size_t))
+CORRADE_CPU_DISPATCHED_IFUNC(bitArrayXorDispatcher, void bitArrayXorWords(const char*, const char*, char*, std::size_t))
+CORRADE_CPU_DISPATCHED_IFUNC(bitArrayAndNotDispatcher, void bitArrayAndNotWords(const char*, const char*, char*, std::size_t))
+#else
+CORRADE_CPU_DISPATCHED_POINTER(bitArrayCountDispatcher, Implementation::BitArrayCountFunction bitArrayCountWords)
+CORRADE_CPU_DISPATCHED_POINTER(bitArrayAndDispatcher, Implementation::BitArrayOperationFunction bitArrayAndWords)
+CORRADE_CPU_DISPATCHED_POINTER(bitArrayOrDispatcher, Implementation::BitArrayOperationFunction bitArrayOrWords)
+CORRADE_CPU_DISPATCHED_POINTER(bitArrayXorDispatcher, Implementation::BitArrayOperationFunction bitArrayXorWords)
+CORRADE_CPU_DISPATCHED_POINTER(bitArrayAndNotDispatcher, Implementation::BitArrayOperationFunction bitArrayAndNotWords)
+#endif
+#else
+/* Picking the best variant enabled at compile time */
+std::size_t bitArrayCountWords(const char* const data, const std::size_t wordCount) {
+    return bitArrayCountDispatcher(Utility::Cpu::compiledFeatures)(data, wordCount);
+}
+void bitArrayAndWords(const char* const a, const char* const b, char* const out, const std::size_t wordCount) {
+    Implementation::bitArrayAndImplementation(Utility::Cpu::DefaultBase)(a, b, out, wordCount);
+}
+void bitArrayOrWords(const char* const a, const char* const b, char* const out, const std::size_t wordCount) {
+    Implementation::bitArrayOrImplementation(Utility::Cpu::DefaultBase)(a, b, out, wordCount);
+}
+void bitArrayXorWords(const char* const a, const char* const b, char* const out, const std::size_t wordCount) {
+    Implementation::bitArrayXorImplementation(Utility::Cpu::DefaultBase)(a, b, out, wordCount);
+}
+void bitArrayAndNotWords(const char* const a, const char* const b, char* const out, const std::size_t wordCount) {
+    Implementation::bitArrayAndNotImplementation(Utility::Cpu::DefaultBase)(a, b, out, wordCount);
+}
+#endif
+
+/* Stores `count` bits (1 to 64) of `value` starting at bit `bit` of `data`,
+   keeping the surrounding bits untouched. Counterpart to bitLoad(). */
+void bitStore(char* const data, const std::size_t bit, const std::size_t count, const std::uint64_t value) {
+    unsigned char* const bytes = reinterpret_cast<unsigned char*>(data) + (bit >> 3);
+    const std::size_t shift = bit & 7;
+    const std::uint64_t mask = count == 64 ? ~std::uint64_t{} : (std::uint64_t{1} << count) - 1;
+
+    #ifndef CORRADE_TARGET_BIG_ENDIAN
+    if(!shift && count == 64) {
+        std::memcpy(bytes, &value, 8);
+        return;
+    }
+    #endif
+
+    const std::size_t byteCount = (shift + count + 7) >> 3;
+    for(std::size_t i = 0; i != byteCount; ++i) {
+        unsigned char byteMask, byteValue;
+        if(i == 0) {
+            byteMask = (mask << shift) & 0xff;
+            byteValue = (value << shift) & 0xff;
+        } else {
+            const std::size_t valueShift = i*8 - shift;
+            byteMask = (mask >> valueShift) & 0xff;
+            byteValue = (value >> valueShift) & 0xff;
+        }
+        bytes[i] = (bytes[i] & ~byteMask) | (byteValue & byteMask);
+    }
+}
+
+/* Applies `Op` to all bits of the views. If all views start at the same
+   bit offset, whole words starting at the first byte boundary are processed
+   with the dispatched `words` kernel. The rest goes through bitLoad() and
+   bitStore(), shifting the bits into place. */
+template<class Op> void bitArrayOperation(const BitArrayView a, const BitArrayView b, const MutableBitArrayView out, void(*const words)(const char*, const char*, char*, std::size_t)) {
+    const Op op{};
+    const std::size_t size = out.size();
+    std::size_t i = 0;
+
+    if(a.offset() == out.offset() && b.offset() == out.offset()) {
+        /* Bits up to the first byte boundary */
+        const std::size_t head = (8 - out.offset()) & 7;
+        if(head && size) {
+            const std::size_t count = head < size ? head : size;
+            bitStore(out.data(), out.offset(), count, op(
+                Implementation::bitLoad(a.data(), a.offset(), count),
+                Implementation::bitLoad(b.data(), b.offset(), count)));
+            i = count;
+        }
+
+        /* Whole 64-bit words */
+        if(i < size) {
+            const std::size_t byte = (out.offset() + i) >> 3;
+            const std::size_t wordCount = (size - i)/64;
+            words(a.data() + byte, b.data() + byte, out.data() + byte, wordCount);
+            i += wordCount*64;
+        }
+    }
+
+    /* Remaining bits, or all bits if the offsets differ */
+    for(; i < size; i += 64) {
+        const std::size_t count = size - i < 64 ? size - i : 64;
+        bitStore(out.data(), out.offset() + i, count, op(
+            Implementation::bitLoad(a.data(), a.offset() + i, count),
+            Implementation::bitLoad(b.data(), b.offset() + i, count)));
+    }
+}
+
+}
+
+namespace Implementation {
+
+std::size_t bitArrayCount(const char* const data, const std::size_t offset, const std::size_t size) {
+    std::size_t out = 0;
+    std::size_t i = 0;
+
+    /* Bits up to the first byte boundary */
+    const std::size_t head = (8 - offset) & 7;
+    if(head && size) {
+        const std::size_t count = head < size ? head : size;
+        out += bitCount(bitLoad(data, offset, count));
+        i = count;
+    }
+
+    /* Whole 64-bit words */
+    if(i < size) {
+        const std::size_t wordCount = (size - i)/64;
+        out += bitArrayCountWords(data + ((offset + i) >> 3), wordCount);
+        i += wordCount*64;
+    }
+
+    /* Remaining bits */
+    if(i < size)
+        out += bitCount(bitLoad(data, offset + i, size - i));
+
+    return out;
+}
+
+void bitArrayFill(char* const data, const std::size_t offset, const std::size_t size, const bool value) {
+    const std::uint64_t word = value ? ~std::uint64_t{} : 0;
+
+    /* Bits up to the first byte boundary */
+    const std::size_t head = (8 - offset) & 7;
+    std::size_t i = 0;
+    if(head && size) {
+        const std::size_t count = head < size ? head : size;
+        bitStore(data, offset, count, word);
+        i = count;
+    }
+
+    /* Whole bytes */
+    if(i < size) {
+        const std::size_t byteCount = (size - i) >> 3;
+        std::memset(data + ((offset + i) >> 3), value ? 0xff : 0, byteCount);
+        i += byteCount*8;
+    }
+
+    /* Remaining bits */
+    if(i < size)
+        bitStore(data, offset + i, size - i, word);
+}
+
+}
+
+void bitArrayAnd(const BitArrayView a, const BitArrayView b, const MutableBitArrayView out) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Containers::bitArrayAnd(): expected views of the same size but got" << a.size() << Utility::Debug::nospace << "," << b.size() << "and" << out.size(), );
+    bitArrayOperation<BitAnd>(a, b, out, bitArrayAndWords);
+}
+
+void bitArrayOr(const BitArrayView a, const BitArrayView b, const MutableBitArrayView out) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Containers::bitArrayOr(): expected views of the same size but got" << a.size() << Utility::Debug::nospace << "," << b.size() << "and" << out.size(), );
+    bitArrayOperation<BitOr>(a, b, out, bitArrayOrWords);
+}
+
+void bitArrayXor(const BitArrayView a, const BitArrayView b, const MutableBitArrayView out) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Containers::bitArrayXor(): expected views of the same size but got" << a.size() << Utility::Debug::nospace << "," << b.size() << "and" << out.size(), );
+    bitArrayOperation<BitXor>(a, b, out, bitArrayXorWords);
+}
+
+void bitArrayAndNot(const BitArrayView a, const BitArrayView b, const MutableBitArrayView out) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Containers::bitArrayAndNot(): expected views of the same size but got" << a.size() << Utility::Debug::nospace << "," << b.size() << "and" << out.size(), );
+    bitArrayOperation<BitAndNot>(a, b, out, bitArrayAndNotWords);
+}
+
+}}
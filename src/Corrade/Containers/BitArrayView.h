@@ -0,0 +1,412 @@
+#ifndef Corrade_Containers_BitArrayView_h
+#define Corrade_Containers_BitArrayView_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::BasicBitArrayView, @ref Corrade::Containers::BitIndices, @ref Corrade::Containers::BitIndexIterator, typedef @ref Corrade::Containers::BitArrayView, @ref Corrade::Containers::MutableBitArrayView, function @ref Corrade::Containers::bitArrayAnd(), @ref Corrade::Containers::bitArrayOr(), @ref Corrade::Containers::bitArrayXor(), @ref Corrade::Containers::bitArrayAndNot()
+ * @m_since_latest
+ */
+
+#include <type_traits>
+
+#include "Corrade/Containers/Containers.h"
+#include "Corrade/Containers/bitHelpers.h"
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    CORRADE_UTILITY_EXPORT std::size_t bitArrayCount(const char* data, std::size_t offset, std::size_t size);
+    CORRADE_UTILITY_EXPORT void bitArrayFill(char* data, std::size_t offset, std::size_t size, bool value);
+}
+
+/**
+@brief Bit array view
+@tparam T   @cpp char @ce or @cpp const char @ce
+@m_since_latest
+
+A non-owning view on a contiguous range of bits. Bit @f$ i @f$ of the view is
+stored in byte @f$ \lfloor (o + i) / 8 \rfloor @f$ of @ref data() at position
+@f$ (o + i) \bmod 8 @f$, counting from the least significant bit, where
+@f$ o @f$ is @ref offset(). The offset makes it possible to @ref slice() the
+view at any bit position, not just at byte boundaries.
+
+Compared to a @cpp bool @ce array the storage is eight times smaller, which
+makes a difference for example with visibility masks over millions of
+entries. Operations that touch more than a single bit --- @ref count(),
+@ref setAll(), @ref resetAll(), @ref setBitIndices() and the
+@ref bitArrayAnd() "bitArrayAnd()" family of functions --- process the data
+64 bits at a time. If all views involved start at the same @ref offset(), the
+bulk of the data in @ref count() and @ref bitArrayAnd() "bitArrayAnd()" and
+friends is processed using POPCNT, SSE2 or AVX2 if available. With
+@ref CORRADE_BUILD_CPU_RUNTIME_DISPATCH enabled the implementation is picked
+at runtime based on @ref Utility::Cpu::runtimeFeatures(). Otherwise the bits
+are shifted into place first.
+
+The view is usually created from an owning @ref BitArray, but it can be
+created on any memory as well:
+
+@snippet Containers.cpp BitArrayView-usage
+
+@see @ref BitArrayView, @ref MutableBitArrayView,
+    @ref BasicStridedBitArrayView
+*/
+template<class T> class BasicBitArrayView {
+    static_assert(std::is_same<typename std::remove_const<T>::type, char>::value,
+        "only char and const char is supported");
+
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty @cpp nullptr @ce view.
+         */
+        constexpr /*implicit*/ BasicBitArrayView(std::nullptr_t = nullptr) noexcept: _data{}, _offset{}, _size{} {}
+
+        /**
+         * @brief Construct a view on given memory
+         * @param data      Data pointer
+         * @param offset    Offset of the first bit in the first byte of
+         *      @p data. Expected to be less than 8.
+         * @param size      Size in bits
+         */
+        /*implicit*/ BasicBitArrayView(T* data, std::size_t offset, std::size_t size) noexcept: _data{data}, _offset{offset}, _size{size} {
+            CORRADE_ASSERT(offset < 8,
+                "Containers::BitArrayView: offset expected to be smaller than 8 bits, got" << offset, );
+        }
+
+        /** @brief Construct a @ref BitArrayView from a @ref MutableBitArrayView */
+        template<class U, class = typename std::enable_if<std::is_same<const U, T>::value>::type> constexpr /*implicit*/ BasicBitArrayView(BasicBitArrayView<U> mutable_) noexcept: _data{mutable_._data}, _offset{mutable_._offset}, _size{mutable_._size} {}
+
+        /** @brief Data pointer */
+        constexpr T* data() const { return _data; }
+
+        /** @brief Bit offset in the first byte of @ref data() */
+        constexpr std::size_t offset() const { return _offset; }
+
+        /** @brief Size in bits */
+        constexpr std::size_t size() const { return _size; }
+
+        /** @brief Whether the view is empty */
+        constexpr bool isEmpty() const { return !_size; }
+
+        /**
+         * @brief Bit at given position
+         *
+         * No bounds checking is done.
+         */
+        bool operator[](std::size_t i) const {
+            i += _offset;
+            return _data[i >> 3] & (1 << (i & 7));
+        }
+
+        /**
+         * @brief Set a bit at given position
+         *
+         * Enabled only on a @ref MutableBitArrayView. No bounds checking is
+         * done.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void set(std::size_t i) const {
+            i += _offset;
+            _data[i >> 3] |= char(1 << (i & 7));
+        }
+
+        /**
+         * @brief Reset a bit at given position
+         *
+         * Enabled only on a @ref MutableBitArrayView. No bounds checking is
+         * done.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void reset(std::size_t i) const {
+            i += _offset;
+            _data[i >> 3] &= char(~(1 << (i & 7)));
+        }
+
+        /**
+         * @brief Set or reset a bit at given position
+         *
+         * Enabled only on a @ref MutableBitArrayView. No bounds checking is
+         * done.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void set(std::size_t i, bool value) const {
+            i += _offset;
+            /* Branchless, clearing the bit and then or-ing the new value */
+            _data[i >> 3] = (_data[i >> 3] & char(~(1 << (i & 7)))) | char(int(value) << (i & 7));
+        }
+
+        /**
+         * @brief Set all bits
+         *
+         * Enabled only on a @ref MutableBitArrayView. Bits outside of the
+         * view are left untouched, which means a slice can be used to set
+         * a range of bits.
+         * @see @ref slice()
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void setAll() const {
+            Implementation::bitArrayFill(_data, _offset, _size, true);
+        }
+
+        /**
+         * @brief Reset all bits
+         *
+         * Enabled only on a @ref MutableBitArrayView. Bits outside of the
+         * view are left untouched, which means a slice can be used to reset
+         * a range of bits.
+         * @see @ref slice()
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void resetAll() const {
+            Implementation::bitArrayFill(_data, _offset, _size, false);
+        }
+
+        /**
+         * @brief Count of set bits
+         *
+         * Processes 64 bits at a time using the POPCNT instruction, or
+         * 256 bits at a time using an AVX2 byte shuffle, if available. See
+         * the @ref BitArrayView "class documentation" for details.
+         */
+        std::size_t count() const {
+            return Implementation::bitArrayCount(_data, _offset, _size);
+        }
+
+        /**
+         * @brief Indices of set bits
+         *
+         * Returns a range that finds the set bits 64 bits at a time and then
+         * picks them one by one by counting trailing zeros, which makes the
+         * iteration fast for both sparse and dense bit arrays:
+         *
+         * @snippet Containers.cpp BitArrayView-setBitIndices
+         */
+        BitIndices setBitIndices() const;
+
+        /**
+         * @brief Slice the view
+         *
+         * Expects that @p begin is not larger than @p end and @p end is not
+         * larger than @ref size().
+         */
+        BasicBitArrayView<T> slice(std::size_t begin, std::size_t end) const;
+
+        /**
+         * @brief View prefix
+         *
+         * Equivalent to @cpp view.slice(0, end) @ce.
+         */
+        BasicBitArrayView<T> prefix(std::size_t end) const {
+            return slice(0, end);
+        }
+
+        /**
+         * @brief View suffix
+         *
+         * Equivalent to @cpp view.slice(begin, view.size()) @ce.
+         */
+        BasicBitArrayView<T> suffix(std::size_t begin) const {
+            return slice(begin, _size);
+        }
+
+        /**
+         * @brief View prefix except the last @p count bits
+         *
+         * Equivalent to @cpp view.slice(0, view.size() - count) @ce.
+         */
+        BasicBitArrayView<T> except(std::size_t count) const {
+            return slice(0, _size - count);
+        }
+
+    private:
+        template<class> friend class BasicBitArrayView;
+
+        T* _data;
+        std::size_t _offset;
+        std::size_t _size;
+};
+
+/**
+@brief Const bit array view
+@m_since_latest
+*/
+typedef BasicBitArrayView<const char> BitArrayView;
+
+/**
+@brief Mutable bit array view
+@m_since_latest
+*/
+typedef BasicBitArrayView<char> MutableBitArrayView;
+
+/**
+@brief Iterator over indices of set bits
+@m_since_latest
+
+Returned from @ref BitIndices::begin() and @ref BitIndices::end(). Keeps the
+currently processed 64 bits and walks through them using a count trailing
+zeros instruction, loading next 64 bits only once all bits in the current ones
+are visited.
+*/
+class BitIndexIterator {
+    public:
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        explicit BitIndexIterator(const char* data, std::size_t offset, std::size_t size, std::size_t base) noexcept: _data{data}, _offset{offset}, _size{size}, _base{base}, _bits{} {
+            if(_base < _size) {
+                _bits = load();
+                if(!_bits) next();
+            }
+        }
+        #endif
+
+        /** @brief Index of the current set bit */
+        std::size_t operator*() const {
+            return _base + Implementation::bitCountTrailingZeros(_bits);
+        }
+
+        /** @brief Move to the next set bit */
+        BitIndexIterator& operator++() {
+            /* Clear the lowest set bit */
+            _bits &= _bits - 1;
+            if(!_bits) next();
+            return *this;
+        }
+
+        /** @brief Equality comparison */
+        bool operator==(const BitIndexIterator& other) const {
+            return _base == other._base && _bits == other._bits;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const BitIndexIterator& other) const {
+            return !operator==(other);
+        }
+
+    private:
+        std::uint64_t load() const {
+            const std::size_t count = _size - _base;
+            return Implementation::bitLoad(_data, _offset + _base, count < 64 ? count : 64);
+        }
+
+        void next() {
+            do {
+                _base += 64;
+                if(_base >= _size) {
+                    _base = _size;
+                    return;
+                }
+                _bits = load();
+            } while(!_bits);
+        }
+
+        const char* _data;
+        std::size_t _offset, _size, _base;
+        std::uint64_t _bits;
+};
+
+/**
+@brief Range of indices of set bits
+@m_since_latest
+
+Returned from @ref BasicBitArrayView::setBitIndices(), meant to be used in a
+range-for loop. The indices are produced lazily, no memory is allocated.
+*/
+class BitIndices {
+    public:
+        /** @brief Constructor */
+        explicit BitIndices(BitArrayView view) noexcept: _view{view} {}
+
+        /** @brief Iterator to the first set bit */
+        BitIndexIterator begin() const {
+            return BitIndexIterator{_view.data(), _view.offset(), _view.size(), 0};
+        }
+
+        /** @brief Iterator to (one item after) the last set bit */
+        BitIndexIterator end() const {
+            return BitIndexIterator{_view.data(), _view.offset(), _view.size(), _view.size()};
+        }
+
+    private:
+        BitArrayView _view;
+};
+
+template<class T> inline BitIndices BasicBitArrayView<T>::setBitIndices() const {
+    return BitIndices{*this};
+}
+
+template<class T> BasicBitArrayView<T> BasicBitArrayView<T>::slice(const std::size_t begin, const std::size_t end) const {
+    CORRADE_ASSERT(begin <= end && end <= _size,
+        "Containers::BitArrayView::slice(): slice ["
+        << Utility::Debug::nospace << begin
+        << Utility::Debug::nospace << ":"
+        << Utility::Debug::nospace << end
+        << Utility::Debug::nospace << "] out of range for" << _size
+        << "bits", {});
+    return BasicBitArrayView<T>{_data + ((_offset + begin) >> 3), (_offset + begin) & 7, end - begin};
+}
+
+/**
+@brief Bitwise AND of two bit arrays
+@m_since_latest
+
+Sets bits of @p out to @cpp a & b @ce. Expects that all views have the same
+size. The @p out view is allowed to be the same as one of the inputs, but
+not to overlap with them otherwise.
+@see @ref BasicBitArrayView
+*/
+CORRADE_UTILITY_EXPORT void bitArrayAnd(BitArrayView a, BitArrayView b, MutableBitArrayView out);
+
+/**
+@brief Bitwise OR of two bit arrays
+@m_since_latest
+
+Sets bits of @p out to @cpp a | b @ce. Expects that all views have the same
+size. The @p out view is allowed to be the same as one of the inputs, but
+not to overlap with them otherwise.
+*/
+CORRADE_UTILITY_EXPORT void bitArrayOr(BitArrayView a, BitArrayView b, MutableBitArrayView out);
+
+/**
+@brief Bitwise XOR of two bit arrays
+@m_since_latest
+
+Sets bits of @p out to @cpp a ^ b @ce. Expects that all views have the same
+size. The @p out view is allowed to be the same as one of the inputs, but
+not to overlap with them otherwise.
+*/
+CORRADE_UTILITY_EXPORT void bitArrayXor(BitArrayView a, BitArrayView b, MutableBitArrayView out);
+
+/**
+@brief Bitwise AND NOT of two bit arrays
+@m_since_latest
+
+Sets bits of @p out to @cpp a & ~b @ce, i.e. clears bits of @p a that are
+set in @p b. Expects that all views have the same size. The @p out view is
+allowed to be the same as one of the inputs, but not to overlap with them
+otherwise.
+*/
+CORRADE_UTILITY_EXPORT void bitArrayAndNot(BitArrayView a, BitArrayView b, MutableBitArrayView out);
+
+}}
+
+#endif
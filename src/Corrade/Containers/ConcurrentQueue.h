@@ -0,0 +1,297 @@
+#ifndef Corrade_Containers_ConcurrentQueue_h
+#define Corrade_Containers_ConcurrentQueue_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::ConcurrentQueue
+ * @m_since_latest
+ */
+
+#include "Corrade/Containers/RingBuffer.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    template<class T> struct ConcurrentQueueSlot {
+        /*implicit*/ ConcurrentQueueSlot() noexcept {}
+        ~ConcurrentQueueSlot() {}
+
+        std::atomic<std::size_t> sequence;
+        union {
+            T value;
+        };
+    };
+}
+
+/**
+@brief Lock-free bounded multi-producer multi-consumer queue
+@tparam T   Item type
+@m_since_latest
+
+A bounded FIFO queue that can be pushed to and popped from by any number of
+threads concurrently without locking. Storage for all items is allocated once
+upfront in an @ref Array, with the capacity rounded up to a power of two.
+
+Each slot has a sequence number telling whether it's ready to be written to
+or read from for a particular position in the queue. A producer claims a
+position with a single compare-and-swap on the producer index and then
+writes to the slot without interfering with other producers, consumers do
+the same on the consumer index. Producers and consumers thus contend only
+among themselves and only on a single atomic variable, which is on its own
+cache line.
+
+@snippet Containers.cpp ConcurrentQueue-usage
+
+If there's just a single producer and a single consumer, the
+@ref RingBuffer is faster as it doesn't need any compare-and-swap
+operations.
+*/
+template<class T> class ConcurrentQueue {
+    public:
+        typedef T Type;     /**< @brief Item type */
+
+        /**
+         * @brief Constructor
+         * @param capacity      Minimal capacity. Rounded up to the nearest
+         *      power of two, at least @cpp 2 @ce.
+         */
+        explicit ConcurrentQueue(std::size_t capacity);
+
+        /** @brief Copying is not allowed */
+        ConcurrentQueue(const ConcurrentQueue<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        ConcurrentQueue(ConcurrentQueue<T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Destructs all items that weren't popped. Expects that no other
+         * thread accesses the queue anymore.
+         */
+        ~ConcurrentQueue();
+
+        /** @brief Copying is not allowed */
+        ConcurrentQueue<T>& operator=(const ConcurrentQueue<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        ConcurrentQueue<T>& operator=(ConcurrentQueue<T>&&) = delete;
+
+        /** @brief Capacity */
+        std::size_t capacity() const { return _data.size(); }
+
+        /**
+         * @brief Item count
+         *
+         * Only a snapshot, the value may be outdated already when returned.
+         * Includes items that are being pushed at the moment.
+         */
+        std::size_t size() const {
+            const std::size_t head = _head.load(std::memory_order_acquire);
+            const std::size_t tail = _tail.load(std::memory_order_acquire);
+            /* The head can get ahead of a tail loaded earlier */
+            return tail > head ? tail - head : 0;
+        }
+
+        /**
+         * @brief Whether the queue is empty
+         *
+         * Only a snapshot, the value may be outdated already when returned.
+         */
+        bool isEmpty() const { return !size(); }
+
+        /**
+         * @brief Push an item
+         *
+         * Returns @cpp false @ce if the queue is full, @cpp true @ce
+         * otherwise.
+         */
+        bool push(const T& value) { return emplace(value); }
+        bool push(T&& value) { return emplace(std::move(value)); } /**< @overload */
+
+        /**
+         * @brief Construct an item in place
+         *
+         * Returns @cpp false @ce if the queue is full, in which case nothing
+         * is constructed, @cpp true @ce otherwise.
+         */
+        template<class ...Args> bool emplace(Args&&... args);
+
+        /**
+         * @brief Push a batch of items
+         *
+         * Claims as many consecutive positions as are free, up to
+         * @p values size, with a single compare-and-swap, copies the items
+         * there and returns their count. The items are thus never
+         * interleaved with items pushed by other producers. Consumers may
+         * see the items before the whole batch is written.
+         */
+        std::size_t push(ArrayView<const T> values);
+
+        /**
+         * @brief Pop an item
+         *
+         * Returns @ref NullOpt if the queue is empty.
+         */
+        Optional<T> pop();
+
+        /**
+         * @brief Pop a batch of items
+         *
+         * Claims as many consecutive ready items as available, up to
+         * @p values size, with a single compare-and-swap, moves them into
+         * @p values and returns their count.
+         */
+        std::size_t pop(ArrayView<T> values);
+
+    private:
+        Implementation::ConcurrentQueueSlot<T>& at(std::size_t i) { return _data[i & _mask]; }
+
+        /* Claims up to `count` positions starting at `index` which have the
+           sequence equal to `index + offset`, returns the first claimed
+           position and updates `count` to the claimed count */
+        std::size_t claim(std::atomic<std::size_t>& index, std::size_t& count, std::size_t offset);
+
+        Array<Implementation::ConcurrentQueueSlot<T>> _data;
+        std::size_t _mask;
+
+        /* The class isn't aligned to a cache line, so each padding is a
+           whole line to guarantee the head and tail never share one
+           regardless of where the object is placed */
+        char _padding0[Implementation::RingBufferCacheLineSize];
+        std::atomic<std::size_t> _head;
+        char _padding1[Implementation::RingBufferCacheLineSize];
+        std::atomic<std::size_t> _tail;
+        char _padding2[Implementation::RingBufferCacheLineSize];
+};
+
+template<class T> ConcurrentQueue<T>::ConcurrentQueue(const std::size_t capacity): _data{ValueInit, Implementation::ringBufferCapacity(capacity, 2)}, _mask{_data.size() - 1}, _head{0}, _tail{0} {
+    static_assert(offsetof(ConcurrentQueue<T>, _head) >= offsetof(ConcurrentQueue<T>, _mask) + sizeof(std::size_t) + Implementation::RingBufferCacheLineSize &&
+                  offsetof(ConcurrentQueue<T>, _tail) >= offsetof(ConcurrentQueue<T>, _head) + sizeof(std::atomic<std::size_t>) + Implementation::RingBufferCacheLineSize &&
+                  sizeof(ConcurrentQueue<T>) >= offsetof(ConcurrentQueue<T>, _tail) + sizeof(std::atomic<std::size_t>) + Implementation::RingBufferCacheLineSize,
+        "head and tail not on separate cache lines");
+
+    /* With a single slot, a slot written at position 0 would have the
+       sequence 1, which would look like a free slot for position 1 as well,
+       that's why the capacity is at least 2 */
+    for(std::size_t i = 0; i != _data.size(); ++i)
+        _data[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template<class T> ConcurrentQueue<T>::~ConcurrentQueue() {
+    const std::size_t tail = _tail.load(std::memory_order_relaxed);
+    for(std::size_t i = _head.load(std::memory_order_relaxed); i != tail; ++i)
+        at(i).value.~T();
+}
+
+template<class T> std::size_t ConcurrentQueue<T>::claim(std::atomic<std::size_t>& index, std::size_t& count, const std::size_t offset) {
+    std::size_t position = index.load(std::memory_order_relaxed);
+    for(;;) {
+        /* Find how many slots are ready, the signed difference tells
+           whether the slot is still occupied by a previous round (negative)
+           or whether another thread claimed the position already
+           (positive) */
+        std::size_t ready = 0;
+        std::ptrdiff_t difference = 0;
+        for(; ready != count; ++ready) {
+            const std::size_t sequence = at(position + ready).sequence.load(std::memory_order_acquire);
+            difference = std::ptrdiff_t(sequence - (position + ready + offset));
+            if(difference) break;
+        }
+
+        /* Nothing available, either full / empty or another thread was
+           faster */
+        if(!ready) {
+            if(difference < 0) {
+                count = 0;
+                return position;
+            }
+            position = index.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        /* Nobody else can touch the slots once the index is moved past them,
+           as they're claimable only for this particular position */
+        if(index.compare_exchange_weak(position, position + ready, std::memory_order_relaxed)) {
+            count = ready;
+            return position;
+        }
+    }
+}
+
+template<class T> template<class ...Args> bool ConcurrentQueue<T>::emplace(Args&&... args) {
+    std::size_t count = 1;
+    const std::size_t position = claim(_tail, count, 0);
+    if(!count) return false;
+
+    Implementation::ConcurrentQueueSlot<T>& slot = at(position);
+    Implementation::construct(slot.value, std::forward<Args>(args)...);
+    slot.sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template<class T> std::size_t ConcurrentQueue<T>::push(const ArrayView<const T> values) {
+    if(values.empty()) return 0;
+
+    std::size_t count = values.size() < _data.size() ? values.size() : _data.size();
+    const std::size_t position = claim(_tail, count, 0);
+    for(std::size_t i = 0; i != count; ++i) {
+        Implementation::ConcurrentQueueSlot<T>& slot = at(position + i);
+        Implementation::construct(slot.value, values[i]);
+        slot.sequence.store(position + i + 1, std::memory_order_release);
+    }
+    return count;
+}
+
+template<class T> Optional<T> ConcurrentQueue<T>::pop() {
+    std::size_t count = 1;
+    const std::size_t position = claim(_head, count, 1);
+    if(!count) return {};
+
+    Implementation::ConcurrentQueueSlot<T>& slot = at(position);
+    Optional<T> out{InPlaceInit, std::move(slot.value)};
+    slot.value.~T();
+    slot.sequence.store(position + _data.size(), std::memory_order_release);
+    return out;
+}
+
+template<class T> std::size_t ConcurrentQueue<T>::pop(const ArrayView<T> values) {
+    if(values.empty()) return 0;
+
+    std::size_t count = values.size() < _data.size() ? values.size() : _data.size();
+    const std::size_t position = claim(_head, count, 1);
+    for(std::size_t i = 0; i != count; ++i) {
+        Implementation::ConcurrentQueueSlot<T>& slot = at(position + i);
+        values[i] = std::move(slot.value);
+        slot.value.~T();
+        slot.sequence.store(position + i + _data.size(), std::memory_order_release);
+    }
+    return count;
+}
+
+}}
+
+#endif
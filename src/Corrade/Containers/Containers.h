@@ -46,8 +46,19 @@ template<class T> using Array1 = StaticArray<1, T>;
 template<class T> using Array2 = StaticArray<2, T>;
 template<class T> using Array3 = StaticArray<3, T>;
 template<class T> using Array4 = StaticArray<4, T>;
+template<std::size_t, class> class SmallArray;
 
 template<class T, std::size_t size = 1 << (sizeof(T)*8 - 6)> class BigEnumSet;
+template<class, std::size_t> class BigEnumSetIterator;
+template<class> class BasicBitArrayView;
+typedef BasicBitArrayView<const char> BitArrayView;
+typedef BasicBitArrayView<char> MutableBitArrayView;
+class BitArray;
+class BitIndexIterator;
+class BitIndices;
+template<class> class BasicStridedBitArrayView;
+typedef BasicStridedBitArrayView<const char> StridedBitArrayView;
+typedef BasicStridedBitArrayView<char> MutableStridedBitArrayView;
 
 template<unsigned, class> class StridedDimensions;
 template<unsigned, class> class StridedArrayView;
@@ -56,6 +67,13 @@ template<class T> using StridedArrayView1D = StridedArrayView<1, T>;
 template<class T> using StridedArrayView2D = StridedArrayView<2, T>;
 template<class T> using StridedArrayView3D = StridedArrayView<3, T>;
 template<class T> using StridedArrayView4D = StridedArrayView<4, T>;
+template<std::ptrdiff_t, class> class StaticStrideArrayView;
+
+template<class, class> class FlatMap;
+template<class> struct Hash;
+template<class, class> class HashMapEntry;
+template<class Key, class Value, class = Hash<Key>> class HashMap;
+template<class Key, class = Hash<Key>> class HashSet;
 
 template<class T, typename std::underlying_type<T>::type fullValue = typename std::underlying_type<T>::type(~0)> class EnumSet;
 template<class> class LinkedList;
@@ -65,12 +83,19 @@ template<class T> class Optional;
 template<class T> class Pointer;
 template<class T> class Reference;
 
+template<class> class RingBuffer;
+template<class> class ConcurrentQueue;
+
 class ScopeGuard;
 
 class String;
+class StringBuilder;
+class StringPool;
 template<class> class BasicStringView;
 typedef BasicStringView<const char> StringView;
 typedef BasicStringView<char> MutableStringView;
+template<class> class StringSplit;
+template<class> class StringSplitIterator;
 #endif
 
 }}
@@ -0,0 +1,303 @@
+#ifndef Corrade_Containers_FlatMap_h
+#define Corrade_Containers_FlatMap_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::FlatMap
+ * @m_since_latest
+ */
+
+#include <utility>
+
+#include "Corrade/Containers/GrowableArray.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    /* Fills the permutation with indices that stably sort the keys. Done
+       through a function pointer in order to not need to include
+       <algorithm> here. */
+    CORRADE_UTILITY_EXPORT void flatMapSortPermutation(ArrayView<std::size_t> permutation, bool(*less)(const void*, std::size_t, std::size_t), const void* keys);
+
+    /* Moves the last element to given index, shifting all elements after one
+       item forward */
+    template<class T> void flatMapRotateLast(ArrayView<T> array, std::size_t index) {
+        T last = std::move(array[array.size() - 1]);
+        for(std::size_t i = array.size() - 1; i > index; --i)
+            array[i] = std::move(array[i - 1]);
+        array[index] = std::move(last);
+    }
+
+    /* Moves the element at given index to the end, shifting all elements
+       after one item backward */
+    template<class T> void flatMapRotateToLast(ArrayView<T> array, std::size_t index) {
+        T removed = std::move(array[index]);
+        for(std::size_t i = index + 1; i != array.size(); ++i)
+            array[i - 1] = std::move(array[i]);
+        array[array.size() - 1] = std::move(removed);
+    }
+}
+
+/**
+@brief Sorted flat map
+@tparam Key     Key type
+@tparam Value   Value type
+@m_since_latest
+
+A key/value map stored as two contiguous arrays, one with keys sorted using
+@cpp operator< @ce and the other with corresponding values. Compared to
+@ref std::map there's no per-node allocation and no pointer chasing --- a
+lookup is a branchless binary search that touches only the key array, and
+iteration is a plain linear walk over @ref keys() and @ref values().
+
+@snippet Containers.cpp FlatMap-usage
+
+The tradeoff is that @ref set(), @ref emplace() and @ref remove() are
+@f$ \mathcal{O}(n) @f$ as they have to shift all entries after the modified
+one, which makes the container suitable for read-mostly use. To build a large
+map, prefer the @ref FlatMap(Array<Key>&&, Array<Value>&&) constructor, which
+sorts all entries at once.
+
+@section Containers-FlatMap-heterogeneous Heterogeneous lookup
+
+Lookup functions accept any type that's comparable with @p Key using
+@cpp operator< @ce and @cpp operator== @ce in both directions. That means
+for example a map keyed by a @ref String can be queried with a
+@ref StringView without allocating a temporary key.
+
+@section Containers-FlatMap-stability Reference stability
+
+Any insertion or removal may move the entries, invalidating all pointers and
+references to them, as well as views returned by @ref keys() and
+@ref values(). The @p Key and @p Value types are expected to be nothrow
+move-constructible and move-assignable.
+
+@see @ref HashMap
+*/
+template<class Key, class Value> class FlatMap {
+    public:
+        typedef Key KeyType;        /**< @brief Key type */
+        typedef Value ValueType;    /**< @brief Value type */
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty map. Doesn't allocate.
+         */
+        /*implicit*/ FlatMap() noexcept = default;
+
+        /**
+         * @brief Construct from unsorted keys and values
+         *
+         * Sorts the entries by key with a single stable sort. If there are
+         * duplicate keys, the first occurence is used. Expects that both
+         * arrays have the same size.
+         */
+        explicit FlatMap(Array<Key>&& keys, Array<Value>&& values);
+
+        /** @brief Entry count */
+        std::size_t size() const { return _keys.size(); }
+
+        /** @brief Whether the map is empty */
+        bool isEmpty() const { return _keys.empty(); }
+
+        /**
+         * @brief Keys
+         *
+         * Sorted in ascending order, the value corresponding to a key is at
+         * the same index in @ref values().
+         */
+        ArrayView<const Key> keys() const { return _keys; }
+
+        /**
+         * @brief Values
+         *
+         * The key corresponding to a value is at the same index in
+         * @ref keys().
+         */
+        ArrayView<Value> values() { return _values; }
+        ArrayView<const Value> values() const { return _values; } /**< @overload */
+
+        /**
+         * @brief Reserve capacity for given entry count
+         *
+         * If the capacity is already large enough, does nothing.
+         */
+        void reserve(std::size_t size) {
+            arrayReserve(_keys, size);
+            arrayReserve(_values, size);
+        }
+
+        /**
+         * @brief Clear the map
+         *
+         * Destructs all entries but keeps the allocation for reuse.
+         */
+        void clear() {
+            const std::size_t count = size();
+            arrayRemoveSuffix(_keys, count);
+            arrayRemoveSuffix(_values, count);
+        }
+
+        /**
+         * @brief Find index of a key
+         *
+         * Returns index of @p key in @ref keys() and @ref values() or
+         * @ref size() if the key isn't present.
+         */
+        template<class K> std::size_t findIndex(const K& key) const {
+            const std::size_t i = lowerBound(key);
+            return i != _keys.size() && _keys[i] == key ? i : _keys.size();
+        }
+
+        /**
+         * @brief Find a value
+         *
+         * Returns a pointer to the value corresponding to @p key or
+         * @cpp nullptr @ce if the key isn't present.
+         */
+        template<class K> Value* find(const K& key) {
+            const std::size_t i = findIndex(key);
+            return i == _keys.size() ? nullptr : &_values[i];
+        }
+        /** @overload */
+        template<class K> const Value* find(const K& key) const {
+            const std::size_t i = findIndex(key);
+            return i == _keys.size() ? nullptr : &_values[i];
+        }
+
+        /** @brief Whether the map contains given key */
+        template<class K> bool contains(const K& key) const {
+            return findIndex(key) != _keys.size();
+        }
+
+        /**
+         * @brief Insert or replace a value
+         *
+         * If @p key is already present, its value is replaced, otherwise a
+         * new entry is inserted at its sorted position. Returns a reference
+         * to the stored value.
+         */
+        template<class K, class V> Value& set(K&& key, V&& value) {
+            const std::size_t i = lowerBound(key);
+            if(i != _keys.size() && _keys[i] == key)
+                return _values[i] = std::forward<V>(value);
+            return insertAt(i, std::forward<K>(key), std::forward<V>(value));
+        }
+
+        /**
+         * @brief Insert a value if not present
+         *
+         * If @p key isn't present, inserts a new entry with a value
+         * constructed from @p args at its sorted position. Otherwise @p args
+         * are ignored. Returns a reference to the value corresponding to
+         * @p key in both cases.
+         */
+        template<class K, class ...Args> Value& emplace(K&& key, Args&&... args) {
+            const std::size_t i = lowerBound(key);
+            if(i != _keys.size() && _keys[i] == key) return _values[i];
+            return insertAt(i, std::forward<K>(key), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Remove an entry
+         *
+         * Returns @cpp true @ce if @p key was present, @cpp false @ce
+         * otherwise. Doesn't shrink the allocation.
+         */
+        template<class K> bool remove(const K& key) {
+            const std::size_t i = findIndex(key);
+            if(i == _keys.size()) return false;
+            removeAt(i);
+            return true;
+        }
+
+        /**
+         * @brief Remove an entry at given index
+         *
+         * Useful for removing entries while walking through @ref values().
+         * Expects that @p index is less than @ref size().
+         */
+        void removeAt(std::size_t index) {
+            CORRADE_ASSERT(index < _keys.size(),
+                "Containers::FlatMap::removeAt(): index" << index << "out of range for" << _keys.size() << "entries", );
+            Implementation::flatMapRotateToLast<Key>(_keys, index);
+            Implementation::flatMapRotateToLast<Value>(_values, index);
+            arrayRemoveSuffix(_keys);
+            arrayRemoveSuffix(_values);
+        }
+
+    private:
+        /* Index of the first key that's not less than `key`. The loop
+           doesn't branch on the comparison result, so it doesn't suffer from
+           branch mispredictions the way std::lower_bound() does. */
+        template<class K> std::size_t lowerBound(const K& key) const {
+            std::size_t size = _keys.size();
+            if(!size) return 0;
+
+            const Key* base = _keys.data();
+            while(size > 1) {
+                const std::size_t half = size/2;
+                base = base[half] < key ? base + half : base;
+                size -= half;
+            }
+            return std::size_t(base - _keys.data()) + (*base < key);
+        }
+
+        template<class K, class ...Args> Value& insertAt(std::size_t index, K&& key, Args&&... args) {
+            arrayAppend(_keys, InPlaceInit, std::forward<K>(key));
+            arrayAppend(_values, InPlaceInit, std::forward<Args>(args)...);
+            Implementation::flatMapRotateLast<Key>(_keys, index);
+            Implementation::flatMapRotateLast<Value>(_values, index);
+            return _values[index];
+        }
+
+        Array<Key> _keys;
+        Array<Value> _values;
+};
+
+template<class Key, class Value> FlatMap<Key, Value>::FlatMap(Array<Key>&& keys, Array<Value>&& values) {
+    CORRADE_ASSERT(keys.size() == values.size(),
+        "Containers::FlatMap: expected the same count of keys and values but got" << keys.size() << "and" << values.size(), );
+
+    Array<std::size_t> permutation{NoInit, keys.size()};
+    Implementation::flatMapSortPermutation(permutation, [](const void* data, std::size_t a, std::size_t b) {
+        return static_cast<const Key*>(data)[a] < static_cast<const Key*>(data)[b];
+    }, keys.data());
+
+    reserve(keys.size());
+    for(const std::size_t i: permutation) {
+        /* The sort is stable, so if the key is the same as the previous one,
+           it's a duplicate that came later in the input */
+        if(!_keys.empty() && !(_keys[_keys.size() - 1] < keys[i])) continue;
+        arrayAppend(_keys, std::move(keys[i]));
+        arrayAppend(_values, std::move(values[i]));
+    }
+}
+
+}}
+
+#endif
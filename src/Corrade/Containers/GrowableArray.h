@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Class @ref Corrade::Containers::ArrayAllocator, @ref Corrade::Containers::ArrayNewAllocator, @ref Corrade::Containers::ArrayMallocAllocator, function @ref Corrade::Containers::arrayAllocatorCast(), @ref Corrade::Containers::arrayIsGrowable(), @ref Corrade::Containers::arrayCapacity(), @ref Corrade::Containers::arrayReserve(), @ref Corrade::Containers::arrayResize(), @ref Corrade::Containers::arrayAppend(), @ref Corrade::Containers::arrayRemoveSuffix(), @ref Corrade::Containers::arrayShrink()
+ * @brief Class @ref Corrade::Containers::ArrayAllocator, @ref Corrade::Containers::ArrayNewAllocator, @ref Corrade::Containers::ArrayMallocAllocator, @ref Corrade::Containers::ArrayAlignedAllocator, function @ref Corrade::Containers::arrayAllocatorCast(), @ref Corrade::Containers::arrayIsGrowable(), @ref Corrade::Containers::arrayCapacity(), @ref Corrade::Containers::arrayReserve(), @ref Corrade::Containers::arrayResize(), @ref Corrade::Containers::arrayAppend(), @ref Corrade::Containers::arrayInsert(), @ref Corrade::Containers::arrayRemove(), @ref Corrade::Containers::arrayRemoveUnordered(), @ref Corrade::Containers::arrayRemoveSuffix(), @ref Corrade::Containers::arrayShrink()
  * @m_since{2020,06}
  */
 
@@ -270,6 +270,112 @@ template<class T> struct ArrayMallocAllocator {
     }
 };
 
+/**
+@brief Aligned allocator for growable arrays
+@tparam T           Element type
+@tparam alignment   Data alignment in bytes
+@m_since_latest
+
+An @ref ArrayAllocator that aligns the data to @p alignment bytes, for example
+to allow aligned SIMD loads or to avoid false sharing between per-thread slots
+by aligning them to a cache line. The @p alignment is expected to be a power of
+two and at least @cpp alignof(T) @ce. Memory is allocated with
+@ref std::malloc() with enough extra space to align the data pointer and to
+store the capacity and the original allocation offset *before* the front.
+Expects that @p T is nothrow move-constructible.
+
+Because the alignment is a part of the type and the growable array utilities
+recognize the allocator by its @ref deleter(), reallocations done by
+@ref arrayAppend(), @ref arrayReserve() and others preserve the alignment as
+long as the same allocator is used for all of them. As the allocator has two
+template parameters, pass it together with the type:
+
+@snippet Containers.cpp ArrayAlignedAllocator
+
+@see @ref Containers-Array-growable,
+    @ref Array(NoInitT, std::size_t, std::size_t),
+    @ref ArrayView::alignedData()
+*/
+template<class T, std::size_t alignment> struct ArrayAlignedAllocator {
+    static_assert(alignment && !(alignment & (alignment - 1)),
+        "alignment expected to be a power of two");
+    static_assert(alignment >= alignof(T),
+        "alignment expected to be at least the type alignment");
+
+    typedef T Type; /**< Pointer type */
+
+    /**
+     * @brief Allocate (but not construct) an array of given capacity
+     *
+     * @ref std::malloc()'s a @cpp char @ce array large enough to fit
+     * @p capacity elements at an address aligned to @p alignment together
+     * with the capacity and offset stored *before* the front, returning it
+     * cast to @cpp T* @ce.
+     */
+    static T* allocate(std::size_t capacity) {
+        return Implementation::arrayAlignedAllocate<T>(capacity, alignment);
+    }
+
+    /**
+     * @brief Reallocate an array to given capacity
+     *
+     * For trivially copyable types calls @ref std::realloc() and if the
+     * reallocated memory has a different alignment offset, moves the first
+     * @p prevSize elements to the aligned location. Otherwise calls
+     * @ref allocate(), move-constructs @p prevSize elements from @p array
+     * into the new array, calls destructors on the original elements and
+     * calls @ref deallocate(). In both cases updates the @p array reference
+     * to point to the new array.
+     */
+    static void reallocate(T*& array, std::size_t prevSize, std::size_t newCapacity);
+
+    /**
+     * @brief Deallocate an array
+     *
+     * Calls @ref std::free() on a pointer offset by the stored allocation
+     * offset.
+     */
+    static void deallocate(T* data) {
+        Implementation::arrayAlignedDeallocate(data);
+    }
+
+    /**
+     * @brief Grow the array
+     *
+     * Behaves the same as @ref ArrayNewAllocator::grow().
+     */
+    static std::size_t grow(T* array, std::size_t desired);
+
+    /**
+     * @brief Array capacity
+     *
+     * Retrieves the capacity that's stored *before* the front of the @p array.
+     */
+    static std::size_t capacity(T* array) {
+        return reinterpret_cast<std::size_t*>(array)[-2];
+    }
+
+    /**
+     * @brief Array base address
+     *
+     * Returns the address returned by @ref std::malloc().
+     */
+    static void* base(T* array) {
+        return reinterpret_cast<char*>(array) - reinterpret_cast<std::size_t*>(array)[-1];
+    }
+
+    /**
+     * @brief Array deleter
+     *
+     * Calls a destructor on @p size elements and then delegates into
+     * @ref deallocate().
+     */
+    static void deleter(T* data, std::size_t size) {
+        for(T *it = data, *end = data + size; it != end; ++it) it->~T();
+        deallocate(data);
+    }
+};
+
 #ifdef DOXYGEN_GENERATING_OUTPUT
 /**
 @brief Allocator for growable arrays
@@ -816,6 +922,183 @@ template<template<class> class Allocator, class T> inline Containers::ArrayView<
 }
 #endif
 
+/**
+@brief Insert an item into an array
+@return Reference to the newly inserted item
+@m_since_latest
+
+Expects that @p index is not larger than @ref Array::size(). If the array is
+not growable or the capacity is not large enough, the array capacity is grown
+first like with @ref arrayAppend(Array<T>&, const T&). Then, elements starting
+at @p index are shifted one position forward --- trivially copyable types with
+a single @ref std::memmove(), other types are move-constructed to their new
+location and the original location destructed --- and @p value is
+copy-constructed at @p index. Inserting at the end is equivalent to
+@ref arrayAppend(Array<T>&, const T&).
+
+Apart from the growing step, complexity is @f$ \mathcal{O}(n - i) @f$ in the
+size of the container and the insertion index. Unlike with @ref std::vector,
+@p value isn't allowed to reference an element of @p array itself, as the
+reference may be invalidated by the reallocation or the shift.
+@see @ref arrayRemove(), @ref arrayIsGrowable(), @ref Containers-Array-growable
+*/
+template<class T, class Allocator = ArrayAllocator<T>> T& arrayInsert(Array<T>& array, std::size_t index, const T& value);
+
+/* This crap tool can't distinguish between this and above overload, showing
+   just one with the docs melted together. More useless than showing nothing
+   at all, so hiding this one from it until it improves. */
+#ifndef DOXYGEN_GENERATING_OUTPUT
+/**
+@overload
+@m_since_latest
+
+Convenience overload allowing to specify just the allocator template, with
+array type being inferred.
+*/
+template<template<class> class Allocator, class T> inline T& arrayInsert(Array<T>& array, std::size_t index, const T& value) {
+    return arrayInsert<T, Allocator<T>>(array, index, value);
+}
+#endif
+
+/**
+@brief In-place insert an item into an array
+@return Reference to the newly inserted item
+@m_since_latest
+
+Similar to @ref arrayInsert(Array<T>&, std::size_t, const T&) except that the
+new element is constructed using placement-new with provided @p args.
+*/
+template<class T, class... Args> T& arrayInsert(Array<T>& array, std::size_t index, InPlaceInitT, Args&&... args);
+
+/* This crap tool can't distinguish between these and above overload, showing
+   just one with the docs melted together. More useless than showing nothing
+   at all, so hiding this one from it until it improves. */
+#ifndef DOXYGEN_GENERATING_OUTPUT
+/**
+@overload
+@m_since_latest
+*/
+template<class T, class Allocator, class... Args> T& arrayInsert(Array<T>& array, std::size_t index, InPlaceInitT, Args&&... args);
+
+/**
+@overload
+@m_since_latest
+
+Convenience overload allowing to specify just the allocator template, with
+array type being inferred.
+*/
+template<template<class> class Allocator, class T, class... Args> inline T& arrayInsert(Array<T>& array, std::size_t index, InPlaceInitT, Args&&... args) {
+    return arrayInsert<T, Allocator<T>>(array, index, InPlaceInit, std::forward<Args>(args)...);
+}
+#endif
+
+/**
+@brief Move-insert an item into an array
+@return Reference to the newly inserted item
+@m_since_latest
+
+Calls @ref arrayInsert(Array<T>&, std::size_t, InPlaceInitT, Args&&... args)
+with @p value.
+*/
+template<class T, class Allocator = ArrayAllocator<T>> inline T& arrayInsert(Array<T>& array, std::size_t index, T&& value) {
+    return arrayInsert<T, Allocator>(array, index, InPlaceInit, std::move(value));
+}
+
+/* This crap tool can't distinguish between this and above overload, showing
+   just one with the docs melted together. More useless than showing nothing
+   at all, so hiding this one from it until it improves. */
+#ifndef DOXYGEN_GENERATING_OUTPUT
+/**
+@overload
+@m_since_latest
+
+Convenience overload allowing to specify just the allocator template, with
+array type being inferred.
+*/
+template<template<class> class Allocator, class T> inline T& arrayInsert(Array<T>& array, std::size_t index, T&& value) {
+    return arrayInsert<T, Allocator<T>>(array, index, InPlaceInit, std::move(value));
+}
+#endif
+
+/**
+@brief Insert a list of items into an array
+@return View on the newly inserted items
+@m_since_latest
+
+Like @ref arrayInsert(Array<T>&, std::size_t, const T&), but inserting
+multiple values at once. The existing elements are shifted only once,
+independently of the count of inserted values. Similarly to the single-value
+variant, @p values aren't allowed to reference elements of @p array itself.
+@see @ref arrayAppend(Array<T>&, Containers::ArrayView<const T>)
+*/
+template<class T, class Allocator = ArrayAllocator<T>> Containers::ArrayView<T> arrayInsert(Array<T>& array, std::size_t index, Containers::ArrayView<const T> values);
+
+/* This crap tool can't distinguish between this and above overload, showing
+   just one with the docs melted together. More useless than showing nothing
+   at all, so hiding this one from it until it improves. */
+#ifndef DOXYGEN_GENERATING_OUTPUT
+/**
+@overload
+@m_since_latest
+
+Convenience overload allowing to specify just the allocator template, with
+array type being inferred.
+*/
+template<template<class> class Allocator, class T> inline Containers::ArrayView<T> arrayInsert(Array<T>& array, std::size_t index, Containers::ArrayView<const T> values) {
+    return arrayInsert<T, Allocator<T>>(array, index, values);
+}
+#endif
+
+/**
+@overload
+@m_since_latest
+*/
+template<class T, class Allocator = ArrayAllocator<T>> Containers::ArrayView<T> arrayInsert(Array<T>& array, std::size_t index, std::initializer_list<T> values);
+
+/* This crap tool can't distinguish between this and above overload, showing
+   just one with the docs melted together. More useless than showing nothing
+   at all, so hiding this one from it until it improves. */
+#ifndef DOXYGEN_GENERATING_OUTPUT
+/**
+@overload
+@m_since_latest
+
+Convenience overload allowing to specify just the allocator template, with
+array type being inferred.
+*/
+template<template<class> class Allocator, class T> inline Containers::ArrayView<T> arrayInsert(Array<T>& array, std::size_t index, std::initializer_list<T> values) {
+    return arrayInsert<T, Allocator<T>>(array, index, values);
+}
+#endif
+
+/**
+@brief Insert given count of uninitialized values into an array
+@return View on the newly inserted items
+@m_since_latest
+
+A lower-level variant of
+@ref arrayInsert(Array<T>&, std::size_t, Containers::ArrayView<const T>) where
+the new values are meant to be initialized in-place after, instead of being
+copied from a pre-existing location.
+*/
+template<class T, class Allocator = ArrayAllocator<T>> Containers::ArrayView<T> arrayInsert(Array<T>& array, std::size_t index, NoInitT, std::size_t count);
+
+/* This crap tool can't distinguish between this and above overload, showing
+   just one with the docs melted together. More useless than showing nothing
+   at all, so hiding this one from it until it improves. */
+#ifndef DOXYGEN_GENERATING_OUTPUT
+/**
+@overload
+@m_since_latest
+
+Convenience overload allowing to specify just the allocator template, with
+array type being inferred.
+*/
+template<template<class> class Allocator, class T> inline Containers::ArrayView<T> arrayInsert(Array<T>& array, std::size_t index, NoInitT, std::size_t count) {
+    return arrayInsert<T, Allocator<T>>(array, index, NoInit, count);
+}
+#endif
+
 /**
 @brief Remove a suffix from the array
 @m_since{2020,06}
@@ -844,6 +1127,76 @@ template<template<class> class Allocator, class T> inline void arrayRemoveSuffix
 }
 #endif
 
+/**
+@brief Remove an element from an array
+@m_since_latest
+
+Expects that @cpp index + count @ce is not larger than @ref Array::size().
+Elements after the removed range are shifted @p count positions back ---
+trivially copyable types with a single @ref std::memmove(), other types are
+move-assigned --- preserving their order, and then the last @p count elements
+are removed like with @ref arrayRemoveSuffix(), which includes reallocating
+the array to a growable version if it's not growable already.
+
+Complexity is @f$ \mathcal{O}(n - i - c) @f$ in the size of the container,
+the removal index and the removed count. If the element order doesn't need to
+be preserved, use @ref arrayRemoveUnordered() instead.
+@see @ref arrayInsert(), @ref arrayIsGrowable()
+*/
+template<class T, class Allocator = ArrayAllocator<T>> void arrayRemove(Array<T>& array, std::size_t index, std::size_t count = 1);
+
+/* This crap tool can't distinguish between this and above overload, showing
+   just one with the docs melted together. More useless than showing nothing
+   at all, so hiding this one from it until it improves. */
+#ifndef DOXYGEN_GENERATING_OUTPUT
+/**
+@overload
+@m_since_latest
+
+Convenience overload allowing to specify just the allocator template, with
+array type being inferred.
+*/
+template<template<class> class Allocator, class T> inline void arrayRemove(Array<T>& array, std::size_t index, std::size_t count = 1) {
+    arrayRemove<T, Allocator<T>>(array, index, count);
+}
+#endif
+
+/**
+@brief Remove an element from an unordered array
+@m_since_latest
+
+Expects that @cpp index + count @ce is not larger than @ref Array::size().
+Instead of shifting all following elements like @ref arrayRemove() does, the
+gap is filled with the last @p count elements of the array (or less, if there
+isn't that many elements after the removed range) --- trivially copyable types
+with a single @ref std::memcpy(), other types are move-assigned. The last
+@p count elements are then removed like with @ref arrayRemoveSuffix().
+
+Complexity is @f$ \mathcal{O}(c) @f$ in the removed count, independently of
+the array size, but the order of the remaining elements is not preserved:
+
+@snippet Containers.cpp arrayRemoveUnordered
+
+@see @ref arrayIsGrowable()
+*/
+template<class T, class Allocator = ArrayAllocator<T>> void arrayRemoveUnordered(Array<T>& array, std::size_t index, std::size_t count = 1);
+
+/* This crap tool can't distinguish between this and above overload, showing
+   just one with the docs melted together. More useless than showing nothing
+   at all, so hiding this one from it until it improves. */
+#ifndef DOXYGEN_GENERATING_OUTPUT
+/**
+@overload
+@m_since_latest
+
+Convenience overload allowing to specify just the allocator template, with
+array type being inferred.
+*/
+template<template<class> class Allocator, class T> inline void arrayRemoveUnordered(Array<T>& array, std::size_t index, std::size_t count = 1) {
+    arrayRemoveUnordered<T, Allocator<T>>(array, index, count);
+}
+#endif
+
 /**
 @brief Convert an array back to non-growable
 @m_since{2020,06}
@@ -908,6 +1261,14 @@ template<class T> struct ArrayGuts {
     void(*deleter)(T*, std::size_t);
 };
 
+/* Allocators that can make an array non-growable on their own instead of
+   copying it to a default-allocated array specialize this, returning true and
+   updating the guts, see ArrayAlignedAllocator below and
+   ArrayMmapAllocator.h */
+template<class Allocator> struct ArrayShrinkInPlace {
+    template<class T> static bool shrink(ArrayGuts<T>&) { return false; }
+};
+
 template<class T> inline void arrayConstruct(DefaultInitT, T*, T*, typename std::enable_if<
     #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
     std::is_trivially_constructible<T>::value
@@ -1037,6 +1398,67 @@ template<class T> inline void arrayDestruct(T* begin, T* const end, typename std
     for(; begin < end; ++begin) begin->~T();
 }
 
+/* Moves [begin, end) count items forward, leaving [begin, begin + count)
+   uninitialized. The destination is expected to be allocated. */
+template<class T> inline void arrayShiftForward(T* const begin, T* const end, const std::size_t count, typename std::enable_if<
+    #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+    std::is_trivially_copyable<T>::value
+    #else
+    IsTriviallyCopyableOnOldGcc<T>::value
+    #endif
+>::type* = nullptr) {
+    std::memmove(begin + count, begin, (end - begin)*sizeof(T));
+}
+
+template<class T> inline void arrayShiftForward(T* const begin, T* const end, const std::size_t count, typename std::enable_if<!
+    #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+    std::is_trivially_copyable<T>::value
+    #else
+    IsTriviallyCopyableOnOldGcc<T>::value
+    #endif
+>::type* = nullptr) {
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+        "noexcept move-constructible type is required");
+    static_assert(std::is_nothrow_move_assignable<T>::value,
+        "noexcept move-assignable type is required");
+    /* Items that end up past the original end are move-constructed there,
+       the rest is move-assigned backwards over items that were already
+       moved away. Finally, the moved-out items in the gap get destructed. */
+    const std::size_t size = end - begin;
+    const std::size_t constructCount = count < size ? count : size;
+    arrayMoveConstruct<T>(end - constructCount, end - constructCount + count, constructCount);
+    for(T* src = end - constructCount; src != begin; ) {
+        --src;
+        *(src + count) = std::move(*src);
+    }
+    arrayDestruct<T>(begin, begin + constructCount);
+}
+
+/* Moves [src, end) to dst, which is before src. The destination range is
+   expected to be constructed, the items are move-assigned. */
+template<class T> inline void arrayShiftBackward(T* const src, T* const end, T* const dst, typename std::enable_if<
+    #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+    std::is_trivially_copyable<T>::value
+    #else
+    IsTriviallyCopyableOnOldGcc<T>::value
+    #endif
+>::type* = nullptr) {
+    std::memmove(dst, src, (end - src)*sizeof(T));
+}
+
+template<class T> inline void arrayShiftBackward(T* src, T* const end, T* dst, typename std::enable_if<!
+    #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+    std::is_trivially_copyable<T>::value
+    #else
+    IsTriviallyCopyableOnOldGcc<T>::value
+    #endif
+>::type* = nullptr) {
+    static_assert(std::is_nothrow_move_assignable<T>::value,
+        "noexcept move-assignable type is required");
+    for(; src != end; ++src, ++dst)
+        *dst = std::move(*src);
+}
+
 inline std::size_t arrayGrowth(const std::size_t currentCapacity, const std::size_t desiredCapacity, const std::size_t sizeOfT) {
     /** @todo pick a nice value when current = 0 and desired > 1 */
     const std::size_t currentCapacityInBytes = sizeOfT*currentCapacity + sizeof(std::size_t);
@@ -1092,6 +1514,63 @@ template<class T> void ArrayMallocAllocator<T>::reallocate(T*& array, std::size_
     array = reinterpret_cast<T*>(memory + sizeof(std::size_t));
 }
 
+namespace Implementation {
+
+template<class T, std::size_t alignment> void arrayAlignedReallocate(T*& array, const std::size_t prevSize, const std::size_t newCapacity, typename std::enable_if<
+    #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+    std::is_trivially_copyable<T>::value
+    #else
+    IsTriviallyCopyableOnOldGcc<T>::value
+    #endif
+>::type* = nullptr) {
+    /* std::realloc() keeps the contents at the same offset from the base
+       pointer, which may not be aligned anymore. In that case move them. */
+    const std::size_t actualAlignment = arrayAlignment(alignment, alignof(T));
+    const std::size_t prevOffset = reinterpret_cast<std::size_t*>(array)[-1];
+    char* const memory = static_cast<char*>(std::realloc(reinterpret_cast<char*>(array) - prevOffset, newCapacity*sizeof(T) + 2*sizeof(std::size_t) + actualAlignment - 1));
+    char* const data = reinterpret_cast<char*>((reinterpret_cast<std::size_t>(memory) + 2*sizeof(std::size_t) + actualAlignment - 1) & ~(actualAlignment - 1));
+    const std::size_t offset = data - memory;
+    if(offset != prevOffset)
+        std::memmove(data, memory + prevOffset, prevSize*sizeof(T));
+    reinterpret_cast<std::size_t*>(data)[-2] = newCapacity;
+    reinterpret_cast<std::size_t*>(data)[-1] = offset;
+    array = reinterpret_cast<T*>(data);
+}
+
+template<class T, std::size_t alignment> void arrayAlignedReallocate(T*& array, const std::size_t prevSize, const std::size_t newCapacity, typename std::enable_if<!
+    #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+    std::is_trivially_copyable<T>::value
+    #else
+    IsTriviallyCopyableOnOldGcc<T>::value
+    #endif
+>::type* = nullptr) {
+    T* const newArray = arrayAlignedAllocate<T>(newCapacity, alignment);
+    arrayMoveConstruct<T>(array, newArray, prevSize);
+    for(T *it = array, *end = array + prevSize; it < end; ++it) it->~T();
+    arrayAlignedDeallocate(array);
+    array = newArray;
+}
+
+/* Shrinking keeps the alignment, for trivially copyable types it's usually
+   done in-place by std::realloc() */
+template<class T, std::size_t alignment> struct ArrayShrinkInPlace<ArrayAlignedAllocator<T, alignment>> {
+    static bool shrink(ArrayGuts<T>& guts) {
+        arrayAlignedReallocate<T, alignment>(guts.data, guts.size, guts.size);
+        guts.deleter = arrayAlignedDeleter<T>;
+        return true;
+    }
+};
+
+}
+
+template<class T, std::size_t alignment> void ArrayAlignedAllocator<T, alignment>::reallocate(T*& array, const std::size_t prevSize, const std::size_t newCapacity) {
+    Implementation::arrayAlignedReallocate<T, alignment>(array, prevSize, newCapacity);
+}
+
+template<class T, std::size_t alignment> std::size_t ArrayAlignedAllocator<T, alignment>::grow(T* const array, const std::size_t desiredCapacity) {
+    return Implementation::arrayGrowth(array ? capacity(array) : 0, desiredCapacity, sizeof(T));
+}
+
 template<class T> std::size_t ArrayNewAllocator<T>::grow(T* const array, const std::size_t desiredCapacity) {
     return Implementation::arrayGrowth(array ? capacity(array) : 0, desiredCapacity, sizeof(T));
 }
@@ -1287,6 +1766,22 @@ template<class T, class Allocator> T* arrayGrowBy(Array<T>& array, const std::si
     return it;
 }
 
+template<class T, class Allocator> T* arrayGrowAtBy(Array<T>& array, const std::size_t index, const std::size_t count) {
+    /* Direct access & caching to speed up debug builds */
+    auto& arrayGuts = reinterpret_cast<Implementation::ArrayGuts<T>&>(array);
+    const std::size_t size = arrayGuts.size;
+
+    /* Grow at the end first, which also takes care of reallocation and
+       sanitizer annotations, and then shift the items after index to the
+       newly added space. Not doing anything if there's nothing to shift, to
+       make inserting at the end as fast as appending. */
+    arrayGrowBy<T, Allocator>(array, count);
+    T* const it = arrayGuts.data + index;
+    if(index != size && count)
+        arrayShiftForward<T>(it, arrayGuts.data + size, count);
+    return it;
+}
+
 }
 
 template<class T, class Allocator> inline T& arrayAppend(Array<T>& array, const T& value) {
@@ -1301,7 +1796,7 @@ template<class T, class Allocator> inline T& arrayAppend(Array<T>& array, const
 }
 
 template<class T, class Allocator> inline Containers::ArrayView<T> arrayAppend(Array<T>& array, const std::initializer_list<T> values) {
-    return arrayAppend(array, {values.begin(), values.size()});
+    return arrayAppend<T, Allocator>(array, Containers::ArrayView<const T>{values.begin(), values.size()});
 }
 
 template<class T, class Allocator> inline Containers::ArrayView<T> arrayAppend(Array<T>& array, const Containers::ArrayView<const T> values) {
@@ -1336,6 +1831,57 @@ template<class T, class Allocator> Containers::ArrayView<T> arrayAppend(Array<T>
     return {it, count};
 }
 
+template<class T, class Allocator> inline T& arrayInsert(Array<T>& array, const std::size_t index, const T& value) {
+    CORRADE_ASSERT(index <= array.size(), "Containers::arrayInsert(): can't insert at index" << index << "into an array of size" << array.size(), *array.data());
+    T* const it = Implementation::arrayGrowAtBy<T, Allocator>(array, index, 1);
+    /* Can't use {}, see the GCC 4.8-specific overload for details */
+    #if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG) &&  __GNUC__ < 5
+    Implementation::construct(*it, value);
+    #else
+    new(it) T{value};
+    #endif
+    return *it;
+}
+
+template<class T, class Allocator> inline Containers::ArrayView<T> arrayInsert(Array<T>& array, const std::size_t index, const std::initializer_list<T> values) {
+    return arrayInsert<T, Allocator>(array, index, Containers::ArrayView<const T>{values.begin(), values.size()});
+}
+
+template<class T, class Allocator> inline Containers::ArrayView<T> arrayInsert(Array<T>& array, const std::size_t index, const Containers::ArrayView<const T> values) {
+    CORRADE_ASSERT(index <= array.size(), "Containers::arrayInsert(): can't insert at index" << index << "into an array of size" << array.size(), {});
+    /* Direct access & caching to speed up debug builds */
+    const std::size_t valueCount = values.size();
+
+    T* const it = Implementation::arrayGrowAtBy<T, Allocator>(array, index, valueCount);
+    Implementation::arrayCopyConstruct<T>(values.data(), it, valueCount);
+    return {it, valueCount};
+}
+
+template<class T, class Allocator, class... Args> T& arrayInsert(Array<T>& array, const std::size_t index, InPlaceInitT, Args&&... args) {
+    CORRADE_ASSERT(index <= array.size(), "Containers::arrayInsert(): can't insert at index" << index << "into an array of size" << array.size(), *array.data());
+    T* const it = Implementation::arrayGrowAtBy<T, Allocator>(array, index, 1);
+    /* No helper function as there's no way we could memcpy such a thing. */
+    /* On GCC 4.8 this includes another workaround, see the 4.8-specific
+       overload docs for details */
+    Implementation::construct(*it, std::forward<Args>(args)...);
+    return *it;
+}
+
+/* This crap tool can't distinguish between this and above overload, showing
+   just one with the docs melted together. More useless than showing nothing
+   at all, so hiding this one from it until it improves. */
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template<class T, class... Args> inline T& arrayInsert(Array<T>& array, const std::size_t index, InPlaceInitT, Args&&... args) {
+    return arrayInsert<T, ArrayAllocator<T>>(array, index, InPlaceInit, std::forward<Args>(args)...);
+}
+#endif
+
+template<class T, class Allocator> Containers::ArrayView<T> arrayInsert(Array<T>& array, const std::size_t index, NoInitT, const std::size_t count) {
+    CORRADE_ASSERT(index <= array.size(), "Containers::arrayInsert(): can't insert at index" << index << "into an array of size" << array.size(), {});
+    T* const it = Implementation::arrayGrowAtBy<T, Allocator>(array, index, count);
+    return {it, count};
+}
+
 template<class T, class Allocator> void arrayRemoveSuffix(Array<T>& array, const std::size_t count) {
     /* Direct access to speed up debug builds */
     auto& arrayGuts = reinterpret_cast<Implementation::ArrayGuts<T>&>(array);
@@ -1378,6 +1924,40 @@ template<class T, class Allocator> void arrayRemoveSuffix(Array<T>& array, const
     }
 }
 
+template<class T, class Allocator> void arrayRemove(Array<T>& array, const std::size_t index, const std::size_t count) {
+    /* Direct access to speed up debug builds */
+    auto& arrayGuts = reinterpret_cast<Implementation::ArrayGuts<T>&>(array);
+    CORRADE_ASSERT(index + count <= arrayGuts.size, "Containers::arrayRemove(): can't remove" << count << "elements at index" << index << "from an array of size" << arrayGuts.size, );
+
+    /* Nothing to remove, yay! */
+    if(!count) return;
+
+    /* Shift the following items to the removed range, if there are any, and
+       then drop the suffix, which also takes care of destructing the moved-out
+       items and converting the array to a growable one if needed */
+    if(index + count != arrayGuts.size)
+        Implementation::arrayShiftBackward<T>(arrayGuts.data + index + count, arrayGuts.data + arrayGuts.size, arrayGuts.data + index);
+    arrayRemoveSuffix<T, Allocator>(array, count);
+}
+
+template<class T, class Allocator> void arrayRemoveUnordered(Array<T>& array, const std::size_t index, const std::size_t count) {
+    /* Direct access to speed up debug builds */
+    auto& arrayGuts = reinterpret_cast<Implementation::ArrayGuts<T>&>(array);
+    CORRADE_ASSERT(index + count <= arrayGuts.size, "Containers::arrayRemoveUnordered(): can't remove" << count << "elements at index" << index << "from an array of size" << arrayGuts.size, );
+
+    /* Nothing to remove, yay! */
+    if(!count) return;
+
+    /* Move at most count items from the end to the removed range. If there's
+       less items after the removed range than count, the remaining removed
+       items are at the end already. The ranges never overlap, so it's fine
+       to use the move assignment helper that memcpy()s trivial types. */
+    const std::size_t after = arrayGuts.size - index - count;
+    const std::size_t moveCount = after < count ? after : count;
+    Implementation::arrayMoveAssign<T>(arrayGuts.data + arrayGuts.size - moveCount, arrayGuts.data + index, moveCount);
+    arrayRemoveSuffix<T, Allocator>(array, count);
+}
+
 template<class T, class Allocator> void arrayShrink(Array<T>& array, NoInitT) {
     /* Direct access to speed up debug builds */
     auto& arrayGuts = reinterpret_cast<Implementation::ArrayGuts<T>&>(array);
@@ -1387,6 +1967,10 @@ template<class T, class Allocator> void arrayShrink(Array<T>& array, NoInitT) {
     if(arrayGuts.deleter != Allocator::deleter)
         return;
 
+    /* Some allocators can release the unused capacity in place */
+    if(Implementation::ArrayShrinkInPlace<Allocator>::shrink(arrayGuts))
+        return;
+
     /* Even if we don't need to shrink, reallocating to an usual array with
        common deleters to avoid surprises */
     Array<T> newArray{NoInit, arrayGuts.size};
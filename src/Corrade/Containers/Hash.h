@@ -0,0 +1,108 @@
+#ifndef Corrade_Containers_Hash_h
+#define Corrade_Containers_Hash_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::Hash
+ * @m_since_latest
+ */
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Corrade/Containers/Containers.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    /* MurmurHash3 64-bit finalizer. An identity hash isn't suitable for the
+       hash table in HashMap, which splits the hash into a group index and a
+       7-bit tag, so all bits have to be well mixed. */
+    inline std::size_t hashInteger(unsigned long long h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return std::size_t(h);
+    }
+
+    template<class T, bool = std::is_integral<T>::value || std::is_enum<T>::value> struct IntegerHash {};
+    template<class T> struct IntegerHash<T, true> {
+        std::size_t operator()(T value) const {
+            return hashInteger(static_cast<unsigned long long>(value));
+        }
+    };
+}
+
+/**
+@brief Hash function
+@tparam T   Type to hash
+@m_since_latest
+
+Function object used by @ref HashMap and @ref HashSet. Specializations are
+provided for builtin integer types, enums, pointers and @ref String,
+@ref StringView and @ref MutableStringView. The string specializations all
+accept a @ref StringView, which means a @ref HashMap keyed by a @ref String can
+be queried with a @ref StringView without allocating a temporary string.
+Strings are hashed using the 64-bit @ref Utility::XxHash3, integers and
+pointers go through a cheap bit-mixing finalizer.
+
+Specialize this template for custom key types, or pass a custom function
+object as a template parameter of @ref HashMap or @ref HashSet. Since the hash
+tables split the value into a group index and a tag, the returned hash is
+expected to have all bits well-distributed --- an identity function isn't a
+good hash.
+*/
+template<class T> struct Hash
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    : Implementation::IntegerHash<T>
+    #endif
+{
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    /** @brief Hash a value */
+    std::size_t operator()(const T& value) const;
+    #endif
+};
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template<class T> struct Hash<T*> {
+    std::size_t operator()(const T* value) const {
+        return Implementation::hashInteger(reinterpret_cast<std::size_t>(value));
+    }
+};
+
+template<> struct CORRADE_UTILITY_EXPORT Hash<StringView> {
+    std::size_t operator()(StringView value) const;
+};
+template<> struct Hash<MutableStringView>: Hash<StringView> {};
+template<> struct Hash<String>: Hash<StringView> {};
+#endif
+
+}}
+
+#endif
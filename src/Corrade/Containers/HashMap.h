@@ -0,0 +1,587 @@
+#ifndef Corrade_Containers_HashMap_h
+#define Corrade_Containers_HashMap_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::HashMap, @ref Corrade::Containers::HashMapEntry
+ * @m_since_latest
+ */
+
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <utility>
+
+#include "Corrade/Containers/Hash.h"
+#include "Corrade/Containers/Tags.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(CORRADE_TARGET_MSVC) && !defined(CORRADE_TARGET_GCC)
+#include <intrin.h>
+#endif
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+
+/* Shared implementation of HashMap and HashSet. It's a Swiss table -- slots
+   are split into groups of 16 and each slot has a control byte that's either
+   HashTableEmpty, HashTableDeleted or the lowest 7 bits of the key hash
+   (called a tag below). A lookup computes the starting group from the
+   remaining hash bits and then compares all 16 tags of a group at once,
+   checking the actual keys only for slots where the tag matches. If the
+   group has no match but has an empty slot, the key isn't in the table,
+   otherwise the next group is probed. The groups are probed in a triangular
+   sequence, which visits all of them for a power-of-two group count. */
+
+enum: std::size_t { HashTableGroupSize = 16 };
+
+enum: signed char {
+    HashTableEmpty = -128,
+    HashTableDeleted = -2
+};
+
+inline unsigned hashTableFirstBit(unsigned mask) {
+    #ifdef CORRADE_TARGET_GCC
+    return __builtin_ctz(mask);
+    #else
+    unsigned long bit;
+    _BitScanForward(&bit, mask);
+    return unsigned(bit);
+    #endif
+}
+
+/* Bits of the result are set for control bytes in a group that are equal to
+   given value */
+inline unsigned hashTableMatch(const signed char* group, signed char value) {
+    #ifdef CORRADE_TARGET_SSE2
+    const __m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8(value))));
+    #else
+    unsigned mask = 0;
+    for(std::size_t i = 0; i != HashTableGroupSize; ++i)
+        if(group[i] == value) mask |= 1u << i;
+    return mask;
+    #endif
+}
+
+/* Bits of the result are set for control bytes in a group that are either
+   empty or deleted. Those are exactly the ones with the highest bit set. */
+inline unsigned hashTableMatchFree(const signed char* group) {
+    #ifdef CORRADE_TARGET_SSE2
+    return unsigned(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+    #else
+    unsigned mask = 0;
+    for(std::size_t i = 0; i != HashTableGroupSize; ++i)
+        if(group[i] < 0) mask |= 1u << i;
+    return mask;
+    #endif
+}
+
+/* At most 7/8 of the slots can be full or deleted, which guarantees that
+   every probe sequence eventually hits an empty slot */
+constexpr std::size_t hashTableMaxLoad(std::size_t capacity) {
+    return capacity - capacity/8;
+}
+
+template<class T> class HashTableIterator {
+    public:
+        explicit HashTableIterator(T* slot, const signed char* control, const signed char* end) noexcept: _slot{slot}, _control{control}, _end{end} {
+            skipFree();
+        }
+
+        T& operator*() const { return *_slot; }
+        T* operator->() const { return _slot; }
+
+        HashTableIterator<T>& operator++() {
+            ++_slot;
+            ++_control;
+            skipFree();
+            return *this;
+        }
+
+        bool operator==(const HashTableIterator<T>& other) const {
+            return _control == other._control;
+        }
+        bool operator!=(const HashTableIterator<T>& other) const {
+            return _control != other._control;
+        }
+
+    private:
+        void skipFree() {
+            while(_control != _end && *_control < 0) {
+                ++_slot;
+                ++_control;
+            }
+        }
+
+        T* _slot;
+        const signed char* _control;
+        const signed char* _end;
+};
+
+/* KeyOf::get() extracts the key from a slot. The Hash function object is
+   assumed to be stateless. */
+template<class Slot, class KeyOf, class Hash> class HashTable {
+    static_assert(alignof(Slot) <= 2*sizeof(std::size_t), "over-aligned types are not supported");
+
+    public:
+        enum: std::size_t { NotFound = ~std::size_t{} };
+
+        /*implicit*/ HashTable() noexcept: _slots{}, _control{}, _size{}, _capacity{}, _growthLeft{} {}
+
+        HashTable(const HashTable<Slot, KeyOf, Hash>& other): _size{other._size}, _capacity{other._capacity}, _growthLeft{other._growthLeft} {
+            if(!_capacity) {
+                _slots = nullptr;
+                _control = nullptr;
+                return;
+            }
+
+            allocate(_capacity);
+            std::memcpy(_control, other._control, _capacity);
+            for(std::size_t i = 0; i != _capacity; ++i)
+                if(_control[i] >= 0) new(&_slots[i]) Slot(other._slots[i]);
+        }
+
+        HashTable(HashTable<Slot, KeyOf, Hash>&& other) noexcept: _slots{other._slots}, _control{other._control}, _size{other._size}, _capacity{other._capacity}, _growthLeft{other._growthLeft} {
+            other._slots = nullptr;
+            other._control = nullptr;
+            other._size = other._capacity = other._growthLeft = 0;
+        }
+
+        ~HashTable() {
+            destruct();
+            delete[] reinterpret_cast<char*>(_slots);
+        }
+
+        HashTable<Slot, KeyOf, Hash>& operator=(const HashTable<Slot, KeyOf, Hash>& other) {
+            HashTable<Slot, KeyOf, Hash> copy{other};
+            swap(copy);
+            return *this;
+        }
+
+        HashTable<Slot, KeyOf, Hash>& operator=(HashTable<Slot, KeyOf, Hash>&& other) noexcept {
+            swap(other);
+            return *this;
+        }
+
+        Slot* slots() { return _slots; }
+        const Slot* slots() const { return _slots; }
+        const signed char* control() const { return _control; }
+        std::size_t size() const { return _size; }
+        std::size_t capacity() const { return _capacity; }
+
+        template<class K> std::size_t find(const K& key) const {
+            if(!_capacity) return NotFound;
+
+            const std::size_t hash = Hash{}(key);
+            const signed char tag = static_cast<signed char>(hash & 0x7f);
+            const std::size_t groupMask = _capacity/HashTableGroupSize - 1;
+            std::size_t group = (hash >> 7) & groupMask;
+            for(std::size_t step = 1; ; ++step) {
+                const signed char* const control = _control + group*HashTableGroupSize;
+                for(unsigned mask = hashTableMatch(control, tag); mask; mask &= mask - 1) {
+                    const std::size_t i = group*HashTableGroupSize + hashTableFirstBit(mask);
+                    if(KeyOf::get(_slots[i]) == key) return i;
+                }
+
+                if(hashTableMatch(control, HashTableEmpty)) return NotFound;
+                group = (group + step) & groupMask;
+            }
+        }
+
+        /* If the key isn't found, marks a slot as full and returns its index
+           with `found` set to false, the caller is then expected to construct
+           the slot */
+        template<class K> std::size_t findOrPrepareInsert(const K& key, bool& found) {
+            found = true;
+            const std::size_t hash = Hash{}(key);
+            const signed char tag = static_cast<signed char>(hash & 0x7f);
+            if(_capacity) {
+                const std::size_t groupMask = _capacity/HashTableGroupSize - 1;
+                std::size_t group = (hash >> 7) & groupMask;
+                for(std::size_t step = 1; ; ++step) {
+                    const signed char* const control = _control + group*HashTableGroupSize;
+                    for(unsigned mask = hashTableMatch(control, tag); mask; mask &= mask - 1) {
+                        const std::size_t i = group*HashTableGroupSize + hashTableFirstBit(mask);
+                        if(KeyOf::get(_slots[i]) == key) return i;
+                    }
+
+                    if(hashTableMatch(control, HashTableEmpty)) break;
+                    group = (group + step) & groupMask;
+                }
+            }
+
+            found = false;
+
+            /* Reusing a deleted slot doesn't make the probe sequences any
+               longer, so grow only if an empty slot would be taken */
+            std::size_t i = _capacity ? findFree(hash) : 0;
+            if(!_growthLeft && (!_capacity || _control[i] != HashTableDeleted)) {
+                /* If more than half of the load are deleted slots, it's enough
+                   to rehash to the same capacity to get rid of them */
+                rehash(_size < hashTableMaxLoad(_capacity)/2 ? _capacity : (_capacity ? _capacity*2 : HashTableGroupSize));
+                i = findFree(hash);
+            }
+
+            if(_control[i] == HashTableEmpty) --_growthLeft;
+            _control[i] = tag;
+            ++_size;
+            return i;
+        }
+
+        void removeAt(std::size_t i) {
+            _slots[i].~Slot();
+            --_size;
+
+            /* If the group has an empty slot, no probe sequence could continue
+               past it and the slot can be marked as empty again. Otherwise it
+               has to be marked as deleted to not break probe sequences of
+               keys that were put into subsequent groups. */
+            if(hashTableMatch(_control + (i & ~(HashTableGroupSize - 1)), HashTableEmpty)) {
+                _control[i] = HashTableEmpty;
+                ++_growthLeft;
+            } else _control[i] = HashTableDeleted;
+        }
+
+        void reserve(std::size_t size) {
+            std::size_t capacity = HashTableGroupSize;
+            while(hashTableMaxLoad(capacity) < size) capacity *= 2;
+            if(capacity > _capacity) rehash(capacity);
+        }
+
+        void clear() {
+            destruct();
+            if(_capacity) std::memset(_control, HashTableEmpty, _capacity);
+            _size = 0;
+            _growthLeft = hashTableMaxLoad(_capacity);
+        }
+
+    private:
+        void swap(HashTable<Slot, KeyOf, Hash>& other) {
+            using std::swap;
+            swap(_slots, other._slots);
+            swap(_control, other._control);
+            swap(_size, other._size);
+            swap(_capacity, other._capacity);
+            swap(_growthLeft, other._growthLeft);
+        }
+
+        /* Slots followed by control bytes in a single allocation */
+        void allocate(std::size_t capacity) {
+            char* const data = new char[capacity*(sizeof(Slot) + 1)];
+            _slots = reinterpret_cast<Slot*>(data);
+            _control = reinterpret_cast<signed char*>(data + capacity*sizeof(Slot));
+        }
+
+        void destruct() {
+            for(std::size_t i = 0; i != _capacity; ++i)
+                if(_control[i] >= 0) _slots[i].~Slot();
+        }
+
+        std::size_t findFree(std::size_t hash) const {
+            const std::size_t groupMask = _capacity/HashTableGroupSize - 1;
+            std::size_t group = (hash >> 7) & groupMask;
+            for(std::size_t step = 1; ; ++step) {
+                if(const unsigned mask = hashTableMatchFree(_control + group*HashTableGroupSize))
+                    return group*HashTableGroupSize + hashTableFirstBit(mask);
+                group = (group + step) & groupMask;
+            }
+        }
+
+        void rehash(std::size_t capacity) {
+            Slot* const oldSlots = _slots;
+            signed char* const oldControl = _control;
+            const std::size_t oldCapacity = _capacity;
+
+            allocate(capacity);
+            std::memset(_control, HashTableEmpty, capacity);
+            _capacity = capacity;
+            _growthLeft = hashTableMaxLoad(capacity) - _size;
+
+            for(std::size_t i = 0; i != oldCapacity; ++i) {
+                if(oldControl[i] < 0) continue;
+                const std::size_t hash = Hash{}(KeyOf::get(oldSlots[i]));
+                const std::size_t j = findFree(hash);
+                _control[j] = static_cast<signed char>(hash & 0x7f);
+                new(&_slots[j]) Slot(std::move(oldSlots[i]));
+                oldSlots[i].~Slot();
+            }
+
+            delete[] reinterpret_cast<char*>(oldSlots);
+        }
+
+        Slot* _slots;
+        signed char* _control;
+        std::size_t _size, _capacity, _growthLeft;
+};
+
+template<class Key, class Value> struct HashMapKeyOf;
+
+}
+
+/**
+@brief Hash map entry
+@m_since_latest
+
+Key/value pair stored in a @ref HashMap and returned when iterating it. The
+key is accessible only through a @cpp const @ce reference in order to not
+break the table invariants.
+*/
+template<class Key, class Value> class HashMapEntry {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Used by the @ref HashMap::HashMap(InPlaceInitT, std::initializer_list<HashMapEntry<Key, Value>>)
+         * constructor.
+         */
+        /*implicit*/ HashMapEntry(const Key& key, const Value& value): _key(key), _value(value) {}
+
+        /** @brief Key */
+        const Key& key() const { return _key; }
+
+        /** @brief Value */
+        Value& value() { return _value; }
+        const Value& value() const { return _value; } /**< @overload */
+
+    private:
+        template<class, class, class> friend class HashMap;
+
+        template<class K, class ...Args> explicit HashMapEntry(InPlaceInitT, K&& key, Args&&... args): _key(std::forward<K>(key)), _value{std::forward<Args>(args)...} {}
+
+        Key _key;
+        Value _value;
+};
+
+namespace Implementation {
+    template<class Key, class Value> struct HashMapKeyOf {
+        static const Key& get(const HashMapEntry<Key, Value>& entry) {
+            return entry.key();
+        }
+    };
+}
+
+/**
+@brief Hash map
+@tparam Key     Key type
+@tparam Value   Value type
+@tparam Hash    Hash function object
+@m_since_latest
+
+An unordered key/value map with open addressing. Compared to
+@ref std::unordered_map, all entries are stored in a single contiguous
+allocation instead of each being allocated separately. The slots are split
+into groups of 16, each slot has a one-byte tag with the lowest 7 bits of
+the hash, and a lookup compares the whole group of tags at once using SSE2
+(if @ref CORRADE_TARGET_SSE2 is enabled), checking the keys themselves only
+for slots with a matching tag. At most 7/8 of the slots are used before the
+table grows to twice its size.
+
+@snippet Containers.cpp HashMap-usage
+
+@section Containers-HashMap-heterogeneous Heterogeneous lookup
+
+Lookup functions such as @ref find(), @ref contains() and @ref remove(), as
+well as @ref set() and @ref emplace(), accept any type that @p Hash accepts
+and that's comparable to @p Key. Since the @ref Hash specialization for
+@ref String accepts a @ref StringView, a map keyed by a @ref String can be
+queried with a @ref StringView or a plain C string literal without having to
+allocate a temporary key. A new key is constructed only when an entry gets
+inserted.
+
+@section Containers-HashMap-stability Reference stability
+
+Unlike with @ref std::unordered_map, inserting an entry may cause a rehash,
+which moves the existing entries to a new allocation and invalidates all
+pointers and references to them. Removing an entry doesn't affect pointers
+to other entries. The @p Key and @p Value types are expected to be nothrow
+move-constructible.
+
+@see @ref HashSet
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class Key, class Value, class Hash = Containers::Hash<Key>>
+#else
+template<class Key, class Value, class Hash>
+#endif
+class HashMap {
+    public:
+        typedef Key KeyType;        /**< @brief Key type */
+        typedef Value ValueType;    /**< @brief Value type */
+
+        /** @brief Iterator type */
+        typedef Implementation::HashTableIterator<HashMapEntry<Key, Value>> Iterator;
+
+        /** @brief Const iterator type */
+        typedef Implementation::HashTableIterator<const HashMapEntry<Key, Value>> ConstIterator;
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty map with zero @ref capacity(). Doesn't allocate.
+         */
+        /*implicit*/ HashMap() noexcept = default;
+
+        /**
+         * @brief Construct from an initializer list
+         *
+         * If the list contains duplicate keys, the first occurence is used.
+         */
+        explicit HashMap(InPlaceInitT, std::initializer_list<HashMapEntry<Key, Value>> list) {
+            _table.reserve(list.size());
+            for(const HashMapEntry<Key, Value>& entry: list)
+                emplace(entry.key(), entry.value());
+        }
+
+        /** @brief Entry count */
+        std::size_t size() const { return _table.size(); }
+
+        /** @brief Whether the map is empty */
+        bool isEmpty() const { return !_table.size(); }
+
+        /**
+         * @brief Capacity
+         *
+         * Count of slots, always either zero or a power-of-two multiple of
+         * 16. At most 7/8 of it can be used before the map grows.
+         */
+        std::size_t capacity() const { return _table.capacity(); }
+
+        /**
+         * @brief Reserve capacity for given entry count
+         *
+         * If the map is already large enough, does nothing. Otherwise
+         * rehashes all entries to a new allocation, invalidating all
+         * references to them.
+         */
+        void reserve(std::size_t size) { _table.reserve(size); }
+
+        /**
+         * @brief Clear the map
+         *
+         * Destructs all entries but keeps the allocation for reuse.
+         */
+        void clear() { _table.clear(); }
+
+        /** @brief Iterator to the first entry */
+        Iterator begin() {
+            return Iterator{_table.slots(), _table.control(), _table.control() + _table.capacity()};
+        }
+        /** @overload */
+        ConstIterator begin() const {
+            return ConstIterator{_table.slots(), _table.control(), _table.control() + _table.capacity()};
+        }
+        ConstIterator cbegin() const { return begin(); } /**< @overload */
+
+        /** @brief Iterator to (one item after) the last entry */
+        Iterator end() {
+            return Iterator{_table.slots() + _table.capacity(), _table.control() + _table.capacity(), _table.control() + _table.capacity()};
+        }
+        /** @overload */
+        ConstIterator end() const {
+            return ConstIterator{_table.slots() + _table.capacity(), _table.control() + _table.capacity(), _table.control() + _table.capacity()};
+        }
+        ConstIterator cend() const { return end(); } /**< @overload */
+
+        /**
+         * @brief Find a value
+         *
+         * Returns a pointer to the value corresponding to @p key or
+         * @cpp nullptr @ce if the key isn't present. See
+         * @ref Containers-HashMap-heterogeneous for the types accepted as
+         * @p key.
+         */
+        template<class K> Value* find(const K& key) {
+            const std::size_t i = _table.find(key);
+            return i == Table::NotFound ? nullptr : &_table.slots()[i]._value;
+        }
+        /** @overload */
+        template<class K> const Value* find(const K& key) const {
+            const std::size_t i = _table.find(key);
+            return i == Table::NotFound ? nullptr : &_table.slots()[i]._value;
+        }
+
+        /** @brief Whether the map contains given key */
+        template<class K> bool contains(const K& key) const {
+            return _table.find(key) != Table::NotFound;
+        }
+
+        /**
+         * @brief Insert or replace a value
+         *
+         * If @p key is already present, its value is replaced, otherwise a
+         * new entry is inserted. Returns a reference to the stored value.
+         */
+        template<class K, class V> Value& set(K&& key, V&& value) {
+            bool found;
+            const std::size_t i = _table.findOrPrepareInsert(key, found);
+            HashMapEntry<Key, Value>& entry = _table.slots()[i];
+            if(found) entry._value = std::forward<V>(value);
+            else new(&entry) HashMapEntry<Key, Value>{InPlaceInit, std::forward<K>(key), std::forward<V>(value)};
+            return entry._value;
+        }
+
+        /**
+         * @brief Insert a value if not present
+         *
+         * If @p key isn't present, inserts a new entry with a value
+         * constructed from @p args. Otherwise @p args are ignored. Returns a
+         * reference to the value corresponding to @p key in both cases. Use
+         * @ref contains() if you need to distinguish the two cases.
+         */
+        template<class K, class ...Args> Value& emplace(K&& key, Args&&... args) {
+            bool found;
+            const std::size_t i = _table.findOrPrepareInsert(key, found);
+            HashMapEntry<Key, Value>& entry = _table.slots()[i];
+            if(!found) new(&entry) HashMapEntry<Key, Value>{InPlaceInit, std::forward<K>(key), std::forward<Args>(args)...};
+            return entry._value;
+        }
+
+        /**
+         * @brief Remove an entry
+         *
+         * Returns @cpp true @ce if @p key was present, @cpp false @ce
+         * otherwise. Doesn't shrink the allocation.
+         */
+        template<class K> bool remove(const K& key) {
+            const std::size_t i = _table.find(key);
+            if(i == Table::NotFound) return false;
+            _table.removeAt(i);
+            return true;
+        }
+
+    private:
+        typedef Implementation::HashTable<HashMapEntry<Key, Value>, Implementation::HashMapKeyOf<Key, Value>, Hash> Table;
+
+        Table _table;
+};
+
+}}
+
+#endif
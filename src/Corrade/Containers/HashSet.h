@@ -0,0 +1,184 @@
+#ifndef Corrade_Containers_HashSet_h
+#define Corrade_Containers_HashSet_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::HashSet
+ * @m_since_latest
+ */
+
+#include "Corrade/Containers/HashMap.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    template<class Key> struct HashSetKeyOf {
+        static const Key& get(const Key& key) { return key; }
+    };
+}
+
+/**
+@brief Hash set
+@tparam Key     Key type
+@tparam Hash    Hash function object
+@m_since_latest
+
+An unordered set with open addressing, sharing the implementation with
+@ref HashMap. See its documentation for details about the internal layout,
+@ref Containers-HashMap-heterogeneous "heterogeneous lookup" and
+@ref Containers-HashMap-stability "reference stability".
+
+@snippet Containers.cpp HashSet-usage
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class Key, class Hash = Containers::Hash<Key>>
+#else
+template<class Key, class Hash>
+#endif
+class HashSet {
+    public:
+        typedef Key KeyType;        /**< @brief Key type */
+
+        /**
+         * @brief Iterator type
+         *
+         * The keys are accessible only through a @cpp const @ce reference in
+         * order to not break the table invariants.
+         */
+        typedef Implementation::HashTableIterator<const Key> Iterator;
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty set with zero @ref capacity(). Doesn't allocate.
+         */
+        /*implicit*/ HashSet() noexcept = default;
+
+        /**
+         * @brief Construct from an initializer list
+         *
+         * Duplicate keys are inserted just once.
+         */
+        explicit HashSet(InPlaceInitT, std::initializer_list<Key> list) {
+            _table.reserve(list.size());
+            for(const Key& key: list) insert(key);
+        }
+
+        /** @brief Key count */
+        std::size_t size() const { return _table.size(); }
+
+        /** @brief Whether the set is empty */
+        bool isEmpty() const { return !_table.size(); }
+
+        /**
+         * @brief Capacity
+         *
+         * Count of slots, always either zero or a power-of-two multiple of
+         * 16. At most 7/8 of it can be used before the set grows.
+         */
+        std::size_t capacity() const { return _table.capacity(); }
+
+        /** @copydoc HashMap::reserve() */
+        void reserve(std::size_t size) { _table.reserve(size); }
+
+        /**
+         * @brief Clear the set
+         *
+         * Destructs all keys but keeps the allocation for reuse.
+         */
+        void clear() { _table.clear(); }
+
+        /** @brief Iterator to the first key */
+        Iterator begin() const {
+            return Iterator{_table.slots(), _table.control(), _table.control() + _table.capacity()};
+        }
+        Iterator cbegin() const { return begin(); } /**< @overload */
+
+        /** @brief Iterator to (one item after) the last key */
+        Iterator end() const {
+            return Iterator{_table.slots() + _table.capacity(), _table.control() + _table.capacity(), _table.control() + _table.capacity()};
+        }
+        Iterator cend() const { return end(); } /**< @overload */
+
+        /**
+         * @brief Whether the set contains given key
+         *
+         * See @ref Containers-HashMap-heterogeneous for the types accepted
+         * as @p key.
+         */
+        template<class K> bool contains(const K& key) const {
+            return _table.find(key) != Table::NotFound;
+        }
+
+        /**
+         * @brief Find a key
+         *
+         * Returns a pointer to the stored key equal to @p key or
+         * @cpp nullptr @ce if the key isn't present. Useful for getting the
+         * stored instance when @p key is of a different type. See
+         * @ref Containers-HashMap-heterogeneous for the types accepted as
+         * @p key.
+         */
+        template<class K> const Key* find(const K& key) const {
+            const std::size_t i = _table.find(key);
+            return i == Table::NotFound ? nullptr : &_table.slots()[i];
+        }
+
+        /**
+         * @brief Insert a key
+         *
+         * Returns @cpp true @ce if @p key was inserted, @cpp false @ce if it
+         * was already present.
+         */
+        template<class K> bool insert(K&& key) {
+            bool found;
+            const std::size_t i = _table.findOrPrepareInsert(key, found);
+            if(!found) new(&_table.slots()[i]) Key(std::forward<K>(key));
+            return !found;
+        }
+
+        /**
+         * @brief Remove a key
+         *
+         * Returns @cpp true @ce if @p key was present, @cpp false @ce
+         * otherwise. Doesn't shrink the allocation.
+         */
+        template<class K> bool remove(const K& key) {
+            const std::size_t i = _table.find(key);
+            if(i == Table::NotFound) return false;
+            _table.removeAt(i);
+            return true;
+        }
+
+    private:
+        typedef Implementation::HashTable<Key, Implementation::HashSetKeyOf<Key>, Hash> Table;
+
+        Table _table;
+};
+
+}}
+
+#endif
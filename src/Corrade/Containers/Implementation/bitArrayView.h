@@ -0,0 +1,69 @@
+#ifndef Corrade_Containers_Implementation_bitArrayView_h
+#define Corrade_Containers_Implementation_bitArrayView_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Corrade/Utility/Cpu.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Containers { namespace Implementation {
+
+/* Needs to be exposed like this so we can test all variants, not just the
+   one picked by the dispatcher */
+
+/* Counts set bits in wordCount contiguous 64-bit words */
+typedef std::size_t(*BitArrayCountFunction)(const char* data, std::size_t wordCount);
+
+/* POPCNT is an extension on top of the regular instruction sets, so it can't
+   be picked by a tag. Returns the best variant for given features instead,
+   which is what's used by the dispatcher as well. */
+CORRADE_UTILITY_EXPORT BitArrayCountFunction bitArrayCountImplementation(Utility::Cpu::Features features);
+
+/* Applies an operation to wordCount contiguous 64-bit words of a and b,
+   writing the result to out */
+typedef void(*BitArrayOperationFunction)(const char* a, const char* b, char* out, std::size_t wordCount);
+
+CORRADE_UTILITY_EXPORT BitArrayOperationFunction bitArrayAndImplementation(Utility::Cpu::ScalarT);
+CORRADE_UTILITY_EXPORT BitArrayOperationFunction bitArrayOrImplementation(Utility::Cpu::ScalarT);
+CORRADE_UTILITY_EXPORT BitArrayOperationFunction bitArrayXorImplementation(Utility::Cpu::ScalarT);
+CORRADE_UTILITY_EXPORT BitArrayOperationFunction bitArrayAndNotImplementation(Utility::Cpu::ScalarT);
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_EXPORT BitArrayOperationFunction bitArrayAndImplementation(Utility::Cpu::Sse2T);
+CORRADE_UTILITY_EXPORT BitArrayOperationFunction bitArrayOrImplementation(Utility::Cpu::Sse2T);
+CORRADE_UTILITY_EXPORT BitArrayOperationFunction bitArrayXorImplementation(Utility::Cpu::Sse2T);
+CORRADE_UTILITY_EXPORT BitArrayOperationFunction bitArrayAndNotImplementation(Utility::Cpu::Sse2T);
+#endif
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_UTILITY_EXPORT BitArrayOperationFunction bitArrayAndImplementation(Utility::Cpu::Avx2T);
+CORRADE_UTILITY_EXPORT BitArrayOperationFunction bitArrayOrImplementation(Utility::Cpu::Avx2T);
+CORRADE_UTILITY_EXPORT BitArrayOperationFunction bitArrayXorImplementation(Utility::Cpu::Avx2T);
+CORRADE_UTILITY_EXPORT BitArrayOperationFunction bitArrayAndNotImplementation(Utility::Cpu::Avx2T);
+#endif
+
+}}}
+
+#endif
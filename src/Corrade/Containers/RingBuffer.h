@@ -0,0 +1,284 @@
+#ifndef Corrade_Containers_RingBuffer_h
+#define Corrade_Containers_RingBuffer_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::RingBuffer
+ * @m_since_latest
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/Optional.h"
+#include "Corrade/Containers/constructHelpers.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    /* Storage for a ring buffer item. A union so the item is constructed only
+       when pushed and destructed only when popped, while the surrounding
+       Array can construct and destruct the slots freely. */
+    template<class T> struct RingBufferSlot {
+        /*implicit*/ RingBufferSlot() noexcept {}
+        ~RingBufferSlot() {}
+
+        union {
+            T value;
+        };
+    };
+
+    /* Smallest power of two not less than given size, used by both
+       RingBuffer and ConcurrentQueue */
+    inline std::size_t ringBufferCapacity(std::size_t capacity, std::size_t min) {
+        std::size_t out = min;
+        while(out < capacity) out <<= 1;
+        return out;
+    }
+
+    /* Assumed cache line size. Has to be at least the real size to avoid
+       false sharing, larger only wastes a bit of memory. */
+    enum: std::size_t { RingBufferCacheLineSize = 64 };
+}
+
+/**
+@brief Lock-free single-producer single-consumer ring buffer
+@tparam T   Item type
+@m_since_latest
+
+A bounded FIFO queue for passing items from one producer thread to one
+consumer thread without locking. Storage for all items is allocated once
+upfront in an @ref Array, with the capacity rounded up to a power of two.
+
+The producer index and the consumer index are each on a separate cache line
+and each side additionally keeps a cached copy of the other side's index, so
+the two threads only touch each other's cache line when the cached value
+suggests the buffer is full or empty.
+
+@snippet Containers.cpp RingBuffer-usage
+
+@section Containers-RingBuffer-threads Thread safety
+
+@ref push(), @ref emplace() and @ref push(ArrayView<const T>) can be called
+only from a single producer thread at a time, @ref pop() and
+@ref pop(ArrayView<T>) only from a single consumer thread at a time, but the
+producer and the consumer can run concurrently. @ref size() and
+@ref isEmpty() can be called from anywhere, but the result is only a
+snapshot. For multiple producers or consumers use a @ref ConcurrentQueue
+instead.
+*/
+template<class T> class RingBuffer {
+    public:
+        typedef T Type;     /**< @brief Item type */
+
+        /**
+         * @brief Constructor
+         * @param capacity      Minimal capacity. Rounded up to the nearest
+         *      power of two.
+         */
+        explicit RingBuffer(std::size_t capacity);
+
+        /** @brief Copying is not allowed */
+        RingBuffer(const RingBuffer<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        RingBuffer(RingBuffer<T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Destructs all items that weren't popped.
+         */
+        ~RingBuffer();
+
+        /** @brief Copying is not allowed */
+        RingBuffer<T>& operator=(const RingBuffer<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        RingBuffer<T>& operator=(RingBuffer<T>&&) = delete;
+
+        /** @brief Capacity */
+        std::size_t capacity() const { return _data.size(); }
+
+        /**
+         * @brief Item count
+         *
+         * If called from other threads than the producer and the consumer,
+         * the value may be outdated already when returned.
+         */
+        std::size_t size() const {
+            const std::size_t head = _head.load(std::memory_order_acquire);
+            return _tail.load(std::memory_order_acquire) - head;
+        }
+
+        /**
+         * @brief Whether the buffer is empty
+         *
+         * If called from other threads than the producer and the consumer,
+         * the value may be outdated already when returned.
+         */
+        bool isEmpty() const { return !size(); }
+
+        /**
+         * @brief Push an item
+         *
+         * Returns @cpp false @ce if the buffer is full, @cpp true @ce
+         * otherwise. Producer only.
+         */
+        bool push(const T& value) { return emplace(value); }
+        bool push(T&& value) { return emplace(std::move(value)); } /**< @overload */
+
+        /**
+         * @brief Construct an item in place
+         *
+         * Returns @cpp false @ce if the buffer is full, in which case
+         * nothing is constructed, @cpp true @ce otherwise. Producer only.
+         */
+        template<class ...Args> bool emplace(Args&&... args);
+
+        /**
+         * @brief Push a batch of items
+         *
+         * Copies as many items from @p values as fits into the buffer and
+         * returns their count, which is less than @p values size if the
+         * buffer gets full. The consumer sees the whole batch at once.
+         * Producer only.
+         */
+        std::size_t push(ArrayView<const T> values);
+
+        /**
+         * @brief Pop an item
+         *
+         * Returns @ref NullOpt if the buffer is empty. Consumer only.
+         */
+        Optional<T> pop();
+
+        /**
+         * @brief Pop a batch of items
+         *
+         * Moves as many items as available into @p values and returns their
+         * count, which is less than @p values size if the buffer gets
+         * empty. Consumer only.
+         */
+        std::size_t pop(ArrayView<T> values);
+
+    private:
+        T& at(std::size_t i) { return _data[i & _mask].value; }
+
+        Array<Implementation::RingBufferSlot<T>> _data;
+        std::size_t _mask;
+
+        /* Consumer-owned. The padding before separates it from whatever
+           else the buffer is embedded in. The class itself isn't aligned to
+           a cache line, so each padding is a whole line to guarantee the
+           consumer and producer members never share one regardless of where
+           the object is placed. */
+        char _padding0[Implementation::RingBufferCacheLineSize];
+        std::atomic<std::size_t> _head;
+        std::size_t _cachedTail;
+
+        /* Producer-owned */
+        char _padding1[Implementation::RingBufferCacheLineSize];
+        std::atomic<std::size_t> _tail;
+        std::size_t _cachedHead;
+        char _padding2[Implementation::RingBufferCacheLineSize];
+};
+
+template<class T> RingBuffer<T>::RingBuffer(const std::size_t capacity): _data{ValueInit, Implementation::ringBufferCapacity(capacity, 1)}, _mask{_data.size() - 1}, _head{0}, _cachedTail{0}, _tail{0}, _cachedHead{0} {
+    static_assert(offsetof(RingBuffer<T>, _head) >= offsetof(RingBuffer<T>, _mask) + sizeof(std::size_t) + Implementation::RingBufferCacheLineSize &&
+                  offsetof(RingBuffer<T>, _tail) >= offsetof(RingBuffer<T>, _cachedTail) + sizeof(std::size_t) + Implementation::RingBufferCacheLineSize &&
+                  sizeof(RingBuffer<T>) >= offsetof(RingBuffer<T>, _cachedHead) + sizeof(std::size_t) + Implementation::RingBufferCacheLineSize,
+        "consumer and producer members not on separate cache lines");
+}
+
+template<class T> RingBuffer<T>::~RingBuffer() {
+    const std::size_t tail = _tail.load(std::memory_order_relaxed);
+    for(std::size_t i = _head.load(std::memory_order_relaxed); i != tail; ++i)
+        at(i).~T();
+}
+
+template<class T> template<class ...Args> bool RingBuffer<T>::emplace(Args&&... args) {
+    const std::size_t tail = _tail.load(std::memory_order_relaxed);
+    if(tail - _cachedHead == _data.size()) {
+        _cachedHead = _head.load(std::memory_order_acquire);
+        if(tail - _cachedHead == _data.size()) return false;
+    }
+
+    Implementation::construct(at(tail), std::forward<Args>(args)...);
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template<class T> std::size_t RingBuffer<T>::push(const ArrayView<const T> values) {
+    const std::size_t tail = _tail.load(std::memory_order_relaxed);
+    if(_cachedHead + _data.size() - tail < values.size())
+        _cachedHead = _head.load(std::memory_order_acquire);
+
+    const std::size_t free = _cachedHead + _data.size() - tail;
+    const std::size_t count = values.size() < free ? values.size() : free;
+    for(std::size_t i = 0; i != count; ++i)
+        Implementation::construct(at(tail + i), values[i]);
+
+    _tail.store(tail + count, std::memory_order_release);
+    return count;
+}
+
+template<class T> Optional<T> RingBuffer<T>::pop() {
+    const std::size_t head = _head.load(std::memory_order_relaxed);
+    if(head == _cachedTail) {
+        _cachedTail = _tail.load(std::memory_order_acquire);
+        if(head == _cachedTail) return {};
+    }
+
+    T& value = at(head);
+    Optional<T> out{InPlaceInit, std::move(value)};
+    value.~T();
+    _head.store(head + 1, std::memory_order_release);
+    return out;
+}
+
+template<class T> std::size_t RingBuffer<T>::pop(const ArrayView<T> values) {
+    const std::size_t head = _head.load(std::memory_order_relaxed);
+    if(_cachedTail - head < values.size())
+        _cachedTail = _tail.load(std::memory_order_acquire);
+
+    const std::size_t available = _cachedTail - head;
+    const std::size_t count = values.size() < available ? values.size() : available;
+    for(std::size_t i = 0; i != count; ++i) {
+        T& value = at(head + i);
+        values[i] = std::move(value);
+        value.~T();
+    }
+
+    _head.store(head + count, std::memory_order_release);
+    return count;
+}
+
+}}
+
+#endif
@@ -0,0 +1,724 @@
+#ifndef Corrade_Containers_SmallArray_h
+#define Corrade_Containers_SmallArray_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::SmallArray
+ * @m_since_latest
+ */
+
+#include "Corrade/Containers/GrowableArray.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    template<std::size_t, class> struct SmallArrayAccess;
+}
+
+/**
+@brief Array with inline storage for a small number of elements
+@tparam inlineCapacity_ Count of elements stored inline
+@tparam T               Element type
+@m_since_latest
+
+A growable array that stores up to @p inlineCapacity_ elements directly in the
+instance, similarly to how @ref String stores short strings inline. Only when
+it grows past that it transparently moves its contents to a heap allocation.
+This makes it a good fit for lists that are in the common case short, such as
+dependency lists or connection lists, where a regular @ref Array or
+@ref std::vector would do a heap allocation for each non-empty instance.
+
+The array is growable through the same @ref arrayAppend(), @ref arrayReserve(),
+@ref arrayResize(), @ref arrayRemoveSuffix() and @ref arrayShrink() family of
+functions as @ref Containers-Array-growable "growable arrays", except that
+there's no allocator template parameter:
+
+@snippet Containers.cpp SmallArray-usage
+
+@section Containers-SmallArray-initialization Array initialization
+
+Same as with @ref Array, the array is by default empty and there are
+@ref SmallArray(ValueInitT, std::size_t),
+@ref SmallArray(DefaultInitT, std::size_t), @ref SmallArray(NoInitT, std::size_t),
+@ref SmallArray(DirectInitT, std::size_t, Args&&... args) and
+@ref SmallArray(InPlaceInitT, std::initializer_list<T>) constructors for
+creating an array of given size, placing it inline if it fits
+@p inlineCapacity_.
+
+@section Containers-SmallArray-views Conversion to array views
+
+Arrays are implicitly convertible to @ref ArrayView as described in the
+following table. The conversion is only allowed if @cpp T* @ce is implicitly
+convertible to @cpp U* @ce (or both are the same type) and both have the same
+size. This also extends to other container types constructibe from
+@ref ArrayView, which means for example that a @ref StridedArrayView1D is
+implicitly convertible from @ref SmallArray as well.
+
+Owning array type               | ↭ | Non-owning view type
+------------------------------- | - | ---------------------
+@ref SmallArray "SmallArray<n, T>" | → | @ref ArrayView "ArrayView<U>"
+@ref SmallArray "SmallArray<n, T>" | → | @ref ArrayView "ArrayView<const U>"
+@ref SmallArray "const SmallArray<n, T>" | → | @ref ArrayView "ArrayView<const U>"
+
+@section Containers-SmallArray-moves Copies and moves
+
+Unlike @ref Array, the class is copyable if @p T is copyable. Moving an array
+that's stored on heap is just a pointer swap, but moving an array that's stored
+inline needs to move all elements one by one, invalidating any pointers to
+them. As with growable arrays, @p T is expected to be nothrow
+move-constructible.
+
+@see @ref Array, @ref StaticArray
+*/
+/* Underscore at the end to avoid conflict with member inlineCapacity() */
+template<std::size_t inlineCapacity_, class T> class SmallArray {
+    static_assert(inlineCapacity_, "inline capacity can't be zero");
+
+    public:
+        enum: std::size_t {
+            InlineCapacity = inlineCapacity_    /**< Inline capacity */
+        };
+        typedef T Type;     /**< @brief Element type */
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty array with @ref capacity() equal to
+         * @ref InlineCapacity. Doesn't allocate.
+         */
+        /*implicit*/ SmallArray() noexcept: _data{inlineData()}, _size{0}, _capacity{inlineCapacity_} {}
+
+        /**
+         * @brief Construct a default-initialized array
+         *
+         * Creates an array of given size, the contents are default-initialized
+         * (i.e., builtin types are not initialized). If @p size is not larger
+         * than @ref InlineCapacity, the array is stored inline.
+         * @see @ref DefaultInit, @ref SmallArray(ValueInitT, std::size_t)
+         */
+        explicit SmallArray(DefaultInitT, std::size_t size): SmallArray{NoInit, size} {
+            Implementation::arrayConstruct(DefaultInit, _data, _data + size);
+        }
+
+        /**
+         * @brief Construct a value-initialized array
+         *
+         * Creates an array of given size, the contents are value-initialized
+         * (i.e., builtin types are zero-initialized, default constructor
+         * called otherwise). If @p size is not larger than
+         * @ref InlineCapacity, the array is stored inline.
+         * @see @ref ValueInit, @ref SmallArray(DefaultInitT, std::size_t)
+         */
+        explicit SmallArray(ValueInitT, std::size_t size): SmallArray{NoInit, size} {
+            Implementation::arrayConstruct(ValueInit, _data, _data + size);
+        }
+
+        /**
+         * @brief Construct an array without initializing its contents
+         *
+         * Creates an array of given size, the contents are *not* initialized.
+         * Initialize the values using placement new.
+         * @attention The destructor calls a destructor on *all elements*
+         *      regardless of whether they were properly constructed or not.
+         * @see @ref NoInit, @ref SmallArray(DirectInitT, std::size_t, Args&&... args)
+         */
+        explicit SmallArray(NoInitT, std::size_t size): _data{size > inlineCapacity_ ? allocate(size) : inlineData()}, _size{size}, _capacity{size > inlineCapacity_ ? size : inlineCapacity_} {}
+
+        /**
+         * @brief Construct a direct-initialized array
+         *
+         * Constructs the array using the @ref SmallArray(NoInitT, std::size_t)
+         * constructor and then initializes each element with placement new
+         * using forwarded @p args.
+         */
+        template<class ...Args> explicit SmallArray(DirectInitT, std::size_t size, Args&&... args);
+
+        /**
+         * @brief Construct a list-initialized array
+         *
+         * Constructs the array using the @ref SmallArray(NoInitT, std::size_t)
+         * constructor and then copy-initializes each element with placement
+         * new using values from @p list.
+         */
+        explicit SmallArray(InPlaceInitT, std::initializer_list<T> list);
+
+        /**
+         * @brief Construct a value-initialized array
+         *
+         * Alias to @ref SmallArray(ValueInitT, std::size_t).
+         */
+        explicit SmallArray(std::size_t size): SmallArray{ValueInit, size} {}
+
+        /** @brief Copy constructor */
+        SmallArray(const SmallArray<inlineCapacity_, T>& other);
+
+        /**
+         * @brief Move constructor
+         *
+         * If @p other is stored on heap, the allocation is taken over.
+         * Otherwise its elements are move-constructed one by one. In both
+         * cases @p other is empty afterwards.
+         */
+        SmallArray(SmallArray<inlineCapacity_, T>&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Calls destructors on all elements and frees the heap allocation, if
+         * any.
+         */
+        ~SmallArray();
+
+        /** @brief Copy assignment */
+        SmallArray<inlineCapacity_, T>& operator=(const SmallArray<inlineCapacity_, T>& other);
+
+        /**
+         * @brief Move assignment
+         *
+         * Destroys current contents and then behaves the same as
+         * @ref SmallArray(SmallArray<inlineCapacity_, T>&&).
+         */
+        SmallArray<inlineCapacity_, T>& operator=(SmallArray<inlineCapacity_, T>&& other) noexcept;
+
+        /** @brief Conversion to array type */
+        /*implicit*/ operator T*() & { return _data; }
+
+        /** @overload */
+        /*implicit*/ operator const T*() const & { return _data; }
+
+        /**
+         * @brief Array data
+         *
+         * Never @cpp nullptr @ce --- points either to the inline storage or
+         * to the heap allocation.
+         */
+        T* data() { return _data; }
+        const T* data() const { return _data; }         /**< @overload */
+
+        /** @brief Array size */
+        std::size_t size() const { return _size; }
+
+        /**
+         * @brief Array capacity
+         *
+         * At least @ref InlineCapacity.
+         * @see @ref isSmall(), @ref arrayCapacity(SmallArray<inlineCapacity, T>&)
+         */
+        std::size_t capacity() const { return _capacity; }
+
+        /**
+         * @brief Whether the array is stored inline
+         *
+         * Returns @cpp true @ce if the contents are stored inside the
+         * instance, @cpp false @ce if on heap.
+         */
+        bool isSmall() const { return _data == inlineData(); }
+
+        /** @brief Whether the array is empty */
+        bool empty() const { return !_size; }
+
+        /** @brief Pointer to first element */
+        T* begin() { return _data; }
+        const T* begin() const { return _data; }        /**< @overload */
+        const T* cbegin() const { return _data; }       /**< @overload */
+
+        /** @brief Pointer to (one item after) last element */
+        T* end() { return _data + _size; }
+        const T* end() const { return _data + _size; }  /**< @overload */
+        const T* cend() const { return _data + _size; } /**< @overload */
+
+        /**
+         * @brief First element
+         *
+         * Expects there is at least one element.
+         */
+        T& front();
+        const T& front() const; /**< @overload */
+
+        /**
+         * @brief Last element
+         *
+         * Expects there is at least one element.
+         */
+        T& back();
+        const T& back() const; /**< @overload */
+
+        /**
+         * @brief Reference to array slice
+         *
+         * Equivalent to @ref ArrayView::slice().
+         */
+        ArrayView<T> slice(std::size_t begin, std::size_t end) {
+            return ArrayView<T>{_data, _size}.slice(begin, end);
+        }
+
+        /** @overload */
+        ArrayView<const T> slice(std::size_t begin, std::size_t end) const {
+            return ArrayView<const T>{_data, _size}.slice(begin, end);
+        }
+
+        /**
+         * @brief Array prefix
+         *
+         * Equivalent to @ref ArrayView::prefix().
+         */
+        ArrayView<T> prefix(std::size_t end) {
+            return ArrayView<T>{_data, _size}.prefix(end);
+        }
+
+        /** @overload */
+        ArrayView<const T> prefix(std::size_t end) const {
+            return ArrayView<const T>{_data, _size}.prefix(end);
+        }
+
+        /**
+         * @brief Array suffix
+         *
+         * Equivalent to @ref ArrayView::suffix().
+         */
+        ArrayView<T> suffix(std::size_t begin) {
+            return ArrayView<T>{_data, _size}.suffix(begin);
+        }
+
+        /** @overload */
+        ArrayView<const T> suffix(std::size_t begin) const {
+            return ArrayView<const T>{_data, _size}.suffix(begin);
+        }
+
+        /**
+         * @brief Array prefix except the last @p count items
+         *
+         * Equivalent to @ref ArrayView::except().
+         */
+        ArrayView<T> except(std::size_t count) {
+            return ArrayView<T>{_data, _size}.except(count);
+        }
+
+        /** @overload */
+        ArrayView<const T> except(std::size_t count) const {
+            return ArrayView<const T>{_data, _size}.except(count);
+        }
+
+    private:
+        /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        friend Implementation::SmallArrayAccess<inlineCapacity_, T>;
+        #endif
+
+        static T* allocate(std::size_t capacity) {
+            return reinterpret_cast<T*>(new char[capacity*sizeof(T)]);
+        }
+        static void deallocate(T* data) {
+            delete[] reinterpret_cast<char*>(data);
+        }
+
+        T* inlineData() { return _inline; }
+        const T* inlineData() const { return _inline; }
+
+        /* Move contents of other into this, which is assumed to be empty and
+           inline */
+        void moveFrom(SmallArray<inlineCapacity_, T>& other) noexcept;
+
+        T* _data;
+        std::size_t _size;
+        std::size_t _capacity;
+        union {
+            T _inline[inlineCapacity_];
+        };
+};
+
+/** @relatesalso SmallArray
+@brief Make view on @ref SmallArray
+
+Convenience alternative to converting to an @ref ArrayView explicitly.
+*/
+template<std::size_t inlineCapacity, class T> inline ArrayView<T> arrayView(SmallArray<inlineCapacity, T>& array) {
+    return ArrayView<T>{array.data(), array.size()};
+}
+
+/** @relatesalso SmallArray
+@brief Make view on const @ref SmallArray
+
+Convenience alternative to converting to an @ref ArrayView explicitly.
+*/
+template<std::size_t inlineCapacity, class T> inline ArrayView<const T> arrayView(const SmallArray<inlineCapacity, T>& array) {
+    return ArrayView<const T>{array.data(), array.size()};
+}
+
+/** @relatesalso SmallArray
+@brief Small array size
+
+See @ref arraySize(ArrayView<T>) for more information.
+*/
+template<std::size_t inlineCapacity, class T> std::size_t arraySize(const SmallArray<inlineCapacity, T>& array) {
+    return array.size();
+}
+
+/** @relatesalso SmallArray
+@brief Small array capacity
+
+Same as @ref SmallArray::capacity(), provided for consistency with
+@ref arrayCapacity(Array<T>&).
+*/
+template<std::size_t inlineCapacity, class T> inline std::size_t arrayCapacity(SmallArray<inlineCapacity, T>& array) {
+    return array.capacity();
+}
+
+/** @relatesalso SmallArray
+@brief Reserve given capacity in a small array
+@return New capacity of the array
+
+If @p array capacity is already large enough, the function returns the current
+capacity. Otherwise the contents are moved to a heap allocation of exactly
+@p capacity elements.
+@see @ref arrayReserve(Array<T>&, std::size_t)
+*/
+template<std::size_t inlineCapacity, class T> std::size_t arrayReserve(SmallArray<inlineCapacity, T>& array, std::size_t capacity);
+
+/** @relatesalso SmallArray
+@brief Resize a small array to given size, leaving new elements uninitialized
+
+If @p size is smaller than current size, calls destructors on elements that
+get cut off the end. Otherwise, if current capacity isn't large enough, grows
+the array the same way as @ref arrayAppend(SmallArray<inlineCapacity, T>&, NoInitT, std::size_t)
+and leaves the new elements uninitialized.
+@see @ref arrayResize(Array<T>&, NoInitT, std::size_t)
+*/
+template<std::size_t inlineCapacity, class T> void arrayResize(SmallArray<inlineCapacity, T>& array, NoInitT, std::size_t size);
+
+/** @relatesalso SmallArray
+@brief Resize a small array to given size, default-initializing new elements
+
+Same as @ref arrayResize(SmallArray<inlineCapacity, T>&, NoInitT, std::size_t),
+but new elements are default-initialized.
+@see @ref arrayResize(Array<T>&, DefaultInitT, std::size_t)
+*/
+template<std::size_t inlineCapacity, class T> void arrayResize(SmallArray<inlineCapacity, T>& array, DefaultInitT, std::size_t size) {
+    const std::size_t prevSize = array.size();
+    arrayResize(array, NoInit, size);
+    if(size > prevSize)
+        Implementation::arrayConstruct(DefaultInit, array.data() + prevSize, array.data() + size);
+}
+
+/** @relatesalso SmallArray
+@brief Resize a small array to given size, value-initializing new elements
+
+Same as @ref arrayResize(SmallArray<inlineCapacity, T>&, NoInitT, std::size_t),
+but new elements are value-initialized.
+@see @ref arrayResize(Array<T>&, ValueInitT, std::size_t)
+*/
+template<std::size_t inlineCapacity, class T> void arrayResize(SmallArray<inlineCapacity, T>& array, ValueInitT, std::size_t size) {
+    const std::size_t prevSize = array.size();
+    arrayResize(array, NoInit, size);
+    if(size > prevSize)
+        Implementation::arrayConstruct(ValueInit, array.data() + prevSize, array.data() + size);
+}
+
+/** @relatesalso SmallArray
+@brief Resize a small array to given size, constructing new elements using provided arguments
+
+Same as @ref arrayResize(SmallArray<inlineCapacity, T>&, NoInitT, std::size_t),
+but new elements are constructed using placement-new with provided @p args.
+@see @ref arrayResize(Array<T>&, DirectInitT, std::size_t, Args&&... args)
+*/
+template<std::size_t inlineCapacity, class T, class... Args> void arrayResize(SmallArray<inlineCapacity, T>& array, DirectInitT, std::size_t size, Args&&... args) {
+    const std::size_t prevSize = array.size();
+    arrayResize(array, NoInit, size);
+    for(T *it = array.data() + prevSize, *end = array.data() + size; it < end; ++it)
+        Implementation::construct(*it, std::forward<Args>(args)...);
+}
+
+/** @relatesalso SmallArray
+@brief Resize a small array to given size, value-initializing new elements
+
+Alias to @ref arrayResize(SmallArray<inlineCapacity, T>&, ValueInitT, std::size_t).
+*/
+template<std::size_t inlineCapacity, class T> inline void arrayResize(SmallArray<inlineCapacity, T>& array, std::size_t size) {
+    arrayResize(array, ValueInit, size);
+}
+
+namespace Implementation {
+
+template<std::size_t inlineCapacity, class T> struct SmallArrayAccess {
+    static void reallocate(SmallArray<inlineCapacity, T>& array, const std::size_t capacity) {
+        static_assert(std::is_nothrow_move_constructible<T>::value,
+            "noexcept move-constructible type is required");
+        T* const newData = capacity > inlineCapacity ?
+            SmallArray<inlineCapacity, T>::allocate(capacity) : array.inlineData();
+        if(newData == array._data) return;
+        arrayMoveConstruct<T>(array._data, newData, array._size);
+        arrayDestruct<T>(array._data, array._data + array._size);
+        if(!array.isSmall()) SmallArray<inlineCapacity, T>::deallocate(array._data);
+        array._data = newData;
+        array._capacity = capacity > inlineCapacity ? capacity : inlineCapacity;
+    }
+
+    static T* growBy(SmallArray<inlineCapacity, T>& array, const std::size_t count) {
+        const std::size_t desired = array._size + count;
+        if(desired > array._capacity) {
+            const std::size_t grown = array._capacity*2;
+            reallocate(array, desired > grown ? desired : grown);
+        }
+
+        T* const it = array._data + array._size;
+        array._size = desired;
+        return it;
+    }
+
+    static void shrinkBy(SmallArray<inlineCapacity, T>& array, const std::size_t count) {
+        arrayDestruct<T>(array._data + array._size - count, array._data + array._size);
+        array._size -= count;
+    }
+};
+
+}
+
+/** @relatesalso SmallArray
+@brief Copy-append an item to a small array
+@return Reference to the newly appended item
+
+If there's no space left, the capacity is doubled, moving the contents to heap
+if they were stored inline.
+@see @ref arrayAppend(Array<T>&, const T&)
+*/
+template<std::size_t inlineCapacity, class T> inline T& arrayAppend(SmallArray<inlineCapacity, T>& array, const T& value) {
+    T* const it = Implementation::SmallArrayAccess<inlineCapacity, T>::growBy(array, 1);
+    /* Can't use {}, see the GCC 4.8-specific overload for details */
+    #if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG) &&  __GNUC__ < 5
+    Implementation::construct(*it, value);
+    #else
+    new(it) T{value};
+    #endif
+    return *it;
+}
+
+/** @relatesalso SmallArray
+@brief In-place append an item to a small array
+@return Reference to the newly appended item
+
+Similar to @ref arrayAppend(SmallArray<inlineCapacity, T>&, const T&), except
+that the new item is constructed in-place from @p args.
+@see @ref arrayAppend(Array<T>&, InPlaceInitT, Args&&... args)
+*/
+template<std::size_t inlineCapacity, class T, class... Args> T& arrayAppend(SmallArray<inlineCapacity, T>& array, InPlaceInitT, Args&&... args) {
+    T* const it = Implementation::SmallArrayAccess<inlineCapacity, T>::growBy(array, 1);
+    /* No helper for this as there's no way to call a constructor of an
+       arbitrary type with Implementation::construct */
+    Implementation::construct(*it, std::forward<Args>(args)...);
+    return *it;
+}
+
+/** @relatesalso SmallArray
+@brief Move-append an item to a small array
+@return Reference to the newly appended item
+
+Calls @ref arrayAppend(SmallArray<inlineCapacity, T>&, InPlaceInitT, Args&&... args)
+with @p value.
+*/
+template<std::size_t inlineCapacity, class T> inline T& arrayAppend(SmallArray<inlineCapacity, T>& array, T&& value) {
+    return arrayAppend(array, InPlaceInit, std::move(value));
+}
+
+/** @relatesalso SmallArray
+@brief Copy-append a list of items to a small array
+@return View on the newly appended items
+
+Like @ref arrayAppend(SmallArray<inlineCapacity, T>&, const T&), but
+appending multiple values at once.
+@see @ref arrayAppend(Array<T>&, ArrayView<const T>)
+*/
+template<std::size_t inlineCapacity, class T> ArrayView<T> arrayAppend(SmallArray<inlineCapacity, T>& array, ArrayView<const T> values) {
+    T* const it = Implementation::SmallArrayAccess<inlineCapacity, T>::growBy(array, values.size());
+    Implementation::arrayCopyConstruct<T>(values.data(), it, values.size());
+    return {it, values.size()};
+}
+
+/** @relatesalso SmallArray
+@overload
+*/
+template<std::size_t inlineCapacity, class T> inline ArrayView<T> arrayAppend(SmallArray<inlineCapacity, T>& array, std::initializer_list<T> values) {
+    return arrayAppend(array, arrayView(values));
+}
+
+/** @relatesalso SmallArray
+@brief Append given count of uninitialized values to a small array
+@return View on the newly appended items
+
+A lower-level variant of @ref arrayAppend(SmallArray<inlineCapacity, T>&, ArrayView<const T>)
+where the new values are meant to be initialized in-place after, instead of
+being copied from a pre-existing location.
+@see @ref arrayAppend(Array<T>&, NoInitT, std::size_t)
+*/
+template<std::size_t inlineCapacity, class T> inline ArrayView<T> arrayAppend(SmallArray<inlineCapacity, T>& array, NoInitT, std::size_t count) {
+    return {Implementation::SmallArrayAccess<inlineCapacity, T>::growBy(array, count), count};
+}
+
+/** @relatesalso SmallArray
+@brief Remove given count of items from the end of a small array
+
+Calls destructors on the removed elements, the capacity stays the same.
+Expects that @p count is not larger than the array size.
+@see @ref arrayRemoveSuffix(Array<T>&, std::size_t), @ref arrayShrink()
+*/
+template<std::size_t inlineCapacity, class T> void arrayRemoveSuffix(SmallArray<inlineCapacity, T>& array, std::size_t count = 1);
+
+/** @relatesalso SmallArray
+@brief Convert a small array back to the smallest capacity possible
+
+If the array is stored on heap and its size fits into the inline storage, the
+contents are moved back inline. Otherwise, if the heap allocation is larger
+than needed, the contents are moved to a heap allocation of exactly
+@ref SmallArray::size() elements.
+@see @ref arrayShrink(Array<T>&, NoInitT)
+*/
+template<std::size_t inlineCapacity, class T> void arrayShrink(SmallArray<inlineCapacity, T>& array) {
+    if(array.capacity() != array.size() && !array.isSmall())
+        Implementation::SmallArrayAccess<inlineCapacity, T>::reallocate(array, array.size());
+}
+
+template<std::size_t inlineCapacity_, class T> template<class ...Args> SmallArray<inlineCapacity_, T>::SmallArray(DirectInitT, std::size_t size, Args&&... args): SmallArray{NoInit, size} {
+    for(std::size_t i = 0; i != size; ++i)
+        /* This works around a featurebug in C++ where new T{} doesn't work for
+           an explicit defaulted constructor. Additionally it works around GCC
+           4.8 bugs where copy/move construction can't be done with {} for
+           plain structs. */
+        Implementation::construct(_data[i], std::forward<Args>(args)...);
+}
+
+template<std::size_t inlineCapacity_, class T> SmallArray<inlineCapacity_, T>::SmallArray(InPlaceInitT, std::initializer_list<T> list): SmallArray{NoInit, list.size()} {
+    Implementation::arrayCopyConstruct<T>(list.begin(), _data, list.size());
+}
+
+template<std::size_t inlineCapacity_, class T> SmallArray<inlineCapacity_, T>::SmallArray(const SmallArray<inlineCapacity_, T>& other): SmallArray{NoInit, other._size} {
+    Implementation::arrayCopyConstruct<T>(other._data, _data, other._size);
+}
+
+template<std::size_t inlineCapacity_, class T> SmallArray<inlineCapacity_, T>::SmallArray(SmallArray<inlineCapacity_, T>&& other) noexcept: SmallArray{} {
+    moveFrom(other);
+}
+
+template<std::size_t inlineCapacity_, class T> SmallArray<inlineCapacity_, T>::~SmallArray() {
+    Implementation::arrayDestruct<T>(_data, _data + _size);
+    if(!isSmall()) deallocate(_data);
+}
+
+template<std::size_t inlineCapacity_, class T> SmallArray<inlineCapacity_, T>& SmallArray<inlineCapacity_, T>::operator=(const SmallArray<inlineCapacity_, T>& other) {
+    if(&other != this) *this = SmallArray<inlineCapacity_, T>{other};
+    return *this;
+}
+
+template<std::size_t inlineCapacity_, class T> SmallArray<inlineCapacity_, T>& SmallArray<inlineCapacity_, T>::operator=(SmallArray<inlineCapacity_, T>&& other) noexcept {
+    if(&other == this) return *this;
+    Implementation::arrayDestruct<T>(_data, _data + _size);
+    if(!isSmall()) deallocate(_data);
+    _data = inlineData();
+    _size = 0;
+    _capacity = inlineCapacity_;
+    moveFrom(other);
+    return *this;
+}
+
+template<std::size_t inlineCapacity_, class T> void SmallArray<inlineCapacity_, T>::moveFrom(SmallArray<inlineCapacity_, T>& other) noexcept {
+    /* Heap allocation can be just taken over */
+    if(!other.isSmall()) {
+        _data = other._data;
+        _capacity = other._capacity;
+        other._data = other.inlineData();
+        other._capacity = inlineCapacity_;
+
+    /* Inline data have to be moved one by one */
+    } else {
+        static_assert(std::is_nothrow_move_constructible<T>::value,
+            "noexcept move-constructible type is required");
+        Implementation::arrayMoveConstruct<T>(other._data, _data, other._size);
+        Implementation::arrayDestruct<T>(other._data, other._data + other._size);
+    }
+
+    _size = other._size;
+    other._size = 0;
+}
+
+template<std::size_t inlineCapacity_, class T> const T& SmallArray<inlineCapacity_, T>::front() const {
+    CORRADE_ASSERT(_size, "Containers::SmallArray::front(): array is empty", _data[0]);
+    return _data[0];
+}
+
+template<std::size_t inlineCapacity_, class T> const T& SmallArray<inlineCapacity_, T>::back() const {
+    CORRADE_ASSERT(_size, "Containers::SmallArray::back(): array is empty", _data[_size - 1]);
+    return _data[_size - 1];
+}
+
+template<std::size_t inlineCapacity_, class T> T& SmallArray<inlineCapacity_, T>::front() {
+    return const_cast<T&>(static_cast<const SmallArray<inlineCapacity_, T>&>(*this).front());
+}
+
+template<std::size_t inlineCapacity_, class T> T& SmallArray<inlineCapacity_, T>::back() {
+    return const_cast<T&>(static_cast<const SmallArray<inlineCapacity_, T>&>(*this).back());
+}
+
+template<std::size_t inlineCapacity, class T> std::size_t arrayReserve(SmallArray<inlineCapacity, T>& array, const std::size_t capacity) {
+    if(array.capacity() >= capacity) return array.capacity();
+    Implementation::SmallArrayAccess<inlineCapacity, T>::reallocate(array, capacity);
+    return capacity;
+}
+
+template<std::size_t inlineCapacity, class T> void arrayResize(SmallArray<inlineCapacity, T>& array, NoInitT, const std::size_t size) {
+    if(size <= array.size())
+        Implementation::SmallArrayAccess<inlineCapacity, T>::shrinkBy(array, array.size() - size);
+    else Implementation::SmallArrayAccess<inlineCapacity, T>::growBy(array, size - array.size());
+}
+
+template<std::size_t inlineCapacity, class T> void arrayRemoveSuffix(SmallArray<inlineCapacity, T>& array, const std::size_t count) {
+    CORRADE_ASSERT(count <= array.size(), "Containers::arrayRemoveSuffix(): can't remove" << count << "elements from an array of size" << array.size(), );
+    Implementation::SmallArrayAccess<inlineCapacity, T>::shrinkBy(array, count);
+}
+
+namespace Implementation {
+
+/* SmallArray to ArrayView in order to have implicit conversion for
+   StridedArrayView without needing to introduce a header dependency. The
+   SFINAE needs to be here in order to ensure proper behavior with function
+   overloads taking more than one type of (Strided)ArrayView. */
+template<class U, std::size_t inlineCapacity, class T> struct ArrayViewConverter<U, SmallArray<inlineCapacity, T>> {
+    template<class V = U> constexpr static typename std::enable_if<std::is_convertible<T*, V*>::value, ArrayView<U>>::type from(SmallArray<inlineCapacity, T>& other) {
+        static_assert(sizeof(T) == sizeof(U), "types are not compatible");
+        return {other.data(), other.size()};
+    }
+};
+template<class U, std::size_t inlineCapacity, class T> struct ArrayViewConverter<const U, SmallArray<inlineCapacity, T>> {
+    template<class V = U> constexpr static typename std::enable_if<std::is_convertible<T*, V*>::value, ArrayView<const U>>::type from(const SmallArray<inlineCapacity, T>& other) {
+        static_assert(sizeof(T) == sizeof(U), "types are not compatible");
+        return {other.data(), other.size()};
+    }
+};
+template<std::size_t inlineCapacity, class T> struct ErasedArrayViewConverter<SmallArray<inlineCapacity, T>>: ArrayViewConverter<T, SmallArray<inlineCapacity, T>> {};
+template<std::size_t inlineCapacity, class T> struct ErasedArrayViewConverter<const SmallArray<inlineCapacity, T>>: ArrayViewConverter<const T, SmallArray<inlineCapacity, T>> {};
+
+}
+
+}}
+
+#endif
@@ -0,0 +1,452 @@
+#ifndef Corrade_Containers_StaticStrideArrayView_h
+#define Corrade_Containers_StaticStrideArrayView_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::StaticStrideArrayView
+ * @m_since_latest
+ */
+
+#include "Corrade/Containers/StridedArrayView.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief Array view with a compile-time stride
+@tparam stride  Stride in bytes
+@tparam T       Element type
+@m_since_latest
+
+A variant of @ref StridedArrayView1D where the stride is a template parameter
+instead of being stored at runtime. Element access in loops over the view is
+then just a multiplication of the index by a constant, which allows the
+compiler to unroll and vectorize the loop the same way as for a plain array.
+Useful for example for iterating over interleaved vertex attributes, where the
+vertex layout is known at compile time:
+
+@snippet Containers.cpp StaticStrideArrayView-usage
+
+The view is implicitly convertible from @ref ArrayView, @ref StaticArrayView
+and plain C arrays if @p stride is equal to @cpp sizeof(T) @ce, and explicitly
+convertible from a @ref StridedArrayView1D, in which case it expects that the
+runtime stride matches @p stride. In the other direction it's implicitly
+convertible to a @ref StridedArrayView1D, so it can be passed to all APIs
+taking a runtime-strided view. Both conversions are just a copy of the data
+pointer and size.
+
+Slicing and stride manipulation functions such as @ref slice(),
+@ref prefix(), @ref every() or @ref flipped() are the same as in
+@ref StridedArrayView1D, with the resulting stride being known at compile time
+where possible. Multi-dimensional views are not supported, slice them to
+one-dimensional rows and convert these instead. The @ref Utility::copy()
+function has an overload taking two @ref StaticStrideArrayView instances
+that's inlined and turned into a @ref std::memcpy() if both views are
+contiguous.
+@see @ref StridedArrayView, @ref StridedIterator
+*/
+/* All member functions are const because the view doesn't own the data */
+template<std::ptrdiff_t stride_, class T> class StaticStrideArrayView {
+    public:
+        /**
+         * @brief Underlying type
+         *
+         * Underlying data type. See also @ref ErasedType.
+         */
+        typedef T Type;
+
+        /**
+         * @brief Erased type
+         *
+         * Either @cpp void @ce or @cpp const void @ce based on constness
+         * of @ref Type.
+         */
+        typedef typename std::conditional<std::is_const<T>::value, const void, void>::type ErasedType;
+
+        /** @brief Conversion from `nullptr` */
+        constexpr /*implicit*/ StaticStrideArrayView(std::nullptr_t) noexcept: _data{}, _size{} {}
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty view.
+         */
+        constexpr /*implicit*/ StaticStrideArrayView() noexcept: _data{}, _size{} {}
+
+        /**
+         * @brief Construct a view with explicit size
+         * @param data      Continuous view on the data
+         * @param member    Pointer to the first member of the strided view
+         * @param size      Data size
+         *
+         * The @p data view is used only for a bounds check --- expects that
+         * @p data size is enough for @p size elements of @p stride. Zero
+         * strides can't be reliably checked for out-of-bounds conditions, so
+         * be extra careful when specifying these.
+         * @see @ref StridedArrayView::StridedArrayView(ArrayView<ErasedType>, T*, const Size&, const Stride&)
+         */
+        constexpr /*implicit*/ StaticStrideArrayView(ArrayView<ErasedType> data, T* member, std::size_t size) noexcept: _data{(
+            CORRADE_CONSTEXPR_ASSERT(!size || size*std::size_t(stride_ < 0 ? -stride_ : stride_) <= data.size(),
+                "Containers::StaticStrideArrayView: data size" << data.size() << "is not enough for" << size << "elements of stride" << stride_)
+            #ifdef CORRADE_NO_ASSERT
+            , static_cast<void>(data)
+            #endif
+            , member)}, _size{size} {}
+
+        /**
+         * @brief Construct a view with explicit size
+         *
+         * Equivalent to calling @ref StaticStrideArrayView(ArrayView<ErasedType>, T*, std::size_t)
+         * with @p data as the first parameter and @cpp data.data() @ce as the
+         * second parameter.
+         */
+        constexpr /*implicit*/ StaticStrideArrayView(ArrayView<T> data, std::size_t size) noexcept: StaticStrideArrayView{data, data.data(), size} {}
+
+        /**
+         * @brief Construct a view on a fixed-size array
+         *
+         * Enabled only if @cpp T* @ce is implicitly convertible to @cpp U* @ce
+         * and @p stride is equal to @cpp sizeof(U) @ce.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<class U, std::size_t size>
+        #else
+        template<class U, std::size_t size, class = typename std::enable_if<std::is_convertible<U*, T*>::value && stride_ == std::ptrdiff_t(sizeof(U))>::type>
+        #endif
+        constexpr /*implicit*/ StaticStrideArrayView(U(&data)[size]) noexcept: _data{data}, _size{size} {
+            static_assert(sizeof(T) == sizeof(U), "type sizes are not compatible");
+        }
+
+        /**
+         * @brief Construct a view on @ref ArrayView
+         *
+         * Enabled only if @cpp T* @ce is implicitly convertible to @cpp U* @ce
+         * and @p stride is equal to @cpp sizeof(U) @ce.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<class U>
+        #else
+        template<class U, class = typename std::enable_if<std::is_convertible<U*, T*>::value && stride_ == std::ptrdiff_t(sizeof(U))>::type>
+        #endif
+        constexpr /*implicit*/ StaticStrideArrayView(ArrayView<U> view) noexcept: _data{view.data()}, _size{view.size()} {
+            static_assert(sizeof(T) == sizeof(U), "type sizes are not compatible");
+        }
+
+        /**
+         * @brief Construct a view on @ref StaticArrayView
+         *
+         * Enabled only if @cpp T* @ce is implicitly convertible to @cpp U* @ce
+         * and @p stride is equal to @cpp sizeof(U) @ce.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<std::size_t size, class U>
+        #else
+        template<std::size_t size, class U, class = typename std::enable_if<std::is_convertible<U*, T*>::value && stride_ == std::ptrdiff_t(sizeof(U))>::type>
+        #endif
+        constexpr /*implicit*/ StaticStrideArrayView(StaticArrayView<size, U> view) noexcept: _data{view.data()}, _size{size} {
+            static_assert(sizeof(T) == sizeof(U), "type sizes are not compatible");
+        }
+
+        /**
+         * @brief Construct a view on @ref StaticStrideArrayView
+         *
+         * Enabled only if @cpp T* @ce is implicitly convertible to @cpp U* @ce.
+         * Expects that both types have the same size.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<class U>
+        #else
+        template<class U, class = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+        #endif
+        constexpr /*implicit*/ StaticStrideArrayView(StaticStrideArrayView<stride_, U> view) noexcept: _data{view._data}, _size{view._size} {
+            static_assert(sizeof(T) == sizeof(U), "type sizes are not compatible");
+        }
+
+        /**
+         * @brief Construct a view on @ref StridedArrayView1D
+         *
+         * Enabled only if @cpp T* @ce is implicitly convertible to @cpp U* @ce.
+         * Expects that both types have the same size and that stride of
+         * @p view is equal to @p stride.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<class U>
+        #else
+        template<class U, class = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+        #endif
+        constexpr explicit StaticStrideArrayView(const StridedArrayView1D<U>& view) noexcept: _data{(
+            CORRADE_CONSTEXPR_ASSERT(view.stride() == stride_,
+                "Containers::StaticStrideArrayView: expected stride" << stride_ << "but got" << view.stride()),
+            view.data())}, _size{view.size()}
+        {
+            static_assert(sizeof(T) == sizeof(U), "type sizes are not compatible");
+        }
+
+        /**
+         * @brief Convert to a @ref StridedArrayView1D
+         *
+         * Enabled only if @cpp T* @ce is implicitly convertible to @cpp U* @ce.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<class U>
+        #else
+        template<class U, class = typename std::enable_if<std::is_convertible<T*, U*>::value>::type>
+        #endif
+        constexpr /*implicit*/ operator StridedArrayView1D<U>() const {
+            return StridedArrayView1D<U>{_size, stride_, _data};
+        }
+
+        /** @brief Whether the array is non-empty */
+        constexpr explicit operator bool() const { return _data; }
+
+        /** @brief Array data */
+        constexpr ErasedType* data() const { return _data; }
+
+        /** @brief Array size */
+        constexpr std::size_t size() const { return _size; }
+
+        /**
+         * @brief Array stride
+         *
+         * Always equal to @p stride.
+         */
+        static constexpr std::ptrdiff_t stride() { return stride_; }
+
+        /** @brief Whether the array is empty */
+        constexpr bool empty() const { return !_size; }
+
+        /**
+         * @brief Whether the view is contiguous
+         *
+         * Returns @cpp true @ce if @p stride is equal to @cpp sizeof(T) @ce,
+         * @cpp false @ce otherwise.
+         * @see @ref asContiguous()
+         */
+        static constexpr bool isContiguous() { return stride_ == std::ptrdiff_t(sizeof(T)); }
+
+        /**
+         * @brief Convert the view to a contiguous one
+         *
+         * Enabled only if @p stride is equal to @cpp sizeof(T) @ce.
+         * @see @ref isContiguous()
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        ArrayView<T> asContiguous() const;
+        #else
+        template<class U = T, class = typename std::enable_if<stride_ == std::ptrdiff_t(sizeof(U))>::type> ArrayView<T> asContiguous() const {
+            return {static_cast<T*>(_data), _size};
+        }
+        #endif
+
+        /** @brief Element access */
+        T& operator[](std::size_t i) const;
+
+        /**
+         * @brief Iterator to first element
+         *
+         * The iterator stores the stride at runtime, but as it's initialized
+         * from a constant, the compiler is able to propagate it in typical
+         * range-for loops.
+         * @see @ref front()
+         */
+        StridedIterator<1, T> begin() const { return {_data, _size, stride_, 0}; }
+        /** @overload */
+        StridedIterator<1, T> cbegin() const { return {_data, _size, stride_, 0}; }
+
+        /**
+         * @brief Iterator to (one item after) last element
+         *
+         * @see @ref back()
+         */
+        StridedIterator<1, T> end() const { return {_data, _size, stride_, _size}; }
+        /** @overload */
+        StridedIterator<1, T> cend() const { return {_data, _size, stride_, _size}; }
+
+        /**
+         * @brief First element
+         *
+         * Expects there is at least one element.
+         * @see @ref begin()
+         */
+        T& front() const;
+
+        /**
+         * @brief Last element
+         *
+         * Expects there is at least one element.
+         * @see @ref end()
+         */
+        T& back() const;
+
+        /**
+         * @brief Array slice
+         *
+         * Both arguments are expected to be in range.
+         */
+        StaticStrideArrayView<stride_, T> slice(std::size_t begin, std::size_t end) const;
+
+        /**
+         * @brief Slice to a member
+         *
+         * Returns a view on a particular structure member, with the same
+         * stride. If @p T is @cpp const @ce, the member view is
+         * @cpp const @ce as well.
+         * @see @ref StridedArrayView::slice(U T::*) const
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<class U> StaticStrideArrayView<stride, U> slice(U T::*member) const;
+        #else
+        template<class U, class V = typename std::remove_const<T>::type, class = typename std::enable_if<std::is_class<V>::value || std::is_union<V>::value>::type> StaticStrideArrayView<stride_, typename std::conditional<std::is_const<T>::value, const U, U>::type> slice(U V::*member) const {
+            return StaticStrideArrayView<stride_, typename std::conditional<std::is_const<T>::value, const U, U>::type>{_size, &(static_cast<T*>(_data)->*member)};
+        }
+        #endif
+
+        /**
+         * @brief Array prefix
+         *
+         * Equivalent to @cpp data.slice(0, end) @ce.
+         */
+        StaticStrideArrayView<stride_, T> prefix(std::size_t end) const {
+            return slice(0, end);
+        }
+
+        /**
+         * @brief Array suffix
+         *
+         * Equivalent to @cpp data.slice(begin, data.size()) @ce.
+         */
+        StaticStrideArrayView<stride_, T> suffix(std::size_t begin) const {
+            return slice(begin, _size);
+        }
+
+        /**
+         * @brief Array prefix except the last @p count items
+         *
+         * Equivalent to @cpp data.slice(0, data.size() - count) @ce.
+         */
+        StaticStrideArrayView<stride_, T> except(std::size_t count) const {
+            return slice(0, _size - count);
+        }
+
+        /**
+         * @brief Pick every Nth element
+         *
+         * Multiplies @ref stride() with @p skip and adjusts @ref size()
+         * accordingly. As the result has a compile-time stride as well,
+         * @p skip has to be positive, use @ref flipped() to reverse the
+         * order.
+         * @see @ref every(std::ptrdiff_t) const
+         */
+        template<std::ptrdiff_t skip> StaticStrideArrayView<stride_*skip, T> every() const;
+
+        /**
+         * @brief Pick every Nth element with a runtime step
+         *
+         * Converts the view to a @ref StridedArrayView1D and calls
+         * @ref StridedArrayView::every(std::ptrdiff_t) const on it.
+         */
+        StridedArrayView1D<T> every(std::ptrdiff_t skip) const {
+            return StridedArrayView1D<T>{*this}.every(skip);
+        }
+
+        /**
+         * @brief Flip the view
+         *
+         * Negates the stride and adjusts the data pointer to point to the
+         * last element. This is a non-destructive operation on the view,
+         * flipping it again will go back to the original form.
+         */
+        StaticStrideArrayView<-stride_, T> flipped() const;
+
+        /**
+         * @brief Broadcast the view
+         *
+         * Stretches the initial value to @p size by setting the stride to
+         * @cpp 0 @ce. To avoid destructive operations on the view, the
+         * function expects that the size is 1.
+         */
+        StaticStrideArrayView<0, T> broadcasted(std::size_t size) const;
+
+    private:
+        template<std::ptrdiff_t, class> friend class StaticStrideArrayView;
+
+        typedef typename std::conditional<std::is_const<T>::value, const char, char>::type ArithmeticType;
+
+        /* Internal constructor without size checks for things like slice()
+           etc. Argument order is different to avoid this function getting
+           matched when passing a pointer and a size to the public
+           constructors. */
+        constexpr /*implicit*/ StaticStrideArrayView(std::size_t size, ErasedType* data) noexcept: _data{data}, _size{size} {}
+
+        ErasedType* _data;
+        std::size_t _size;
+};
+
+template<std::ptrdiff_t stride_, class T> inline T& StaticStrideArrayView<stride_, T>::operator[](const std::size_t i) const {
+    CORRADE_ASSERT(i < _size, "Containers::StaticStrideArrayView::operator[](): index" << i << "out of range for" << _size << "elements", *reinterpret_cast<T*>(static_cast<ArithmeticType*>(_data)));
+    return *reinterpret_cast<T*>(static_cast<ArithmeticType*>(_data) + std::ptrdiff_t(i)*stride_);
+}
+
+template<std::ptrdiff_t stride_, class T> inline T& StaticStrideArrayView<stride_, T>::front() const {
+    CORRADE_ASSERT(_size, "Containers::StaticStrideArrayView::front(): view is empty", *reinterpret_cast<T*>(static_cast<ArithmeticType*>(_data)));
+    return *reinterpret_cast<T*>(static_cast<ArithmeticType*>(_data));
+}
+
+template<std::ptrdiff_t stride_, class T> inline T& StaticStrideArrayView<stride_, T>::back() const {
+    CORRADE_ASSERT(_size, "Containers::StaticStrideArrayView::back(): view is empty", *reinterpret_cast<T*>(static_cast<ArithmeticType*>(_data)));
+    return *reinterpret_cast<T*>(static_cast<ArithmeticType*>(_data) + std::ptrdiff_t(_size - 1)*stride_);
+}
+
+template<std::ptrdiff_t stride_, class T> StaticStrideArrayView<stride_, T> StaticStrideArrayView<stride_, T>::slice(const std::size_t begin, const std::size_t end) const {
+    CORRADE_ASSERT(begin <= end && end <= _size,
+        "Containers::StaticStrideArrayView::slice(): slice [" << Utility::Debug::nospace
+        << begin << Utility::Debug::nospace << ":"
+        << Utility::Debug::nospace << end << Utility::Debug::nospace
+        << "] out of range for" << _size << "elements", {});
+    return StaticStrideArrayView<stride_, T>{end - begin, static_cast<ArithmeticType*>(_data) + std::ptrdiff_t(begin)*stride_};
+}
+
+template<std::ptrdiff_t stride_, class T> template<std::ptrdiff_t skip> StaticStrideArrayView<stride_*skip, T> StaticStrideArrayView<stride_, T>::every() const {
+    static_assert(skip > 0, "expected a positive step");
+    /* Taking every 5th element of a 6-element array should result in 2
+       elements */
+    return StaticStrideArrayView<stride_*skip, T>{(_size + skip - 1)/skip, _data};
+}
+
+template<std::ptrdiff_t stride_, class T> StaticStrideArrayView<-stride_, T> StaticStrideArrayView<stride_, T>::flipped() const {
+    /* Same as in StridedArrayView::flipped(), the pointer is adjusted only
+       for non-empty views */
+    return StaticStrideArrayView<-stride_, T>{_size, static_cast<ArithmeticType*>(_data) + (_size ? std::ptrdiff_t(_size - 1)*stride_ : 0)};
+}
+
+template<std::ptrdiff_t stride_, class T> StaticStrideArrayView<0, T> StaticStrideArrayView<stride_, T>::broadcasted(const std::size_t size) const {
+    CORRADE_ASSERT(_size == 1,
+        "Containers::StaticStrideArrayView::broadcasted(): can't broadcast a view with" << _size << "elements", {});
+    return StaticStrideArrayView<0, T>{size, _data};
+}
+
+}}
+
+#endif
@@ -500,6 +500,18 @@ template<unsigned dimensions, class T> class StridedArrayView {
         /** @brief Array data */
         constexpr ErasedType* data() const { return _data; }
 
+        /**
+         * @brief Array data with an alignment hint
+         * @m_since_latest
+         *
+         * Expects that @ref data() is aligned to @p alignment bytes and
+         * returns it annotated for the compiler, see
+         * @ref ArrayView::alignedData() for more information. Only the data
+         * pointer is assumed to be aligned, alignment of elements other than
+         * the first depends on @ref stride().
+         */
+        template<std::size_t alignment> ErasedType* alignedData() const;
+
         /**
          * @brief Array size
          *
@@ -768,6 +780,8 @@ template<unsigned dimensions, class T> class StridedArrayView {
 
     private:
         template<unsigned, class> friend class StridedArrayView;
+        /* Uses the internal constructor in its conversion operator */
+        template<std::ptrdiff_t, class> friend class StaticStrideArrayView;
 
         #ifndef CORRADE_NO_PYTHON_COMPATIBILITY
         /* so Python buffer protocol can point to the size / stride members */
@@ -1695,6 +1709,12 @@ template<unsigned dimensions, class T> inline StridedIterator<dimensions, T> ope
     return it + i;
 }
 
+template<unsigned dimensions, class T> template<std::size_t alignment> auto StridedArrayView<dimensions, T>::alignedData() const -> ErasedType* {
+    CORRADE_ASSERT(!(reinterpret_cast<std::size_t>(_data) & (alignment - 1)),
+        "Containers::StridedArrayView::alignedData(): expected data to be aligned to" << alignment << "bytes but got" << reinterpret_cast<const void*>(_data), {});
+    return Implementation::assumeAligned<alignment>(_data);
+}
+
 template<unsigned dimensions, class T> template<unsigned dimension> bool StridedArrayView<dimensions, T>::isContiguous() const {
     static_assert(dimension < dimensions, "dimension out of bounds");
     std::size_t nextDimensionSize = sizeof(T);
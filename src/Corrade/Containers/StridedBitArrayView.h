@@ -0,0 +1,254 @@
+#ifndef Corrade_Containers_StridedBitArrayView_h
+#define Corrade_Containers_StridedBitArrayView_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::BasicStridedBitArrayView, typedef @ref Corrade::Containers::StridedBitArrayView, @ref Corrade::Containers::MutableStridedBitArrayView
+ * @m_since_latest
+ */
+
+#include "Corrade/Containers/BitArrayView.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief Strided bit array view
+@tparam T   @cpp char @ce or @cpp const char @ce
+@m_since_latest
+
+A variant of @ref BasicBitArrayView where consecutive bits are
+@ref stride() bits apart instead of being adjacent, similarly to how
+@ref StridedArrayView relates to @ref ArrayView. The stride can be negative
+as well, for example to view bits in a reverse order with @ref flipped(),
+or zero to repeat a single bit. Bit @f$ i @f$ of the view is at bit
+position @f$ o + i s @f$ relative to @ref data(), where @f$ o @f$ is
+@ref offset() and @f$ s @f$ is @ref stride().
+
+As the bits aren't contiguous, all operations on the view are done one bit
+at a time. Use a @ref BasicBitArrayView "BitArrayView" for bulk operations.
+
+@snippet Containers.cpp StridedBitArrayView-usage
+
+@see @ref StridedBitArrayView, @ref MutableStridedBitArrayView
+*/
+template<class T> class BasicStridedBitArrayView {
+    static_assert(std::is_same<typename std::remove_const<T>::type, char>::value,
+        "only char and const char is supported");
+
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty @cpp nullptr @ce view.
+         */
+        constexpr /*implicit*/ BasicStridedBitArrayView(std::nullptr_t = nullptr) noexcept: _data{}, _offset{}, _size{}, _stride{} {}
+
+        /**
+         * @brief Construct a view on given memory
+         * @param data      Data pointer
+         * @param offset    Offset of the first bit in the first byte of
+         *      @p data. Expected to be less than 8.
+         * @param size      Size in bits
+         * @param stride    Distance between consecutive bits, in bits
+         */
+        /*implicit*/ BasicStridedBitArrayView(T* data, std::size_t offset, std::size_t size, std::ptrdiff_t stride) noexcept: _data{data}, _offset{offset}, _size{size}, _stride{stride} {
+            CORRADE_ASSERT(offset < 8,
+                "Containers::StridedBitArrayView: offset expected to be smaller than 8 bits, got" << offset, );
+        }
+
+        /**
+         * @brief Construct from a contiguous view
+         *
+         * The stride is set to @cpp 1 @ce.
+         */
+        template<class U, class = typename std::enable_if<std::is_same<U, T>::value || std::is_same<const U, T>::value>::type> /*implicit*/ BasicStridedBitArrayView(BasicBitArrayView<U> view) noexcept: _data{view.data()}, _offset{view.offset()}, _size{view.size()}, _stride{1} {}
+
+        /** @brief Construct a @ref StridedBitArrayView from a @ref MutableStridedBitArrayView */
+        template<class U, class = typename std::enable_if<std::is_same<const U, T>::value>::type> constexpr /*implicit*/ BasicStridedBitArrayView(BasicStridedBitArrayView<U> mutable_) noexcept: _data{mutable_._data}, _offset{mutable_._offset}, _size{mutable_._size}, _stride{mutable_._stride} {}
+
+        /** @brief Data pointer */
+        constexpr T* data() const { return _data; }
+
+        /** @brief Bit offset in the first byte of @ref data() */
+        constexpr std::size_t offset() const { return _offset; }
+
+        /** @brief Size in bits */
+        constexpr std::size_t size() const { return _size; }
+
+        /** @brief Stride in bits */
+        constexpr std::ptrdiff_t stride() const { return _stride; }
+
+        /** @brief Whether the view is empty */
+        constexpr bool isEmpty() const { return !_size; }
+
+        /**
+         * @brief Bit at given position
+         *
+         * No bounds checking is done.
+         */
+        bool operator[](std::size_t i) const {
+            const std::ptrdiff_t bit = position(i);
+            return _data[byte(bit)] & (1 << (bit & 7));
+        }
+
+        /**
+         * @brief Set a bit at given position
+         *
+         * Enabled only on a @ref MutableStridedBitArrayView. No bounds
+         * checking is done.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void set(std::size_t i) const {
+            const std::ptrdiff_t bit = position(i);
+            _data[byte(bit)] |= char(1 << (bit & 7));
+        }
+
+        /**
+         * @brief Reset a bit at given position
+         *
+         * Enabled only on a @ref MutableStridedBitArrayView. No bounds
+         * checking is done.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void reset(std::size_t i) const {
+            const std::ptrdiff_t bit = position(i);
+            _data[byte(bit)] &= char(~(1 << (bit & 7)));
+        }
+
+        /**
+         * @brief Set or reset a bit at given position
+         *
+         * Enabled only on a @ref MutableStridedBitArrayView. No bounds
+         * checking is done.
+         */
+        template<class U = T, class = typename std::enable_if<!std::is_const<U>::value>::type> void set(std::size_t i, bool value) const {
+            const std::ptrdiff_t bit = position(i);
+            T& byteRef = _data[byte(bit)];
+            byteRef = (byteRef & char(~(1 << (bit & 7)))) | char(int(value) << (bit & 7));
+        }
+
+        /** @brief Count of set bits */
+        std::size_t count() const {
+            std::size_t out = 0;
+            for(std::size_t i = 0; i != _size; ++i) out += (*this)[i];
+            return out;
+        }
+
+        /**
+         * @brief Slice the view
+         *
+         * Expects that @p begin is not larger than @p end and @p end is not
+         * larger than @ref size().
+         */
+        BasicStridedBitArrayView<T> slice(std::size_t begin, std::size_t end) const {
+            CORRADE_ASSERT(begin <= end && end <= _size,
+                "Containers::StridedBitArrayView::slice(): slice ["
+                << Utility::Debug::nospace << begin
+                << Utility::Debug::nospace << ":"
+                << Utility::Debug::nospace << end
+                << Utility::Debug::nospace << "] out of range for" << _size
+                << "bits", {});
+            const std::ptrdiff_t bit = position(begin);
+            return BasicStridedBitArrayView<T>{_data + byte(bit), std::size_t(bit & 7), end - begin, _stride};
+        }
+
+        /**
+         * @brief View prefix
+         *
+         * Equivalent to @cpp view.slice(0, end) @ce.
+         */
+        BasicStridedBitArrayView<T> prefix(std::size_t end) const {
+            return slice(0, end);
+        }
+
+        /**
+         * @brief View suffix
+         *
+         * Equivalent to @cpp view.slice(begin, view.size()) @ce.
+         */
+        BasicStridedBitArrayView<T> suffix(std::size_t begin) const {
+            return slice(begin, _size);
+        }
+
+        /**
+         * @brief Pick every Nth bit
+         *
+         * Multiplies the stride by @p step, the size is divided by it,
+         * rounded up. Expects that @p step is non-zero.
+         */
+        BasicStridedBitArrayView<T> every(std::size_t step) const {
+            CORRADE_ASSERT(step,
+                "Containers::StridedBitArrayView::every(): expected a non-zero step", {});
+            return BasicStridedBitArrayView<T>{_data, _offset, (_size + step - 1)/step, _stride*std::ptrdiff_t(step)};
+        }
+
+        /**
+         * @brief Flip the view
+         *
+         * The first bit of the result is the last bit of the original and
+         * the stride is negated.
+         */
+        BasicStridedBitArrayView<T> flipped() const {
+            if(!_size) return *this;
+            const std::ptrdiff_t bit = position(_size - 1);
+            return BasicStridedBitArrayView<T>{_data + byte(bit), std::size_t(bit & 7), _size, -_stride};
+        }
+
+    private:
+        template<class> friend class BasicStridedBitArrayView;
+
+        /* Bit position relative to _data, can be negative for negative
+           strides */
+        std::ptrdiff_t position(std::size_t i) const {
+            return std::ptrdiff_t(_offset) + std::ptrdiff_t(i)*_stride;
+        }
+
+        /* Byte containing given bit position, rounding down also for
+           negative positions. The bit in the byte is then `bit & 7`, which
+           is correct for negative values in two's complement as well. */
+        static std::ptrdiff_t byte(std::ptrdiff_t bit) {
+            return bit >= 0 ? bit/8 : -((-bit + 7)/8);
+        }
+
+        T* _data;
+        std::size_t _offset;
+        std::size_t _size;
+        std::ptrdiff_t _stride;
+};
+
+/**
+@brief Const strided bit array view
+@m_since_latest
+*/
+typedef BasicStridedBitArrayView<const char> StridedBitArrayView;
+
+/**
+@brief Mutable strided bit array view
+@m_since_latest
+*/
+typedef BasicStridedBitArrayView<char> MutableStridedBitArrayView;
+
+}}
+
+#endif
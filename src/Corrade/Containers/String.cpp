@@ -58,6 +58,72 @@ String String::nullTerminatedGlobalView(StringView view) {
     return String{view};
 }
 
+namespace {
+
+/* Appends a view to the output, advancing the pointer. Avoiding memcpy()
+   with a null pointer which is undefined behavior even for zero size. */
+inline void append(char*& out, const StringView string) {
+    if(!string.size()) return;
+    std::memcpy(out, string.data(), string.size());
+    out += string.size();
+}
+
+}
+
+String String::join(const ArrayView<const StringView> strings, const StringView delimiter) {
+    /* Calculate the total size first to allocate just once */
+    std::size_t size = strings.empty() ? 0 : delimiter.size()*(strings.size() - 1);
+    for(const StringView string: strings) size += string.size();
+
+    String out{NoInit, size};
+    char* it = out.data();
+    for(std::size_t i = 0; i != strings.size(); ++i) {
+        if(i) append(it, delimiter);
+        append(it, strings[i]);
+    }
+
+    return out;
+}
+
+String String::join(const std::initializer_list<StringView> strings, const StringView delimiter) {
+    return join(ArrayView<const StringView>{strings.begin(), strings.size()}, delimiter);
+}
+
+String String::joinWithoutEmptyParts(const ArrayView<const StringView> strings, const StringView delimiter) {
+    std::size_t size = 0;
+    std::size_t count = 0;
+    for(const StringView string: strings) {
+        if(string.isEmpty()) continue;
+        size += string.size();
+        ++count;
+    }
+    if(count) size += delimiter.size()*(count - 1);
+
+    String out{NoInit, size};
+    char* it = out.data();
+    bool first = true;
+    for(const StringView string: strings) {
+        if(string.isEmpty()) continue;
+        if(!first) append(it, delimiter);
+        append(it, string);
+        first = false;
+    }
+
+    return out;
+}
+
+String String::joinWithoutEmptyParts(const std::initializer_list<StringView> strings, const StringView delimiter) {
+    return joinWithoutEmptyParts(ArrayView<const StringView>{strings.begin(), strings.size()}, delimiter);
+}
+
+String String::concat(const ArrayView<const StringView> strings) {
+    return join(strings, {});
+}
+
+String String::concat(const std::initializer_list<StringView> strings) {
+    return join(ArrayView<const StringView>{strings.begin(), strings.size()}, {});
+}
+
 inline void String::construct(const char* data, std::size_t size) {
     /* If the size is small enough for SSO, use that. Not using <= because we
        need to store the null terminator as well. */
@@ -149,6 +215,26 @@ String::String(AllocatedInitT, const char* const data, const std::size_t size)
     _large.deleter = nullptr;
 }
 
+String::String(NoInitT, const std::size_t size)
+    #ifdef CORRADE_GRACEFUL_ASSERT
+    /* Zero-init the contents so the destructor doesn't crash if we assert here */
+    : _large{}
+    #endif
+{
+    CORRADE_ASSERT(size < std::size_t{1} << (sizeof(std::size_t)*8 - 2),
+        "Containers::String: string expected to be smaller than 2^" << Utility::Debug::nospace << sizeof(std::size_t)*8 - 2 << "bytes, got" << size, );
+
+    if(size < Implementation::SmallStringSize) {
+        _small.data[size] = '\0';
+        _small.size = size | SmallSize;
+    } else {
+        _large.data = new char[size+1];
+        _large.data[size] = '\0';
+        _large.size = size;
+        _large.deleter = nullptr;
+    }
+}
+
 String::String(char* const data, const std::size_t size, void(*deleter)(char*, std::size_t)) noexcept
     #ifdef CORRADE_GRACEFUL_ASSERT
     /* Zero-init the contents so the destructor doesn't crash if we assert here */
@@ -32,12 +32,14 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
 #include <type_traits>
 #include <utility>
 
 #include "Corrade/Containers/Containers.h"
 #include "Corrade/Containers/StringView.h" /* needs to be included for
                                               comparison operators */
+#include "Corrade/Containers/Tags.h"
 #include "Corrade/Utility/Utility.h"
 #include "Corrade/Utility/visibility.h"
 
@@ -190,6 +192,58 @@ class CORRADE_UTILITY_EXPORT String {
          */
         static String nullTerminatedGlobalView(StringView view);
 
+        /**
+         * @brief Join strings with a delimiter
+         * @m_since_latest
+         *
+         * Calculates the total size first and then copies all @p strings
+         * with @p delimiter between them to a single allocation, or to the
+         * SSO storage if the result is small enough. No temporaries are
+         * created in the process.
+         * @see @ref joinWithoutEmptyParts(), @ref concat(),
+         *      @ref StringBuilder
+         */
+        static String join(ArrayView<const StringView> strings, StringView delimiter);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        static String join(std::initializer_list<StringView> strings, StringView delimiter);
+
+        /**
+         * @brief Join strings with a delimiter, skipping empty parts
+         * @m_since_latest
+         *
+         * Like @ref join(), but empty strings in @p strings are skipped
+         * including their delimiter.
+         */
+        static String joinWithoutEmptyParts(ArrayView<const StringView> strings, StringView delimiter);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        static String joinWithoutEmptyParts(std::initializer_list<StringView> strings, StringView delimiter);
+
+        /**
+         * @brief Concatenate strings
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref join() with an empty delimiter. Compared
+         * to concatenating the strings one by one, the result is allocated
+         * just once:
+         *
+         * @snippet Containers.cpp String-concat
+         */
+        static String concat(ArrayView<const StringView> strings);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        static String concat(std::initializer_list<StringView> strings);
+
         /**
          * @brief Default constructor
          *
@@ -265,6 +319,17 @@ class CORRADE_UTILITY_EXPORT String {
          */
         explicit String(AllocatedInitT, const char* data, std::size_t size);
 
+        /**
+         * @brief Construct a string with uninitialized contents
+         * @m_since_latest
+         *
+         * Only the null terminator is written, the contents are expected to
+         * be filled through @ref data(). If @p size is small enough, the
+         * string is stored inside the class.
+         * @see @ref Containers-String-sso
+         */
+        explicit String(NoInitT, std::size_t size);
+
         /**
          * @brief Take ownership of an external data array
          * @param data      String
@@ -0,0 +1,172 @@
+#ifndef Corrade_Containers_StringBuilder_h
+#define Corrade_Containers_StringBuilder_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::StringBuilder
+ * @m_since_latest
+ */
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/String.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief String builder
+@m_since_latest
+
+Accumulates string pieces into a single @ref Containers-Array-growable "growable"
+memory, growing the capacity geometrically so a loop appending many small
+pieces does only a logarithmic count of reallocations. Calling
+@ref release() then transfers the memory to a @ref String without any copy:
+
+@snippet Containers.cpp StringBuilder-usage
+
+If the count of pieces and their sizes is known upfront, @ref String::join()
+and @ref String::concat() are a better fit, as they allocate just once.
+
+The class is header-only, as growable arrays can't be shared across shared
+library boundaries.
+*/
+class StringBuilder {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty builder with zero @ref capacity(). Doesn't
+         * allocate.
+         */
+        /*implicit*/ StringBuilder() noexcept = default;
+
+        /**
+         * @brief Construct with a preallocated capacity
+         *
+         * Equivalent to default-constructing and calling @ref reserve().
+         */
+        explicit StringBuilder(std::size_t capacity) { reserve(capacity); }
+
+        /** @brief Size of the accumulated string */
+        std::size_t size() const { return _data.size(); }
+
+        /** @brief Whether the accumulated string is empty */
+        bool isEmpty() const { return _data.empty(); }
+
+        /**
+         * @brief Capacity
+         *
+         * One byte is always reserved for the null terminator added in
+         * @ref release(), so this is the count of bytes that can be appended
+         * without a reallocation.
+         */
+        std::size_t capacity() const {
+            /* arrayCapacity() takes a mutable reference but doesn't modify
+               anything */
+            const std::size_t capacity = arrayCapacity(const_cast<Array<char>&>(_data));
+            return capacity ? capacity - 1 : 0;
+        }
+
+        /**
+         * @brief View on the accumulated string
+         *
+         * The view is not null-terminated and gets invalidated by the next
+         * append.
+         */
+        StringView view() const { return {_data.data(), _data.size()}; }
+
+        /**
+         * @brief Reserve capacity
+         *
+         * If the @ref capacity() is already large enough, does nothing.
+         */
+        StringBuilder& reserve(std::size_t capacity) {
+            arrayReserve(_data, capacity + 1);
+            return *this;
+        }
+
+        /**
+         * @brief Append a string
+         * @return Reference to self (for method chaining)
+         */
+        StringBuilder& append(StringView string) {
+            arrayAppend(_data, ArrayView<const char>{string.data(), string.size()});
+            return *this;
+        }
+
+        /**
+         * @brief Append a character
+         * @return Reference to self (for method chaining)
+         */
+        StringBuilder& append(char character) {
+            arrayAppend(_data, character);
+            return *this;
+        }
+
+        /**
+         * @brief Clear the accumulated string
+         *
+         * Keeps the allocation for reuse.
+         */
+        StringBuilder& clear() {
+            arrayResize(_data, NoInit, 0);
+            return *this;
+        }
+
+        /**
+         * @brief Release the accumulated string
+         *
+         * Transfers the memory to a @ref String without copying it, unless
+         * the string is small enough for @ref Containers-String-sso "SSO",
+         * in which case it's copied and the memory is kept for reuse. The
+         * builder is empty afterwards.
+         */
+        String release();
+
+    private:
+        Array<char> _data;
+};
+
+inline String StringBuilder::release() {
+    /* Small strings get copied into the SSO storage, the builder keeps the
+       memory for a potential next use */
+    if(_data.size() < Implementation::SmallStringSize) {
+        String out{_data.data(), _data.size()};
+        clear();
+        return out;
+    }
+
+    /* Otherwise null-terminate and transfer the ownership. The size passed
+       to the deleter by the String is one byte less than the actual memory
+       size, which doesn't matter for the growable array deleter. */
+    arrayAppend(_data, '\0');
+    const std::size_t size = _data.size() - 1;
+    const String::Deleter deleter = _data.deleter();
+    return String{_data.release(), size, deleter};
+}
+
+}}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "StringPool.h"
+
+#include <cstring>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/HashSet.h"
+
+namespace Corrade { namespace Containers {
+
+struct StringPool::State {
+    explicit State(std::size_t chunkSize): chunkSize{chunkSize} {}
+
+    /* Views on the chunk memory. The chunks are never reallocated, so the
+       views stay valid even if the chunks array itself grows. */
+    HashSet<StringView> strings;
+    Array<Array<char>> chunks;
+    char* ptr{};
+    char* end{};
+    std::size_t chunkSize;
+};
+
+StringPool::StringPool(const std::size_t chunkSize): _state{InPlaceInit, chunkSize} {}
+
+StringPool::StringPool(StringPool&&) noexcept = default;
+
+StringPool::~StringPool() = default;
+
+StringPool& StringPool::operator=(StringPool&&) noexcept = default;
+
+std::size_t StringPool::chunkSize() const { return _state->chunkSize; }
+
+std::size_t StringPool::count() const { return _state->strings.size(); }
+
+StringView StringPool::intern(const StringView string) {
+    if(const StringView* found = _state->strings.find(string))
+        return *found;
+
+    /* Copy the string including a null terminator. If it doesn't fit into
+       the current chunk, allocate a new one. Strings larger than the chunk
+       size get a dedicated chunk and the current one stays current. */
+    const std::size_t size = string.size() + 1;
+    char* out;
+    if(std::size_t(_state->end - _state->ptr) >= size) {
+        out = _state->ptr;
+        _state->ptr += size;
+    } else if(size > _state->chunkSize) {
+        out = arrayAppend(_state->chunks, Array<char>{NoInit, size}).data();
+    } else {
+        out = arrayAppend(_state->chunks, Array<char>{NoInit, _state->chunkSize}).data();
+        _state->ptr = out + size;
+        _state->end = out + _state->chunkSize;
+    }
+
+    /* The source view can be null if it's empty */
+    if(string.size()) std::memcpy(out, string.data(), string.size());
+    out[string.size()] = '\0';
+
+    const StringView interned{out, string.size(), StringViewFlag::Global|StringViewFlag::NullTerminated};
+    _state->strings.insert(interned);
+    return interned;
+}
+
+StringView StringPool::find(const StringView string) const {
+    const StringView* found = _state->strings.find(string);
+    return found ? *found : nullptr;
+}
+
+}}
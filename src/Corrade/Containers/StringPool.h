@@ -0,0 +1,134 @@
+#ifndef Corrade_Containers_StringPool_h
+#define Corrade_Containers_StringPool_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::StringPool
+ * @m_since_latest
+ */
+
+#include "Corrade/Containers/Pointer.h"
+#include "Corrade/Containers/StringView.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief String interning pool
+@m_since_latest
+
+Deduplicates strings by copying each distinct string just once into large
+memory chunks owned by the pool. The views returned from @ref intern() have
+both @ref StringViewFlag::Global and @ref StringViewFlag::NullTerminated set,
+so passing them to @ref String::nullTerminatedGlobalView() or to any API that
+takes a @ref StringView and stores it doesn't make a copy:
+
+@snippet Containers.cpp StringPool-usage
+
+Because every distinct string is stored just once, two views returned from
+the same pool are equal exactly when their @ref StringView::data() pointers
+are equal, which is considerably cheaper than comparing the contents.
+
+@attention The views are marked as global but they're valid only for as long
+    as the pool exists. The pool is expected to outlive all views and
+    @ref String instances created from them --- in practice it's meant to be
+    a long-lived, usually application-wide, instance.
+
+Strings longer than @ref chunkSize() get a dedicated allocation, the rest is
+packed one after another including the null terminator. Apart from that the
+class isn't thread-safe, so one instance shouldn't be used from multiple
+threads at the same time without external synchronization.
+*/
+class CORRADE_UTILITY_EXPORT StringPool {
+    public:
+        /**
+         * @brief Constructor
+         * @param chunkSize     Size of each memory chunk in bytes
+         *
+         * No memory is allocated until the first call to @ref intern().
+         */
+        explicit StringPool(std::size_t chunkSize = 4096);
+
+        /** @brief Copying is not allowed */
+        StringPool(const StringPool&) = delete;
+
+        /**
+         * @brief Move constructor
+         *
+         * The string data stay at the same place, so views returned from
+         * @p other stay valid.
+         */
+        StringPool(StringPool&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all chunks, invalidating all views returned from
+         * @ref intern().
+         */
+        ~StringPool();
+
+        /** @brief Copying is not allowed */
+        StringPool& operator=(const StringPool&) = delete;
+
+        /** @brief Move assignment */
+        StringPool& operator=(StringPool&&) noexcept;
+
+        /** @brief Chunk size */
+        std::size_t chunkSize() const;
+
+        /** @brief Count of distinct strings in the pool */
+        std::size_t count() const;
+
+        /**
+         * @brief Intern a string
+         *
+         * If a string equal to @p string is already in the pool, returns a
+         * view on it, otherwise copies @p string to the pool first. The
+         * returned view has @ref StringViewFlag::Global and
+         * @ref StringViewFlag::NullTerminated set.
+         */
+        StringView intern(StringView string);
+
+        /**
+         * @brief Find an interned string
+         *
+         * If a string equal to @p string is in the pool, returns a view on
+         * it, with @ref StringViewFlag::Global and
+         * @ref StringViewFlag::NullTerminated set. Otherwise returns a
+         * @cpp nullptr @ce view. Unlike @ref intern() doesn't modify the
+         * pool.
+         */
+        StringView find(StringView string) const;
+
+    private:
+        struct State;
+        Pointer<State> _state;
+};
+
+}}
+
+#endif
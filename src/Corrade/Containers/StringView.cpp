@@ -26,9 +26,23 @@
 #include "StringView.h"
 #include "StringStl.h"
 
+#include <cstdint>
 #include <cstring>
 #include <string>
 
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef CORRADE_TARGET_SSSE3
+#include <tmmintrin.h>
+#endif
+#ifdef CORRADE_TARGET_AVX2
+#include <immintrin.h>
+#endif
+#if defined(CORRADE_TARGET_SSE2) && defined(CORRADE_TARGET_MSVC) && !defined(CORRADE_TARGET_GCC)
+#include <intrin.h>
+#endif
+
 #include "Corrade/Containers/Array.h"
 #include "Corrade/Containers/ArrayView.h"
 #include "Corrade/Containers/GrowableArray.h"
@@ -109,48 +123,184 @@ template<class T> Array<BasicStringView<T>> BasicStringView<T>::splitWithoutEmpt
 
 namespace {
 
+#ifdef CORRADE_TARGET_SSE2
+/* Position of the lowest / highest set bit in a movemask result. The mask is
+   never zero when these are called. */
+inline int firstSetBit(std::uint32_t mask) {
+    #ifdef CORRADE_TARGET_GCC
+    return __builtin_ctz(mask);
+    #else
+    unsigned long bit;
+    _BitScanForward(&bit, mask);
+    return int(bit);
+    #endif
+}
+
+inline int lastSetBit(std::uint32_t mask) {
+    #ifdef CORRADE_TARGET_GCC
+    return 31 - __builtin_clz(mask);
+    #else
+    unsigned long bit;
+    _BitScanReverse(&bit, mask);
+    return int(bit);
+    #endif
+}
+#endif
+
 /* I don't want to include <algorithm> just for std::find_first_of() and
    unfortunately there's no equivalent in the C string library. Coming close
    are strpbrk() or strcspn() but both of them work with null-terminated
-   strings, which is absolutely useless here, not to mention that both do
-   *exactly* the same thing, with one returning a pointer but the other an
-   offset, so what's the point of having both? What the hell. And there's no
-   memcspn() or whatever which would take explicit lengths. Which means I'm
-   left to my own devices. Looking at how strpbrk() / strcspn() is done, it
-   ranges from trivial code:
+   strings, which is absolutely useless here, and neither has a variant taking
+   an explicit length. The original implementation did a memchr() over the
+   character set for every byte of the input, which is O(n·k) and was the
+   hottest part of tokenizers splitting large files on whitespace.
+
+   Instead, the character set is converted to a 256-bit membership table
+   upfront, making the scalar lookup O(1) per byte. The table is laid out in a
+   way that makes it possible to use it directly in a nibble lookup with
+   pshufb, as described in http://0x80.pl/articles/simd-byte-lookup.html ---
+   for a byte c, bit (c >> 4) & 0x07 of table[(c >> 7)*16 + (c & 0x0f)] is
+   set if c is in the set. With SSSE3 and AVX2, 16 or 32 bytes get classified
+   in a handful of instructions, independently of the set size. */
+using Implementation::StringCharacterSet;
+
+StringCharacterSet characterSet(const char* const characters, const std::size_t count) {
+    StringCharacterSet out{};
+    for(std::size_t i = 0; i != count; ++i) {
+        const std::uint8_t c = characters[i];
+        out.table[(c >> 7)*16 + (c & 0x0f)] |= 1 << ((c >> 4) & 0x07);
+    }
+    return out;
+}
+
+inline bool characterSetContains(const StringCharacterSet& set, const char character) {
+    const std::uint8_t c = character;
+    return set.table[(c >> 7)*16 + (c & 0x0f)] & (1 << ((c >> 4) & 0x07));
+}
+
+#ifdef CORRADE_TARGET_SSSE3
+/* Returns a 16-bit mask with bits set for bytes of the block that are in the
+   set. The pshufb instruction uses only the low nibble and the top bit of
+   each index, producing zero if the top bit is set. Thus indexing the lower
+   half of the table with the block itself looks up characters < 128 and
+   indexing the upper half with the top bit flipped looks up the rest. */
+inline std::uint32_t characterSetMatch(const __m128i lower, const __m128i upper, const __m128i block) {
+    const __m128i bitLookup = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i rows = _mm_or_si128(
+        _mm_shuffle_epi8(lower, block),
+        _mm_shuffle_epi8(upper, _mm_xor_si128(block, _mm_set1_epi8(-128))));
+    const __m128i bits = _mm_shuffle_epi8(bitLookup,
+        _mm_and_si128(_mm_srli_epi16(block, 4), _mm_set1_epi8(0x0f)));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(rows, bits), bits));
+}
+#endif
 
-    https://github.com/bminor/newlib/blob/6497fdfaf41d47e835fdefc78ecb0a934875d7cf/newlib/libc/string/strcspn.c
+#ifdef CORRADE_TARGET_AVX2
+/* Same as above, just with the tables broadcast to both 128-bit lanes as
+   vpshufb doesn't cross them */
+inline std::uint32_t characterSetMatch(const __m256i lower, const __m256i upper, const __m256i block) {
+    const __m256i bitLookup = _mm256_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+        1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m256i rows = _mm256_or_si256(
+        _mm256_shuffle_epi8(lower, block),
+        _mm256_shuffle_epi8(upper, _mm256_xor_si256(block, _mm256_set1_epi8(-128))));
+    const __m256i bits = _mm256_shuffle_epi8(bitLookup,
+        _mm256_and_si256(_mm256_srli_epi16(block, 4), _mm256_set1_epi8(0x0f)));
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(rows, bits), bits));
+}
+#endif
 
-   to extremely optimized machine-specific code (don't look, it's GPL):
+/* Finds the first character that is (or, if inSet is false, isn't) in the
+   set. Returns nullptr if there's no such character. */
+const char* findCharacterSet(const char* const data, const std::size_t size, const StringCharacterSet& set, const bool inSet) {
+    const char* i = data;
+    const char* const end = data + size;
+
+    #ifdef CORRADE_TARGET_AVX2
+    {
+        const __m256i lower = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.table)));
+        const __m256i upper = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.table + 16)));
+        const std::uint32_t flip = inSet ? 0 : 0xffffffffu;
+        for(; end - i >= 32; i += 32) {
+            const std::uint32_t mask = characterSetMatch(lower, upper, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(i)))^flip;
+            if(mask) return i + firstSetBit(mask);
+        }
+    }
+    #endif
 
-    https://github.com/bminor/glibc/blob/43b1048ab9418e902aac8c834a7a9a88c501620a/sysdeps/x86_64/multiarch/strcspn-c.c
+    #ifdef CORRADE_TARGET_SSSE3
+    {
+        const __m128i lower = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.table));
+        const __m128i upper = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.table + 16));
+        const std::uint32_t flip = inSet ? 0 : 0xffffu;
+        for(; end - i >= 16; i += 16) {
+            const std::uint32_t mask = characterSetMatch(lower, upper, _mm_loadu_si128(reinterpret_cast<const __m128i*>(i)))^flip;
+            if(mask) return i + firstSetBit(mask);
+        }
+    }
+    #endif
 
-   and the only trick I realized above the nested loop is using memchr() in an
-   inverse way. In all honesty, I think that'll still be *at least* as fast as
-   std::find_first_of() because I doubt STL implementations explicitly optimize
-   for that case. Yes, std::string::find_first_of() probably would have that,
-   but I'd first need to allocate to make use of that and FUCK NO. */
-inline const char* findFirstOf(const char* begin, const char* const end, const char* const characters, std::size_t characterCount) {
-    for(; begin != end; ++begin)
-        if(std::memchr(characters, *begin, characterCount)) return begin;
-    return end;
+    for(; i != end; ++i)
+        if(characterSetContains(set, *i) == inSet) return i;
+
+    return nullptr;
+}
+
+/* Finds the last character that is (or, if inSet is false, isn't) in the
+   set. Returns nullptr if there's no such character. */
+const char* findLastCharacterSet(const char* const data, const std::size_t size, const StringCharacterSet& set, const bool inSet) {
+    const char* i = data + size;
+
+    #ifdef CORRADE_TARGET_AVX2
+    {
+        const __m256i lower = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.table)));
+        const __m256i upper = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.table + 16)));
+        const std::uint32_t flip = inSet ? 0 : 0xffffffffu;
+        for(; i - data >= 32; i -= 32) {
+            const std::uint32_t mask = characterSetMatch(lower, upper, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(i - 32)))^flip;
+            if(mask) return i - 32 + lastSetBit(mask);
+        }
+    }
+    #endif
+
+    #ifdef CORRADE_TARGET_SSSE3
+    {
+        const __m128i lower = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.table));
+        const __m128i upper = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.table + 16));
+        const std::uint32_t flip = inSet ? 0 : 0xffffu;
+        for(; i - data >= 16; i -= 16) {
+            const std::uint32_t mask = characterSetMatch(lower, upper, _mm_loadu_si128(reinterpret_cast<const __m128i*>(i - 16)))^flip;
+            if(mask) return i - 16 + lastSetBit(mask);
+        }
+    }
+    #endif
+
+    while(i != data)
+        if(characterSetContains(set, *--i) == inSet) return i;
+
+    return nullptr;
 }
 
 }
 
 template<class T> Array<BasicStringView<T>> BasicStringView<T>::splitWithoutEmptyParts(const Containers::StringView delimiters) const {
     Array<BasicStringView<T>> parts;
-    const char* const characters = delimiters.begin();
-    const std::size_t characterCount = delimiters.size();
+    const StringCharacterSet set = characterSet(delimiters._data, delimiters.size());
     T* const end = this->end();
     T* oldpos = _data;
 
     while(oldpos < end) {
-        T* const pos = const_cast<T*>(findFirstOf(oldpos, end, characters, characterCount));
-        if(pos != oldpos)
-            arrayAppend(parts, slice(oldpos, pos));
+        /* Skip all delimiters at once, then find where the part ends */
+        const char* const begin = findCharacterSet(oldpos, end - oldpos, set, false);
+        if(!begin) break;
 
-        oldpos = pos + 1;
+        T* const partBegin = oldpos + (begin - oldpos);
+        const char* const pos = findCharacterSet(begin, end - partBegin, set, true);
+        T* const partEnd = pos ? oldpos + (pos - oldpos) : end;
+        arrayAppend(parts, slice(partBegin, partEnd));
+
+        oldpos = partEnd;
     }
 
     return parts;
@@ -225,6 +375,321 @@ template<class T> BasicStringView<T> BasicStringView<T>::stripSuffix(const Strin
     return prefix(size() - suffix.size());
 }
 
+namespace {
+
+/* The SIMD variants below are the "generic SIMD" substring search described
+   at http://0x80.pl/articles/simd-strfind.html -- the first and the last
+   character of the substring are compared against a whole block of candidate
+   positions at once, and only positions where both match are verified with a
+   memcmp(). For typical text that filters out nearly all candidates, so the
+   search runs at close to memory bandwidth. All functions expect that
+   substringSize is at least 2 and not larger than size. */
+const char* findStringForward(const char* const data, const std::size_t size, const char* const substring, const std::size_t substringSize) {
+    /* One item after the last position the substring can start at. The
+       "last character" block loads read substringSize - 1 bytes after the
+       candidate block, which is still in bounds as long as the candidate
+       block ends before this. */
+    const char* const end = data + size - substringSize + 1;
+    const char* i = data;
+
+    #ifdef CORRADE_TARGET_AVX2
+    {
+        const __m256i first = _mm256_set1_epi8(substring[0]);
+        const __m256i last = _mm256_set1_epi8(substring[substringSize - 1]);
+        for(; end - i >= 32; i += 32) {
+            const __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(i));
+            const __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(i + substringSize - 1));
+            std::uint32_t mask = _mm256_movemask_epi8(_mm256_and_si256(
+                _mm256_cmpeq_epi8(first, blockFirst),
+                _mm256_cmpeq_epi8(last, blockLast)));
+            for(; mask; mask &= mask - 1) {
+                const char* const candidate = i + firstSetBit(mask);
+                if(std::memcmp(candidate + 1, substring + 1, substringSize - 2) == 0)
+                    return candidate;
+            }
+        }
+    }
+    #endif
+
+    #ifdef CORRADE_TARGET_SSE2
+    {
+        const __m128i first = _mm_set1_epi8(substring[0]);
+        const __m128i last = _mm_set1_epi8(substring[substringSize - 1]);
+        for(; end - i >= 16; i += 16) {
+            const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(i));
+            const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(i + substringSize - 1));
+            std::uint32_t mask = _mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(first, blockFirst),
+                _mm_cmpeq_epi8(last, blockLast)));
+            for(; mask; mask &= mask - 1) {
+                const char* const candidate = i + firstSetBit(mask);
+                if(std::memcmp(candidate + 1, substring + 1, substringSize - 2) == 0)
+                    return candidate;
+            }
+        }
+    }
+    #endif
+
+    /* Scalar fallback, also handling the remainder that didn't fit into a
+       full block */
+    const char first = substring[0];
+    const char last = substring[substringSize - 1];
+    for(; i != end; ++i)
+        if(*i == first && i[substringSize - 1] == last && std::memcmp(i + 1, substring + 1, substringSize - 2) == 0)
+            return i;
+
+    return nullptr;
+}
+
+const char* findStringBackward(const char* const data, const std::size_t size, const char* const substring, const std::size_t substringSize) {
+    /* One item after the last position the substring can start at, going
+       backwards from there */
+    const char* i = data + size - substringSize + 1;
+
+    #ifdef CORRADE_TARGET_AVX2
+    {
+        const __m256i first = _mm256_set1_epi8(substring[0]);
+        const __m256i last = _mm256_set1_epi8(substring[substringSize - 1]);
+        for(; i - data >= 32; i -= 32) {
+            const char* const block = i - 32;
+            const __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+            const __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + substringSize - 1));
+            std::uint32_t mask = _mm256_movemask_epi8(_mm256_and_si256(
+                _mm256_cmpeq_epi8(first, blockFirst),
+                _mm256_cmpeq_epi8(last, blockLast)));
+            while(mask) {
+                const int bit = lastSetBit(mask);
+                const char* const candidate = block + bit;
+                if(std::memcmp(candidate + 1, substring + 1, substringSize - 2) == 0)
+                    return candidate;
+                mask &= ~(std::uint32_t{1} << bit);
+            }
+        }
+    }
+    #endif
+
+    #ifdef CORRADE_TARGET_SSE2
+    {
+        const __m128i first = _mm_set1_epi8(substring[0]);
+        const __m128i last = _mm_set1_epi8(substring[substringSize - 1]);
+        for(; i - data >= 16; i -= 16) {
+            const char* const block = i - 16;
+            const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+            const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + substringSize - 1));
+            std::uint32_t mask = _mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(first, blockFirst),
+                _mm_cmpeq_epi8(last, blockLast)));
+            while(mask) {
+                const int bit = lastSetBit(mask);
+                const char* const candidate = block + bit;
+                if(std::memcmp(candidate + 1, substring + 1, substringSize - 2) == 0)
+                    return candidate;
+                mask &= ~(std::uint32_t{1} << bit);
+            }
+        }
+    }
+    #endif
+
+    const char first = substring[0];
+    const char last = substring[substringSize - 1];
+    while(i != data) {
+        --i;
+        if(*i == first && i[substringSize - 1] == last && std::memcmp(i + 1, substring + 1, substringSize - 2) == 0)
+            return i;
+    }
+
+    return nullptr;
+}
+
+/* There's memrchr() on glibc but it's a GNU extension, not available
+   elsewhere */
+const char* findCharacterBackward(const char* const data, const std::size_t size, const char character) {
+    const char* i = data + size;
+
+    #ifdef CORRADE_TARGET_SSE2
+    {
+        const __m128i needle = _mm_set1_epi8(character);
+        for(; i - data >= 16; i -= 16) {
+            const std::uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(needle, _mm_loadu_si128(reinterpret_cast<const __m128i*>(i - 16))));
+            if(mask) return i - 16 + lastSetBit(mask);
+        }
+    }
+    #endif
+
+    while(i != data)
+        if(*--i == character) return i;
+
+    return nullptr;
+}
+
+}
+
+template<class T> BasicStringView<T> BasicStringView<T>::find(const StringView substring) const {
+    const std::size_t size = this->size();
+    const std::size_t substringSize = substring.size();
+
+    /* An empty substring is found at the beginning, a substring larger than
+       the string can't be found */
+    if(!substringSize) return prefix(std::size_t{});
+    if(substringSize > size) return {};
+
+    /* Single-character substrings are better handled by memchr(), which is
+       already heavily optimized in every libc */
+    const char* const found = substringSize == 1 ?
+        static_cast<const char*>(std::memchr(_data, substring._data[0], size)) :
+        findStringForward(_data, size, substring._data, substringSize);
+    if(!found) return {};
+
+    T* const begin = _data + (found - _data);
+    return slice(begin, begin + substringSize);
+}
+
+template<class T> BasicStringView<T> BasicStringView<T>::find(const char character) const {
+    /* Passing a null pointer to memchr() is undefined even for zero size */
+    const std::size_t size = this->size();
+    if(!size) return {};
+
+    T* const found = static_cast<T*>(std::memchr(_data, character, size));
+    if(!found) return {};
+    return slice(found, found + 1);
+}
+
+template<class T> BasicStringView<T> BasicStringView<T>::findLast(const StringView substring) const {
+    const std::size_t size = this->size();
+    const std::size_t substringSize = substring.size();
+
+    /* An empty substring is found at the end, a substring larger than the
+       string can't be found */
+    if(!substringSize) return suffix(size);
+    if(substringSize > size) return {};
+
+    const char* const found = substringSize == 1 ?
+        findCharacterBackward(_data, size, substring._data[0]) :
+        findStringBackward(_data, size, substring._data, substringSize);
+    if(!found) return {};
+
+    T* const begin = _data + (found - _data);
+    return slice(begin, begin + substringSize);
+}
+
+template<class T> BasicStringView<T> BasicStringView<T>::findLast(const char character) const {
+    const char* const found = findCharacterBackward(_data, size(), character);
+    if(!found) return {};
+
+    T* const begin = _data + (found - _data);
+    return slice(begin, begin + 1);
+}
+
+template<class T> bool BasicStringView<T>::contains(const StringView substring) const {
+    const std::size_t size = this->size();
+    const std::size_t substringSize = substring.size();
+
+    if(!substringSize) return true;
+    if(substringSize > size) return false;
+    if(substringSize == 1) return std::memchr(_data, substring._data[0], size) != nullptr;
+    return findStringForward(_data, size, substring._data, substringSize) != nullptr;
+}
+
+template<class T> bool BasicStringView<T>::contains(const char character) const {
+    const std::size_t size = this->size();
+    return size && std::memchr(_data, character, size) != nullptr;
+}
+
+template<class T> BasicStringView<T> BasicStringView<T>::findAny(const StringView characters) const {
+    const std::size_t size = this->size();
+    if(!size) return {};
+
+    const char* const found = findCharacterSet(_data, size, characterSet(characters._data, characters.size()), true);
+    if(!found) return {};
+
+    T* const begin = _data + (found - _data);
+    return slice(begin, begin + 1);
+}
+
+template<class T> BasicStringView<T> BasicStringView<T>::findLastAny(const StringView characters) const {
+    const std::size_t size = this->size();
+    if(!size) return {};
+
+    const char* const found = findLastCharacterSet(_data, size, characterSet(characters._data, characters.size()), true);
+    if(!found) return {};
+
+    T* const begin = _data + (found - _data);
+    return slice(begin, begin + 1);
+}
+
+template<class T> bool BasicStringView<T>::containsAny(const StringView characters) const {
+    const std::size_t size = this->size();
+    return size && findCharacterSet(_data, size, characterSet(characters._data, characters.size()), true) != nullptr;
+}
+
+template<class T> BasicStringView<T> BasicStringView<T>::trimmed(const StringView characters) const {
+    return trimmedPrefix(characters).trimmedSuffix(characters);
+}
+
+template<class T> BasicStringView<T> BasicStringView<T>::trimmed() const {
+    #ifdef CORRADE_MSVC2019_COMPATIBILITY
+    using namespace Containers::Literals;
+    return trimmed(" \t\f\v\r\n"_s);
+    #else
+    return trimmed(Whitespace);
+    #endif
+}
+
+template<class T> BasicStringView<T> BasicStringView<T>::trimmedPrefix(const StringView characters) const {
+    const std::size_t size = this->size();
+    const char* const found = size ? findCharacterSet(_data, size, characterSet(characters._data, characters.size()), false) : nullptr;
+    return suffix(found ? found - _data : size);
+}
+
+template<class T> BasicStringView<T> BasicStringView<T>::trimmedPrefix() const {
+    #ifdef CORRADE_MSVC2019_COMPATIBILITY
+    using namespace Containers::Literals;
+    return trimmedPrefix(" \t\f\v\r\n"_s);
+    #else
+    return trimmedPrefix(Whitespace);
+    #endif
+}
+
+template<class T> BasicStringView<T> BasicStringView<T>::trimmedSuffix(const StringView characters) const {
+    const std::size_t size = this->size();
+    const char* const found = size ? findLastCharacterSet(_data, size, characterSet(characters._data, characters.size()), false) : nullptr;
+    return prefix(found ? found - _data + 1 : 0);
+}
+
+template<class T> BasicStringView<T> BasicStringView<T>::trimmedSuffix() const {
+    #ifdef CORRADE_MSVC2019_COMPATIBILITY
+    using namespace Containers::Literals;
+    return trimmedSuffix(" \t\f\v\r\n"_s);
+    #else
+    return trimmedSuffix(Whitespace);
+    #endif
+}
+
+template<class T> StringSplit<T> BasicStringView<T>::splitLazy(const char delimiter) const {
+    return StringSplit<T>{*this, Implementation::StringSplitMode::Character, delimiter, {}};
+}
+
+template<class T> StringSplit<T> BasicStringView<T>::splitLazyWithoutEmptyParts(const char delimiter) const {
+    return StringSplit<T>{*this, Implementation::StringSplitMode::CharacterWithoutEmptyParts, delimiter, {}};
+}
+
+template<class T> StringSplit<T> BasicStringView<T>::splitLazyWithoutEmptyParts(const StringView delimiters) const {
+    return StringSplit<T>{*this, Implementation::StringSplitMode::CharacterSetWithoutEmptyParts, {}, characterSet(delimiters._data, delimiters.size())};
+}
+
+template<class T> StringSplit<T> BasicStringView<T>::splitLazyWithoutEmptyParts() const {
+    #ifdef CORRADE_MSVC2019_COMPATIBILITY
+    using namespace Containers::Literals;
+    return splitLazyWithoutEmptyParts(" \t\f\v\r\n"_s);
+    #else
+    return splitLazyWithoutEmptyParts(Whitespace);
+    #endif
+}
+
+template<class T> StringSplit<T> BasicStringView<T>::lines() const {
+    return StringSplit<T>{*this, Implementation::StringSplitMode::Lines, '\n', {}};
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class
     /* GCC needs the export macro on the class definition (and here it warns
@@ -241,6 +706,89 @@ template class
     BasicStringView<const char>;
 #endif
 
+template<class T> StringSplitIterator<T>::StringSplitIterator(const StringSplit<T>& split): _string{split._string}, _next{}, _done{split._string.isEmpty()}, _mode{split._mode}, _delimiter{split._delimiter}, _characterSet(split._characterSet) {
+    if(!_done) find(_string.data());
+}
+
+template<class T> StringSplitIterator<T>& StringSplitIterator<T>::operator++() {
+    CORRADE_ASSERT(!_done, "Containers::StringSplitIterator: can't advance past the end", *this);
+
+    if(!_next) _done = true;
+    else find(_next);
+    return *this;
+}
+
+template<class T> void StringSplitIterator<T>::find(T* const begin) {
+    T* const end = _string.end();
+
+    switch(_mode) {
+        /* Same as split(), an empty part is produced after a trailing
+           delimiter */
+        case Implementation::StringSplitMode::Character: {
+            T* const pos = begin == end ? nullptr : static_cast<T*>(std::memchr(begin, _delimiter, end - begin));
+            _part = _string.slice(begin, pos ? pos : end);
+            _next = pos ? pos + 1 : nullptr;
+            return;
+        }
+
+        /* Same as split() but without the trailing empty part, and with the
+           \r before \n stripped */
+        case Implementation::StringSplitMode::Lines: {
+            T* const pos = static_cast<T*>(std::memchr(begin, '\n', end - begin));
+            T* partEnd = pos ? pos : end;
+            if(pos && partEnd != begin && partEnd[-1] == '\r') --partEnd;
+            _part = _string.slice(begin, partEnd);
+            _next = pos && pos + 1 != end ? pos + 1 : nullptr;
+            return;
+        }
+
+        /* Skip all delimiters first, if there's nothing else then there are
+           no more parts */
+        case Implementation::StringSplitMode::CharacterWithoutEmptyParts: {
+            T* partBegin = begin;
+            while(partBegin != end && *partBegin == _delimiter) ++partBegin;
+            if(partBegin == end) {
+                _done = true;
+                return;
+            }
+
+            T* const pos = static_cast<T*>(std::memchr(partBegin, _delimiter, end - partBegin));
+            _part = _string.slice(partBegin, pos ? pos : end);
+            _next = pos;
+            return;
+        }
+
+        case Implementation::StringSplitMode::CharacterSetWithoutEmptyParts: {
+            const char* const found = findCharacterSet(begin, end - begin, _characterSet, false);
+            if(!found) {
+                _done = true;
+                return;
+            }
+
+            T* const partBegin = begin + (found - begin);
+            const char* const pos = findCharacterSet(partBegin, end - partBegin, _characterSet, true);
+            _part = _string.slice(partBegin, pos ? begin + (pos - begin) : end);
+            _next = pos ? begin + (pos - begin) : nullptr;
+            return;
+        }
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template class
+    #if defined(CORRADE_TARGET_CLANG) || defined(CORRADE_TARGET_MSVC)
+    CORRADE_UTILITY_EXPORT
+    #endif
+    StringSplitIterator<char>;
+template class
+    #if defined(CORRADE_TARGET_CLANG) || defined(CORRADE_TARGET_MSVC)
+    CORRADE_UTILITY_EXPORT
+    #endif
+    StringSplitIterator<const char>;
+#endif
+
 bool operator==(const StringView a, const StringView b) {
     /* Not using the size() accessor to speed up debug builds */
     const std::size_t aSize = a._size & ~Implementation::StringViewSizeMask;
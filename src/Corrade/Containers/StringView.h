@@ -26,12 +26,14 @@
 */
 
 /** @file
- * @brief Class @ref Corrade::Containers::BasicStringView, typedef @ref Corrade::Containers::StringView, @ref Corrade::Containers::MutableStringView, literal @link Corrade::Containers::Literals::operator""_s() @endlink
+ * @brief Class @ref Corrade::Containers::BasicStringView, @ref Corrade::Containers::StringSplit, @ref Corrade::Containers::StringSplitIterator, typedef @ref Corrade::Containers::StringView, @ref Corrade::Containers::MutableStringView, literal @link Corrade::Containers::Literals::operator""_s() @endlink
  * @m_since_latest
  * @experimental
  */
 
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <utility>
 
 #include "Corrade/Containers/Containers.h"
@@ -44,6 +46,20 @@ namespace Corrade { namespace Containers {
 
 namespace Implementation {
     template<class, class> struct StringViewConverter;
+
+    /* 256-bit character set membership table used by the character set
+       search in StringView.cpp, exposed here only so StringSplitIterator can
+       store it */
+    struct StringCharacterSet {
+        std::uint8_t table[32];
+    };
+
+    enum class StringSplitMode: std::uint8_t {
+        Character,
+        CharacterWithoutEmptyParts,
+        CharacterSetWithoutEmptyParts,
+        Lines
+    };
 }
 
 /**
@@ -462,6 +478,68 @@ template<class T> class CORRADE_UTILITY_EXPORT BasicStringView {
          */
         Array<BasicStringView<T>> splitWithoutEmptyParts() const;
 
+        /**
+         * @brief Lazily split on given character
+         *
+         * Returns a range that yields the same parts as @ref split(char) const
+         * but finds them on demand, without allocating any array:
+         *
+         * @snippet Containers.cpp StringView-splitLazy
+         *
+         * The parts are found using @ref std::memchr(), the same as in
+         * @ref split(). The original view is expected to stay in scope for
+         * the whole iteration.
+         * @see @ref splitLazyWithoutEmptyParts(), @ref lines()
+         */
+        StringSplit<T> splitLazy(char delimiter) const;
+
+        /**
+         * @brief Lazily split on given character, removing empty parts
+         *
+         * Returns a range that yields the same parts as
+         * @ref splitWithoutEmptyParts(char) const but finds them on demand,
+         * without allocating any array.
+         * @see @ref splitLazy()
+         */
+        StringSplit<T> splitLazyWithoutEmptyParts(char delimiter) const;
+
+        /**
+         * @brief Lazily split on any character from given set, removing empty parts
+         *
+         * Returns a range that yields the same parts as
+         * @ref splitWithoutEmptyParts(StringView) const but finds them on
+         * demand, without allocating any array. The character set is
+         * converted to a lookup table once and then used for the whole
+         * iteration, see @ref findAny() for details about the search. Only
+         * the data pointed to by the view is expected to stay in scope for
+         * the whole iteration, @p delimiters can be a temporary.
+         * @see @ref splitLazy()
+         */
+        StringSplit<T> splitLazyWithoutEmptyParts(StringView delimiters) const;
+
+        /**
+         * @brief Lazily split on whitespace, removing empty parts
+         *
+         * Equivalent to calling @ref splitLazyWithoutEmptyParts(StringView) const
+         * with @cpp " \t\f\v\r\n" @ce passed to @p delimiters.
+         */
+        StringSplit<T> splitLazyWithoutEmptyParts() const;
+
+        /**
+         * @brief Lazily iterate over lines
+         *
+         * Splits the string on @cpp '\n' @ce, removing a @cpp '\r' @ce
+         * preceding it, if any, so both Unix and Windows line endings are
+         * handled. A newline at the very end of the string doesn't produce
+         * an additional empty line, an empty string produces no lines at all.
+         * Lines are found on demand, without allocating any array:
+         *
+         * @snippet Containers.cpp StringView-lines
+         *
+         * @see @ref splitLazy()
+         */
+        StringSplit<T> lines() const;
+
         /**
          * @brief Partition
          *
@@ -521,6 +599,174 @@ template<class T> class CORRADE_UTILITY_EXPORT BasicStringView {
          */
         BasicStringView<T> stripSuffix(StringView suffix) const;
 
+        /**
+         * @brief Find a substring
+         *
+         * Returns a view pointing to the first occurence of @p substring in
+         * the string. If not found, an empty @cpp nullptr @ce view is
+         * returned. An empty @p substring is found at the beginning of the
+         * string. The function uses @ref slice() internally, meaning it
+         * propagates the @ref flags() as appropriate.
+         *
+         * On @ref CORRADE_TARGET_SSE2 "SSE2" and
+         * @ref CORRADE_TARGET_AVX2 "AVX2" targets, candidate positions are
+         * found by comparing the first and the last character of
+         * @p substring against 16 or 32 positions at once and only the
+         * candidates are then compared in full, otherwise a scalar
+         * implementation is used.
+         * @see @ref findLast(), @ref contains()
+         * @m_keywords{strstr() std::string::find()}
+         */
+        BasicStringView<T> find(StringView substring) const;
+
+        /**
+         * @brief Find a character
+         *
+         * Faster than @ref find(StringView) const if you know the substring
+         * is just a single character. If not found, an empty @cpp nullptr @ce
+         * view is returned.
+         * @m_keywords{memchr() std::string::find()}
+         */
+        BasicStringView<T> find(char character) const;
+
+        /**
+         * @brief Find the last occurence of a substring
+         *
+         * Returns a view pointing to the last occurence of @p substring in
+         * the string. If not found, an empty @cpp nullptr @ce view is
+         * returned. An empty @p substring is found at the end of the string.
+         * The function uses @ref slice() internally, meaning it propagates
+         * the @ref flags() as appropriate. Uses the same SIMD acceleration as
+         * @ref find(StringView) const, just going backwards.
+         * @see @ref find(), @ref contains()
+         * @m_keywords{std::string::rfind()}
+         */
+        BasicStringView<T> findLast(StringView substring) const;
+
+        /**
+         * @brief Find the last occurence of a character
+         *
+         * Faster than @ref findLast(StringView) const if you know the
+         * substring is just a single character. If not found, an empty
+         * @cpp nullptr @ce view is returned.
+         * @m_keywords{memrchr() std::string::rfind()}
+         */
+        BasicStringView<T> findLast(char character) const;
+
+        /**
+         * @brief Whether the view contains a substring
+         *
+         * A slightly lighter variant of @ref find(StringView) const useful
+         * when you only want to know if a substring was found or not. An
+         * empty @p substring is always contained.
+         */
+        bool contains(StringView substring) const;
+
+        /**
+         * @brief Whether the view contains a character
+         *
+         * Faster than @ref contains(StringView) const if you know the
+         * substring is just a single character.
+         */
+        bool contains(char character) const;
+
+        /**
+         * @brief Find any character from given set
+         *
+         * Returns a view pointing to the first occurence of any character
+         * from @p characters in the string. If not found, an empty
+         * @cpp nullptr @ce view is returned. The function uses @ref slice()
+         * internally, meaning it propagates the @ref flags() as appropriate.
+         *
+         * The character set is converted to a 256-bit membership table
+         * upfront, so the lookup cost doesn't depend on its size. On
+         * @ref CORRADE_TARGET_SSSE3 "SSSE3" and @ref CORRADE_TARGET_AVX2 "AVX2"
+         * targets the table is used for classifying 16 or 32 bytes at once
+         * using a nibble lookup. The same search is used by @ref trimmed()
+         * and @ref splitWithoutEmptyParts(StringView) const.
+         * @see @ref findLastAny(), @ref containsAny()
+         * @m_keywords{strpbrk() std::string::find_first_of()}
+         */
+        BasicStringView<T> findAny(StringView characters) const;
+
+        /**
+         * @brief Find the last occurence of any character from given set
+         *
+         * Returns a view pointing to the last occurence of any character from
+         * @p characters in the string. If not found, an empty @cpp nullptr @ce
+         * view is returned. The function uses @ref slice() internally, meaning
+         * it propagates the @ref flags() as appropriate.
+         * @see @ref findAny(), @ref containsAny()
+         * @m_keywords{std::string::find_last_of()}
+         */
+        BasicStringView<T> findLastAny(StringView characters) const;
+
+        /**
+         * @brief Whether the view contains any character from given set
+         *
+         * A slightly lighter variant of @ref findAny() useful when you only
+         * want to know if a character was found or not. For an empty
+         * @p characters always returns @cpp false @ce.
+         */
+        bool containsAny(StringView characters) const;
+
+        /**
+         * @brief View with given characters trimmed from prefix and suffix
+         *
+         * The function uses @ref slice() internally, meaning it propagates
+         * the @ref flags() as appropriate. Additionally, the resulting view
+         * is @cpp nullptr @ce only if the input is @cpp nullptr @ce,
+         * otherwise the view always points to existing memory.
+         * @see @ref trimmedPrefix(), @ref trimmedSuffix(), @ref findAny()
+         */
+        BasicStringView<T> trimmed(StringView characters) const;
+
+        /**
+         * @brief View with whitespace trimmed from prefix and suffix
+         *
+         * Equivalent to calling @ref trimmed(StringView) const with
+         * @cpp " \t\f\v\r\n" @ce passed to @p characters.
+         */
+        BasicStringView<T> trimmed() const;
+
+        /**
+         * @brief View with given characters trimmed from prefix
+         *
+         * The function uses @ref slice() internally, meaning it propagates
+         * the @ref flags() as appropriate. Additionally, the resulting view
+         * is @cpp nullptr @ce only if the input is @cpp nullptr @ce,
+         * otherwise the view always points to existing memory.
+         * @see @ref trimmed(), @ref trimmedSuffix()
+         */
+        BasicStringView<T> trimmedPrefix(StringView characters) const;
+
+        /**
+         * @brief View with whitespace trimmed from prefix
+         *
+         * Equivalent to calling @ref trimmedPrefix(StringView) const with
+         * @cpp " \t\f\v\r\n" @ce passed to @p characters.
+         */
+        BasicStringView<T> trimmedPrefix() const;
+
+        /**
+         * @brief View with given characters trimmed from suffix
+         *
+         * The function uses @ref slice() internally, meaning it propagates
+         * the @ref flags() as appropriate. Additionally, the resulting view
+         * is @cpp nullptr @ce only if the input is @cpp nullptr @ce,
+         * otherwise the view always points to existing memory.
+         * @see @ref trimmed(), @ref trimmedPrefix()
+         */
+        BasicStringView<T> trimmedSuffix(StringView characters) const;
+
+        /**
+         * @brief View with whitespace trimmed from suffix
+         *
+         * Equivalent to calling @ref trimmedSuffix(StringView) const with
+         * @cpp " \t\f\v\r\n" @ce passed to @p characters.
+         */
+        BasicStringView<T> trimmedSuffix() const;
+
     private:
         /* Needed for mutable/immutable conversion */
         template<class> friend class BasicStringView;
@@ -542,6 +788,114 @@ template<class T> class CORRADE_UTILITY_EXPORT BasicStringView {
         std::size_t _size;
 };
 
+/**
+@brief Lazy string split iterator
+@m_since_latest
+
+Forward iterator returned from @ref StringSplit::begin() and
+@ref StringSplit::end(). Each increment finds the next part, the iterator
+doesn't allocate. See @ref BasicStringView::splitLazy() for more information.
+@experimental
+*/
+template<class T> class CORRADE_UTILITY_EXPORT StringSplitIterator {
+    public:
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* Iterator traits, to make it usable with STL algorithms */
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::ptrdiff_t difference_type;
+        typedef BasicStringView<T> value_type;
+        typedef const BasicStringView<T>* pointer;
+        typedef const BasicStringView<T>& reference;
+        #endif
+
+        /**
+         * @brief Equality comparison
+         *
+         * Iterators are equal if they're both at the end or point to the same
+         * part.
+         */
+        bool operator==(const StringSplitIterator<T>& other) const {
+            return _done == other._done && (_done || (_part.data() == other._part.data() && _part.size() == other._part.size()));
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const StringSplitIterator<T>& other) const {
+            return !operator==(other);
+        }
+
+        /** @brief Current part */
+        const BasicStringView<T>& operator*() const { return _part; }
+
+        /** @brief Current part */
+        const BasicStringView<T>* operator->() const { return &_part; }
+
+        /** @brief Find the next part */
+        StringSplitIterator<T>& operator++();
+
+        /** @brief Find the next part, returning the previous position */
+        StringSplitIterator<T> operator++(int) {
+            StringSplitIterator<T> previous = *this;
+            operator++();
+            return previous;
+        }
+
+    private:
+        friend StringSplit<T>;
+
+        /* Creates a begin iterator, finding the first part */
+        explicit StringSplitIterator(const StringSplit<T>& split);
+        /* Creates an end iterator */
+        explicit StringSplitIterator(std::nullptr_t) noexcept: _next{}, _done{true}, _mode{}, _delimiter{}, _characterSet{} {}
+
+        void find(T* begin);
+
+        BasicStringView<T> _string, _part;
+        /* Where to start looking for the next part, nullptr if the current
+           part is the last one */
+        T* _next;
+        bool _done;
+        Implementation::StringSplitMode _mode;
+        char _delimiter;
+        Implementation::StringCharacterSet _characterSet;
+};
+
+/**
+@brief Lazy string split range
+@m_since_latest
+
+Returned from @ref BasicStringView::splitLazy(),
+@ref BasicStringView::splitLazyWithoutEmptyParts() and
+@ref BasicStringView::lines(), meant to be used in a range-for loop. Doesn't
+own the string data --- the original string is expected to stay in scope for
+the whole iteration.
+@experimental
+*/
+template<class T> class StringSplit {
+    public:
+        /** @brief Iterator to the first part */
+        StringSplitIterator<T> begin() const {
+            return StringSplitIterator<T>{*this};
+        }
+        StringSplitIterator<T> cbegin() const { return begin(); } /**< @overload */
+
+        /** @brief Iterator to (one item after) the last part */
+        StringSplitIterator<T> end() const {
+            return StringSplitIterator<T>{nullptr};
+        }
+        StringSplitIterator<T> cend() const { return end(); } /**< @overload */
+
+    private:
+        friend BasicStringView<T>;
+        friend StringSplitIterator<T>;
+
+        explicit StringSplit(BasicStringView<T> string, Implementation::StringSplitMode mode, char delimiter, const Implementation::StringCharacterSet& characterSet) noexcept: _string{string}, _mode{mode}, _delimiter{delimiter}, _characterSet(characterSet) {}
+
+        BasicStringView<T> _string;
+        Implementation::StringSplitMode _mode;
+        char _delimiter;
+        Implementation::StringCharacterSet _characterSet;
+};
+
 /**
 @brief String view
 @m_since_latest
@@ -0,0 +1,458 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+
+#include "Corrade/Containers/ArrayArena.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/Utility/DebugStl.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct ArrayArenaTest: TestSuite::Tester {
+    explicit ArrayArenaTest();
+
+    void construct();
+    void constructNested();
+
+    void allocate();
+    void allocateLargerThanChunk();
+    void resize();
+    void deallocate();
+    void reset();
+    void resetLargerThanChunk();
+
+    void allocatorAppend();
+    void allocatorAppendNonTrivial();
+    void allocatorReallocateNotLast();
+    void allocatorReallocateNonTrivialNotLast();
+    void allocatorReserveResize();
+    void allocatorIsGrowable();
+    void allocatorNested();
+    void allocatorNoArena();
+
+    template<template<class> class Allocator> void benchmarkShortLivedArrays();
+    template<template<class> class Allocator> void benchmarkInterleavedArrays();
+};
+
+struct Movable {
+    static int constructed;
+    static int destructed;
+    static int moved;
+
+    /*implicit*/ Movable(int a = 0) noexcept: a{a} { ++constructed; }
+    Movable(const Movable&) = delete;
+    Movable(Movable&& other) noexcept: a(other.a) {
+        ++constructed;
+        ++moved;
+    }
+    ~Movable() { ++destructed; }
+    Movable& operator=(const Movable&) = delete;
+    Movable& operator=(Movable&&) = delete;
+
+    int a;
+};
+
+int Movable::constructed = 0;
+int Movable::destructed = 0;
+int Movable::moved = 0;
+
+template<template<class> class> struct AllocatorName;
+template<> struct AllocatorName<ArrayMallocAllocator> {
+    static const char* name() { return "ArrayMallocAllocator"; }
+};
+template<> struct AllocatorName<ArrayArenaAllocator> {
+    static const char* name() { return "ArrayArenaAllocator"; }
+};
+
+ArrayArenaTest::ArrayArenaTest() {
+    addTests({&ArrayArenaTest::construct,
+              &ArrayArenaTest::constructNested,
+
+              &ArrayArenaTest::allocate,
+              &ArrayArenaTest::allocateLargerThanChunk,
+              &ArrayArenaTest::resize,
+              &ArrayArenaTest::deallocate,
+              &ArrayArenaTest::reset,
+              &ArrayArenaTest::resetLargerThanChunk,
+
+              &ArrayArenaTest::allocatorAppend,
+              &ArrayArenaTest::allocatorAppendNonTrivial,
+              &ArrayArenaTest::allocatorReallocateNotLast,
+              &ArrayArenaTest::allocatorReallocateNonTrivialNotLast,
+              &ArrayArenaTest::allocatorReserveResize,
+              &ArrayArenaTest::allocatorIsGrowable,
+              &ArrayArenaTest::allocatorNested,
+              &ArrayArenaTest::allocatorNoArena});
+
+    addBenchmarks<ArrayArenaTest>({
+        &ArrayArenaTest::benchmarkShortLivedArrays<ArrayMallocAllocator>,
+        &ArrayArenaTest::benchmarkShortLivedArrays<ArrayArenaAllocator>,
+        &ArrayArenaTest::benchmarkInterleavedArrays<ArrayMallocAllocator>,
+        &ArrayArenaTest::benchmarkInterleavedArrays<ArrayArenaAllocator>}, 10);
+}
+
+void ArrayArenaTest::construct() {
+    CORRADE_VERIFY(!ArrayArena::current());
+    {
+        ArrayArena arena{1024};
+        CORRADE_COMPARE(ArrayArena::current(), &arena);
+        CORRADE_COMPARE(arena.chunkSize(), 1024);
+        CORRADE_COMPARE(arena.chunkCount(), 0);
+    }
+    CORRADE_VERIFY(!ArrayArena::current());
+}
+
+void ArrayArenaTest::constructNested() {
+    ArrayArena a;
+    CORRADE_COMPARE(ArrayArena::current(), &a);
+    {
+        ArrayArena b;
+        CORRADE_COMPARE(ArrayArena::current(), &b);
+    }
+    CORRADE_COMPARE(ArrayArena::current(), &a);
+}
+
+void ArrayArenaTest::allocate() {
+    ArrayArena arena{1024};
+
+    char* a = static_cast<char*>(arena.allocate(3));
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(a) % ArrayArena::Alignment, 0);
+    CORRADE_COMPARE(arena.chunkCount(), 1);
+
+    /* Next allocation is right after, rounded up to the alignment */
+    char* b = static_cast<char*>(arena.allocate(17));
+    CORRADE_COMPARE(b, a + ArrayArena::Alignment);
+
+    /* Filling up the rest of the chunk */
+    char* c = static_cast<char*>(arena.allocate(1024 - 3*ArrayArena::Alignment));
+    CORRADE_COMPARE(c, a + 3*ArrayArena::Alignment);
+    CORRADE_COMPARE(arena.chunkCount(), 1);
+
+    /* This doesn't fit anymore */
+    char* d = static_cast<char*>(arena.allocate(1));
+    CORRADE_VERIFY(d);
+    CORRADE_VERIFY(d < a || d >= a + 1024);
+    CORRADE_COMPARE(arena.chunkCount(), 2);
+}
+
+void ArrayArenaTest::allocateLargerThanChunk() {
+    ArrayArena arena{64};
+
+    char* a = static_cast<char*>(arena.allocate(1000));
+    CORRADE_VERIFY(a);
+    /* The memory should be usable */
+    a[999] = 'a';
+    CORRADE_COMPARE(arena.chunkCount(), 1);
+
+    /* The large chunk is full, so this goes into a new one */
+    char* b = static_cast<char*>(arena.allocate(16));
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(arena.chunkCount(), 2);
+}
+
+void ArrayArenaTest::resize() {
+    ArrayArena arena{1024};
+
+    void* a = arena.allocate(16);
+    CORRADE_VERIFY(arena.resize(a, 16, 500));
+    CORRADE_VERIFY(arena.resize(a, 500, 1024));
+
+    /* Doesn't fit into the chunk anymore */
+    CORRADE_VERIFY(!arena.resize(a, 1024, 1025));
+    CORRADE_VERIFY(arena.resize(a, 1024, 32));
+
+    /* Not the last allocation */
+    void* b = arena.allocate(16);
+    CORRADE_COMPARE(b, static_cast<char*>(a) + 32);
+    CORRADE_VERIFY(!arena.resize(a, 32, 48));
+    CORRADE_VERIFY(arena.resize(b, 16, 48));
+}
+
+void ArrayArenaTest::deallocate() {
+    ArrayArena arena{1024};
+
+    void* a = arena.allocate(16);
+    void* b = arena.allocate(16);
+
+    /* Not the last allocation, nothing happens */
+    arena.deallocate(a, 16);
+    void* c = arena.allocate(16);
+    CORRADE_COMPARE(c, static_cast<char*>(b) + 16);
+
+    /* Last allocation, the space is reused */
+    arena.deallocate(c, 16);
+    void* d = arena.allocate(16);
+    CORRADE_COMPARE(d, c);
+}
+
+void ArrayArenaTest::reset() {
+    ArrayArena arena{1024};
+
+    void* a = arena.allocate(1000);
+    void* b = arena.allocate(1000);
+    CORRADE_COMPARE(arena.chunkCount(), 2);
+
+    /* The chunks get reused in the same order */
+    arena.reset();
+    CORRADE_COMPARE(arena.allocate(1000), a);
+    CORRADE_COMPARE(arena.allocate(1000), b);
+    CORRADE_COMPARE(arena.chunkCount(), 2);
+
+    /* And once exhausted, new ones get allocated */
+    arena.allocate(1000);
+    CORRADE_COMPARE(arena.chunkCount(), 3);
+}
+
+void ArrayArenaTest::resetLargerThanChunk() {
+    ArrayArena arena{1024};
+
+    void* a = arena.allocate(1000);
+    void* b = arena.allocate(1000);
+    CORRADE_COMPARE(arena.chunkCount(), 2);
+
+    arena.reset();
+
+    /* Doesn't fit into the first chunk, a new one is allocated in front */
+    void* c = arena.allocate(2000);
+    CORRADE_VERIFY(c != a);
+    CORRADE_VERIFY(c != b);
+    CORRADE_COMPARE(arena.chunkCount(), 3);
+
+    /* The original chunks are still used afterwards */
+    CORRADE_COMPARE(arena.allocate(1000), a);
+    CORRADE_COMPARE(arena.allocate(1000), b);
+    CORRADE_COMPARE(arena.chunkCount(), 3);
+}
+
+void ArrayArenaTest::allocatorAppend() {
+    ArrayArena arena{4096};
+
+    Array<int> a;
+    arrayAppend<ArrayArenaAllocator>(a, 1);
+    CORRADE_VERIFY(arrayIsGrowable<ArrayArenaAllocator>(a));
+    CORRADE_COMPARE(&ArrayArenaAllocator<int>::arena(a), &arena);
+    CORRADE_COMPARE(arrayCapacity<ArrayArenaAllocator>(a), ArrayArena::Alignment/sizeof(int));
+
+    /* The array is the last allocation, so it's grown in-place */
+    int* data = a.data();
+    for(int i = 2; i <= 500; ++i) arrayAppend<ArrayArenaAllocator>(a, i);
+    CORRADE_COMPARE(a.data(), data);
+    CORRADE_COMPARE(a.size(), 500);
+    CORRADE_COMPARE(arena.chunkCount(), 1);
+    for(std::size_t i = 0; i != a.size(); ++i)
+        CORRADE_COMPARE(a[i], i + 1);
+
+    /* Grown out of the chunk, moves elsewhere */
+    for(int i = 501; i <= 2000; ++i) arrayAppend<ArrayArenaAllocator>(a, i);
+    CORRADE_VERIFY(a.data() != data);
+    CORRADE_VERIFY(arena.chunkCount() > 1);
+    for(std::size_t i = 0; i != a.size(); ++i)
+        CORRADE_COMPARE(a[i], i + 1);
+}
+
+void ArrayArenaTest::allocatorAppendNonTrivial() {
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+
+    {
+        ArrayArena arena;
+        Array<Movable> a;
+        for(int i = 0; i != 100; ++i)
+            arrayAppend<ArrayArenaAllocator>(a, InPlaceInit, i);
+        CORRADE_COMPARE(a.size(), 100);
+        CORRADE_COMPARE(a[57].a, 57);
+
+        /* Grown in-place every time, nothing moved */
+        CORRADE_COMPARE(Movable::moved, 0);
+    }
+
+    CORRADE_COMPARE(Movable::constructed, 100);
+    CORRADE_COMPARE(Movable::destructed, 100);
+}
+
+void ArrayArenaTest::allocatorReallocateNotLast() {
+    ArrayArena arena;
+
+    Array<int> a;
+    arrayAppend<ArrayArenaAllocator>(a, {1, 2, 3});
+    Array<int> b;
+    arrayAppend<ArrayArenaAllocator>(b, 4);
+
+    /* The first array is not the last allocation anymore, has to move */
+    int* data = a.data();
+    arrayAppend<ArrayArenaAllocator>(a, {5, 6, 7, 8, 9});
+    CORRADE_VERIFY(a.data() != data);
+    CORRADE_COMPARE_AS(a, arrayView({1, 2, 3, 5, 6, 7, 8, 9}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(b, arrayView({4}),
+        TestSuite::Compare::Container);
+}
+
+void ArrayArenaTest::allocatorReallocateNonTrivialNotLast() {
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+
+    {
+        ArrayArena arena;
+        Array<Movable> a;
+        arrayAppend<ArrayArenaAllocator>(a, InPlaceInit, 1);
+        arrayAppend<ArrayArenaAllocator>(a, InPlaceInit, 2);
+        Array<Movable> b;
+        arrayAppend<ArrayArenaAllocator>(b, InPlaceInit, 3);
+
+        for(int i = 0; i != 100; ++i)
+            arrayAppend<ArrayArenaAllocator>(a, InPlaceInit, i);
+        CORRADE_COMPARE(a[1].a, 2);
+        CORRADE_COMPARE(a[101].a, 99);
+        CORRADE_COMPARE(b[0].a, 3);
+
+        /* The first four elements got moved out once, when the initial
+           capacity got exhausted. After that the array is the last
+           allocation again, growing in-place. */
+        CORRADE_COMPARE(Movable::moved, 4);
+    }
+
+    CORRADE_COMPARE(Movable::constructed, 107);
+    CORRADE_COMPARE(Movable::destructed, 107);
+}
+
+void ArrayArenaTest::allocatorReserveResize() {
+    ArrayArena arena;
+
+    Array<int> a;
+    CORRADE_COMPARE(arrayReserve<ArrayArenaAllocator>(a, 100), 100);
+    CORRADE_VERIFY(arrayIsGrowable<ArrayArenaAllocator>(a));
+    CORRADE_COMPARE(arrayCapacity<ArrayArenaAllocator>(a), 100);
+    CORRADE_COMPARE(a.size(), 0);
+
+    arrayResize<ArrayArenaAllocator>(a, ValueInit, 50);
+    CORRADE_COMPARE(a.size(), 50);
+    CORRADE_COMPARE(a[49], 0);
+    CORRADE_COMPARE(arrayCapacity<ArrayArenaAllocator>(a), 100);
+
+    arrayRemoveSuffix<ArrayArenaAllocator>(a, 20);
+    CORRADE_COMPARE(a.size(), 30);
+
+    /* Shrinking moves the array to the heap */
+    arrayShrink<ArrayArenaAllocator>(a);
+    CORRADE_VERIFY(!arrayIsGrowable<ArrayArenaAllocator>(a));
+    CORRADE_COMPARE(a.size(), 30);
+}
+
+void ArrayArenaTest::allocatorIsGrowable() {
+    ArrayArena arena;
+
+    Array<int> a;
+    arrayAppend<ArrayMallocAllocator>(a, 1);
+    CORRADE_VERIFY(arrayIsGrowable<ArrayMallocAllocator>(a));
+    CORRADE_VERIFY(!arrayIsGrowable<ArrayArenaAllocator>(a));
+
+    /* Appending with a different allocator moves the array to the arena */
+    arrayAppend<ArrayArenaAllocator>(a, 2);
+    CORRADE_VERIFY(!arrayIsGrowable<ArrayMallocAllocator>(a));
+    CORRADE_VERIFY(arrayIsGrowable<ArrayArenaAllocator>(a));
+    CORRADE_COMPARE_AS(a, arrayView({1, 2}),
+        TestSuite::Compare::Container);
+}
+
+void ArrayArenaTest::allocatorNested() {
+    ArrayArena outer;
+
+    Array<int> a;
+    arrayAppend<ArrayArenaAllocator>(a, 1);
+    {
+        ArrayArena inner;
+        Array<int> b;
+        arrayAppend<ArrayArenaAllocator>(b, 2);
+        CORRADE_COMPARE(&ArrayArenaAllocator<int>::arena(b), &inner);
+
+        /* Growing an existing array stays in its original arena */
+        for(int i = 0; i != 100; ++i) arrayAppend<ArrayArenaAllocator>(a, i);
+        CORRADE_COMPARE(&ArrayArenaAllocator<int>::arena(a), &outer);
+        CORRADE_COMPARE(inner.chunkCount(), 1);
+    }
+
+    CORRADE_COMPARE(a.size(), 101);
+}
+
+void ArrayArenaTest::allocatorNoArena() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    ArrayArenaAllocator<int>::allocate(3);
+    CORRADE_COMPARE(out.str(),
+        "Containers::ArrayArenaAllocator::allocate(): no arena is active\n");
+}
+
+template<template<class> class Allocator> void ArrayArenaTest::benchmarkShortLivedArrays() {
+    setTestCaseTemplateName(AllocatorName<Allocator>::name());
+
+    /* Unused by the ArrayMallocAllocator variant, but created and reset in
+       both to have the two comparable */
+    ArrayArena arena;
+
+    /* Many small scratch arrays, each destroyed before the next one is
+       created */
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != 1000; ++i) {
+            Array<int> a;
+            for(std::size_t j = 0; j != 100; ++j)
+                arrayAppend<Allocator>(a, int(j));
+            sum += a[i % 100];
+        }
+        arena.reset();
+    }
+
+    CORRADE_COMPARE(sum, 49500);
+}
+
+template<template<class> class Allocator> void ArrayArenaTest::benchmarkInterleavedArrays() {
+    setTestCaseTemplateName(AllocatorName<Allocator>::name());
+
+    ArrayArena arena;
+
+    /* Several arrays alive at the same time and growing in an interleaved
+       fashion, so the arena can't grow them in-place */
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != 100; ++i) {
+            Array<int> arrays[10];
+            for(std::size_t j = 0; j != 100; ++j)
+                for(Array<int>& a: arrays) arrayAppend<Allocator>(a, int(j));
+            for(Array<int>& a: arrays) sum += a[i];
+        }
+        arena.reset();
+    }
+
+    CORRADE_COMPARE(sum, 49500);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::ArrayArenaTest)
@@ -0,0 +1,288 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Corrade/Containers/ArrayMmapAllocator.h"
+#include "Corrade/Containers/Optional.h"
+#include "Corrade/Containers/StringStl.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
+#include "Corrade/Utility/DebugStl.h"
+#include "Corrade/Utility/Directory.h"
+
+#include "configure.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct ArrayMappedFileAllocatorTest: TestSuite::Tester {
+    explicit ArrayMappedFileAllocatorTest();
+
+    void setup();
+
+    void create();
+    void createEmpty();
+    void createInvalid();
+    void open();
+    void openNonexistent();
+    void openInvalidSize();
+    void append();
+    void appendReopen();
+    void appendNotMapped();
+    void shrink();
+    void shrinkDefaultInit();
+    void flush();
+
+    std::string _filename;
+};
+
+ArrayMappedFileAllocatorTest::ArrayMappedFileAllocatorTest() {
+    addTests({&ArrayMappedFileAllocatorTest::create,
+              &ArrayMappedFileAllocatorTest::createEmpty,
+              &ArrayMappedFileAllocatorTest::createInvalid,
+              &ArrayMappedFileAllocatorTest::open,
+              &ArrayMappedFileAllocatorTest::openNonexistent,
+              &ArrayMappedFileAllocatorTest::openInvalidSize,
+              &ArrayMappedFileAllocatorTest::append,
+              &ArrayMappedFileAllocatorTest::appendReopen,
+              &ArrayMappedFileAllocatorTest::appendNotMapped,
+              &ArrayMappedFileAllocatorTest::shrink,
+              &ArrayMappedFileAllocatorTest::shrinkDefaultInit,
+              &ArrayMappedFileAllocatorTest::flush},
+        &ArrayMappedFileAllocatorTest::setup,
+        &ArrayMappedFileAllocatorTest::setup);
+
+    Utility::Directory::mkpath(CONTAINERS_WRITE_TEST_DIR);
+    _filename = Utility::Directory::join(CONTAINERS_WRITE_TEST_DIR, "ArrayMappedFileAllocatorTest.bin");
+}
+
+void ArrayMappedFileAllocatorTest::setup() {
+    if(Utility::Directory::exists(_filename))
+        Utility::Directory::rm(_filename);
+}
+
+void ArrayMappedFileAllocatorTest::create() {
+    {
+        Array<int> a = arrayMapFileWrite<int>(_filename, 5);
+        CORRADE_VERIFY(a);
+        CORRADE_COMPARE(a.size(), 5);
+        CORRADE_VERIFY(arrayIsGrowable<ArrayMappedFileAllocator>(a));
+        /* The mapping is whole pages */
+        CORRADE_COMPARE_AS(arrayCapacity<ArrayMappedFileAllocator>(a), 5,
+            TestSuite::Compare::Greater);
+
+        /* The file is zero-filled */
+        CORRADE_COMPARE(a[0], 0);
+        CORRADE_COMPARE(a[4], 0);
+
+        a[1] = 1337;
+        a[4] = -42;
+    }
+
+    /* The file is truncated to the array size on destruction */
+    CORRADE_COMPARE(Utility::Directory::fileSize(_filename), 5*sizeof(int));
+    Array<char> data = Utility::Directory::read(_filename);
+    CORRADE_COMPARE(arrayCast<int>(data)[1], 1337);
+    CORRADE_COMPARE(arrayCast<int>(data)[4], -42);
+}
+
+void ArrayMappedFileAllocatorTest::createEmpty() {
+    {
+        Array<int> a = arrayMapFileWrite<int>(_filename, 0);
+        CORRADE_VERIFY(a);
+        CORRADE_COMPARE(a.size(), 0);
+        CORRADE_VERIFY(arrayIsGrowable<ArrayMappedFileAllocator>(a));
+        CORRADE_COMPARE_AS(arrayCapacity<ArrayMappedFileAllocator>(a), 0,
+            TestSuite::Compare::Greater);
+    }
+
+    CORRADE_COMPARE(Utility::Directory::fileSize(_filename), 0);
+}
+
+void ArrayMappedFileAllocatorTest::createInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    Array<int> a = arrayMapFileWrite<int>(Utility::Directory::join(_filename, "nonexistent"), 5);
+    CORRADE_VERIFY(!a);
+    CORRADE_COMPARE(out.str(), "Containers::arrayMapFileWrite(): can't open " + Utility::Directory::join(_filename, "nonexistent") + ": No such file or directory\n");
+}
+
+void ArrayMappedFileAllocatorTest::open() {
+    const int data[]{3, 17, -5};
+    CORRADE_VERIFY(Utility::Directory::write(_filename, data));
+
+    {
+        Array<int> a = arrayMapFile<int>(_filename);
+        CORRADE_VERIFY(a);
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_VERIFY(arrayIsGrowable<ArrayMappedFileAllocator>(a));
+        CORRADE_COMPARE(a[0], 3);
+        CORRADE_COMPARE(a[1], 17);
+        CORRADE_COMPARE(a[2], -5);
+
+        a[1] = 18;
+    }
+
+    CORRADE_COMPARE(Utility::Directory::fileSize(_filename), 3*sizeof(int));
+    Array<char> read = Utility::Directory::read(_filename);
+    CORRADE_COMPARE(arrayCast<int>(read)[0], 3);
+    CORRADE_COMPARE(arrayCast<int>(read)[1], 18);
+    CORRADE_COMPARE(arrayCast<int>(read)[2], -5);
+}
+
+void ArrayMappedFileAllocatorTest::openNonexistent() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    Array<int> a = arrayMapFile<int>(_filename);
+    CORRADE_VERIFY(!a);
+    CORRADE_COMPARE(out.str(), "Containers::arrayMapFile(): can't open " + _filename + ": No such file or directory\n");
+}
+
+void ArrayMappedFileAllocatorTest::openInvalidSize() {
+    CORRADE_VERIFY(Utility::Directory::writeString(_filename, "hello"));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Array<int> a = arrayMapFile<int>(_filename);
+    CORRADE_VERIFY(!a);
+    CORRADE_COMPARE(out.str(), "Containers::arrayMapFile(): size of " + _filename + " is 5 bytes, which is not a multiple of 4\n");
+
+    /* The file isn't touched */
+    CORRADE_COMPARE(Utility::Directory::readString(_filename), "hello");
+}
+
+void ArrayMappedFileAllocatorTest::append() {
+    {
+        Array<int> a = arrayMapFileWrite<int>(_filename, 0);
+
+        /* Appending one by one to go through several remaps, some of which
+           likely have to move the mapping */
+        for(int i = 0; i != 100000; ++i)
+            arrayAppend<ArrayMappedFileAllocator>(a, i);
+        CORRADE_COMPARE(a.size(), 100000);
+        CORRADE_VERIFY(arrayIsGrowable<ArrayMappedFileAllocator>(a));
+        CORRADE_COMPARE_AS(arrayCapacity<ArrayMappedFileAllocator>(a), 100000,
+            TestSuite::Compare::GreaterOrEqual);
+        CORRADE_COMPARE(a[0], 0);
+        CORRADE_COMPARE(a[4567], 4567);
+        CORRADE_COMPARE(a[99999], 99999);
+
+        /* While growing, the file is as large as the capacity */
+        CORRADE_COMPARE(Utility::Directory::fileSize(_filename), arrayCapacity<ArrayMappedFileAllocator>(a)*sizeof(int));
+    }
+
+    CORRADE_COMPARE(Utility::Directory::fileSize(_filename), 100000*sizeof(int));
+    Array<char> read = Utility::Directory::read(_filename);
+    CORRADE_COMPARE(arrayCast<int>(read)[4567], 4567);
+    CORRADE_COMPARE(arrayCast<int>(read)[99999], 99999);
+}
+
+void ArrayMappedFileAllocatorTest::appendReopen() {
+    {
+        Array<int> a = arrayMapFileWrite<int>(_filename, 0);
+        arrayAppend<ArrayMappedFileAllocator>(a, {1, 2, 3});
+    } {
+        Array<int> a = arrayMapFile<int>(_filename);
+        CORRADE_COMPARE(a.size(), 3);
+        arrayAppend<ArrayMappedFileAllocator>(a, {4, 5});
+        CORRADE_COMPARE(a.size(), 5);
+    }
+
+    CORRADE_COMPARE(Utility::Directory::fileSize(_filename), 5*sizeof(int));
+    Array<char> read = Utility::Directory::read(_filename);
+    CORRADE_COMPARE(arrayCast<int>(read)[0], 1);
+    CORRADE_COMPARE(arrayCast<int>(read)[2], 3);
+    CORRADE_COMPARE(arrayCast<int>(read)[4], 5);
+}
+
+void ArrayMappedFileAllocatorTest::appendNotMapped() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Array<int> a;
+    arrayReserve<ArrayMappedFileAllocator>(a, 10);
+    CORRADE_COMPARE(out.str(), "Containers::ArrayMappedFileAllocator: can only grow arrays created with arrayMapFile() or arrayMapFileWrite()\n");
+}
+
+void ArrayMappedFileAllocatorTest::shrink() {
+    {
+        Array<int> a = arrayMapFileWrite<int>(_filename, 0);
+        for(int i = 0; i != 10000; ++i)
+            arrayAppend<ArrayMappedFileAllocator>(a, i);
+        arrayRemoveSuffix<ArrayMappedFileAllocator>(a, 5000);
+        const int* data = a.data();
+
+        /* Shrinking doesn't move the data, only truncates the file and
+           makes the array non-growable */
+        arrayShrink<ArrayMappedFileAllocator>(a);
+        CORRADE_VERIFY(!arrayIsGrowable<ArrayMappedFileAllocator>(a));
+        CORRADE_COMPARE(arrayCapacity<ArrayMappedFileAllocator>(a), 5000);
+        CORRADE_VERIFY(a.data() == data);
+        CORRADE_COMPARE(a.size(), 5000);
+        CORRADE_COMPARE(a[4999], 4999);
+        CORRADE_COMPARE(Utility::Directory::fileSize(_filename), 5000*sizeof(int));
+    }
+
+    CORRADE_COMPARE(Utility::Directory::fileSize(_filename), 5000*sizeof(int));
+    Array<char> read = Utility::Directory::read(_filename);
+    CORRADE_COMPARE(arrayCast<int>(read)[4999], 4999);
+}
+
+void ArrayMappedFileAllocatorTest::shrinkDefaultInit() {
+    {
+        Array<int> a = arrayMapFileWrite<int>(_filename, 0);
+        arrayAppend<ArrayMappedFileAllocator>(a, {1, 2, 3});
+
+        /* This overload has to produce an array with a default deleter, so a
+           copy is made and the file gets closed */
+        arrayShrink<int, ArrayMappedFileAllocator<int>>(a, DefaultInit);
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_COMPARE(a[2], 3);
+        CORRADE_VERIFY(!a.deleter());
+    }
+
+    CORRADE_COMPARE(Utility::Directory::fileSize(_filename), 3*sizeof(int));
+}
+
+void ArrayMappedFileAllocatorTest::flush() {
+    Array<int> a = arrayMapFileWrite<int>(_filename, 0);
+    arrayAppend<ArrayMappedFileAllocator>(a, {1, 2, 3, 4});
+
+    CORRADE_VERIFY(arrayMapFileFlush(a));
+    /* Not starting at a page boundary */
+    CORRADE_VERIFY(arrayMapFileFlush(a.suffix(2)));
+    /* Empty is a no-op */
+    CORRADE_VERIFY(arrayMapFileFlush(nullptr));
+
+    Array<char> read = Utility::Directory::read(_filename);
+    CORRADE_COMPARE(arrayCast<int>(read)[3], 4);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::ArrayMappedFileAllocatorTest)
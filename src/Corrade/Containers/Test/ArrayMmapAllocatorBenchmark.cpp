@@ -0,0 +1,102 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/ArrayMmapAllocator.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Arguments.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct ArrayMmapAllocatorBenchmark: TestSuite::Tester {
+    explicit ArrayMmapAllocatorBenchmark();
+
+    template<template<class> class Allocator> void append();
+};
+
+/* Appending in 64 kB chunks, as when streaming data from a file or a
+   network */
+constexpr std::size_t ChunkSize = 65536;
+
+/* Sorted by size. The last two need a lot of memory and time and so aren't
+   run by default, pass `--mmap-max-size 1073741824` to run them as well. */
+const struct {
+    const char* name;
+    std::size_t size;
+} AppendData[]{
+    {"4 MB", std::size_t{4} << 20},
+    {"16 MB", std::size_t{16} << 20},
+    {"64 MB", std::size_t{64} << 20},
+    {"256 MB", std::size_t{256} << 20},
+    {"1 GB", std::size_t{1} << 30}
+};
+
+ArrayMmapAllocatorBenchmark::ArrayMmapAllocatorBenchmark(): TestSuite::Tester{TesterConfiguration{}.setSkippedArgumentPrefixes({"mmap"})} {
+    Utility::Arguments args{"mmap"};
+    args.addOption("max-size", "67108864").setHelp("max-size", "max size of data to benchmark with", "N")
+        .parse(arguments().first, arguments().second);
+    const std::size_t maxSize = args.value<std::size_t>("max-size");
+
+    std::size_t appendInstanceCount = 0;
+    while(appendInstanceCount != Containers::arraySize(AppendData) && AppendData[appendInstanceCount].size <= maxSize)
+        ++appendInstanceCount;
+
+    addInstancedBenchmarks<ArrayMmapAllocatorBenchmark>({&ArrayMmapAllocatorBenchmark::append<ArrayMallocAllocator>,
+                            &ArrayMmapAllocatorBenchmark::append<ArrayMmapAllocator>,
+                            &ArrayMmapAllocatorBenchmark::append<ArrayMmapHugePageAllocator>}, 3,
+        appendInstanceCount);
+}
+
+template<template<class> class> struct AllocatorName;
+template<> struct AllocatorName<ArrayMallocAllocator> {
+    static const char* name() { return "ArrayMallocAllocator"; }
+};
+template<> struct AllocatorName<ArrayMmapAllocator> {
+    static const char* name() { return "ArrayMmapAllocator"; }
+};
+template<> struct AllocatorName<ArrayMmapHugePageAllocator> {
+    static const char* name() { return "ArrayMmapHugePageAllocator"; }
+};
+
+template<template<class> class Allocator> void ArrayMmapAllocatorBenchmark::append() {
+    auto&& data = AppendData[testCaseInstanceId()];
+    setTestCaseTemplateName(AllocatorName<Allocator>::name());
+    setTestCaseDescription(data.name);
+
+    const Array<char> chunk{DirectInit, ChunkSize, '\x5a'};
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        Array<char> array;
+        for(std::size_t i = 0; i < data.size; i += ChunkSize)
+            arrayAppend<Allocator>(array, arrayView(chunk));
+        size = array.size();
+    }
+
+    CORRADE_COMPARE(size, data.size);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::ArrayMmapAllocatorBenchmark)
@@ -0,0 +1,211 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <unistd.h>
+
+#include "Corrade/Containers/ArrayMmapAllocator.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct ArrayMmapAllocatorTest: TestSuite::Tester {
+    explicit ArrayMmapAllocatorTest();
+
+    template<template<class> class Allocator> void allocate();
+    template<template<class> class Allocator> void append();
+    template<template<class> class Allocator> void appendFromNonGrowable();
+    template<template<class> class Allocator> void reserveLarge();
+    template<template<class> class Allocator> void shrink();
+    template<template<class> class Allocator> void shrinkAfterRemove();
+    void shrinkDefaultInit();
+};
+
+ArrayMmapAllocatorTest::ArrayMmapAllocatorTest() {
+    addTests({&ArrayMmapAllocatorTest::allocate<ArrayMmapAllocator>,
+              &ArrayMmapAllocatorTest::allocate<ArrayMmapHugePageAllocator>,
+              &ArrayMmapAllocatorTest::append<ArrayMmapAllocator>,
+              &ArrayMmapAllocatorTest::append<ArrayMmapHugePageAllocator>,
+              &ArrayMmapAllocatorTest::appendFromNonGrowable<ArrayMmapAllocator>,
+              &ArrayMmapAllocatorTest::appendFromNonGrowable<ArrayMmapHugePageAllocator>,
+              &ArrayMmapAllocatorTest::reserveLarge<ArrayMmapAllocator>,
+              &ArrayMmapAllocatorTest::reserveLarge<ArrayMmapHugePageAllocator>,
+              &ArrayMmapAllocatorTest::shrink<ArrayMmapAllocator>,
+              &ArrayMmapAllocatorTest::shrink<ArrayMmapHugePageAllocator>,
+              &ArrayMmapAllocatorTest::shrinkAfterRemove<ArrayMmapAllocator>,
+              &ArrayMmapAllocatorTest::shrinkAfterRemove<ArrayMmapHugePageAllocator>,
+              &ArrayMmapAllocatorTest::shrinkDefaultInit});
+}
+
+template<template<class> class> struct AllocatorName;
+template<> struct AllocatorName<ArrayMmapAllocator> {
+    static const char* name() { return "ArrayMmapAllocator"; }
+};
+template<> struct AllocatorName<ArrayMmapHugePageAllocator> {
+    static const char* name() { return "ArrayMmapHugePageAllocator"; }
+};
+
+template<template<class> class Allocator> void ArrayMmapAllocatorTest::allocate() {
+    setTestCaseTemplateName(AllocatorName<Allocator>::name());
+
+    int* data = Allocator<int>::allocate(100);
+    CORRADE_VERIFY(data);
+    /* The whole page is used, minus the header */
+    const std::size_t pageSize = sysconf(_SC_PAGESIZE);
+    CORRADE_COMPARE(Allocator<int>::capacity(data), (pageSize - 16)/sizeof(int));
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(data) % 16, 0);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(Allocator<int>::base(data)) % pageSize, 0);
+
+    /* The memory is writable */
+    for(std::size_t i = 0; i != 100; ++i) data[i] = int(i);
+    CORRADE_COMPARE(data[99], 99);
+
+    Allocator<int>::reallocate(data, 100, 5000);
+    CORRADE_COMPARE(Allocator<int>::capacity(data)*sizeof(int) + 16, (5000*sizeof(int) + 16 + pageSize - 1)/pageSize*pageSize);
+    CORRADE_COMPARE(data[0], 0);
+    CORRADE_COMPARE(data[99], 99);
+    data[4999] = 1337;
+
+    Allocator<int>::deallocate(data);
+    Allocator<int>::deallocate(nullptr);
+}
+
+template<template<class> class Allocator> void ArrayMmapAllocatorTest::append() {
+    setTestCaseTemplateName(AllocatorName<Allocator>::name());
+
+    Array<std::uint64_t> a;
+    for(std::size_t i = 0; i != 1000000; ++i)
+        arrayAppend<Allocator>(a, i*3);
+
+    CORRADE_VERIFY(arrayIsGrowable<Allocator>(a));
+    CORRADE_VERIFY(!arrayIsGrowable<ArrayMallocAllocator>(a));
+    CORRADE_COMPARE(a.size(), 1000000);
+    CORRADE_VERIFY(arrayCapacity<Allocator>(a) >= 1000000);
+    /* The growth is doubling, so it shouldn't be more than twice as large */
+    CORRADE_VERIFY(arrayCapacity<Allocator>(a) < 2000000);
+
+    /* All data survived the remapping */
+    bool valid = true;
+    for(std::size_t i = 0; i != a.size(); ++i)
+        if(a[i] != i*3) valid = false;
+    CORRADE_VERIFY(valid);
+}
+
+template<template<class> class Allocator> void ArrayMmapAllocatorTest::appendFromNonGrowable() {
+    setTestCaseTemplateName(AllocatorName<Allocator>::name());
+
+    Array<int> a{InPlaceInit, {1, 2, 3}};
+    CORRADE_VERIFY(!arrayIsGrowable<Allocator>(a));
+
+    arrayAppend<Allocator>(a, 4);
+    CORRADE_VERIFY(arrayIsGrowable<Allocator>(a));
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a[0], 1);
+    CORRADE_COMPARE(a[3], 4);
+}
+
+template<template<class> class Allocator> void ArrayMmapAllocatorTest::reserveLarge() {
+    setTestCaseTemplateName(AllocatorName<Allocator>::name());
+
+    /* Reserving a gigabyte doesn't commit any memory until it's touched, so
+       this is cheap */
+    Array<char> a;
+    arrayReserve<Allocator>(a, std::size_t{1} << 30);
+    CORRADE_VERIFY(arrayCapacity<Allocator>(a) >= std::size_t{1} << 30);
+
+    arrayAppend<Allocator>(a, {'a', 'b', 'c'});
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a[2], 'c');
+}
+
+template<template<class> class Allocator> void ArrayMmapAllocatorTest::shrink() {
+    setTestCaseTemplateName(AllocatorName<Allocator>::name());
+
+    Array<int> a;
+    for(int i = 0; i != 100000; ++i)
+        arrayAppend<Allocator>(a, i);
+    const int* data = a.data();
+    CORRADE_VERIFY(arrayCapacity<Allocator>(a) > 100000);
+
+    /* The array isn't copied, just loses the growable property */
+    arrayShrink<Allocator>(a);
+    CORRADE_COMPARE(a.data(), data);
+    CORRADE_COMPARE(a.size(), 100000);
+    CORRADE_VERIFY(!arrayIsGrowable<Allocator>(a));
+    CORRADE_COMPARE(arrayCapacity<Allocator>(a), 100000);
+    CORRADE_COMPARE(a[0], 0);
+    CORRADE_COMPARE(a[99999], 99999);
+
+    /* Shrinking again does nothing */
+    arrayShrink<Allocator>(a);
+    CORRADE_COMPARE(a.data(), data);
+
+    /* Appending to it again allocates a new growable array */
+    arrayAppend<Allocator>(a, 100000);
+    CORRADE_VERIFY(arrayIsGrowable<Allocator>(a));
+    CORRADE_COMPARE(a.size(), 100001);
+    CORRADE_COMPARE(a[99999], 99999);
+    CORRADE_COMPARE(a[100000], 100000);
+}
+
+template<template<class> class Allocator> void ArrayMmapAllocatorTest::shrinkAfterRemove() {
+    setTestCaseTemplateName(AllocatorName<Allocator>::name());
+
+    Array<int> a;
+    arrayResize<Allocator>(a, NoInit, 1000000);
+    for(std::size_t i = 0; i != a.size(); ++i) a[i] = int(i);
+
+    /* The discarded pages are right after the remaining data, which have to
+       stay intact */
+    arrayRemoveSuffix<Allocator>(a, 999000);
+    arrayShrink<Allocator>(a);
+    CORRADE_COMPARE(a.size(), 1000);
+    CORRADE_COMPARE(a[0], 0);
+    CORRADE_COMPARE(a[999], 999);
+
+    /* Shrinking an empty array discards everything except the header
+       page */
+    Array<int> b;
+    arrayResize<Allocator>(b, NoInit, 1000000);
+    arrayResize<Allocator>(b, NoInit, 0);
+    arrayShrink<Allocator>(b);
+    CORRADE_COMPARE(b.size(), 0);
+    CORRADE_VERIFY(!arrayIsGrowable<Allocator>(b));
+}
+
+void ArrayMmapAllocatorTest::shrinkDefaultInit() {
+    Array<int> a;
+    arrayAppend<ArrayMmapAllocator>(a, {1, 2, 3});
+
+    /* This overload has to produce an array with a default deleter, so a
+       copy is made */
+    arrayShrink<int, ArrayMmapAllocator<int>>(a, DefaultInit);
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a[2], 3);
+    CORRADE_VERIFY(!a.deleter());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::ArrayMmapAllocatorTest)
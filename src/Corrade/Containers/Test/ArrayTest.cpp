@@ -77,6 +77,10 @@ struct ArrayTest: TestSuite::Tester {
     void constructValueInit();
     void constructNoInitNonTrivial();
     void constructNoInitTrivial();
+    void constructAligned();
+    void constructAlignedNonTrivial();
+    void constructAlignedZeroSize();
+    void constructAlignedInvalid();
     void constructDirectInit();
     void constructInPlaceInit();
     void constructFromExisting();
@@ -134,6 +138,10 @@ ArrayTest::ArrayTest() {
               &ArrayTest::constructValueInit,
               &ArrayTest::constructNoInitNonTrivial,
               &ArrayTest::constructNoInitTrivial,
+              &ArrayTest::constructAligned,
+              &ArrayTest::constructAlignedNonTrivial,
+              &ArrayTest::constructAlignedZeroSize,
+              &ArrayTest::constructAlignedInvalid,
               &ArrayTest::constructDirectInit,
               &ArrayTest::constructInPlaceInit,
               &ArrayTest::constructFromExisting,
@@ -267,6 +275,89 @@ void ArrayTest::constructNoInitNonTrivial() {
     CORRADE_COMPARE(Foo::constructorCallCount, 7);
 }
 
+void ArrayTest::constructAligned() {
+    const Array a{DefaultInit, 5, 64};
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_VERIFY(a.deleter());
+    CORRADE_COMPARE(reinterpret_cast<std::size_t>(a.data()) % 64, 0);
+
+    const Array b{ValueInit, 7, 4096};
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(b.size(), 7);
+    CORRADE_VERIFY(b.deleter());
+    CORRADE_COMPARE(reinterpret_cast<std::size_t>(b.data()) % 4096, 0);
+    for(std::size_t i = 0; i != b.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(b[i], 0);
+    }
+
+    const Array c{NoInit, 3, 128};
+    CORRADE_VERIFY(c);
+    CORRADE_COMPARE(c.size(), 3);
+    CORRADE_VERIFY(c.deleter());
+    CORRADE_COMPARE(reinterpret_cast<std::size_t>(c.data()) % 128, 0);
+
+    /* Alignment smaller than the type alignment is rounded up */
+    const Containers::Array<double> d{ValueInit, 3, 1};
+    CORRADE_COMPARE(reinterpret_cast<std::size_t>(d.data()) % alignof(double), 0);
+    CORRADE_COMPARE(d[2], 0.0);
+}
+
+struct Counted {
+    static int constructed;
+    static int destructed;
+    Counted() { ++constructed; }
+    ~Counted() { ++destructed; }
+};
+
+int Counted::constructed = 0;
+int Counted::destructed = 0;
+
+void ArrayTest::constructAlignedNonTrivial() {
+    Counted::constructed = Counted::destructed = 0;
+
+    {
+        const Containers::Array<Counted> a{NoInit, 5, 64};
+        CORRADE_COMPARE(reinterpret_cast<std::size_t>(a.data()) % 64, 0);
+        CORRADE_COMPARE(Counted::constructed, 0);
+
+        const Containers::Array<Counted> b{DefaultInit, 3, 64};
+        CORRADE_COMPARE(reinterpret_cast<std::size_t>(b.data()) % 64, 0);
+        CORRADE_COMPARE(Counted::constructed, 3);
+
+        const Containers::Array<Counted> c{ValueInit, 2, 256};
+        CORRADE_COMPARE(reinterpret_cast<std::size_t>(c.data()) % 256, 0);
+        CORRADE_COMPARE(Counted::constructed, 5);
+    }
+
+    /* Destructors are called on all elements, including the ones that were
+       not constructed, same as with Array(NoInitT, std::size_t) */
+    CORRADE_COMPARE(Counted::destructed, 10);
+}
+
+void ArrayTest::constructAlignedZeroSize() {
+    const Array a{ValueInit, 0, 64};
+    CORRADE_VERIFY(!a);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.deleter());
+}
+
+void ArrayTest::constructAlignedInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::stringstream out;
+    Error redirectError{&out};
+
+    Array a{NoInit, 5, 0};
+    Array b{ValueInit, 5, 48};
+    CORRADE_COMPARE(out.str(),
+        "Containers::Array: alignment expected to be a power of two, got 0\n"
+        "Containers::Array: alignment expected to be a power of two, got 48\n");
+}
+
 void ArrayTest::constructDirectInit() {
     const Array a{DirectInit, 2, -37};
     CORRADE_VERIFY(a);
@@ -28,6 +28,7 @@
 #include "Corrade/Containers/ArrayView.h"
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/Utility/DebugStl.h" /** @todo remove when <sstream> is gone */
+#include "Corrade/Utility/Macros.h"
 
 namespace {
 
@@ -132,6 +133,8 @@ struct ArrayViewTest: TestSuite::Tester {
     void accessVoid();
     void accessConstVoid();
     void accessInvalid();
+    void accessAligned();
+    void accessAlignedInvalid();
     void rangeBasedFor();
 
     void sliceInvalid();
@@ -190,6 +193,8 @@ ArrayViewTest::ArrayViewTest() {
               &ArrayViewTest::accessVoid,
               &ArrayViewTest::accessConstVoid,
               &ArrayViewTest::accessInvalid,
+              &ArrayViewTest::accessAligned,
+              &ArrayViewTest::accessAlignedInvalid,
               &ArrayViewTest::rangeBasedFor,
 
               &ArrayViewTest::sliceInvalid,
@@ -890,6 +895,40 @@ void ArrayViewTest::accessInvalid() {
         "Containers::ArrayView::back(): view is empty\n");
 }
 
+void ArrayViewTest::accessAligned() {
+    CORRADE_ALIGNAS(32) int a[16]{};
+    ArrayView b = a;
+    CORRADE_VERIFY(b.alignedData<32>() == a);
+    CORRADE_VERIFY(b.alignedData<16>() == a);
+
+    /* Only the data pointer matters, not the size */
+    CORRADE_VERIFY(b.slice(8, 11).alignedData<32>() == a + 8);
+
+    Containers::ArrayView<const int> c = a;
+    const int* data = c.alignedData<32>();
+    CORRADE_VERIFY(data == a);
+
+    /* A null pointer is aligned */
+    CORRADE_VERIFY(!ArrayView{}.alignedData<64>());
+}
+
+void ArrayViewTest::accessAlignedInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    CORRADE_ALIGNAS(32) int a[16]{};
+    ArrayView b = a;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    b.slice(1, 16).alignedData<32>();
+
+    std::ostringstream expected;
+    Debug{&expected} << "Containers::ArrayView::alignedData(): expected data to be aligned to 32 bytes but got" << reinterpret_cast<const void*>(a + 1);
+    CORRADE_COMPARE(out.str(), expected.str());
+}
+
 void ArrayViewTest::rangeBasedFor() {
     int a[5];
     ArrayView b = a;
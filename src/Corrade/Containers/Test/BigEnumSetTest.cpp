@@ -51,6 +51,9 @@ struct BigEnumSetTest: TestSuite::Tester {
     void operatorInverse();
     void compare();
 
+    void iterate();
+    void iterateEmpty();
+
     void templateFriendOperators();
 
     void debug();
@@ -71,6 +74,9 @@ BigEnumSetTest::BigEnumSetTest() {
               &BigEnumSetTest::operatorInverse,
               &BigEnumSetTest::compare,
 
+              &BigEnumSetTest::iterate,
+              &BigEnumSetTest::iterateEmpty,
+
               &BigEnumSetTest::templateFriendOperators,
 
               &BigEnumSetTest::debug});
@@ -451,6 +457,40 @@ void BigEnumSetTest::compare() {
     CORRADE_VERIFY(cFeaturesGreaterEqual);
 }
 
+void BigEnumSetTest::iterate() {
+    /* Values in the first and last word and an empty word in between */
+    Features features = Feature::Popular|Feature::Cheap|Feature::Fast|Feature(255)|Feature(0);
+
+    Feature values[8];
+    std::size_t count = 0;
+    for(Feature i: features) {
+        CORRADE_ITERATION(count);
+        CORRADE_VERIFY(count < 8);
+        values[count++] = i;
+    }
+
+    /* Goes from the smallest to the largest */
+    CORRADE_COMPARE(count, 5);
+    CORRADE_COMPARE(std::uint16_t(values[0]), 0);
+    CORRADE_COMPARE(std::uint16_t(values[1]), 1);
+    CORRADE_COMPARE(std::uint16_t(values[2]), 41);
+    CORRADE_COMPARE(std::uint16_t(values[3]), 197);
+    CORRADE_COMPARE(std::uint16_t(values[4]), 255);
+}
+
+void BigEnumSetTest::iterateEmpty() {
+    Features features;
+    CORRADE_VERIFY(features.begin() == features.end());
+
+    /* All bits set visits all values */
+    std::size_t count = 0;
+    for(Feature i: ~features) {
+        CORRADE_COMPARE(std::uint16_t(i), count);
+        ++count;
+    }
+    CORRADE_COMPARE(count, 256);
+}
+
 template<class T> struct Foo {
     enum class Flag: std::uint8_t {
         A = 25,
@@ -0,0 +1,199 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/BitArray.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct BitArrayTest: TestSuite::Tester {
+    explicit BitArrayTest();
+
+    void constructDefault();
+    void constructValueInit();
+    void constructNoInit();
+    void constructDirectInit();
+    void constructSize();
+    void constructCopy();
+    void constructMove();
+
+    void convertView();
+    void convertMutableView();
+
+    void access();
+    void setAll();
+    void count();
+    void setBitIndices();
+};
+
+BitArrayTest::BitArrayTest() {
+    addTests({&BitArrayTest::constructDefault,
+              &BitArrayTest::constructValueInit,
+              &BitArrayTest::constructNoInit,
+              &BitArrayTest::constructDirectInit,
+              &BitArrayTest::constructSize,
+              &BitArrayTest::constructCopy,
+              &BitArrayTest::constructMove,
+
+              &BitArrayTest::convertView,
+              &BitArrayTest::convertMutableView,
+
+              &BitArrayTest::access,
+              &BitArrayTest::setAll,
+              &BitArrayTest::count,
+              &BitArrayTest::setBitIndices});
+}
+
+void BitArrayTest::constructDefault() {
+    BitArray a;
+    CORRADE_VERIFY(!a.data());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+}
+
+void BitArrayTest::constructValueInit() {
+    BitArray a{ValueInit, 97};
+    CORRADE_VERIFY(a.data());
+    CORRADE_COMPARE(a.size(), 97);
+    CORRADE_VERIFY(!a.isEmpty());
+    CORRADE_COMPARE(a.count(), 0);
+    /* Storage is allocated in 64-bit words */
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(a.data()) % alignof(std::uint64_t), 0);
+}
+
+void BitArrayTest::constructNoInit() {
+    BitArray a{NoInit, 97};
+    CORRADE_VERIFY(a.data());
+    CORRADE_COMPARE(a.size(), 97);
+}
+
+void BitArrayTest::constructDirectInit() {
+    BitArray a{DirectInit, 97, true};
+    CORRADE_COMPARE(a.size(), 97);
+    CORRADE_COMPARE(a.count(), 97);
+
+    BitArray b{DirectInit, 97, false};
+    CORRADE_COMPARE(b.size(), 97);
+    CORRADE_COMPARE(b.count(), 0);
+}
+
+void BitArrayTest::constructSize() {
+    BitArray a{33};
+    CORRADE_COMPARE(a.size(), 33);
+    CORRADE_COMPARE(a.count(), 0);
+}
+
+void BitArrayTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<BitArray>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<BitArray>::value);
+}
+
+void BitArrayTest::constructMove() {
+    BitArray a{DirectInit, 70, true};
+    const char* data = a.data();
+
+    BitArray b = std::move(a);
+    CORRADE_VERIFY(!a.data());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(b.data(), data);
+    CORRADE_COMPARE(b.size(), 70);
+
+    BitArray c{5};
+    c = std::move(b);
+    CORRADE_COMPARE(c.data(), data);
+    CORRADE_COMPARE(c.size(), 70);
+    CORRADE_COMPARE(b.size(), 5);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<BitArray>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<BitArray>::value);
+}
+
+void BitArrayTest::convertView() {
+    const BitArray a{DirectInit, 70, true};
+    BitArrayView b = a;
+    CORRADE_COMPARE(b.data(), a.data());
+    CORRADE_COMPARE(b.offset(), 0);
+    CORRADE_COMPARE(b.size(), 70);
+}
+
+void BitArrayTest::convertMutableView() {
+    BitArray a{70};
+    MutableBitArrayView b = a;
+    CORRADE_COMPARE(b.data(), a.data());
+    CORRADE_COMPARE(b.offset(), 0);
+    CORRADE_COMPARE(b.size(), 70);
+
+    b.set(69);
+    CORRADE_VERIFY(a[69]);
+}
+
+void BitArrayTest::access() {
+    BitArray a{70};
+    a.set(3);
+    a.set(64);
+    a.set(69, true);
+    CORRADE_VERIFY(a[3]);
+    CORRADE_VERIFY(!a[4]);
+    CORRADE_VERIFY(a[64]);
+    CORRADE_VERIFY(a[69]);
+    CORRADE_COMPARE(a.data()[0], '\x08');
+    CORRADE_COMPARE(a.data()[8], '\x21');
+
+    a.reset(3);
+    a.set(64, false);
+    CORRADE_VERIFY(!a[3]);
+    CORRADE_VERIFY(!a[64]);
+    CORRADE_VERIFY(a[69]);
+}
+
+void BitArrayTest::setAll() {
+    BitArray a{70};
+    a.setAll();
+    CORRADE_COMPARE(a.count(), 70);
+    a.resetAll();
+    CORRADE_COMPARE(a.count(), 0);
+}
+
+void BitArrayTest::count() {
+    BitArray a{200};
+    for(std::size_t i = 0; i < 200; i += 3) a.set(i);
+    CORRADE_COMPARE(a.count(), 67);
+}
+
+void BitArrayTest::setBitIndices() {
+    BitArray a{200};
+    for(std::size_t i = 0; i < 200; i += 3) a.set(i);
+
+    std::size_t expected = 0;
+    for(std::size_t i: a.setBitIndices()) {
+        CORRADE_COMPARE(i, expected);
+        expected += 3;
+    }
+    CORRADE_COMPARE(expected, 201);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::BitArrayTest)
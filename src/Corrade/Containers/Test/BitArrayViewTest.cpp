@@ -0,0 +1,631 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+
+#include "Corrade/Containers/BitArrayView.h"
+#include "Corrade/Containers/Implementation/bitArrayView.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/DebugStl.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct BitArrayViewTest: TestSuite::Tester {
+    explicit BitArrayViewTest();
+
+    void constructDefault();
+    void construct();
+    void constructInvalidOffset();
+    void constructMutableToConst();
+
+    void access();
+    void accessOffset();
+    void set();
+    void reset();
+    void setValue();
+
+    void slice();
+    void sliceInvalid();
+
+    void setAll();
+    void resetAll();
+    void fillRange();
+
+    void count();
+    void countOffset();
+
+    void setBitIndices();
+    void setBitIndicesEmpty();
+    void setBitIndicesOffset();
+
+    void bitwiseOperation();
+    void bitwiseOperationSameOffset();
+    void bitwiseOperationInPlace();
+    void bitwiseOperationInvalidSize();
+
+    void countImplementation();
+    void bitwiseOperationImplementation();
+};
+
+const struct {
+    const char* name;
+    std::size_t aOffset, bOffset, outOffset, size;
+} BitwiseOperationData[]{
+    {"all aligned", 0, 0, 0, 500},
+    {"all aligned, less than a word", 0, 0, 0, 37},
+    {"same offset", 5, 5, 5, 500},
+    {"same offset, less than a byte", 5, 5, 5, 2},
+    {"different offsets", 3, 0, 7, 500},
+    {"different offsets, less than a word", 1, 6, 2, 61},
+    {"empty", 3, 2, 1, 0}
+};
+
+/* Each variant is tested directly as the dispatcher picks just one. POPCNT
+   isn't a part of the regular instruction set chain, so the count variants
+   are picked by passing the features to the dispatcher. */
+const struct {
+    const char* name;
+    Utility::Cpu::Features features;
+} CountImplementationData[]{
+    {"scalar", {}},
+    #ifdef CORRADE_ENABLE_POPCNT
+    {"POPCNT", Utility::Cpu::Feature::Popcnt},
+    #endif
+    #if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_POPCNT)
+    {"AVX2", Utility::Cpu::Feature::Avx2|Utility::Cpu::Feature::Popcnt},
+    #endif
+};
+
+const struct {
+    const char* name;
+    Utility::Cpu::Features features;
+    Implementation::BitArrayOperationFunction(*and_)();
+    Implementation::BitArrayOperationFunction(*or_)();
+    Implementation::BitArrayOperationFunction(*xor_)();
+    Implementation::BitArrayOperationFunction(*andNot)();
+} BitwiseOperationImplementationData[]{
+    {"scalar", {}, [] {
+        return Implementation::bitArrayAndImplementation(Utility::Cpu::Scalar);
+    }, [] {
+        return Implementation::bitArrayOrImplementation(Utility::Cpu::Scalar);
+    }, [] {
+        return Implementation::bitArrayXorImplementation(Utility::Cpu::Scalar);
+    }, [] {
+        return Implementation::bitArrayAndNotImplementation(Utility::Cpu::Scalar);
+    }},
+    #ifdef CORRADE_ENABLE_SSE2
+    {"SSE2", Utility::Cpu::Feature::Sse2, [] {
+        return Implementation::bitArrayAndImplementation(Utility::Cpu::Sse2);
+    }, [] {
+        return Implementation::bitArrayOrImplementation(Utility::Cpu::Sse2);
+    }, [] {
+        return Implementation::bitArrayXorImplementation(Utility::Cpu::Sse2);
+    }, [] {
+        return Implementation::bitArrayAndNotImplementation(Utility::Cpu::Sse2);
+    }},
+    #endif
+    #ifdef CORRADE_ENABLE_AVX2
+    {"AVX2", Utility::Cpu::Feature::Avx2, [] {
+        return Implementation::bitArrayAndImplementation(Utility::Cpu::Avx2);
+    }, [] {
+        return Implementation::bitArrayOrImplementation(Utility::Cpu::Avx2);
+    }, [] {
+        return Implementation::bitArrayXorImplementation(Utility::Cpu::Avx2);
+    }, [] {
+        return Implementation::bitArrayAndNotImplementation(Utility::Cpu::Avx2);
+    }},
+    #endif
+};
+
+/* Word count for the above, chosen so there's a partial block at the end in
+   all variants */
+constexpr std::size_t ImplementationWordCount = 37;
+
+BitArrayViewTest::BitArrayViewTest() {
+    addTests({&BitArrayViewTest::constructDefault,
+              &BitArrayViewTest::construct,
+              &BitArrayViewTest::constructInvalidOffset,
+              &BitArrayViewTest::constructMutableToConst,
+
+              &BitArrayViewTest::access,
+              &BitArrayViewTest::accessOffset,
+              &BitArrayViewTest::set,
+              &BitArrayViewTest::reset,
+              &BitArrayViewTest::setValue,
+
+              &BitArrayViewTest::slice,
+              &BitArrayViewTest::sliceInvalid,
+
+              &BitArrayViewTest::setAll,
+              &BitArrayViewTest::resetAll,
+              &BitArrayViewTest::fillRange,
+
+              &BitArrayViewTest::count,
+              &BitArrayViewTest::countOffset,
+
+              &BitArrayViewTest::setBitIndices,
+              &BitArrayViewTest::setBitIndicesEmpty,
+              &BitArrayViewTest::setBitIndicesOffset});
+
+    addInstancedTests({&BitArrayViewTest::bitwiseOperation},
+        Containers::arraySize(BitwiseOperationData));
+
+    addTests({&BitArrayViewTest::bitwiseOperationSameOffset,
+              &BitArrayViewTest::bitwiseOperationInPlace,
+              &BitArrayViewTest::bitwiseOperationInvalidSize});
+
+    addInstancedTests({&BitArrayViewTest::countImplementation},
+        Containers::arraySize(CountImplementationData));
+
+    addInstancedTests({&BitArrayViewTest::bitwiseOperationImplementation},
+        Containers::arraySize(BitwiseOperationImplementationData));
+}
+
+void BitArrayViewTest::constructDefault() {
+    BitArrayView a;
+    BitArrayView b = nullptr;
+    CORRADE_VERIFY(!a.data());
+    CORRADE_VERIFY(!b.data());
+    CORRADE_COMPARE(a.offset(), 0);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+
+    constexpr BitArrayView ca;
+    constexpr std::size_t size = ca.size();
+    CORRADE_COMPARE(size, 0);
+}
+
+void BitArrayViewTest::construct() {
+    const char data[4]{};
+    BitArrayView a{data, 5, 24};
+    CORRADE_COMPARE(a.data(), &data[0]);
+    CORRADE_COMPARE(a.offset(), 5);
+    CORRADE_COMPARE(a.size(), 24);
+    CORRADE_VERIFY(!a.isEmpty());
+}
+
+void BitArrayViewTest::constructInvalidOffset() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const char data[1]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    BitArrayView{data, 8, 0};
+    CORRADE_COMPARE(out.str(), "Containers::BitArrayView: offset expected to be smaller than 8 bits, got 8\n");
+}
+
+void BitArrayViewTest::constructMutableToConst() {
+    char data[4]{};
+    MutableBitArrayView a{data, 3, 20};
+    BitArrayView b = a;
+    CORRADE_COMPARE(b.data(), &data[0]);
+    CORRADE_COMPARE(b.offset(), 3);
+    CORRADE_COMPARE(b.size(), 20);
+
+    CORRADE_VERIFY((std::is_convertible<MutableBitArrayView, BitArrayView>::value));
+    CORRADE_VERIFY(!(std::is_convertible<BitArrayView, MutableBitArrayView>::value));
+}
+
+void BitArrayViewTest::access() {
+    /* 0b00000101, 0b10000000 */
+    const char data[]{'\x05', '\x80'};
+    BitArrayView a{data, 0, 16};
+    CORRADE_VERIFY(a[0]);
+    CORRADE_VERIFY(!a[1]);
+    CORRADE_VERIFY(a[2]);
+    CORRADE_VERIFY(!a[3]);
+    CORRADE_VERIFY(!a[14]);
+    CORRADE_VERIFY(a[15]);
+}
+
+void BitArrayViewTest::accessOffset() {
+    const char data[]{'\x05', '\x80'};
+    BitArrayView a{data, 2, 14};
+    CORRADE_VERIFY(a[0]);
+    CORRADE_VERIFY(!a[1]);
+    CORRADE_VERIFY(!a[12]);
+    CORRADE_VERIFY(a[13]);
+}
+
+void BitArrayViewTest::set() {
+    char data[2]{};
+    MutableBitArrayView a{data, 3, 13};
+    a.set(0);
+    a.set(4);
+    a.set(12);
+    CORRADE_COMPARE(data[0], '\x88');
+    CORRADE_COMPARE(data[1], '\x80');
+    CORRADE_VERIFY(a[0]);
+    CORRADE_VERIFY(!a[1]);
+    CORRADE_VERIFY(a[4]);
+    CORRADE_VERIFY(a[12]);
+}
+
+void BitArrayViewTest::reset() {
+    char data[]{'\xff', '\xff'};
+    MutableBitArrayView a{data, 3, 13};
+    a.reset(0);
+    a.reset(4);
+    a.reset(12);
+    CORRADE_COMPARE(data[0], '\x77');
+    CORRADE_COMPARE(data[1], '\x7f');
+}
+
+void BitArrayViewTest::setValue() {
+    char data[]{'\x0f'};
+    MutableBitArrayView a{data, 0, 8};
+    a.set(0, false);
+    a.set(1, true);
+    a.set(4, true);
+    a.set(5, false);
+    CORRADE_COMPARE(data[0], '\x1e');
+}
+
+void BitArrayViewTest::slice() {
+    const char data[]{'\x00', '\x00', '\x10'};
+    BitArrayView a{data, 3, 21};
+
+    BitArrayView b = a.slice(7, 19);
+    CORRADE_COMPARE(b.data(), &data[1]);
+    CORRADE_COMPARE(b.offset(), 2);
+    CORRADE_COMPARE(b.size(), 12);
+    /* Bit 20 of the data, i.e. bit 17 of a and bit 10 of b */
+    CORRADE_VERIFY(a[17]);
+    CORRADE_VERIFY(b[10]);
+    CORRADE_VERIFY(!b[9]);
+
+    BitArrayView prefix = a.prefix(5);
+    CORRADE_COMPARE(prefix.data(), &data[0]);
+    CORRADE_COMPARE(prefix.offset(), 3);
+    CORRADE_COMPARE(prefix.size(), 5);
+
+    BitArrayView suffix = a.suffix(5);
+    CORRADE_COMPARE(suffix.data(), &data[1]);
+    CORRADE_COMPARE(suffix.offset(), 0);
+    CORRADE_COMPARE(suffix.size(), 16);
+
+    BitArrayView except = a.except(5);
+    CORRADE_COMPARE(except.data(), &data[0]);
+    CORRADE_COMPARE(except.offset(), 3);
+    CORRADE_COMPARE(except.size(), 16);
+}
+
+void BitArrayViewTest::sliceInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const char data[2]{};
+    BitArrayView a{data, 1, 15};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.slice(5, 16);
+    a.slice(6, 5);
+    CORRADE_COMPARE(out.str(),
+        "Containers::BitArrayView::slice(): slice [5:16] out of range for 15 bits\n"
+        "Containers::BitArrayView::slice(): slice [6:5] out of range for 15 bits\n");
+}
+
+void BitArrayViewTest::setAll() {
+    char data[20]{};
+    MutableBitArrayView{data, 0, 160}.setAll();
+    for(std::size_t i = 0; i != 20; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[i], '\xff');
+    }
+}
+
+void BitArrayViewTest::resetAll() {
+    char data[20];
+    for(char& i: data) i = '\xff';
+    MutableBitArrayView{data, 0, 160}.resetAll();
+    for(std::size_t i = 0; i != 20; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[i], '\x00');
+    }
+}
+
+void BitArrayViewTest::fillRange() {
+    /* Bits outside of the view stay untouched */
+    char data[5]{};
+    MutableBitArrayView{data, 0, 40}.slice(3, 30).setAll();
+    CORRADE_COMPARE(data[0], '\xf8');
+    CORRADE_COMPARE(data[1], '\xff');
+    CORRADE_COMPARE(data[2], '\xff');
+    CORRADE_COMPARE(data[3], '\x3f');
+    CORRADE_COMPARE(data[4], '\x00');
+
+    MutableBitArrayView{data, 0, 40}.slice(5, 6).resetAll();
+    CORRADE_COMPARE(data[0], '\xd8');
+
+    /* Within a single byte */
+    char single[1]{};
+    MutableBitArrayView{single, 2, 3}.setAll();
+    CORRADE_COMPARE(single[0], '\x1c');
+}
+
+void BitArrayViewTest::count() {
+    char data[64]{};
+    MutableBitArrayView a{data, 0, 512};
+    CORRADE_COMPARE(a.count(), 0);
+
+    a.set(0);
+    a.set(63);
+    a.set(64);
+    a.set(200);
+    a.set(511);
+    CORRADE_COMPARE(a.count(), 5);
+    CORRADE_COMPARE(a.prefix(511).count(), 4);
+    CORRADE_COMPARE(a.slice(1, 64).count(), 1);
+
+    a.setAll();
+    CORRADE_COMPARE(a.count(), 512);
+    CORRADE_COMPARE(a.prefix(77).count(), 77);
+}
+
+void BitArrayViewTest::countOffset() {
+    char data[64];
+    for(char& i: data) i = '\xff';
+    for(std::size_t offset = 0; offset != 8; ++offset) {
+        for(std::size_t size: {0, 1, 7, 63, 64, 65, 200, 504}) {
+            CORRADE_ITERATION(offset << Utility::Debug::nospace << ":" << Utility::Debug::nospace << size);
+            CORRADE_COMPARE((BitArrayView{data, offset, size}.count()), size);
+        }
+    }
+
+    /* Bits around the view aren't counted */
+    char sparse[]{'\x81', '\x81', '\x81'};
+    CORRADE_COMPARE((BitArrayView{sparse, 1, 22}.count()), 4);
+    CORRADE_COMPARE((BitArrayView{sparse, 0, 24}.count()), 6);
+}
+
+void BitArrayViewTest::setBitIndices() {
+    char data[40]{};
+    MutableBitArrayView a{data, 0, 320};
+    const std::size_t expected[]{0, 5, 63, 64, 65, 127, 250, 319};
+    for(std::size_t i: expected) a.set(i);
+
+    std::size_t count = 0;
+    for(std::size_t i: a.setBitIndices()) {
+        CORRADE_ITERATION(count);
+        CORRADE_VERIFY(count < Containers::arraySize(expected));
+        CORRADE_COMPARE(i, expected[count]);
+        ++count;
+    }
+    CORRADE_COMPARE(count, Containers::arraySize(expected));
+}
+
+void BitArrayViewTest::setBitIndicesEmpty() {
+    char data[40]{};
+    MutableBitArrayView a{data, 0, 320};
+    CORRADE_VERIFY(a.setBitIndices().begin() == a.setBitIndices().end());
+
+    BitArrayView empty;
+    CORRADE_VERIFY(empty.setBitIndices().begin() == empty.setBitIndices().end());
+
+    /* Bits after the end aren't visited */
+    a.set(319);
+    CORRADE_VERIFY(a.prefix(319).setBitIndices().begin() == a.prefix(319).setBitIndices().end());
+}
+
+void BitArrayViewTest::setBitIndicesOffset() {
+    char data[]{'\x81', '\x81', '\x81'};
+    const std::size_t expected[]{6, 7, 14, 15};
+
+    std::size_t count = 0;
+    for(std::size_t i: BitArrayView{data, 1, 22}.setBitIndices()) {
+        CORRADE_ITERATION(count);
+        CORRADE_VERIFY(count < Containers::arraySize(expected));
+        CORRADE_COMPARE(i, expected[count]);
+        ++count;
+    }
+    CORRADE_COMPARE(count, Containers::arraySize(expected));
+}
+
+void BitArrayViewTest::bitwiseOperation() {
+    auto&& data = BitwiseOperationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Pseudo-random bit patterns, with guard bytes around the output */
+    char a[72], b[72], out[72];
+    for(std::size_t i = 0; i != 72; ++i) {
+        a[i] = char(i*37 + 11);
+        b[i] = char(i*101 + 7);
+    }
+
+    const BitArrayView aView{a, data.aOffset, data.size};
+    const BitArrayView bView{b, data.bOffset, data.size};
+
+    struct {
+        const char* name;
+        void(*function)(BitArrayView, BitArrayView, MutableBitArrayView);
+        bool(*expected)(bool, bool);
+    } operations[]{
+        {"and", bitArrayAnd, [](bool x, bool y) { return x && y; }},
+        {"or", bitArrayOr, [](bool x, bool y) { return x || y; }},
+        {"xor", bitArrayXor, [](bool x, bool y) { return x != y; }},
+        {"and not", bitArrayAndNot, [](bool x, bool y) { return x && !y; }},
+    };
+    for(auto&& operation: operations) {
+        CORRADE_ITERATION(operation.name);
+
+        for(char& i: out) i = '\x5a';
+        const MutableBitArrayView outView{out, data.outOffset, data.size};
+        operation.function(aView, bView, outView);
+
+        for(std::size_t i = 0; i != data.size; ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(outView[i], operation.expected(aView[i], bView[i]));
+        }
+
+        /* Bits around the output are untouched */
+        const MutableBitArrayView all{out, 0, sizeof(out)*8};
+        for(std::size_t i = 0; i != data.outOffset; ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(all[i], bool(0x5a & (1 << (i % 8))));
+        }
+        for(std::size_t i = data.outOffset + data.size; i != sizeof(out)*8; ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(all[i], bool(0x5a & (1 << (i % 8))));
+        }
+    }
+}
+
+void BitArrayViewTest::bitwiseOperationSameOffset() {
+    /* The aligned fast path picks whole words after the first byte
+       boundary */
+    char a[17], b[17], out[17]{};
+    for(char& i: a) i = '\xf0';
+    for(char& i: b) i = '\x3c';
+
+    bitArrayAnd({a, 4, 130}, {b, 4, 130}, {out, 4, 130});
+    CORRADE_COMPARE(out[0], '\x30');
+    for(std::size_t i = 1; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], '\x30');
+    }
+    /* 4 + 130 = 134 bits, so 6 bits in the last byte */
+    CORRADE_COMPARE(out[16], '\x30');
+
+    bitArrayXor({a, 4, 130}, {b, 4, 130}, {out, 4, 130});
+    CORRADE_COMPARE(out[0], '\xc0');
+    CORRADE_COMPARE(out[8], '\xcc');
+    CORRADE_COMPARE(out[16], '\x0c');
+}
+
+void BitArrayViewTest::bitwiseOperationInPlace() {
+    char a[]{'\x0f', '\xf0', '\xff'};
+    const char b[]{'\x3c', '\x3c', '\x3c'};
+    const MutableBitArrayView view{a, 0, 24};
+    bitArrayOr(view, {b, 0, 24}, view);
+    CORRADE_COMPARE(a[0], '\x3f');
+    CORRADE_COMPARE(a[1], '\xfc');
+    CORRADE_COMPARE(a[2], '\xff');
+
+    bitArrayAndNot(view, {b, 0, 24}, view);
+    CORRADE_COMPARE(a[0], '\x03');
+    CORRADE_COMPARE(a[1], '\xc0');
+    CORRADE_COMPARE(a[2], '\xc3');
+}
+
+void BitArrayViewTest::bitwiseOperationInvalidSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    char data[4]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    bitArrayAnd({data, 0, 16}, {data, 0, 15}, {data, 0, 16});
+    bitArrayOr({data, 0, 16}, {data, 0, 16}, {data, 0, 17});
+    bitArrayXor({data, 0, 15}, {data, 0, 16}, {data, 0, 16});
+    bitArrayAndNot({data, 0, 1}, {data, 0, 2}, {data, 0, 3});
+    CORRADE_COMPARE(out.str(),
+        "Containers::bitArrayAnd(): expected views of the same size but got 16, 15 and 16\n"
+        "Containers::bitArrayOr(): expected views of the same size but got 16, 16 and 17\n"
+        "Containers::bitArrayXor(): expected views of the same size but got 15, 16 and 16\n"
+        "Containers::bitArrayAndNot(): expected views of the same size but got 1, 2 and 3\n");
+}
+
+void BitArrayViewTest::countImplementation() {
+    auto&& data = CountImplementationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(Utility::Cpu::runtimeFeatures() >= data.features))
+        CORRADE_SKIP("Feature not supported by this CPU");
+
+    const Implementation::BitArrayCountFunction count = Implementation::bitArrayCountImplementation(data.features);
+
+    /* A byte past the end that should not get counted */
+    unsigned char bytes[ImplementationWordCount*8 + 1];
+    for(std::size_t i = 0; i != sizeof(bytes); ++i) bytes[i] = i*37 + 11;
+
+    for(const std::size_t wordCount: {std::size_t{0}, std::size_t{1}, std::size_t{4}, std::size_t{5}, ImplementationWordCount}) {
+        CORRADE_ITERATION(wordCount);
+
+        std::size_t expected = 0;
+        for(std::size_t i = 0; i != wordCount*8; ++i)
+            for(std::size_t j = 0; j != 8; ++j)
+                if(bytes[i] & (1 << j)) ++expected;
+
+        CORRADE_COMPARE(count(reinterpret_cast<const char*>(bytes), wordCount), expected);
+    }
+}
+
+void BitArrayViewTest::bitwiseOperationImplementation() {
+    auto&& data = BitwiseOperationImplementationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(Utility::Cpu::runtimeFeatures() >= data.features))
+        CORRADE_SKIP("Feature not supported by this CPU");
+
+    char a[ImplementationWordCount*8];
+    char b[ImplementationWordCount*8];
+    for(std::size_t i = 0; i != sizeof(a); ++i) {
+        a[i] = i*37 + 11;
+        b[i] = i*13 + 101;
+    }
+
+    const struct {
+        const char* name;
+        Implementation::BitArrayOperationFunction function;
+        char(*expected)(char, char);
+    } operations[]{
+        {"and", data.and_(), [](char x, char y) { return char(x & y); }},
+        {"or", data.or_(), [](char x, char y) { return char(x | y); }},
+        {"xor", data.xor_(), [](char x, char y) { return char(x ^ y); }},
+        {"and not", data.andNot(), [](char x, char y) { return char(x & ~y); }}
+    };
+
+    for(auto&& operation: operations) {
+        CORRADE_ITERATION(operation.name);
+
+        /* The byte after the last word should stay untouched */
+        char out[ImplementationWordCount*8 + 1];
+        char expected[ImplementationWordCount*8 + 1];
+        for(std::size_t i = 0; i != ImplementationWordCount*8; ++i)
+            expected[i] = operation.expected(a[i], b[i]);
+        out[ImplementationWordCount*8] = expected[ImplementationWordCount*8] = '-';
+
+        operation.function(a, b, out, ImplementationWordCount);
+        CORRADE_COMPARE(std::memcmp(out, expected, sizeof(out)), 0);
+
+        /* In-place operation, used by bitwiseOperationInPlace() */
+        char inPlace[ImplementationWordCount*8];
+        std::memcpy(inPlace, a, sizeof(a));
+        operation.function(inPlace, b, inPlace, ImplementationWordCount);
+        CORRADE_COMPARE(std::memcmp(inPlace, expected, sizeof(inPlace)), 0);
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::BitArrayViewTest)
@@ -0,0 +1,284 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "Corrade/Containers/ConcurrentQueue.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct ConcurrentQueueBenchmark: TestSuite::Tester {
+    explicit ConcurrentQueueBenchmark();
+
+    void ringBuffer();
+    void ringBufferBatch();
+    void concurrentQueue();
+    void concurrentQueueBatch();
+    void mutexDeque();
+};
+
+constexpr std::size_t ItemCount = 1 << 16;
+constexpr std::size_t Capacity = 1024;
+constexpr std::size_t BatchSize = 32;
+
+/* With a single thread the items are pushed and popped in alternating
+   batches by the same thread, otherwise half of the threads are producers
+   and half consumers */
+const struct {
+    const char* name;
+    std::size_t threads;
+} ThreadData[]{
+    {"1 thread", 1},
+    {"2 threads", 2},
+    {"4 threads", 4},
+    {"8 threads", 8},
+    {"16 threads", 16},
+    {"32 threads", 32},
+    {"64 threads", 64}
+};
+
+ConcurrentQueueBenchmark::ConcurrentQueueBenchmark() {
+    /* A RingBuffer supports just a single producer and consumer */
+    addInstancedBenchmarks({&ConcurrentQueueBenchmark::ringBuffer,
+                            &ConcurrentQueueBenchmark::ringBufferBatch}, 3, 2);
+
+    addInstancedBenchmarks({&ConcurrentQueueBenchmark::concurrentQueue,
+                            &ConcurrentQueueBenchmark::concurrentQueueBatch,
+                            &ConcurrentQueueBenchmark::mutexDeque}, 3,
+        Containers::arraySize(ThreadData));
+}
+
+/* Baseline to compare against, a bounded queue guarded by a mutex */
+template<class T> struct MutexDeque {
+    explicit MutexDeque(std::size_t capacity): capacity{capacity} {}
+
+    bool push(const T& value) {
+        std::lock_guard<std::mutex> lock{mutex};
+        if(deque.size() == capacity) return false;
+        deque.push_back(value);
+        return true;
+    }
+
+    std::size_t push(ArrayView<const T> values) {
+        std::lock_guard<std::mutex> lock{mutex};
+        std::size_t count = 0;
+        for(; count != values.size() && deque.size() != capacity; ++count)
+            deque.push_back(values[count]);
+        return count;
+    }
+
+    Optional<T> pop() {
+        std::lock_guard<std::mutex> lock{mutex};
+        if(deque.empty()) return {};
+        Optional<T> out{deque.front()};
+        deque.pop_front();
+        return out;
+    }
+
+    std::size_t pop(ArrayView<T> values) {
+        std::lock_guard<std::mutex> lock{mutex};
+        std::size_t count = 0;
+        for(; count != values.size() && !deque.empty(); ++count) {
+            values[count] = deque.front();
+            deque.pop_front();
+        }
+        return count;
+    }
+
+    std::mutex mutex;
+    std::deque<T> deque;
+    std::size_t capacity;
+};
+
+/* Returns a sum of all popped items */
+template<class Queue> std::size_t transfer(Queue& queue, std::size_t threads) {
+    /* Single thread, alternating between pushing and popping a batch */
+    if(threads == 1) {
+        std::size_t sum = 0;
+        for(std::size_t i = 0; i != ItemCount; i += BatchSize) {
+            for(std::size_t j = 0; j != BatchSize; ++j)
+                queue.push(i + j);
+            for(std::size_t j = 0; j != BatchSize; ++j)
+                sum += *queue.pop();
+        }
+        return sum;
+    }
+
+    const std::size_t producerCount = threads/2;
+    const std::size_t consumerCount = threads - producerCount;
+    const std::size_t perProducer = ItemCount/producerCount;
+
+    std::atomic<std::size_t> popped{0};
+    std::atomic<std::size_t> sum{0};
+    Array<std::thread> producers{producerCount};
+    Array<std::thread> consumers{consumerCount};
+    for(std::size_t i = 0; i != producerCount; ++i) {
+        producers[i] = std::thread{[&queue, i, perProducer]() {
+            for(std::size_t j = i*perProducer, end = j + perProducer; j != end; ++j)
+                while(!queue.push(j)) std::this_thread::yield();
+        }};
+    }
+    for(std::size_t i = 0; i != consumerCount; ++i) {
+        consumers[i] = std::thread{[&queue, &popped, &sum]() {
+            std::size_t localSum = 0;
+            while(popped.load(std::memory_order_relaxed) != ItemCount) {
+                if(Optional<std::size_t> value = queue.pop()) {
+                    localSum += *value;
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                } else std::this_thread::yield();
+            }
+            sum.fetch_add(localSum);
+        }};
+    }
+
+    for(std::thread& i: producers) i.join();
+    for(std::thread& i: consumers) i.join();
+    return sum;
+}
+
+template<class Queue> std::size_t transferBatch(Queue& queue, std::size_t threads) {
+    /* Single thread, alternating between pushing and popping a batch */
+    if(threads == 1) {
+        std::size_t sum = 0;
+        std::size_t batch[BatchSize];
+        for(std::size_t i = 0; i != ItemCount; i += BatchSize) {
+            for(std::size_t j = 0; j != BatchSize; ++j)
+                batch[j] = i + j;
+            queue.push(ArrayView<const std::size_t>{batch});
+            queue.pop(ArrayView<std::size_t>{batch});
+            for(std::size_t j = 0; j != BatchSize; ++j)
+                sum += batch[j];
+        }
+        return sum;
+    }
+
+    const std::size_t producerCount = threads/2;
+    const std::size_t consumerCount = threads - producerCount;
+    const std::size_t perProducer = ItemCount/producerCount;
+
+    std::atomic<std::size_t> popped{0};
+    std::atomic<std::size_t> sum{0};
+    Array<std::thread> producers{producerCount};
+    Array<std::thread> consumers{consumerCount};
+    for(std::size_t i = 0; i != producerCount; ++i) {
+        producers[i] = std::thread{[&queue, i, perProducer]() {
+            std::size_t batch[BatchSize];
+            for(std::size_t j = i*perProducer, end = j + perProducer; j != end; ) {
+                const std::size_t count = end - j < BatchSize ? end - j : BatchSize;
+                for(std::size_t k = 0; k != count; ++k)
+                    batch[k] = j + k;
+                const std::size_t pushed = queue.push(ArrayView<const std::size_t>{batch, count});
+                if(!pushed) std::this_thread::yield();
+                j += pushed;
+            }
+        }};
+    }
+    for(std::size_t i = 0; i != consumerCount; ++i) {
+        consumers[i] = std::thread{[&queue, &popped, &sum]() {
+            std::size_t batch[BatchSize];
+            std::size_t localSum = 0;
+            while(popped.load(std::memory_order_relaxed) != ItemCount) {
+                const std::size_t count = queue.pop(ArrayView<std::size_t>{batch});
+                if(!count) std::this_thread::yield();
+                for(std::size_t j = 0; j != count; ++j)
+                    localSum += batch[j];
+                popped.fetch_add(count, std::memory_order_relaxed);
+            }
+            sum.fetch_add(localSum);
+        }};
+    }
+
+    for(std::thread& i: producers) i.join();
+    for(std::thread& i: consumers) i.join();
+    return sum;
+}
+
+void ConcurrentQueueBenchmark::ringBuffer() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    RingBuffer<std::size_t> queue{Capacity};
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum = transfer(queue, data.threads);
+
+    CORRADE_COMPARE(sum, ItemCount*(ItemCount - 1)/2);
+}
+
+void ConcurrentQueueBenchmark::ringBufferBatch() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    RingBuffer<std::size_t> queue{Capacity};
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum = transferBatch(queue, data.threads);
+
+    CORRADE_COMPARE(sum, ItemCount*(ItemCount - 1)/2);
+}
+
+void ConcurrentQueueBenchmark::concurrentQueue() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ConcurrentQueue<std::size_t> queue{Capacity};
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum = transfer(queue, data.threads);
+
+    CORRADE_COMPARE(sum, ItemCount*(ItemCount - 1)/2);
+}
+
+void ConcurrentQueueBenchmark::concurrentQueueBatch() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ConcurrentQueue<std::size_t> queue{Capacity};
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum = transferBatch(queue, data.threads);
+
+    CORRADE_COMPARE(sum, ItemCount*(ItemCount - 1)/2);
+}
+
+void ConcurrentQueueBenchmark::mutexDeque() {
+    auto&& data = ThreadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    MutexDeque<std::size_t> queue{Capacity};
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum = transfer(queue, data.threads);
+
+    CORRADE_COMPARE(sum, ItemCount*(ItemCount - 1)/2);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::ConcurrentQueueBenchmark)
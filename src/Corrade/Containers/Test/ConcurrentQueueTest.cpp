@@ -0,0 +1,411 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/ConcurrentQueue.h"
+#include "Corrade/Containers/Pointer.h"
+#include "Corrade/TestSuite/Tester.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct ConcurrentQueueTest: TestSuite::Tester {
+    explicit ConcurrentQueueTest();
+
+    void construct();
+    void constructSmallCapacity();
+    void constructCopy();
+    void constructMove();
+
+    void pushPop();
+    void pushFull();
+    void popEmpty();
+    void wrapAround();
+    void emplace();
+    void moveOnly();
+
+    void pushBatch();
+    void pushBatchFull();
+    void popBatch();
+    void popBatchEmpty();
+
+    void destructRemaining();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void threaded();
+    void threadedBatch();
+    #endif
+};
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+const struct {
+    const char* name;
+    std::size_t producers, consumers;
+} ThreadedData[]{
+    {"1 producer, 1 consumer", 1, 1},
+    {"4 producers, 1 consumer", 4, 1},
+    {"1 producer, 4 consumers", 1, 4},
+    {"4 producers, 4 consumers", 4, 4}
+};
+#endif
+
+ConcurrentQueueTest::ConcurrentQueueTest() {
+    addTests({&ConcurrentQueueTest::construct,
+              &ConcurrentQueueTest::constructSmallCapacity,
+              &ConcurrentQueueTest::constructCopy,
+              &ConcurrentQueueTest::constructMove,
+
+              &ConcurrentQueueTest::pushPop,
+              &ConcurrentQueueTest::pushFull,
+              &ConcurrentQueueTest::popEmpty,
+              &ConcurrentQueueTest::wrapAround,
+              &ConcurrentQueueTest::emplace,
+              &ConcurrentQueueTest::moveOnly,
+
+              &ConcurrentQueueTest::pushBatch,
+              &ConcurrentQueueTest::pushBatchFull,
+              &ConcurrentQueueTest::popBatch,
+              &ConcurrentQueueTest::popBatchEmpty,
+
+              &ConcurrentQueueTest::destructRemaining});
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    addInstancedTests({&ConcurrentQueueTest::threaded,
+                       &ConcurrentQueueTest::threadedBatch},
+        Containers::arraySize(ThreadedData));
+    #endif
+}
+
+struct Counted {
+    static int constructed;
+    static int destructed;
+
+    /*implicit*/ Counted(int value = 0): value{value} { ++constructed; }
+    Counted(const Counted& other): value{other.value} { ++constructed; }
+    ~Counted() { ++destructed; }
+    Counted& operator=(const Counted&) = default;
+
+    int value;
+};
+
+int Counted::constructed = 0;
+int Counted::destructed = 0;
+
+void ConcurrentQueueTest::construct() {
+    ConcurrentQueue<int> a{100};
+    CORRADE_COMPARE(a.capacity(), 128);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+
+    ConcurrentQueue<int> b{64};
+    CORRADE_COMPARE(b.capacity(), 64);
+}
+
+void ConcurrentQueueTest::constructSmallCapacity() {
+    /* A single slot can't be distinguished between full and empty, so the
+       minimal capacity is 2 */
+    ConcurrentQueue<int> a{1};
+    CORRADE_COMPARE(a.capacity(), 2);
+    CORRADE_VERIFY(a.push(3));
+    CORRADE_VERIFY(a.push(4));
+    CORRADE_VERIFY(!a.push(5));
+    CORRADE_COMPARE(a.pop(), 3);
+    CORRADE_COMPARE(a.pop(), 4);
+    CORRADE_VERIFY(!a.pop());
+}
+
+void ConcurrentQueueTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<ConcurrentQueue<int>>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<ConcurrentQueue<int>>::value);
+}
+
+void ConcurrentQueueTest::constructMove() {
+    CORRADE_VERIFY(!std::is_move_constructible<ConcurrentQueue<int>>::value);
+    CORRADE_VERIFY(!std::is_move_assignable<ConcurrentQueue<int>>::value);
+}
+
+void ConcurrentQueueTest::pushPop() {
+    ConcurrentQueue<int> a{4};
+    CORRADE_VERIFY(a.push(1));
+    CORRADE_VERIFY(a.push(2));
+    CORRADE_VERIFY(a.push(3));
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_VERIFY(!a.isEmpty());
+
+    CORRADE_COMPARE(a.pop(), 1);
+    CORRADE_COMPARE(a.pop(), 2);
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(a.pop(), 3);
+    CORRADE_VERIFY(a.isEmpty());
+}
+
+void ConcurrentQueueTest::pushFull() {
+    ConcurrentQueue<int> a{4};
+    for(int i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(a.push(i));
+    }
+    CORRADE_VERIFY(!a.push(4));
+    CORRADE_COMPARE(a.size(), 4);
+
+    /* After popping one there's space again */
+    CORRADE_COMPARE(a.pop(), 0);
+    CORRADE_VERIFY(a.push(4));
+    CORRADE_VERIFY(!a.push(5));
+}
+
+void ConcurrentQueueTest::popEmpty() {
+    ConcurrentQueue<int> a{4};
+    CORRADE_VERIFY(!a.pop());
+
+    a.push(3);
+    CORRADE_COMPARE(a.pop(), 3);
+    CORRADE_VERIFY(!a.pop());
+}
+
+void ConcurrentQueueTest::wrapAround() {
+    ConcurrentQueue<int> a{4};
+    int next = 0, expected = 0;
+    for(std::size_t i = 0; i != 25; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(a.push(next++));
+        CORRADE_VERIFY(a.push(next++));
+        CORRADE_VERIFY(a.push(next++));
+        CORRADE_COMPARE(a.pop(), expected++);
+        CORRADE_COMPARE(a.pop(), expected++);
+        CORRADE_COMPARE(a.pop(), expected++);
+    }
+}
+
+void ConcurrentQueueTest::emplace() {
+    struct Pair {
+        int a;
+        float b;
+    };
+
+    ConcurrentQueue<Pair> a{2};
+    CORRADE_VERIFY(a.emplace(3, 1.5f));
+
+    Optional<Pair> out = a.pop();
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(out->a, 3);
+    CORRADE_COMPARE(out->b, 1.5f);
+}
+
+void ConcurrentQueueTest::moveOnly() {
+    ConcurrentQueue<Pointer<int>> a{2};
+    CORRADE_VERIFY(a.push(Pointer<int>{InPlaceInit, 5}));
+    CORRADE_VERIFY(a.emplace(new int{6}));
+
+    Optional<Pointer<int>> out = a.pop();
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(**out, 5);
+
+    Pointer<int> outBatch[2];
+    CORRADE_COMPARE(a.pop(outBatch), 1);
+    CORRADE_COMPARE(*outBatch[0], 6);
+    CORRADE_VERIFY(!outBatch[1]);
+}
+
+void ConcurrentQueueTest::pushBatch() {
+    ConcurrentQueue<int> a{8};
+    const int data[]{1, 2, 3, 4, 5};
+    CORRADE_COMPARE(a.push(data), 5);
+    CORRADE_COMPARE(a.size(), 5);
+
+    for(int i = 1; i != 6; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(a.pop(), i);
+    }
+
+    /* Batch crossing the end of the storage */
+    CORRADE_COMPARE(a.push(data), 5);
+    for(int i = 1; i != 6; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(a.pop(), i);
+    }
+
+    CORRADE_COMPARE(a.push(nullptr), 0);
+}
+
+void ConcurrentQueueTest::pushBatchFull() {
+    ConcurrentQueue<int> a{4};
+    a.push(0);
+    const int data[]{1, 2, 3, 4, 5};
+    CORRADE_COMPARE(a.push(data), 3);
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a.push(data), 0);
+
+    for(int i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(a.pop(), i);
+    }
+}
+
+void ConcurrentQueueTest::popBatch() {
+    ConcurrentQueue<int> a{8};
+    for(int i = 0; i != 6; ++i) a.push(i);
+
+    int out[4]{};
+    CORRADE_COMPARE(a.pop(out), 4);
+    CORRADE_COMPARE(out[0], 0);
+    CORRADE_COMPARE(out[1], 1);
+    CORRADE_COMPARE(out[2], 2);
+    CORRADE_COMPARE(out[3], 3);
+
+    /* Only two remaining */
+    CORRADE_COMPARE(a.pop(out), 2);
+    CORRADE_COMPARE(out[0], 4);
+    CORRADE_COMPARE(out[1], 5);
+    CORRADE_VERIFY(a.isEmpty());
+}
+
+void ConcurrentQueueTest::popBatchEmpty() {
+    ConcurrentQueue<int> a{8};
+    int out[4]{};
+    CORRADE_COMPARE(a.pop(out), 0);
+    CORRADE_COMPARE(a.pop(nullptr), 0);
+}
+
+void ConcurrentQueueTest::destructRemaining() {
+    Counted::constructed = Counted::destructed = 0;
+
+    {
+        ConcurrentQueue<Counted> a{8};
+        CORRADE_COMPARE(Counted::constructed, 0);
+
+        a.push(Counted{1});
+        a.push(Counted{2});
+        a.push(Counted{3});
+        /* Three temporaries and three copies in the queue */
+        CORRADE_COMPARE(Counted::constructed, 6);
+        CORRADE_COMPARE(Counted::destructed, 3);
+
+        /* The popped item is moved out of the slot and the slot destructed,
+           so just two remain alive after */
+        CORRADE_COMPARE(a.pop()->value, 1);
+        CORRADE_COMPARE(Counted::constructed - Counted::destructed, 2);
+    }
+
+    /* The remaining two got destructed */
+    CORRADE_COMPARE(Counted::constructed, Counted::destructed);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+constexpr std::size_t ThreadedCount = 20000;
+
+void ConcurrentQueueTest::threaded() {
+    auto&& data = ThreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ConcurrentQueue<std::size_t> a{64};
+
+    /* Each producer pushes a disjoint range, the consumers sum up what they
+       get. Every item has to arrive exactly once. */
+    Array<std::thread> producers{data.producers};
+    for(std::size_t i = 0; i != data.producers; ++i) {
+        producers[i] = std::thread{[&a, i]() {
+            for(std::size_t j = i*ThreadedCount, end = j + ThreadedCount; j != end; ++j)
+                while(!a.push(j)) std::this_thread::yield();
+        }};
+    }
+
+    const std::size_t total = data.producers*ThreadedCount;
+    std::atomic<std::size_t> popped{0};
+    Array<std::size_t> sums{ValueInit, data.consumers};
+    Array<std::thread> consumers{data.consumers};
+    for(std::size_t i = 0; i != data.consumers; ++i) {
+        consumers[i] = std::thread{[&a, &popped, &sums, i, total]() {
+            while(popped.load(std::memory_order_relaxed) != total) {
+                if(Optional<std::size_t> value = a.pop()) {
+                    sums[i] += *value;
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                } else std::this_thread::yield();
+            }
+        }};
+    }
+
+    for(std::thread& i: producers) i.join();
+    for(std::thread& i: consumers) i.join();
+
+    std::size_t sum = 0;
+    for(std::size_t i: sums) sum += i;
+    CORRADE_COMPARE(popped.load(), total);
+    CORRADE_COMPARE(sum, total*(total - 1)/2);
+    CORRADE_VERIFY(a.isEmpty());
+}
+
+void ConcurrentQueueTest::threadedBatch() {
+    auto&& data = ThreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ConcurrentQueue<std::size_t> a{64};
+
+    Array<std::thread> producers{data.producers};
+    for(std::size_t i = 0; i != data.producers; ++i) {
+        producers[i] = std::thread{[&a, i]() {
+            std::size_t batch[13];
+            for(std::size_t j = i*ThreadedCount, end = j + ThreadedCount; j < end; ) {
+                const std::size_t count = end - j < 13 ? end - j : 13;
+                for(std::size_t k = 0; k != count; ++k) batch[k] = j + k;
+                const std::size_t pushed = a.push(ArrayView<const std::size_t>{batch, count});
+                if(!pushed) std::this_thread::yield();
+                j += pushed;
+            }
+        }};
+    }
+
+    const std::size_t total = data.producers*ThreadedCount;
+    std::atomic<std::size_t> popped{0};
+    Array<std::size_t> sums{ValueInit, data.consumers};
+    Array<std::thread> consumers{data.consumers};
+    for(std::size_t i = 0; i != data.consumers; ++i) {
+        consumers[i] = std::thread{[&a, &popped, &sums, i, total]() {
+            std::size_t batch[17];
+            while(popped.load(std::memory_order_relaxed) != total) {
+                const std::size_t count = a.pop(batch);
+                if(!count) std::this_thread::yield();
+                for(std::size_t j = 0; j != count; ++j) sums[i] += batch[j];
+                popped.fetch_add(count, std::memory_order_relaxed);
+            }
+        }};
+    }
+
+    for(std::thread& i: producers) i.join();
+    for(std::thread& i: consumers) i.join();
+
+    std::size_t sum = 0;
+    for(std::size_t i: sums) sum += i;
+    CORRADE_COMPARE(popped.load(), total);
+    CORRADE_COMPARE(sum, total*(total - 1)/2);
+    CORRADE_VERIFY(a.isEmpty());
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::ConcurrentQueueTest)
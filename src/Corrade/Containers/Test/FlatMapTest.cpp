@@ -0,0 +1,371 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <string>
+
+#include "Corrade/Containers/FlatMap.h"
+#include "Corrade/Containers/Pointer.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringStl.h"
+#include "Corrade/Containers/StringView.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/Utility/DebugStl.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct FlatMapTest: TestSuite::Tester {
+    explicit FlatMapTest();
+
+    void constructDefault();
+    void constructUnsorted();
+    void constructUnsortedDuplicates();
+    void constructUnsortedMoveOnly();
+    void constructUnsortedInvalidSize();
+    void copy();
+    void move();
+
+    void find();
+    void findEmpty();
+    void set();
+    void setReplace();
+    void emplace();
+    void emplaceExisting();
+    void remove();
+    void removeAt();
+    void removeAtInvalid();
+    void clear();
+
+    void heterogeneous();
+    void iterate();
+    void manyEntries();
+};
+
+FlatMapTest::FlatMapTest() {
+    addTests({&FlatMapTest::constructDefault,
+              &FlatMapTest::constructUnsorted,
+              &FlatMapTest::constructUnsortedDuplicates,
+              &FlatMapTest::constructUnsortedMoveOnly,
+              &FlatMapTest::constructUnsortedInvalidSize,
+              &FlatMapTest::copy,
+              &FlatMapTest::move,
+
+              &FlatMapTest::find,
+              &FlatMapTest::findEmpty,
+              &FlatMapTest::set,
+              &FlatMapTest::setReplace,
+              &FlatMapTest::emplace,
+              &FlatMapTest::emplaceExisting,
+              &FlatMapTest::remove,
+              &FlatMapTest::removeAt,
+              &FlatMapTest::removeAtInvalid,
+              &FlatMapTest::clear,
+
+              &FlatMapTest::heterogeneous,
+              &FlatMapTest::iterate,
+              &FlatMapTest::manyEntries});
+}
+
+using namespace Literals;
+
+void FlatMapTest::constructDefault() {
+    const FlatMap<int, float> a;
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_VERIFY(a.keys().empty());
+    CORRADE_VERIFY(a.values().empty());
+
+    CORRADE_VERIFY((std::is_nothrow_default_constructible<FlatMap<int, float>>::value));
+}
+
+void FlatMapTest::constructUnsorted() {
+    const FlatMap<int, float> a{
+        Array<int>{InPlaceInit, {5, -1, 3, 17}},
+        Array<float>{InPlaceInit, {0.5f, -0.1f, 0.3f, 1.7f}}};
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE_AS(a.keys(),
+        arrayView({-1, 3, 5, 17}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.values(),
+        arrayView({-0.1f, 0.3f, 0.5f, 1.7f}),
+        TestSuite::Compare::Container);
+}
+
+void FlatMapTest::constructUnsortedDuplicates() {
+    const FlatMap<int, int> a{
+        Array<int>{InPlaceInit, {3, 1, 3, 2, 1, 3}},
+        Array<int>{InPlaceInit, {30, 10, 31, 20, 11, 32}}};
+
+    /* The first occurence wins */
+    CORRADE_COMPARE_AS(a.keys(),
+        arrayView({1, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.values(),
+        arrayView({10, 20, 30}),
+        TestSuite::Compare::Container);
+}
+
+void FlatMapTest::constructUnsortedMoveOnly() {
+    Array<Pointer<int>> values;
+    arrayAppend(values, pointer<int>(2));
+    arrayAppend(values, pointer<int>(1));
+    int* second = values[1].get();
+
+    const FlatMap<String, Pointer<int>> a{
+        Array<String>{InPlaceInit, {"b", "a"}}, std::move(values)};
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a.keys()[0], "a");
+    CORRADE_COMPARE(a.keys()[1], "b");
+    CORRADE_VERIFY(a.values()[0].get() == second);
+    CORRADE_COMPARE(*a.values()[1], 2);
+}
+
+void FlatMapTest::constructUnsortedInvalidSize() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    FlatMap<int, int> a{Array<int>{3}, Array<int>{2}};
+    CORRADE_COMPARE(out.str(), "Containers::FlatMap: expected the same count of keys and values but got 3 and 2\n");
+}
+
+void FlatMapTest::copy() {
+    /* Not copyable, same as the underlying arrays */
+    CORRADE_VERIFY(!(std::is_copy_constructible<FlatMap<int, int>>::value));
+    CORRADE_VERIFY(!(std::is_copy_assignable<FlatMap<int, int>>::value));
+}
+
+void FlatMapTest::move() {
+    FlatMap<int, int> a;
+    a.set(3, 30);
+    a.set(1, 10);
+    const int* values = a.values().data();
+
+    FlatMap<int, int> b = std::move(a);
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_VERIFY(b.values().data() == values);
+
+    FlatMap<int, int> c;
+    c.set(7, 70);
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), 2);
+    CORRADE_VERIFY(!c.contains(7));
+    CORRADE_VERIFY(c.values().data() == values);
+
+    CORRADE_VERIFY((std::is_nothrow_move_constructible<FlatMap<int, int>>::value));
+    CORRADE_VERIFY((std::is_nothrow_move_assignable<FlatMap<int, int>>::value));
+}
+
+void FlatMapTest::find() {
+    FlatMap<int, float> a{
+        Array<int>{InPlaceInit, {5, -1, 3, 17}},
+        Array<float>{InPlaceInit, {0.5f, -0.1f, 0.3f, 1.7f}}};
+
+    CORRADE_COMPARE(a.findIndex(-1), 0);
+    CORRADE_COMPARE(a.findIndex(17), 3);
+    CORRADE_COMPARE(a.findIndex(4), 4);
+    CORRADE_COMPARE(a.findIndex(-100), 4);
+    CORRADE_COMPARE(a.findIndex(100), 4);
+
+    CORRADE_VERIFY(a.find(3));
+    CORRADE_COMPARE(*a.find(3), 0.3f);
+    CORRADE_VERIFY(!a.find(4));
+    CORRADE_VERIFY(a.contains(5));
+    CORRADE_VERIFY(!a.contains(6));
+
+    *a.find(5) = 5.0f;
+    CORRADE_COMPARE(a.values()[2], 5.0f);
+
+    const FlatMap<int, float>& ca = a;
+    CORRADE_VERIFY(ca.find(17));
+    CORRADE_COMPARE(*ca.find(17), 1.7f);
+}
+
+void FlatMapTest::findEmpty() {
+    const FlatMap<int, float> a;
+    CORRADE_COMPARE(a.findIndex(3), 0);
+    CORRADE_VERIFY(!a.find(3));
+    CORRADE_VERIFY(!a.contains(3));
+}
+
+void FlatMapTest::set() {
+    FlatMap<int, int> a;
+    a.set(5, 50);
+    a.set(1, 10);
+    int& value = a.set(3, 30);
+    a.set(7, 70);
+    CORRADE_COMPARE(value, 30);
+    CORRADE_COMPARE_AS(a.keys(),
+        arrayView({1, 3, 5, 7}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.values(),
+        arrayView({10, 30, 50, 70}),
+        TestSuite::Compare::Container);
+}
+
+void FlatMapTest::setReplace() {
+    FlatMap<int, String> a;
+    a.set(5, "hello");
+    String& value = a.set(5, "world");
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(value, "world");
+}
+
+void FlatMapTest::emplace() {
+    FlatMap<int, String> a;
+    String& value = a.emplace(5, "hello", std::size_t{3});
+    CORRADE_COMPARE(value, "hel");
+    a.emplace(2);
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a.values()[0], "");
+    CORRADE_COMPARE(a.values()[1], "hel");
+}
+
+void FlatMapTest::emplaceExisting() {
+    FlatMap<int, String> a;
+    a.emplace(5, "hello");
+
+    /* The arguments are ignored */
+    String& value = a.emplace(5, "world");
+    CORRADE_COMPARE(value, "hello");
+    CORRADE_COMPARE(a.size(), 1);
+}
+
+void FlatMapTest::remove() {
+    FlatMap<int, int> a{
+        Array<int>{InPlaceInit, {1, 2, 3, 4}},
+        Array<int>{InPlaceInit, {10, 20, 30, 40}}};
+    CORRADE_VERIFY(a.remove(2));
+    CORRADE_VERIFY(!a.remove(2));
+    CORRADE_VERIFY(!a.remove(5));
+    CORRADE_COMPARE_AS(a.keys(),
+        arrayView({1, 3, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.values(),
+        arrayView({10, 30, 40}),
+        TestSuite::Compare::Container);
+}
+
+void FlatMapTest::removeAt() {
+    FlatMap<int, int> a{
+        Array<int>{InPlaceInit, {1, 2, 3, 4, 5}},
+        Array<int>{InPlaceInit, {10, 20, 30, 40, 50}}};
+
+    /* Removing all odd values while walking the map */
+    for(std::size_t i = 0; i != a.size(); ) {
+        if(a.values()[i] % 20) a.removeAt(i);
+        else ++i;
+    }
+
+    CORRADE_COMPARE_AS(a.keys(),
+        arrayView({2, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.values(),
+        arrayView({20, 40}),
+        TestSuite::Compare::Container);
+}
+
+void FlatMapTest::removeAtInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    FlatMap<int, int> a;
+    a.set(1, 10);
+    a.removeAt(1);
+    CORRADE_COMPARE(out.str(), "Containers::FlatMap::removeAt(): index 1 out of range for 1 entries\n");
+}
+
+void FlatMapTest::clear() {
+    FlatMap<int, int> a;
+    a.set(1, 10);
+    a.set(2, 20);
+    a.clear();
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_VERIFY(!a.contains(1));
+}
+
+void FlatMapTest::heterogeneous() {
+    FlatMap<String, int> a;
+    a.set("world"_s, 2);
+    a.emplace("hello"_s, 1);
+    a.set(String{"a string that's long enough to not be stored inline"}, 3);
+
+    CORRADE_VERIFY(a.find("hello world"_s.prefix(5)));
+    CORRADE_COMPARE(*a.find("hello world"_s.prefix(5)), 1);
+    CORRADE_VERIFY(a.contains("world"));
+    CORRADE_VERIFY(!a.contains("hell"_s));
+    CORRADE_COMPARE(a.keys()[0], "a string that's long enough to not be stored inline");
+    CORRADE_VERIFY(a.remove("world"_s));
+    CORRADE_COMPARE(a.size(), 2);
+}
+
+void FlatMapTest::iterate() {
+    FlatMap<String, int> a;
+    a.set("b", 2);
+    a.set("c", 3);
+    a.set("a", 1);
+
+    /* Keys are walked in a sorted order, values correspond to them */
+    std::string keys;
+    int values = 0;
+    for(std::size_t i = 0; i != a.size(); ++i) {
+        keys += a.keys()[i];
+        values = values*10 + a.values()[i];
+    }
+    CORRADE_COMPARE(keys, "abc");
+    CORRADE_COMPARE(values, 123);
+}
+
+void FlatMapTest::manyEntries() {
+    /* Inserting in a shuffled order, lookups should work for all sizes in
+       between */
+    FlatMap<unsigned, unsigned> a;
+    for(unsigned i = 0; i != 1000; ++i) {
+        const unsigned key = i*7919 % 1000;
+        a.set(key, key*2);
+        CORRADE_VERIFY(a.contains(key));
+        CORRADE_VERIFY(!a.contains(1000 + i));
+    }
+
+    CORRADE_COMPARE(a.size(), 1000);
+    for(unsigned i = 0; i != 1000; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(a.findIndex(i), i);
+        CORRADE_COMPARE(a.values()[i], i*2);
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::FlatMapTest)
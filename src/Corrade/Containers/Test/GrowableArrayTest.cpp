@@ -29,6 +29,7 @@
 
 #include "Corrade/Containers/GrowableArray.h"
 #include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
 #include "Corrade/Utility/DebugStl.h"
 
 /* No __has_feature on GCC: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=60512
@@ -106,6 +107,24 @@ struct GrowableArrayTest: TestSuite::Tester {
     template<class T> void removeSuffixGrowable();
     void removeSuffixInvalid();
 
+    template<class T> void insertFromNonGrowable();
+    template<class T> void insertFromGrowableNoRealloc();
+    /* InPlace tested in insertFrom*() already */
+    void insertCopy();
+    void insertMove();
+    void insertList();
+    void insertCountNoInit();
+    void insertInvalid();
+
+    template<class T> void removeZero();
+    template<class T> void removeNonGrowable();
+    template<class T> void removeGrowable();
+    void removeInvalid();
+
+    template<class T> void removeUnorderedNonGrowable();
+    template<class T> void removeUnorderedGrowable();
+    void removeUnorderedInvalid();
+
     void shrinkEmpty();
     template<class T> void shrinkNonGrowableNoInit();
     template<class T> void shrinkNonGrowableDefaultInit();
@@ -114,6 +133,10 @@ struct GrowableArrayTest: TestSuite::Tester {
 
     template<class T> void move();
 
+    template<class T> void alignedAllocator();
+    template<class T> void alignedAllocatorFromNonGrowable();
+    template<class T> void alignedAllocatorShrink();
+
     void cast();
     void castEmpty();
     void castNonTrivial();
@@ -144,6 +167,20 @@ struct GrowableArrayTest: TestSuite::Tester {
     void benchmarkAllocationsBegin();
     std::uint64_t benchmarkAllocationsEnd();
 
+    void benchmarkInsertTrivialVector();
+    void benchmarkInsertTrivialArray();
+    void benchmarkInsertBatchTrivialVector();
+    void benchmarkInsertBatchTrivialArray();
+    void benchmarkInsertVector();
+    void benchmarkInsertArray();
+
+    void benchmarkRemoveTrivialVector();
+    void benchmarkRemoveTrivialArray();
+    void benchmarkRemoveUnorderedTrivialVector();
+    void benchmarkRemoveUnorderedTrivialArray();
+    void benchmarkRemoveVector();
+    void benchmarkRemoveArray();
+
     void benchmarkAllocationsVector();
     template<template<class> class Allocator> void benchmarkAllocationsArray();
 };
@@ -281,6 +318,30 @@ GrowableArrayTest::GrowableArrayTest() {
               &GrowableArrayTest::removeSuffixGrowable<Movable>,
               &GrowableArrayTest::removeSuffixInvalid,
 
+              &GrowableArrayTest::insertFromNonGrowable<int>,
+              &GrowableArrayTest::insertFromNonGrowable<Movable>,
+              &GrowableArrayTest::insertFromGrowableNoRealloc<int>,
+              &GrowableArrayTest::insertFromGrowableNoRealloc<Movable>,
+              &GrowableArrayTest::insertCopy,
+              &GrowableArrayTest::insertMove,
+              &GrowableArrayTest::insertList,
+              &GrowableArrayTest::insertCountNoInit,
+              &GrowableArrayTest::insertInvalid,
+
+              &GrowableArrayTest::removeZero<int>,
+              &GrowableArrayTest::removeZero<Movable>,
+              &GrowableArrayTest::removeNonGrowable<int>,
+              &GrowableArrayTest::removeNonGrowable<Movable>,
+              &GrowableArrayTest::removeGrowable<int>,
+              &GrowableArrayTest::removeGrowable<Movable>,
+              &GrowableArrayTest::removeInvalid,
+
+              &GrowableArrayTest::removeUnorderedNonGrowable<int>,
+              &GrowableArrayTest::removeUnorderedNonGrowable<Movable>,
+              &GrowableArrayTest::removeUnorderedGrowable<int>,
+              &GrowableArrayTest::removeUnorderedGrowable<Movable>,
+              &GrowableArrayTest::removeUnorderedInvalid,
+
               &GrowableArrayTest::shrinkEmpty,
               &GrowableArrayTest::shrinkNonGrowableNoInit<int>,
               &GrowableArrayTest::shrinkNonGrowableNoInit<Movable>,
@@ -292,7 +353,14 @@ GrowableArrayTest::GrowableArrayTest() {
               &GrowableArrayTest::shrinkGrowableDefaultInit<Movable>,
 
               &GrowableArrayTest::move<int>,
-              &GrowableArrayTest::move<Movable>},
+              &GrowableArrayTest::move<Movable>,
+
+              &GrowableArrayTest::alignedAllocator<int>,
+              &GrowableArrayTest::alignedAllocator<Movable>,
+              &GrowableArrayTest::alignedAllocatorFromNonGrowable<int>,
+              &GrowableArrayTest::alignedAllocatorFromNonGrowable<Movable>,
+              &GrowableArrayTest::alignedAllocatorShrink<int>,
+              &GrowableArrayTest::alignedAllocatorShrink<Movable>},
         &GrowableArrayTest::resetCounters, &GrowableArrayTest::resetCounters);
 
     addTests({&GrowableArrayTest::cast,
@@ -323,6 +391,20 @@ GrowableArrayTest::GrowableArrayTest() {
         &GrowableArrayTest::benchmarkAppendBatchTrivialReservedVector,
         &GrowableArrayTest::benchmarkAppendBatchTrivialReservedArray}, 10);
 
+    addBenchmarks({
+        &GrowableArrayTest::benchmarkInsertTrivialVector,
+        &GrowableArrayTest::benchmarkInsertTrivialArray,
+        &GrowableArrayTest::benchmarkInsertBatchTrivialVector,
+        &GrowableArrayTest::benchmarkInsertBatchTrivialArray,
+        &GrowableArrayTest::benchmarkInsertVector,
+        &GrowableArrayTest::benchmarkInsertArray,
+        &GrowableArrayTest::benchmarkRemoveTrivialVector,
+        &GrowableArrayTest::benchmarkRemoveTrivialArray,
+        &GrowableArrayTest::benchmarkRemoveUnorderedTrivialVector,
+        &GrowableArrayTest::benchmarkRemoveUnorderedTrivialArray,
+        &GrowableArrayTest::benchmarkRemoveVector,
+        &GrowableArrayTest::benchmarkRemoveArray}, 10);
+
     addCustomInstancedBenchmarks({
         &GrowableArrayTest::benchmarkAllocationsVector,
         &GrowableArrayTest::benchmarkAllocationsArray<ArrayNewAllocator>,
@@ -1378,6 +1460,459 @@ void GrowableArrayTest::removeSuffixInvalid() {
         "Containers::arrayRemoveSuffix(): can't remove 5 elements from an array of size 4\n");
 }
 
+template<class T> void GrowableArrayTest::insertFromNonGrowable() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    {
+        Array<T> a{3};
+        T* prev = a.data();
+        a[0] = 2;
+        a[1] = 7;
+        a[2] = -1;
+
+        T& inserted = arrayInsert(a, 1, InPlaceInit, 5);
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        CORRADE_VERIFY(a.data() != prev);
+        CORRADE_COMPARE(a.size(), 4);
+        CORRADE_COMPARE(int(a[0]), 2);
+        CORRADE_COMPARE(int(a[1]), 5);
+        CORRADE_COMPARE(int(a[2]), 7);
+        CORRADE_COMPARE(int(a[3]), -1);
+        CORRADE_COMPARE(&inserted, &a[1]);
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<T>);
+
+        /* Three move-constructed to the new array, then the last one
+           move-constructed one item forward, the second move-assigned over it
+           and the moved-out first destructed, and a new one constructed
+           in-place */
+        if(std::is_same<T, Movable>::value) {
+            CORRADE_COMPARE(Movable::constructed, 8);
+            CORRADE_COMPARE(Movable::moved, 5);
+            CORRADE_COMPARE(Movable::assigned, 1);
+            CORRADE_COMPARE(Movable::destructed, 4);
+        }
+    }
+
+    if(std::is_same<T, Movable>::value) {
+        CORRADE_COMPARE(Movable::constructed, 8);
+        CORRADE_COMPARE(Movable::moved, 5);
+        CORRADE_COMPARE(Movable::assigned, 1);
+        CORRADE_COMPARE(Movable::destructed, 8);
+    }
+}
+
+template<class T> void GrowableArrayTest::insertFromGrowableNoRealloc() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    {
+        Array<T> a;
+        arrayReserve(a, 10);
+        T* prev = a.data();
+        arrayAppend(a, InPlaceInit, 2);
+        arrayAppend(a, InPlaceInit, 7);
+        arrayAppend(a, InPlaceInit, -1);
+        arrayAppend(a, InPlaceInit, 3578);
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<T>);
+
+        T& inserted = arrayInsert(a, 1, InPlaceInit, 5);
+        CORRADE_VERIFY(a.data() == prev);
+        CORRADE_COMPARE(a.size(), 5);
+        CORRADE_COMPARE(arrayCapacity(a), 10);
+        CORRADE_COMPARE(int(a[0]), 2);
+        CORRADE_COMPARE(int(a[1]), 5);
+        CORRADE_COMPARE(int(a[2]), 7);
+        CORRADE_COMPARE(int(a[3]), -1);
+        CORRADE_COMPARE(int(a[4]), 3578);
+        CORRADE_COMPARE(&inserted, &a[1]);
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<T>);
+
+        /* Last one move-constructed one item forward, the other two
+           move-assigned, the moved-out item destructed and a new one
+           constructed in-place */
+        if(std::is_same<T, Movable>::value) {
+            CORRADE_COMPARE(Movable::constructed, 6);
+            CORRADE_COMPARE(Movable::moved, 3);
+            CORRADE_COMPARE(Movable::assigned, 2);
+            CORRADE_COMPARE(Movable::destructed, 1);
+        }
+
+        /* Inserting at the end is the same as appending, nothing shifted */
+        T& insertedEnd = arrayInsert(a, 5, InPlaceInit, 11);
+        CORRADE_VERIFY(a.data() == prev);
+        CORRADE_COMPARE(a.size(), 6);
+        CORRADE_COMPARE(int(a[4]), 3578);
+        CORRADE_COMPARE(int(a[5]), 11);
+        CORRADE_COMPARE(&insertedEnd, &a.back());
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<T>);
+        if(std::is_same<T, Movable>::value) {
+            CORRADE_COMPARE(Movable::constructed, 7);
+            CORRADE_COMPARE(Movable::moved, 3);
+            CORRADE_COMPARE(Movable::assigned, 2);
+            CORRADE_COMPARE(Movable::destructed, 1);
+        }
+    }
+
+    if(std::is_same<T, Movable>::value) {
+        CORRADE_COMPARE(Movable::constructed, 7);
+        CORRADE_COMPARE(Movable::moved, 3);
+        CORRADE_COMPARE(Movable::assigned, 2);
+        CORRADE_COMPARE(Movable::destructed, 7);
+    }
+}
+
+void GrowableArrayTest::insertCopy() {
+    Array<int> a;
+    arrayAppend(a, {1, 2, 3});
+    const int value = 2786541;
+    int& inserted = arrayInsert(a, 0, value);
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a[0], 2786541);
+    CORRADE_COMPARE(a[1], 1);
+    CORRADE_COMPARE(a[2], 2);
+    CORRADE_COMPARE(a[3], 3);
+    CORRADE_COMPARE(&inserted, &a.front());
+    VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<int>);
+}
+
+void GrowableArrayTest::insertMove() {
+    {
+        Array<Movable> a;
+        arrayReserve(a, 4);
+        arrayAppend(a, InPlaceInit, 1);
+        arrayAppend(a, InPlaceInit, 2);
+        Movable& inserted = arrayInsert(a, 0, Movable{25141});
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_COMPARE(arrayCapacity(a), 4);
+        CORRADE_COMPARE(a[0].a, 25141);
+        CORRADE_COMPARE(a[1].a, 1);
+        CORRADE_COMPARE(a[2].a, 2);
+        CORRADE_COMPARE(&inserted, &a.front());
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<Movable>);
+    }
+
+    /* One shifted by a move-construction, one by a move-assignment, the
+       temporary moved in */
+    CORRADE_COMPARE(Movable::constructed, 5);
+    CORRADE_COMPARE(Movable::moved, 3);
+    CORRADE_COMPARE(Movable::assigned, 1);
+    CORRADE_COMPARE(Movable::destructed, 5);
+}
+
+void GrowableArrayTest::insertList() {
+    Array<int> a;
+    arrayAppend(a, {1, 2});
+    Containers::ArrayView<int> inserted = arrayInsert(a, 1, {17, -22, 65});
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(a[0], 1);
+    CORRADE_COMPARE(a[1], 17);
+    CORRADE_COMPARE(a[2], -22);
+    CORRADE_COMPARE(a[3], 65);
+    CORRADE_COMPARE(a[4], 2);
+    CORRADE_COMPARE(inserted.data(), a.data() + 1);
+    CORRADE_COMPARE(inserted.size(), 3);
+    VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<int>);
+}
+
+void GrowableArrayTest::insertCountNoInit() {
+    Array<int> a;
+    arrayAppend(a, {1, 2, 3});
+    Containers::ArrayView<int> inserted = arrayInsert(a, 2, Containers::NoInit, 4);
+    CORRADE_COMPARE(a.size(), 7);
+    CORRADE_COMPARE(a[0], 1);
+    CORRADE_COMPARE(a[1], 2);
+    CORRADE_COMPARE(a[6], 3);
+    CORRADE_COMPARE(inserted.data(), a.data() + 2);
+    CORRADE_COMPARE(inserted.size(), 4);
+    VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<int>);
+}
+
+void GrowableArrayTest::insertInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Array<int> a{4};
+
+    std::ostringstream out;
+    Error redirectOutput{&out};
+
+    arrayInsert(a, 5, 3);
+    arrayInsert(a, 5, {3, 4});
+    arrayInsert(a, 5, Containers::NoInit, 2);
+    CORRADE_COMPARE(out.str(),
+        "Containers::arrayInsert(): can't insert at index 5 into an array of size 4\n"
+        "Containers::arrayInsert(): can't insert at index 5 into an array of size 4\n"
+        "Containers::arrayInsert(): can't insert at index 5 into an array of size 4\n");
+}
+
+template<class T> void GrowableArrayTest::removeZero() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    {
+        Array<T> a{3};
+        T* prev = a.data();
+        a[0] = 2;
+        a[1] = 7;
+        a[2] = -1;
+
+        /* Should do no nuthin' */
+        arrayRemove(a, 1, 0);
+        arrayRemoveUnordered(a, 1, 0);
+        CORRADE_VERIFY(!arrayIsGrowable(a));
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_VERIFY(a.data() == prev);
+        CORRADE_COMPARE(int(a[0]), 2);
+        CORRADE_COMPARE(int(a[1]), 7);
+        CORRADE_COMPARE(int(a[2]), -1);
+        /* Not growable, no ASan annotation check */
+    }
+
+    if(std::is_same<T, Movable>::value) {
+        CORRADE_COMPARE(Movable::constructed, 3);
+        CORRADE_COMPARE(Movable::moved, 0);
+        CORRADE_COMPARE(Movable::assigned, 0);
+        CORRADE_COMPARE(Movable::destructed, 3);
+    }
+}
+
+template<class T> void GrowableArrayTest::removeNonGrowable() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    {
+        Array<T> a{5};
+        T* prev = a.data();
+        a[0] = 2;
+        a[1] = 7;
+        a[2] = -1;
+        a[3] = 3578;
+        a[4] = 11;
+
+        /* Gets converted to growable as otherwise we can't ensure the
+           destructors won't be called on removed elements */
+        arrayRemove(a, 1, 2);
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_COMPARE(arrayCapacity(a), 3);
+        CORRADE_VERIFY(a.data() != prev);
+        CORRADE_COMPARE(int(a[0]), 2);
+        CORRADE_COMPARE(int(a[1]), 3578);
+        CORRADE_COMPARE(int(a[2]), 11);
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<T>);
+
+        /* Two move-assigned over the removed ones, then three
+           move-constructed to the new array */
+        if(std::is_same<T, Movable>::value) {
+            CORRADE_COMPARE(Movable::constructed, 8);
+            CORRADE_COMPARE(Movable::moved, 5);
+            CORRADE_COMPARE(Movable::assigned, 2);
+            CORRADE_COMPARE(Movable::destructed, 5);
+        }
+    }
+
+    if(std::is_same<T, Movable>::value) {
+        CORRADE_COMPARE(Movable::constructed, 8);
+        CORRADE_COMPARE(Movable::moved, 5);
+        CORRADE_COMPARE(Movable::assigned, 2);
+        CORRADE_COMPARE(Movable::destructed, 8);
+    }
+}
+
+template<class T> void GrowableArrayTest::removeGrowable() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    {
+        Array<T> a;
+        arrayReserve(a, 10);
+        T* prev = a.data();
+        arrayAppend(a, InPlaceInit, 2);
+        arrayAppend(a, InPlaceInit, 7);
+        arrayAppend(a, InPlaceInit, -1);
+        arrayAppend(a, InPlaceInit, 3578);
+        arrayAppend(a, InPlaceInit, 11);
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<T>);
+
+        arrayRemove(a, 1, 2);
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_COMPARE(arrayCapacity(a), 10);
+        CORRADE_VERIFY(a.data() == prev);
+        CORRADE_COMPARE(int(a[0]), 2);
+        CORRADE_COMPARE(int(a[1]), 3578);
+        CORRADE_COMPARE(int(a[2]), 11);
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<T>);
+
+        /* Two move-assigned over the removed ones, the now-unused suffix
+           destructed */
+        if(std::is_same<T, Movable>::value) {
+            CORRADE_COMPARE(Movable::constructed, 5);
+            CORRADE_COMPARE(Movable::moved, 2);
+            CORRADE_COMPARE(Movable::assigned, 2);
+            CORRADE_COMPARE(Movable::destructed, 2);
+        }
+
+        /* Removing the last element is the same as removing a suffix */
+        arrayRemove(a, 2);
+        CORRADE_COMPARE(a.size(), 2);
+        CORRADE_COMPARE(arrayCapacity(a), 10);
+        CORRADE_COMPARE(int(a[0]), 2);
+        CORRADE_COMPARE(int(a[1]), 3578);
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<T>);
+        if(std::is_same<T, Movable>::value) {
+            CORRADE_COMPARE(Movable::constructed, 5);
+            CORRADE_COMPARE(Movable::moved, 2);
+            CORRADE_COMPARE(Movable::assigned, 2);
+            CORRADE_COMPARE(Movable::destructed, 3);
+        }
+    }
+
+    if(std::is_same<T, Movable>::value) {
+        CORRADE_COMPARE(Movable::constructed, 5);
+        CORRADE_COMPARE(Movable::moved, 2);
+        CORRADE_COMPARE(Movable::assigned, 2);
+        CORRADE_COMPARE(Movable::destructed, 5);
+    }
+}
+
+void GrowableArrayTest::removeInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Array<int> a{4};
+    Array<int> b;
+    arrayResize(b, 4);
+
+    std::ostringstream out;
+    Error redirectOutput{&out};
+
+    arrayRemove(a, 2, 3);
+    arrayRemove(b, 4);
+    CORRADE_COMPARE(out.str(),
+        "Containers::arrayRemove(): can't remove 3 elements at index 2 from an array of size 4\n"
+        "Containers::arrayRemove(): can't remove 1 elements at index 4 from an array of size 4\n");
+}
+
+template<class T> void GrowableArrayTest::removeUnorderedNonGrowable() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    {
+        Array<T> a{5};
+        T* prev = a.data();
+        a[0] = 2;
+        a[1] = 7;
+        a[2] = -1;
+        a[3] = 3578;
+        a[4] = 11;
+
+        /* Gets converted to growable as otherwise we can't ensure the
+           destructors won't be called on removed elements */
+        arrayRemoveUnordered(a, 1);
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        CORRADE_COMPARE(a.size(), 4);
+        CORRADE_COMPARE(arrayCapacity(a), 4);
+        CORRADE_VERIFY(a.data() != prev);
+        CORRADE_COMPARE(int(a[0]), 2);
+        CORRADE_COMPARE(int(a[1]), 11);
+        CORRADE_COMPARE(int(a[2]), -1);
+        CORRADE_COMPARE(int(a[3]), 3578);
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<T>);
+
+        /* Last move-assigned over the removed one, then four move-constructed
+           to the new array */
+        if(std::is_same<T, Movable>::value) {
+            CORRADE_COMPARE(Movable::constructed, 9);
+            CORRADE_COMPARE(Movable::moved, 5);
+            CORRADE_COMPARE(Movable::assigned, 1);
+            CORRADE_COMPARE(Movable::destructed, 5);
+        }
+    }
+
+    if(std::is_same<T, Movable>::value) {
+        CORRADE_COMPARE(Movable::constructed, 9);
+        CORRADE_COMPARE(Movable::moved, 5);
+        CORRADE_COMPARE(Movable::assigned, 1);
+        CORRADE_COMPARE(Movable::destructed, 9);
+    }
+}
+
+template<class T> void GrowableArrayTest::removeUnorderedGrowable() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    {
+        Array<T> a;
+        arrayReserve(a, 10);
+        T* prev = a.data();
+        arrayAppend(a, InPlaceInit, 2);
+        arrayAppend(a, InPlaceInit, 7);
+        arrayAppend(a, InPlaceInit, -1);
+        arrayAppend(a, InPlaceInit, 3578);
+        arrayAppend(a, InPlaceInit, 11);
+        arrayAppend(a, InPlaceInit, 4);
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<T>);
+
+        arrayRemoveUnordered(a, 0, 2);
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        CORRADE_COMPARE(a.size(), 4);
+        CORRADE_COMPARE(arrayCapacity(a), 10);
+        CORRADE_VERIFY(a.data() == prev);
+        CORRADE_COMPARE(int(a[0]), 11);
+        CORRADE_COMPARE(int(a[1]), 4);
+        CORRADE_COMPARE(int(a[2]), -1);
+        CORRADE_COMPARE(int(a[3]), 3578);
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<T>);
+
+        /* Last two move-assigned over the removed ones, the now-unused suffix
+           destructed */
+        if(std::is_same<T, Movable>::value) {
+            CORRADE_COMPARE(Movable::constructed, 6);
+            CORRADE_COMPARE(Movable::moved, 2);
+            CORRADE_COMPARE(Movable::assigned, 2);
+            CORRADE_COMPARE(Movable::destructed, 2);
+        }
+
+        /* There's just one element after the removed range, so only that one
+           gets moved */
+        arrayRemoveUnordered(a, 1, 2);
+        CORRADE_COMPARE(a.size(), 2);
+        CORRADE_COMPARE(arrayCapacity(a), 10);
+        CORRADE_COMPARE(int(a[0]), 11);
+        CORRADE_COMPARE(int(a[1]), 3578);
+        VERIFY_SANITIZED_PROPERLY(a, ArrayAllocator<T>);
+        if(std::is_same<T, Movable>::value) {
+            CORRADE_COMPARE(Movable::constructed, 6);
+            CORRADE_COMPARE(Movable::moved, 3);
+            CORRADE_COMPARE(Movable::assigned, 3);
+            CORRADE_COMPARE(Movable::destructed, 4);
+        }
+    }
+
+    if(std::is_same<T, Movable>::value) {
+        CORRADE_COMPARE(Movable::constructed, 6);
+        CORRADE_COMPARE(Movable::moved, 3);
+        CORRADE_COMPARE(Movable::assigned, 3);
+        CORRADE_COMPARE(Movable::destructed, 6);
+    }
+}
+
+void GrowableArrayTest::removeUnorderedInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    Array<int> a{4};
+    Array<int> b;
+    arrayResize(b, 4);
+
+    std::ostringstream out;
+    Error redirectOutput{&out};
+
+    arrayRemoveUnordered(a, 2, 3);
+    arrayRemoveUnordered(b, 4);
+    CORRADE_COMPARE(out.str(),
+        "Containers::arrayRemoveUnordered(): can't remove 3 elements at index 2 from an array of size 4\n"
+        "Containers::arrayRemoveUnordered(): can't remove 1 elements at index 4 from an array of size 4\n");
+}
+
 void GrowableArrayTest::shrinkEmpty() {
     {
         Array<Movable> a;
@@ -1551,6 +2086,93 @@ template<class T> void GrowableArrayTest::move() {
     }
 }
 
+template<class T> void GrowableArrayTest::alignedAllocator() {
+    setTestCaseTemplateName(std::is_same<T, int>::value ? "int" : "Movable");
+
+    {
+        Array<T> a;
+        /* Appending one by one to go through many reallocations, each of
+           which should preserve the alignment */
+        bool aligned = true;
+        for(int i = 0; i != 1000; ++i) {
+            arrayAppend<T, ArrayAlignedAllocator<T, 64>>(a, T(i));
+            aligned = aligned && reinterpret_cast<std::size_t>(a.data()) % 64 == 0;
+        }
+        CORRADE_VERIFY(aligned);
+        CORRADE_VERIFY(!arrayIsGrowable(a));
+        CORRADE_VERIFY((arrayIsGrowable<T, ArrayAlignedAllocator<T, 64>>(a)));
+        /* Different alignment is a different allocator */
+        CORRADE_VERIFY(!(arrayIsGrowable<T, ArrayAlignedAllocator<T, 128>>(a)));
+        CORRADE_COMPARE(a.size(), 1000);
+        CORRADE_COMPARE_AS((arrayCapacity<T, ArrayAlignedAllocator<T, 64>>(a)), 1000, TestSuite::Compare::GreaterOrEqual);
+        CORRADE_COMPARE(int(a[0]), 0);
+        CORRADE_COMPARE(int(a[517]), 517);
+        CORRADE_COMPARE(int(a[999]), 999);
+        VERIFY_SANITIZED_PROPERLY(a, (ArrayAlignedAllocator<T, 64>));
+
+        /* Large alignments work too */
+        Array<T> b;
+        arrayReserve<T, ArrayAlignedAllocator<T, 4096>>(b, 3);
+        CORRADE_COMPARE(reinterpret_cast<std::size_t>(b.data()) % 4096, 0);
+        CORRADE_COMPARE((arrayCapacity<T, ArrayAlignedAllocator<T, 4096>>(b)), 3);
+        arrayResize<T, ArrayAlignedAllocator<T, 4096>>(b, 5000);
+        CORRADE_COMPARE(reinterpret_cast<std::size_t>(b.data()) % 4096, 0);
+        CORRADE_COMPARE(b.size(), 5000);
+        CORRADE_COMPARE(int(b[4999]), 0);
+    }
+
+    /* Everything that was constructed got destructed */
+    if(std::is_same<T, Movable>::value)
+        CORRADE_COMPARE(Movable::destructed, Movable::constructed);
+}
+
+template<class T> void GrowableArrayTest::alignedAllocatorFromNonGrowable() {
+    setTestCaseTemplateName(std::is_same<T, int>::value ? "int" : "Movable");
+
+    {
+        Array<T> a{ValueInit, 3, 64};
+        a[2] = 7;
+        CORRADE_VERIFY(!(arrayIsGrowable<T, ArrayAlignedAllocator<T, 64>>(a)));
+
+        /* The aligned constructors use a different deleter, so the first
+           append copies to a growable allocation with the same alignment */
+        arrayAppend<T, ArrayAlignedAllocator<T, 64>>(a, T(15));
+        CORRADE_VERIFY((arrayIsGrowable<T, ArrayAlignedAllocator<T, 64>>(a)));
+        CORRADE_COMPARE(reinterpret_cast<std::size_t>(a.data()) % 64, 0);
+        CORRADE_COMPARE(a.size(), 4);
+        CORRADE_COMPARE(int(a[0]), 0);
+        CORRADE_COMPARE(int(a[2]), 7);
+        CORRADE_COMPARE(int(a[3]), 15);
+    }
+
+    if(std::is_same<T, Movable>::value)
+        CORRADE_COMPARE(Movable::destructed, Movable::constructed);
+}
+
+template<class T> void GrowableArrayTest::alignedAllocatorShrink() {
+    setTestCaseTemplateName(std::is_same<T, int>::value ? "int" : "Movable");
+
+    {
+        Array<T> a;
+        for(int i = 0; i != 100; ++i)
+            arrayAppend<T, ArrayAlignedAllocator<T, 256>>(a, T(i));
+        arrayRemoveSuffix<T, ArrayAlignedAllocator<T, 256>>(a, 60);
+        CORRADE_COMPARE_AS((arrayCapacity<T, ArrayAlignedAllocator<T, 256>>(a)), 40, TestSuite::Compare::Greater);
+
+        /* Shrinking keeps the alignment */
+        arrayShrink<T, ArrayAlignedAllocator<T, 256>>(a);
+        CORRADE_VERIFY(!(arrayIsGrowable<T, ArrayAlignedAllocator<T, 256>>(a)));
+        CORRADE_VERIFY(a.deleter());
+        CORRADE_COMPARE(reinterpret_cast<std::size_t>(a.data()) % 256, 0);
+        CORRADE_COMPARE(a.size(), 40);
+        CORRADE_COMPARE(int(a[0]), 0);
+        CORRADE_COMPARE(int(a[39]), 39);
+    }
+
+    if(std::is_same<T, Movable>::value)
+        CORRADE_COMPARE(Movable::destructed, Movable::constructed);
+}
+
 void GrowableArrayTest::cast() {
     Array<char> a;
     arrayResize(a, 10);
@@ -1639,6 +2261,8 @@ void GrowableArrayTest::explicitAllocatorParameter() {
         Containers::ArrayView<int> view = arrayAppend<ArrayNewAllocator>(a, {8, 9, 10});
         CORRADE_COMPARE(view.size(), 3);
         CORRADE_COMPARE(view[2], 10);
+        /* The allocator used to be ignored for initializer lists */
+        CORRADE_VERIFY(arrayIsGrowable<ArrayNewAllocator>(a));
     } {
         const int values[]{11, 12, 13};
         Containers::ArrayView<int> view = arrayAppend<ArrayNewAllocator>(a, arrayView(values));
@@ -1937,6 +2561,152 @@ const char* AllocationBenchmarkName[] {
 
 std::size_t allocationCount, allocationReuseCount, reallocationCount;
 
+void GrowableArrayTest::benchmarkInsertTrivialVector() {
+    std::vector<int> vector;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != 10000; ++i)
+            vector.insert(vector.begin() + vector.size()/2, int(i));
+    }
+
+    CORRADE_COMPARE(vector.size(), 10000);
+}
+
+void GrowableArrayTest::benchmarkInsertTrivialArray() {
+    Array<int> array;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != 10000; ++i)
+            arrayInsert(array, array.size()/2, int(i));
+    }
+
+    CORRADE_COMPARE(array.size(), 10000);
+}
+
+void GrowableArrayTest::benchmarkInsertBatchTrivialVector() {
+    std::vector<int> vector;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != 10000; i += 10)
+            vector.insert(vector.begin() + vector.size()/2, {
+                int(i),
+                int(i) + 1,
+                int(i) + 2,
+                int(i) + 3,
+                int(i) + 4,
+                int(i) + 5,
+                int(i) + 6,
+                int(i) + 7,
+                int(i) + 8,
+                int(i) + 9});
+    }
+
+    CORRADE_COMPARE(vector.size(), 10000);
+}
+
+void GrowableArrayTest::benchmarkInsertBatchTrivialArray() {
+    Array<int> array;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != 10000; i += 10)
+            arrayInsert(array, array.size()/2, {
+                int(i),
+                int(i) + 1,
+                int(i) + 2,
+                int(i) + 3,
+                int(i) + 4,
+                int(i) + 5,
+                int(i) + 6,
+                int(i) + 7,
+                int(i) + 8,
+                int(i) + 9});
+    }
+
+    CORRADE_COMPARE(array.size(), 10000);
+}
+
+void GrowableArrayTest::benchmarkInsertVector() {
+    std::vector<Movable> vector;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != 10000; ++i)
+            vector.emplace(vector.begin() + vector.size()/2, i);
+    }
+
+    CORRADE_COMPARE(vector.size(), 10000);
+}
+
+void GrowableArrayTest::benchmarkInsertArray() {
+    Array<Movable> array;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != 10000; ++i)
+            arrayInsert(array, array.size()/2, InPlaceInit, int(i));
+    }
+
+    CORRADE_COMPARE(array.size(), 10000);
+}
+
+void GrowableArrayTest::benchmarkRemoveTrivialVector() {
+    std::vector<int> vector(10000);
+    CORRADE_BENCHMARK(1) {
+        while(!vector.empty())
+            vector.erase(vector.begin() + vector.size()/2);
+    }
+
+    CORRADE_COMPARE(vector.size(), 0);
+}
+
+void GrowableArrayTest::benchmarkRemoveTrivialArray() {
+    Array<int> array;
+    arrayResize(array, 10000);
+    CORRADE_BENCHMARK(1) {
+        while(!array.empty())
+            arrayRemove(array, array.size()/2);
+    }
+
+    CORRADE_COMPARE(array.size(), 0);
+}
+
+void GrowableArrayTest::benchmarkRemoveUnorderedTrivialVector() {
+    std::vector<int> vector(10000);
+    CORRADE_BENCHMARK(1) {
+        /* The usual swap-and-pop idiom */
+        while(!vector.empty()) {
+            vector[vector.size()/2] = vector.back();
+            vector.pop_back();
+        }
+    }
+
+    CORRADE_COMPARE(vector.size(), 0);
+}
+
+void GrowableArrayTest::benchmarkRemoveUnorderedTrivialArray() {
+    Array<int> array;
+    arrayResize(array, 10000);
+    CORRADE_BENCHMARK(1) {
+        while(!array.empty())
+            arrayRemoveUnordered(array, array.size()/2);
+    }
+
+    CORRADE_COMPARE(array.size(), 0);
+}
+
+void GrowableArrayTest::benchmarkRemoveVector() {
+    std::vector<Movable> vector(10000);
+    CORRADE_BENCHMARK(1) {
+        while(!vector.empty())
+            vector.erase(vector.begin() + vector.size()/2);
+    }
+
+    CORRADE_COMPARE(vector.size(), 0);
+}
+
+void GrowableArrayTest::benchmarkRemoveArray() {
+    Array<Movable> array;
+    arrayResize(array, 10000);
+    CORRADE_BENCHMARK(1) {
+        while(!array.empty())
+            arrayRemove(array, array.size()/2);
+    }
+
+    CORRADE_COMPARE(array.size(), 0);
+}
+
 void GrowableArrayTest::benchmarkAllocationsBegin() {
     allocationCount = 0;
     allocationReuseCount = 0;
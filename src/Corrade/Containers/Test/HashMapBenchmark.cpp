@@ -0,0 +1,286 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/HashMap.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringView.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Arguments.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct HashMapBenchmark: TestSuite::Tester {
+    explicit HashMapBenchmark();
+
+    void insertInteger();
+    void insertIntegerStl();
+    void findInteger();
+    void findIntegerStl();
+
+    void insertString();
+    void insertStringStl();
+    void findString();
+    void findStringStl();
+    void findStringStlTemporary();
+};
+
+/* Sorted by count. The instances above 1e5 take too long for a regular
+   test run, pass e.g. `--hashmap-max-count 10000000` to run them as well. */
+const struct {
+    const char* name;
+    std::size_t count;
+} IntegerData[]{
+    {"1e3", 1000},
+    {"1e4", 10000},
+    {"1e5", 100000},
+    {"1e6", 1000000},
+    {"1e7", 10000000}
+};
+
+/* Stopping at a million for strings, as the key storage alone would be over
+   a hundred megabytes otherwise */
+const struct {
+    const char* name;
+    std::size_t count;
+} StringData[]{
+    {"1e3", 1000},
+    {"1e4", 10000},
+    {"1e5", 100000},
+    {"1e6", 1000000}
+};
+
+/* Count of leading instances in given data that aren't larger than
+   maxCount */
+template<class T, std::size_t size> std::size_t instanceCount(const T(&data)[size], const std::size_t maxCount) {
+    std::size_t count = 0;
+    while(count != size && data[count].count <= maxCount) ++count;
+    return count;
+}
+
+HashMapBenchmark::HashMapBenchmark(): TestSuite::Tester{TesterConfiguration{}.setSkippedArgumentPrefixes({"hashmap"})} {
+    Utility::Arguments args{"hashmap"};
+    args.addOption("max-count", "100000").setHelp("max-count", "max count of items to benchmark with", "N")
+        .parse(arguments().first, arguments().second);
+    const std::size_t maxCount = args.value<std::size_t>("max-count");
+
+    addInstancedBenchmarks({&HashMapBenchmark::insertInteger,
+                            &HashMapBenchmark::insertIntegerStl,
+                            &HashMapBenchmark::findInteger,
+                            &HashMapBenchmark::findIntegerStl}, 3,
+        instanceCount(IntegerData, maxCount));
+
+    addInstancedBenchmarks({&HashMapBenchmark::insertString,
+                            &HashMapBenchmark::insertStringStl,
+                            &HashMapBenchmark::findString,
+                            &HashMapBenchmark::findStringStl,
+                            &HashMapBenchmark::findStringStlTemporary}, 3,
+        instanceCount(StringData, maxCount));
+}
+
+/* Multiplying by an odd constant is a bijection on 32-bit integers, so the
+   keys are unique but not sequential */
+inline unsigned integerKey(std::size_t i) {
+    return unsigned(i)*2654435761u;
+}
+
+/* Lookups are done in a different order than insertion, otherwise the node
+   allocations of std::unordered_map would be accessed sequentially, which
+   doesn't reflect real-world usage. Since the counts are powers of ten, a
+   multiplication by a prime modulo the count is a permutation. */
+inline std::size_t queryIndex(std::size_t i, std::size_t count) {
+    return i*7919 % count;
+}
+
+/* Twelve characters, which fits into the small string storage of both String
+   and libstdc++ / libc++ std::string */
+constexpr std::size_t StringKeySize = 12;
+Array<char> stringKeys(std::size_t count) {
+    Array<char> out{NoInit, count*StringKeySize};
+    for(std::size_t i = 0; i != count; ++i) {
+        char* key = out + i*StringKeySize;
+        key[0] = 'k';
+        key[1] = 'e';
+        key[2] = 'y';
+        key[3] = '-';
+        unsigned value = integerKey(i);
+        for(std::size_t j = 0; j != 8; ++j) {
+            key[4 + j] = "0123456789abcdef"[value & 0xf];
+            value >>= 4;
+        }
+    }
+    return out;
+}
+
+void HashMapBenchmark::insertInteger() {
+    auto&& data = IntegerData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    HashMap<unsigned, unsigned> map;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != data.count; ++i)
+            map.set(integerKey(i), unsigned(i));
+
+    CORRADE_COMPARE(map.size(), data.count);
+}
+
+void HashMapBenchmark::insertIntegerStl() {
+    auto&& data = IntegerData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::unordered_map<unsigned, unsigned> map;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != data.count; ++i)
+            map[integerKey(i)] = unsigned(i);
+
+    CORRADE_COMPARE(map.size(), data.count);
+}
+
+void HashMapBenchmark::findInteger() {
+    auto&& data = IntegerData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    HashMap<unsigned, unsigned> map;
+    for(std::size_t i = 0; i != data.count; ++i)
+        map.set(integerKey(i), unsigned(i));
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != data.count; ++i)
+            sum += *map.find(integerKey(queryIndex(i, data.count)));
+
+    CORRADE_COMPARE(sum, data.count*(data.count - 1)/2);
+}
+
+void HashMapBenchmark::findIntegerStl() {
+    auto&& data = IntegerData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::unordered_map<unsigned, unsigned> map;
+    for(std::size_t i = 0; i != data.count; ++i)
+        map[integerKey(i)] = unsigned(i);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != data.count; ++i)
+            sum += map.find(integerKey(queryIndex(i, data.count)))->second;
+
+    CORRADE_COMPARE(sum, data.count*(data.count - 1)/2);
+}
+
+void HashMapBenchmark::insertString() {
+    auto&& data = StringData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Array<char> keys = stringKeys(data.count);
+
+    HashMap<String, unsigned> map;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != data.count; ++i)
+            map.set(StringView{keys + i*StringKeySize, StringKeySize}, unsigned(i));
+
+    CORRADE_COMPARE(map.size(), data.count);
+}
+
+void HashMapBenchmark::insertStringStl() {
+    auto&& data = StringData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Array<char> keys = stringKeys(data.count);
+
+    std::unordered_map<std::string, unsigned> map;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != data.count; ++i)
+            map[std::string{keys + i*StringKeySize, StringKeySize}] = unsigned(i);
+
+    CORRADE_COMPARE(map.size(), data.count);
+}
+
+void HashMapBenchmark::findString() {
+    auto&& data = StringData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Array<char> keys = stringKeys(data.count);
+    HashMap<String, unsigned> map;
+    for(std::size_t i = 0; i != data.count; ++i)
+        map.set(StringView{keys + i*StringKeySize, StringKeySize}, unsigned(i));
+
+    /* Looking up directly with a view, no temporary is needed */
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != data.count; ++i)
+            sum += *map.find(StringView{keys + queryIndex(i, data.count)*StringKeySize, StringKeySize});
+
+    CORRADE_COMPARE(sum, data.count*(data.count - 1)/2);
+}
+
+void HashMapBenchmark::findStringStl() {
+    auto&& data = StringData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Array<char> keys = stringKeys(data.count);
+    std::unordered_map<std::string, unsigned> map;
+    std::vector<std::string> queries;
+    queries.reserve(data.count);
+    for(std::size_t i = 0; i != data.count; ++i) {
+        queries.emplace_back(keys + i*StringKeySize, StringKeySize);
+        map[queries.back()] = unsigned(i);
+    }
+
+    /* Best case for the STL, with the query strings already prepared */
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != data.count; ++i)
+            sum += map.find(queries[queryIndex(i, data.count)])->second;
+
+    CORRADE_COMPARE(sum, data.count*(data.count - 1)/2);
+}
+
+void HashMapBenchmark::findStringStlTemporary() {
+    auto&& data = StringData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Array<char> keys = stringKeys(data.count);
+    std::unordered_map<std::string, unsigned> map;
+    for(std::size_t i = 0; i != data.count; ++i)
+        map[std::string{keys + i*StringKeySize, StringKeySize}] = unsigned(i);
+
+    /* Usual case, where a temporary std::string has to be made from the key
+       for the lookup before C++20 */
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != data.count; ++i)
+            sum += map.find(std::string{keys + queryIndex(i, data.count)*StringKeySize, StringKeySize})->second;
+
+    CORRADE_COMPARE(sum, data.count*(data.count - 1)/2);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::HashMapBenchmark)
@@ -0,0 +1,480 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/HashMap.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringView.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct HashMapTest: TestSuite::Tester {
+    explicit HashMapTest();
+
+    void hashInteger();
+    void hashString();
+
+    void constructDefault();
+    void constructInPlaceInit();
+    void copy();
+    void move();
+    void destructNonTrivial();
+
+    void set();
+    void setReplace();
+    void emplace();
+    void emplaceExisting();
+    void emplaceMoveOnly();
+    void remove();
+    void removeReinsert();
+    void grow();
+    void collisions();
+    void reserve();
+    void clear();
+
+    void heterogeneousLookup();
+    void heterogeneousInsert();
+
+    void iterate();
+    void iterateConst();
+};
+
+struct Movable {
+    static int constructed;
+    static int destructed;
+
+    /*implicit*/ Movable(int a = 0) noexcept: a{a} { ++constructed; }
+    Movable(const Movable&) = delete;
+    Movable(Movable&& other) noexcept: a(other.a) { ++constructed; }
+    ~Movable() { ++destructed; }
+    Movable& operator=(const Movable&) = delete;
+    Movable& operator=(Movable&&) = delete;
+
+    int a;
+};
+
+int Movable::constructed = 0;
+int Movable::destructed = 0;
+
+/* Puts everything into the same group to test long probe sequences */
+struct ConstantHash {
+    std::size_t operator()(int) const { return 0x2a; }
+};
+
+HashMapTest::HashMapTest() {
+    addTests({&HashMapTest::hashInteger,
+              &HashMapTest::hashString,
+
+              &HashMapTest::constructDefault,
+              &HashMapTest::constructInPlaceInit,
+              &HashMapTest::copy,
+              &HashMapTest::move,
+              &HashMapTest::destructNonTrivial,
+
+              &HashMapTest::set,
+              &HashMapTest::setReplace,
+              &HashMapTest::emplace,
+              &HashMapTest::emplaceExisting,
+              &HashMapTest::emplaceMoveOnly,
+              &HashMapTest::remove,
+              &HashMapTest::removeReinsert,
+              &HashMapTest::grow,
+              &HashMapTest::collisions,
+              &HashMapTest::reserve,
+              &HashMapTest::clear,
+
+              &HashMapTest::heterogeneousLookup,
+              &HashMapTest::heterogeneousInsert,
+
+              &HashMapTest::iterate,
+              &HashMapTest::iterateConst});
+}
+
+using namespace Literals;
+
+void HashMapTest::hashInteger() {
+    /* Consecutive values should differ in the low bits as well as in the
+       high ones */
+    const std::size_t a = Hash<int>{}(0);
+    const std::size_t b = Hash<int>{}(1);
+    CORRADE_VERIFY(a != b);
+    CORRADE_VERIFY((a & 0x7f) != (b & 0x7f));
+    CORRADE_VERIFY((a >> 7) != (b >> 7));
+
+    /* Same value of different types should hash the same */
+    CORRADE_COMPARE(Hash<unsigned short>{}(1337), Hash<long long>{}(1337));
+
+    enum class Enum: int { Value = 1 };
+    CORRADE_COMPARE(Hash<Enum>{}(Enum::Value), b);
+}
+
+void HashMapTest::hashString() {
+    CORRADE_COMPARE(Hash<StringView>{}("hello"_s), Hash<StringView>{}("hello"));
+    CORRADE_VERIFY(Hash<StringView>{}("hello"_s) != Hash<StringView>{}("hellO"_s));
+    CORRADE_COMPARE(Hash<String>{}(String{"hello"}), Hash<StringView>{}("hello"_s));
+
+    char data[] = "hello";
+    CORRADE_COMPARE(Hash<MutableStringView>{}(MutableStringView{data}), Hash<StringView>{}("hello"_s));
+}
+
+void HashMapTest::constructDefault() {
+    const HashMap<int, float> a;
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_VERIFY(a.begin() == a.end());
+    CORRADE_VERIFY(!a.find(5));
+    CORRADE_VERIFY(!a.contains(5));
+
+    CORRADE_VERIFY((std::is_nothrow_default_constructible<HashMap<int, float>>::value));
+}
+
+void HashMapTest::constructInPlaceInit() {
+    const HashMap<int, float> a{InPlaceInit, {
+        {3, 1.5f},
+        {-1, 0.25f},
+        {3, 7.0f}
+    }};
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a.capacity(), 16);
+    CORRADE_VERIFY(!a.isEmpty());
+
+    /* The first occurence wins */
+    CORRADE_VERIFY(a.find(3));
+    CORRADE_COMPARE(*a.find(3), 1.5f);
+    CORRADE_VERIFY(a.find(-1));
+    CORRADE_COMPARE(*a.find(-1), 0.25f);
+    CORRADE_VERIFY(!a.find(0));
+}
+
+void HashMapTest::copy() {
+    HashMap<int, String> a;
+    for(int i = 0; i != 100; ++i) a.set(i, String{"a very long string that doesn't fit into SSO"});
+    /* Leave some deleted slots there as well */
+    for(int i = 0; i < 100; i += 3) a.remove(i);
+
+    HashMap<int, String> b = a;
+    CORRADE_COMPARE(b.size(), a.size());
+    CORRADE_COMPARE(b.capacity(), a.capacity());
+    for(int i = 0; i != 100; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(b.contains(i), i % 3 != 0);
+        if(i % 3) CORRADE_VERIFY(b.find(i)->data() != a.find(i)->data());
+    }
+
+    HashMap<int, String> c{InPlaceInit, {{-7, "seven"}}};
+    c = b;
+    CORRADE_COMPARE(c.size(), a.size());
+    CORRADE_VERIFY(!c.contains(-7));
+    CORRADE_VERIFY(c.contains(2));
+}
+
+void HashMapTest::move() {
+    HashMap<int, int> a;
+    for(int i = 0; i != 100; ++i) a.set(i, i*2);
+    const std::size_t capacity = a.capacity();
+
+    HashMap<int, int> b = std::move(a);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 0);
+    CORRADE_VERIFY(!a.contains(5));
+    CORRADE_COMPARE(b.size(), 100);
+    CORRADE_COMPARE(b.capacity(), capacity);
+    CORRADE_VERIFY(b.find(57));
+    CORRADE_COMPARE(*b.find(57), 114);
+
+    HashMap<int, int> c{InPlaceInit, {{-7, 8}}};
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), 100);
+    CORRADE_VERIFY(!c.contains(-7));
+    CORRADE_VERIFY(c.contains(57));
+
+    CORRADE_VERIFY((std::is_nothrow_move_constructible<HashMap<int, int>>::value));
+    CORRADE_VERIFY((std::is_nothrow_move_assignable<HashMap<int, int>>::value));
+}
+
+void HashMapTest::destructNonTrivial() {
+    Movable::constructed = Movable::destructed = 0;
+    {
+        HashMap<int, Movable> a;
+        for(int i = 0; i != 100; ++i) a.emplace(i, i);
+        for(int i = 0; i != 100; i += 2) a.remove(i);
+        CORRADE_COMPARE(a.size(), 50);
+    }
+
+    /* Everything that was constructed, including the moves on rehash, got
+       destructed */
+    CORRADE_VERIFY(Movable::constructed > 100);
+    CORRADE_COMPARE(Movable::destructed, Movable::constructed);
+}
+
+void HashMapTest::set() {
+    HashMap<int, float> a;
+    float& value = a.set(5, 3.5f);
+    CORRADE_COMPARE(value, 3.5f);
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(a.capacity(), 16);
+    CORRADE_VERIFY(a.find(5) == &value);
+
+    a.set(-7, 0.5f);
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_VERIFY(a.find(-7));
+    CORRADE_COMPARE(*a.find(-7), 0.5f);
+    CORRADE_VERIFY(a.contains(5));
+    CORRADE_VERIFY(!a.contains(6));
+}
+
+void HashMapTest::setReplace() {
+    HashMap<int, String> a;
+    a.set(5, "hello");
+    String& value = a.set(5, "world");
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(value, "world");
+    CORRADE_VERIFY(a.find(5) == &value);
+}
+
+void HashMapTest::emplace() {
+    HashMap<int, String> a;
+    String& value = a.emplace(5, "hello", std::size_t{3});
+    CORRADE_COMPARE(value, "hel");
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_VERIFY(a.find(5) == &value);
+
+    /* Value-initialized if there are no arguments */
+    HashMap<int, int> b;
+    CORRADE_COMPARE(b.emplace(3), 0);
+}
+
+void HashMapTest::emplaceExisting() {
+    HashMap<int, String> a;
+    a.emplace(5, "hello");
+
+    /* The arguments are ignored */
+    String& value = a.emplace(5, "world");
+    CORRADE_COMPARE(value, "hello");
+    CORRADE_COMPARE(a.size(), 1);
+}
+
+void HashMapTest::emplaceMoveOnly() {
+    Movable::constructed = Movable::destructed = 0;
+    {
+        HashMap<int, Movable> a;
+        a.emplace(1, 15);
+        a.emplace(2, Movable{3});
+        CORRADE_COMPARE(a.find(1)->a, 15);
+        CORRADE_COMPARE(a.find(2)->a, 3);
+        CORRADE_COMPARE(Movable::constructed, 3);
+        CORRADE_COMPARE(Movable::destructed, 1);
+    }
+    CORRADE_COMPARE(Movable::destructed, 3);
+}
+
+void HashMapTest::remove() {
+    HashMap<int, int> a;
+    for(int i = 0; i != 10; ++i) a.set(i, i*10);
+
+    CORRADE_VERIFY(a.remove(3));
+    CORRADE_VERIFY(!a.remove(3));
+    CORRADE_VERIFY(!a.remove(10));
+    CORRADE_COMPARE(a.size(), 9);
+    CORRADE_COMPARE(a.capacity(), 16);
+    CORRADE_VERIFY(!a.contains(3));
+    for(int i: {0, 1, 2, 4, 5, 6, 7, 8, 9}) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(a.find(i));
+        CORRADE_COMPARE(*a.find(i), i*10);
+    }
+
+    /* Removing everything */
+    for(int i = 0; i != 10; ++i) a.remove(i);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_VERIFY(a.begin() == a.end());
+}
+
+void HashMapTest::removeReinsert() {
+    /* Repeatedly inserting and removing keys shouldn't make the map grow
+       indefinitely, the deleted slots should get either reused or cleaned up
+       by an in-place rehash */
+    HashMap<int, int> a;
+    for(int i = 0; i != 10000; ++i) {
+        a.set(i, i);
+        if(i >= 20) CORRADE_VERIFY(a.remove(i - 20));
+    }
+
+    /* Once there are more deleted slots than live ones, the map gets rehashed
+       in place instead of growing */
+    CORRADE_COMPARE(a.size(), 20);
+    CORRADE_COMPARE(a.capacity(), 64);
+    for(int i = 10000 - 20; i != 10000; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(a.find(i));
+        CORRADE_COMPARE(*a.find(i), i);
+    }
+}
+
+void HashMapTest::grow() {
+    HashMap<int, int> a;
+    for(int i = 0; i != 1000; ++i) {
+        a.set(i*7, i);
+        CORRADE_VERIFY(a.size() <= a.capacity() - a.capacity()/8);
+    }
+
+    CORRADE_COMPARE(a.size(), 1000);
+    CORRADE_COMPARE(a.capacity(), 2048);
+    for(int i = 0; i != 1000; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(a.find(i*7));
+        CORRADE_COMPARE(*a.find(i*7), i);
+        CORRADE_VERIFY(!a.contains(i*7 + 1));
+    }
+}
+
+void HashMapTest::collisions() {
+    HashMap<int, int, ConstantHash> a;
+    for(int i = 0; i != 100; ++i) a.set(i, -i);
+    CORRADE_COMPARE(a.size(), 100);
+
+    /* Removing from the middle of the probe sequence shouldn't make the keys
+       after inaccessible */
+    for(int i = 0; i != 100; i += 2) CORRADE_VERIFY(a.remove(i));
+    for(int i = 0; i != 100; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(a.contains(i), i % 2 == 1);
+        if(i % 2) CORRADE_COMPARE(*a.find(i), -i);
+    }
+
+    /* Reinserting shouldn't create duplicates */
+    for(int i = 0; i != 100; ++i) a.set(i, i);
+    CORRADE_COMPARE(a.size(), 100);
+    int sum = 0;
+    for(const HashMapEntry<int, int>& entry: a) sum += entry.value();
+    CORRADE_COMPARE(sum, 4950);
+}
+
+void HashMapTest::reserve() {
+    HashMap<int, int> a;
+    a.reserve(100);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 128);
+
+    /* Filling up to the reserved size doesn't reallocate */
+    for(int i = 0; i != 100; ++i) a.set(i, i);
+    const int* data = a.find(0);
+    a.set(100, 100);
+    a.set(101, 101);
+    CORRADE_COMPARE(a.capacity(), 128);
+    CORRADE_VERIFY(a.find(0) == data);
+
+    /* Reserving less does nothing */
+    a.reserve(10);
+    CORRADE_COMPARE(a.capacity(), 128);
+    CORRADE_VERIFY(a.find(0) == data);
+}
+
+void HashMapTest::clear() {
+    Movable::constructed = Movable::destructed = 0;
+    {
+        HashMap<int, Movable> a;
+        for(int i = 0; i != 50; ++i) a.emplace(i, i);
+        const std::size_t capacity = a.capacity();
+
+        a.clear();
+        CORRADE_COMPARE(a.size(), 0);
+        CORRADE_COMPARE(a.capacity(), capacity);
+        CORRADE_VERIFY(!a.contains(3));
+        CORRADE_COMPARE(Movable::destructed, Movable::constructed);
+
+        a.emplace(3, 7);
+        CORRADE_COMPARE(a.find(3)->a, 7);
+    }
+    CORRADE_COMPARE(Movable::destructed, Movable::constructed);
+}
+
+void HashMapTest::heterogeneousLookup() {
+    HashMap<String, int> a;
+    a.set(String{"hello"}, 1);
+    a.set(String{"a string that's long enough to not be stored inline"}, 2);
+
+    CORRADE_VERIFY(a.find("hello"_s));
+    CORRADE_COMPARE(*a.find("hello"_s), 1);
+    CORRADE_VERIFY(a.contains("hello"));
+    /* A view that's not null-terminated */
+    CORRADE_VERIFY(a.find("hello world"_s.prefix(5)));
+    CORRADE_COMPARE(*a.find("a string that's long enough to not be stored inline!"_s.except(1)), 2);
+    CORRADE_VERIFY(!a.contains("hell"_s));
+    CORRADE_VERIFY(a.remove("hello"_s));
+    CORRADE_VERIFY(!a.contains(String{"hello"}));
+}
+
+void HashMapTest::heterogeneousInsert() {
+    HashMap<String, int> a;
+    a.emplace("hello"_s, 3);
+    a.set("world", 4);
+    CORRADE_COMPARE(a.size(), 2);
+
+    /* Existing key isn't copied */
+    const String* key = &a.begin()->key();
+    a.emplace("hello"_s, 5);
+    a.set("world"_s, 6);
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_VERIFY(&a.begin()->key() == key);
+    CORRADE_COMPARE(*a.find("hello"_s), 3);
+    CORRADE_COMPARE(*a.find("world"_s), 6);
+}
+
+void HashMapTest::iterate() {
+    HashMap<int, int> a;
+    for(int i = 0; i != 100; ++i) a.set(i, i);
+    a.remove(50);
+
+    for(HashMapEntry<int, int>& entry: a) entry.value() *= 2;
+
+    int count = 0, keySum = 0, valueSum = 0;
+    for(auto it = a.begin(); it != a.end(); ++it) {
+        ++count;
+        keySum += it->key();
+        valueSum += it->value();
+    }
+    CORRADE_COMPARE(count, 99);
+    CORRADE_COMPARE(keySum, 4900);
+    CORRADE_COMPARE(valueSum, 9800);
+}
+
+void HashMapTest::iterateConst() {
+    const HashMap<int, int> a{InPlaceInit, {{1, 10}, {2, 20}, {3, 30}}};
+
+    int keySum = 0, valueSum = 0;
+    for(auto it = a.cbegin(); it != a.cend(); ++it) {
+        keySum += it->key();
+        valueSum += it->value();
+    }
+    CORRADE_COMPARE(keySum, 6);
+    CORRADE_COMPARE(valueSum, 60);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::HashMapTest)
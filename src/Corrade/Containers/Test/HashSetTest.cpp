@@ -0,0 +1,209 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/HashSet.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringView.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct HashSetTest: TestSuite::Tester {
+    explicit HashSetTest();
+
+    void constructDefault();
+    void constructInPlaceInit();
+    void copy();
+    void move();
+
+    void insert();
+    void find();
+    void remove();
+    void grow();
+    void clear();
+
+    void heterogeneous();
+
+    void iterate();
+};
+
+HashSetTest::HashSetTest() {
+    addTests({&HashSetTest::constructDefault,
+              &HashSetTest::constructInPlaceInit,
+              &HashSetTest::copy,
+              &HashSetTest::move,
+
+              &HashSetTest::insert,
+              &HashSetTest::find,
+              &HashSetTest::remove,
+              &HashSetTest::grow,
+              &HashSetTest::clear,
+
+              &HashSetTest::heterogeneous,
+
+              &HashSetTest::iterate});
+}
+
+using namespace Literals;
+
+void HashSetTest::constructDefault() {
+    const HashSet<int> a;
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_VERIFY(a.begin() == a.end());
+    CORRADE_VERIFY(!a.contains(5));
+
+    CORRADE_VERIFY((std::is_nothrow_default_constructible<HashSet<int>>::value));
+}
+
+void HashSetTest::constructInPlaceInit() {
+    const HashSet<int> a{InPlaceInit, {3, -1, 3, 17}};
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.capacity(), 16);
+    CORRADE_VERIFY(a.contains(3));
+    CORRADE_VERIFY(a.contains(-1));
+    CORRADE_VERIFY(a.contains(17));
+    CORRADE_VERIFY(!a.contains(0));
+}
+
+void HashSetTest::copy() {
+    HashSet<String> a;
+    a.insert(String{"hello"});
+    a.insert(String{"a string that's long enough to not be stored inline"});
+
+    HashSet<String> b = a;
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_VERIFY(b.contains("hello"_s));
+    CORRADE_VERIFY(b.contains("a string that's long enough to not be stored inline"_s));
+
+    HashSet<String> c{InPlaceInit, {"world"}};
+    c = a;
+    CORRADE_COMPARE(c.size(), 2);
+    CORRADE_VERIFY(!c.contains("world"_s));
+    CORRADE_VERIFY(c.contains("hello"_s));
+}
+
+void HashSetTest::move() {
+    HashSet<int> a{InPlaceInit, {1, 2, 3}};
+
+    HashSet<int> b = std::move(a);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 0);
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_VERIFY(b.contains(2));
+
+    HashSet<int> c{InPlaceInit, {7}};
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), 3);
+    CORRADE_VERIFY(!c.contains(7));
+    CORRADE_VERIFY(c.contains(2));
+
+    CORRADE_VERIFY((std::is_nothrow_move_constructible<HashSet<int>>::value));
+    CORRADE_VERIFY((std::is_nothrow_move_assignable<HashSet<int>>::value));
+}
+
+void HashSetTest::insert() {
+    HashSet<int> a;
+    CORRADE_VERIFY(a.insert(5));
+    CORRADE_VERIFY(a.insert(-3));
+    CORRADE_VERIFY(!a.insert(5));
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_VERIFY(a.contains(5));
+    CORRADE_VERIFY(a.contains(-3));
+    CORRADE_VERIFY(!a.contains(3));
+}
+
+void HashSetTest::find() {
+    HashSet<String> a{InPlaceInit, {"hello", "world"}};
+
+    const String* found = a.find("world"_s);
+    CORRADE_VERIFY(found);
+    CORRADE_COMPARE(*found, "world");
+    /* It's the stored instance, not a copy */
+    CORRADE_VERIFY(found == a.find("world"));
+
+    CORRADE_VERIFY(!a.find("hell"_s));
+}
+
+void HashSetTest::remove() {
+    HashSet<int> a{InPlaceInit, {1, 2, 3, 4}};
+    CORRADE_VERIFY(a.remove(2));
+    CORRADE_VERIFY(!a.remove(2));
+    CORRADE_VERIFY(!a.remove(5));
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_VERIFY(a.contains(1));
+    CORRADE_VERIFY(!a.contains(2));
+    CORRADE_VERIFY(a.contains(3));
+    CORRADE_VERIFY(a.contains(4));
+}
+
+void HashSetTest::grow() {
+    HashSet<unsigned> a;
+    for(unsigned i = 0; i != 1000; ++i) CORRADE_VERIFY(a.insert(i*i));
+    CORRADE_COMPARE(a.size(), 1000);
+    CORRADE_COMPARE(a.capacity(), 2048);
+    for(unsigned i = 0; i != 1000; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(a.contains(i*i));
+    }
+}
+
+void HashSetTest::clear() {
+    HashSet<int> a{InPlaceInit, {1, 2, 3}};
+    a.clear();
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 16);
+    CORRADE_VERIFY(!a.contains(1));
+    CORRADE_VERIFY(a.begin() == a.end());
+}
+
+void HashSetTest::heterogeneous() {
+    HashSet<String> a;
+    CORRADE_VERIFY(a.insert("hello"_s));
+    CORRADE_VERIFY(!a.insert("hello"));
+    CORRADE_VERIFY(a.contains("hello world"_s.prefix(5)));
+    CORRADE_VERIFY(!a.contains("hell"_s));
+    CORRADE_VERIFY(a.remove("hello"_s));
+    CORRADE_VERIFY(a.isEmpty());
+}
+
+void HashSetTest::iterate() {
+    HashSet<int> a;
+    for(int i = 0; i != 100; ++i) a.insert(i);
+    a.remove(50);
+
+    int count = 0, sum = 0;
+    for(int i: a) {
+        ++count;
+        sum += i;
+    }
+    CORRADE_COMPARE(count, 99);
+    CORRADE_COMPARE(sum, 4900);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::HashSetTest)
@@ -0,0 +1,360 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/Pointer.h"
+#include "Corrade/Containers/RingBuffer.h"
+#include "Corrade/TestSuite/Tester.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct RingBufferTest: TestSuite::Tester {
+    explicit RingBufferTest();
+
+    void construct();
+    void constructZeroCapacity();
+    void constructCopy();
+    void constructMove();
+
+    void pushPop();
+    void pushFull();
+    void popEmpty();
+    void wrapAround();
+    void emplace();
+    void moveOnly();
+
+    void pushBatch();
+    void pushBatchFull();
+    void popBatch();
+    void popBatchEmpty();
+
+    void destructRemaining();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void threaded();
+    void threadedBatch();
+    #endif
+};
+
+RingBufferTest::RingBufferTest() {
+    addTests({&RingBufferTest::construct,
+              &RingBufferTest::constructZeroCapacity,
+              &RingBufferTest::constructCopy,
+              &RingBufferTest::constructMove,
+
+              &RingBufferTest::pushPop,
+              &RingBufferTest::pushFull,
+              &RingBufferTest::popEmpty,
+              &RingBufferTest::wrapAround,
+              &RingBufferTest::emplace,
+              &RingBufferTest::moveOnly,
+
+              &RingBufferTest::pushBatch,
+              &RingBufferTest::pushBatchFull,
+              &RingBufferTest::popBatch,
+              &RingBufferTest::popBatchEmpty,
+
+              &RingBufferTest::destructRemaining,
+
+              #ifndef CORRADE_TARGET_EMSCRIPTEN
+              &RingBufferTest::threaded,
+              &RingBufferTest::threadedBatch
+              #endif
+              });
+}
+
+struct Counted {
+    static int constructed;
+    static int destructed;
+
+    /*implicit*/ Counted(int value = 0): value{value} { ++constructed; }
+    Counted(const Counted& other): value{other.value} { ++constructed; }
+    ~Counted() { ++destructed; }
+    Counted& operator=(const Counted&) = default;
+
+    int value;
+};
+
+int Counted::constructed = 0;
+int Counted::destructed = 0;
+
+void RingBufferTest::construct() {
+    RingBuffer<int> a{100};
+    CORRADE_COMPARE(a.capacity(), 128);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+
+    RingBuffer<int> b{64};
+    CORRADE_COMPARE(b.capacity(), 64);
+}
+
+void RingBufferTest::constructZeroCapacity() {
+    RingBuffer<int> a{0};
+    CORRADE_COMPARE(a.capacity(), 1);
+    CORRADE_VERIFY(a.push(3));
+    CORRADE_VERIFY(!a.push(4));
+    CORRADE_COMPARE(a.pop(), 3);
+    CORRADE_VERIFY(!a.pop());
+}
+
+void RingBufferTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<RingBuffer<int>>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<RingBuffer<int>>::value);
+}
+
+void RingBufferTest::constructMove() {
+    CORRADE_VERIFY(!std::is_move_constructible<RingBuffer<int>>::value);
+    CORRADE_VERIFY(!std::is_move_assignable<RingBuffer<int>>::value);
+}
+
+void RingBufferTest::pushPop() {
+    RingBuffer<int> a{4};
+    CORRADE_VERIFY(a.push(1));
+    CORRADE_VERIFY(a.push(2));
+    CORRADE_VERIFY(a.push(3));
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_VERIFY(!a.isEmpty());
+
+    CORRADE_COMPARE(a.pop(), 1);
+    CORRADE_COMPARE(a.pop(), 2);
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(a.pop(), 3);
+    CORRADE_VERIFY(a.isEmpty());
+}
+
+void RingBufferTest::pushFull() {
+    RingBuffer<int> a{4};
+    for(int i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(a.push(i));
+    }
+    CORRADE_VERIFY(!a.push(4));
+    CORRADE_COMPARE(a.size(), 4);
+
+    /* After popping one there's space again */
+    CORRADE_COMPARE(a.pop(), 0);
+    CORRADE_VERIFY(a.push(4));
+    CORRADE_VERIFY(!a.push(5));
+}
+
+void RingBufferTest::popEmpty() {
+    RingBuffer<int> a{4};
+    CORRADE_VERIFY(!a.pop());
+
+    a.push(3);
+    CORRADE_COMPARE(a.pop(), 3);
+    CORRADE_VERIFY(!a.pop());
+}
+
+void RingBufferTest::wrapAround() {
+    RingBuffer<int> a{4};
+    int next = 0, expected = 0;
+    for(std::size_t i = 0; i != 25; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(a.push(next++));
+        CORRADE_VERIFY(a.push(next++));
+        CORRADE_VERIFY(a.push(next++));
+        CORRADE_COMPARE(a.pop(), expected++);
+        CORRADE_COMPARE(a.pop(), expected++);
+        CORRADE_COMPARE(a.pop(), expected++);
+    }
+}
+
+void RingBufferTest::emplace() {
+    struct Pair {
+        int a;
+        float b;
+    };
+
+    RingBuffer<Pair> a{2};
+    CORRADE_VERIFY(a.emplace(3, 1.5f));
+
+    Optional<Pair> out = a.pop();
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(out->a, 3);
+    CORRADE_COMPARE(out->b, 1.5f);
+}
+
+void RingBufferTest::moveOnly() {
+    RingBuffer<Pointer<int>> a{2};
+    CORRADE_VERIFY(a.push(Pointer<int>{InPlaceInit, 5}));
+    CORRADE_VERIFY(a.emplace(new int{6}));
+
+    Optional<Pointer<int>> out = a.pop();
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(**out, 5);
+
+    Pointer<int> outBatch[2];
+    CORRADE_COMPARE(a.pop(outBatch), 1);
+    CORRADE_COMPARE(*outBatch[0], 6);
+    CORRADE_VERIFY(!outBatch[1]);
+}
+
+void RingBufferTest::pushBatch() {
+    RingBuffer<int> a{8};
+    const int data[]{1, 2, 3, 4, 5};
+    CORRADE_COMPARE(a.push(data), 5);
+    CORRADE_COMPARE(a.size(), 5);
+
+    for(int i = 1; i != 6; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(a.pop(), i);
+    }
+
+    /* Batch crossing the end of the storage */
+    CORRADE_COMPARE(a.push(data), 5);
+    for(int i = 1; i != 6; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(a.pop(), i);
+    }
+
+    CORRADE_COMPARE(a.push(nullptr), 0);
+}
+
+void RingBufferTest::pushBatchFull() {
+    RingBuffer<int> a{4};
+    a.push(0);
+    const int data[]{1, 2, 3, 4, 5};
+    CORRADE_COMPARE(a.push(data), 3);
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a.push(data), 0);
+
+    for(int i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(a.pop(), i);
+    }
+}
+
+void RingBufferTest::popBatch() {
+    RingBuffer<int> a{8};
+    for(int i = 0; i != 6; ++i) a.push(i);
+
+    int out[4]{};
+    CORRADE_COMPARE(a.pop(out), 4);
+    CORRADE_COMPARE(out[0], 0);
+    CORRADE_COMPARE(out[1], 1);
+    CORRADE_COMPARE(out[2], 2);
+    CORRADE_COMPARE(out[3], 3);
+
+    /* Only two remaining */
+    CORRADE_COMPARE(a.pop(out), 2);
+    CORRADE_COMPARE(out[0], 4);
+    CORRADE_COMPARE(out[1], 5);
+    CORRADE_VERIFY(a.isEmpty());
+}
+
+void RingBufferTest::popBatchEmpty() {
+    RingBuffer<int> a{8};
+    int out[4]{};
+    CORRADE_COMPARE(a.pop(out), 0);
+    CORRADE_COMPARE(a.pop(nullptr), 0);
+}
+
+void RingBufferTest::destructRemaining() {
+    Counted::constructed = Counted::destructed = 0;
+
+    {
+        RingBuffer<Counted> a{8};
+        CORRADE_COMPARE(Counted::constructed, 0);
+
+        a.push(Counted{1});
+        a.push(Counted{2});
+        a.push(Counted{3});
+        /* Three temporaries and three copies in the buffer */
+        CORRADE_COMPARE(Counted::constructed, 6);
+        CORRADE_COMPARE(Counted::destructed, 3);
+
+        /* The popped item is moved out of the slot and the slot destructed,
+           so just two remain alive after */
+        CORRADE_COMPARE(a.pop()->value, 1);
+        CORRADE_COMPARE(Counted::constructed - Counted::destructed, 2);
+    }
+
+    /* The remaining two got destructed */
+    CORRADE_COMPARE(Counted::constructed, Counted::destructed);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+constexpr std::size_t ThreadedCount = 100000;
+
+void RingBufferTest::threaded() {
+    RingBuffer<std::size_t> a{64};
+
+    std::thread producer{[&a]() {
+        for(std::size_t i = 0; i != ThreadedCount; ++i)
+            while(!a.push(i)) std::this_thread::yield();
+    }};
+
+    /* Items have to arrive in order and none of them can get lost */
+    std::size_t expected = 0;
+    bool ordered = true;
+    while(expected != ThreadedCount) {
+        if(Optional<std::size_t> value = a.pop()) {
+            if(*value != expected) ordered = false;
+            ++expected;
+        } else std::this_thread::yield();
+    }
+
+    producer.join();
+    CORRADE_VERIFY(ordered);
+    CORRADE_VERIFY(a.isEmpty());
+}
+
+void RingBufferTest::threadedBatch() {
+    RingBuffer<std::size_t> a{64};
+
+    std::thread producer{[&a]() {
+        std::size_t data[13];
+        for(std::size_t i = 0; i < ThreadedCount; ) {
+            std::size_t count = ThreadedCount - i < 13 ? ThreadedCount - i : 13;
+            for(std::size_t j = 0; j != count; ++j) data[j] = i + j;
+            const std::size_t pushed = a.push(ArrayView<const std::size_t>{data, count});
+            if(!pushed) std::this_thread::yield();
+            i += pushed;
+        }
+    }};
+
+    std::size_t expected = 0;
+    bool ordered = true;
+    std::size_t data[17];
+    while(expected != ThreadedCount) {
+        const std::size_t popped = a.pop(data);
+        if(!popped) std::this_thread::yield();
+        for(std::size_t i = 0; i != popped; ++i)
+            if(data[i] != expected++) ordered = false;
+    }
+
+    producer.join();
+    CORRADE_VERIFY(ordered);
+    CORRADE_VERIFY(a.isEmpty());
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::RingBufferTest)
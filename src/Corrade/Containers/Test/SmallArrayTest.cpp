@@ -0,0 +1,614 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <string>
+
+#include "Corrade/Containers/SmallArray.h"
+#include "Corrade/Containers/StridedArrayView.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/Utility/DebugStl.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct SmallArrayTest: TestSuite::Tester {
+    explicit SmallArrayTest();
+
+    void constructDefault();
+    void constructValueInit();
+    void constructValueInitHeap();
+    void constructDefaultInit();
+    void constructNoInit();
+    void constructDirectInit();
+    void constructInPlaceInit();
+    void constructInPlaceInitHeap();
+
+    void copy();
+    void copyHeap();
+    void move();
+    void moveHeap();
+    void moveAssign();
+    void moveAssignHeap();
+    void destructNonTrivial();
+
+    void convertView();
+    void convertConstView();
+    void convertStridedView();
+
+    void access();
+    void accessInvalid();
+    void slice();
+
+    void appendInline();
+    void appendSpillToHeap();
+    void appendNonTrivial();
+    void appendInPlace();
+    void appendList();
+    void appendNoInit();
+    void reserve();
+    void resize();
+    void removeSuffix();
+    void removeSuffixInvalid();
+    void shrink();
+};
+
+struct Movable {
+    static int constructed;
+    static int destructed;
+    static int moved;
+
+    /*implicit*/ Movable(int a = 0) noexcept: a{a} { ++constructed; }
+    Movable(const Movable&) = delete;
+    Movable(Movable&& other) noexcept: a(other.a) {
+        ++constructed;
+        ++moved;
+    }
+    ~Movable() { ++destructed; }
+    Movable& operator=(const Movable&) = delete;
+    Movable& operator=(Movable&&) = delete;
+
+    int a;
+};
+
+int Movable::constructed = 0;
+int Movable::destructed = 0;
+int Movable::moved = 0;
+
+SmallArrayTest::SmallArrayTest() {
+    addTests({&SmallArrayTest::constructDefault,
+              &SmallArrayTest::constructValueInit,
+              &SmallArrayTest::constructValueInitHeap,
+              &SmallArrayTest::constructDefaultInit,
+              &SmallArrayTest::constructNoInit,
+              &SmallArrayTest::constructDirectInit,
+              &SmallArrayTest::constructInPlaceInit,
+              &SmallArrayTest::constructInPlaceInitHeap,
+
+              &SmallArrayTest::copy,
+              &SmallArrayTest::copyHeap,
+              &SmallArrayTest::move,
+              &SmallArrayTest::moveHeap,
+              &SmallArrayTest::moveAssign,
+              &SmallArrayTest::moveAssignHeap,
+              &SmallArrayTest::destructNonTrivial,
+
+              &SmallArrayTest::convertView,
+              &SmallArrayTest::convertConstView,
+              &SmallArrayTest::convertStridedView,
+
+              &SmallArrayTest::access,
+              &SmallArrayTest::accessInvalid,
+              &SmallArrayTest::slice,
+
+              &SmallArrayTest::appendInline,
+              &SmallArrayTest::appendSpillToHeap,
+              &SmallArrayTest::appendNonTrivial,
+              &SmallArrayTest::appendInPlace,
+              &SmallArrayTest::appendList,
+              &SmallArrayTest::appendNoInit,
+              &SmallArrayTest::reserve,
+              &SmallArrayTest::resize,
+              &SmallArrayTest::removeSuffix,
+              &SmallArrayTest::removeSuffixInvalid,
+              &SmallArrayTest::shrink});
+}
+
+void SmallArrayTest::constructDefault() {
+    const SmallArray<4, int> a;
+    CORRADE_VERIFY(a.data());
+    CORRADE_VERIFY(a.empty());
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 4);
+    CORRADE_COMPARE(a.begin(), a.end());
+    CORRADE_COMPARE(int(SmallArray<4, int>::InlineCapacity), 4);
+
+    /* The data are stored inline */
+    CORRADE_VERIFY(reinterpret_cast<const char*>(a.data()) >= reinterpret_cast<const char*>(&a));
+    CORRADE_VERIFY(reinterpret_cast<const char*>(a.data()) < reinterpret_cast<const char*>(&a + 1));
+}
+
+void SmallArrayTest::constructValueInit() {
+    SmallArray<4, int> a{ValueInit, 3};
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.capacity(), 4);
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({0, 0, 0}),
+        TestSuite::Compare::Container);
+
+    /* Implicit alias */
+    SmallArray<4, int> b{4};
+    CORRADE_VERIFY(b.isSmall());
+    CORRADE_COMPARE_AS(arrayView(b), arrayView({0, 0, 0, 0}),
+        TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::constructValueInitHeap() {
+    SmallArray<4, int> a{ValueInit, 5};
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(a.capacity(), 5);
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({0, 0, 0, 0, 0}),
+        TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::constructDefaultInit() {
+    SmallArray<4, std::string> a{DefaultInit, 3};
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a[2], "");
+}
+
+void SmallArrayTest::constructNoInit() {
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+    {
+        SmallArray<2, Movable> a{NoInit, 3};
+        CORRADE_VERIFY(!a.isSmall());
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_COMPARE(Movable::constructed, 0);
+
+        for(Movable& i: a) new(&i) Movable{7};
+        CORRADE_COMPARE(a[2].a, 7);
+    }
+    CORRADE_COMPARE(Movable::constructed, 3);
+    CORRADE_COMPARE(Movable::destructed, 3);
+}
+
+void SmallArrayTest::constructDirectInit() {
+    SmallArray<4, int> a{DirectInit, 3, -37};
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({-37, -37, -37}),
+        TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::constructInPlaceInit() {
+    SmallArray<4, int> a{InPlaceInit, {1, 3, 5}};
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 3, 5}),
+        TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::constructInPlaceInitHeap() {
+    SmallArray<2, int> a{InPlaceInit, {1, 3, 5}};
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 3, 5}),
+        TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::copy() {
+    SmallArray<4, std::string> a{InPlaceInit, {"hello", "world"}};
+
+    SmallArray<4, std::string> b = a;
+    CORRADE_VERIFY(b.isSmall());
+    CORRADE_COMPARE_AS(arrayView(b), arrayView<std::string>({"hello", "world"}),
+        TestSuite::Compare::Container);
+
+    SmallArray<4, std::string> c{InPlaceInit, {"a", "b", "c", "d", "e"}};
+    CORRADE_VERIFY(!c.isSmall());
+    c = a;
+    CORRADE_VERIFY(c.isSmall());
+    CORRADE_COMPARE_AS(arrayView(c), arrayView<std::string>({"hello", "world"}),
+        TestSuite::Compare::Container);
+
+    /* The original is untouched */
+    CORRADE_COMPARE_AS(arrayView(a), arrayView<std::string>({"hello", "world"}),
+        TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::copyHeap() {
+    SmallArray<1, std::string> a{InPlaceInit, {"hello", "world"}};
+    CORRADE_VERIFY(!a.isSmall());
+
+    SmallArray<1, std::string> b = a;
+    CORRADE_VERIFY(!b.isSmall());
+    CORRADE_VERIFY(b.data() != a.data());
+    CORRADE_COMPARE_AS(arrayView(b), arrayView<std::string>({"hello", "world"}),
+        TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::move() {
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+    {
+        SmallArray<4, Movable> a;
+        arrayAppend(a, InPlaceInit, 1);
+        arrayAppend(a, InPlaceInit, 2);
+
+        SmallArray<4, Movable> b = std::move(a);
+        CORRADE_VERIFY(b.isSmall());
+        CORRADE_COMPARE(b.size(), 2);
+        CORRADE_COMPARE(b[1].a, 2);
+        CORRADE_VERIFY(a.isSmall());
+        CORRADE_COMPARE(a.size(), 0);
+
+        /* Elements had to be moved one by one */
+        CORRADE_COMPARE(Movable::moved, 2);
+    }
+    CORRADE_COMPARE(Movable::constructed, 4);
+    CORRADE_COMPARE(Movable::destructed, 4);
+
+    CORRADE_VERIFY((std::is_nothrow_move_constructible<SmallArray<4, Movable>>::value));
+    CORRADE_VERIFY((std::is_nothrow_move_assignable<SmallArray<4, Movable>>::value));
+}
+
+void SmallArrayTest::moveHeap() {
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+    {
+        SmallArray<1, Movable> a;
+        arrayAppend(a, InPlaceInit, 1);
+        arrayAppend(a, InPlaceInit, 2);
+        CORRADE_VERIFY(!a.isSmall());
+        const Movable* data = a.data();
+        Movable::moved = 0;
+
+        SmallArray<1, Movable> b = std::move(a);
+        CORRADE_VERIFY(!b.isSmall());
+        CORRADE_COMPARE(b.data(), data);
+        CORRADE_COMPARE(b.size(), 2);
+        CORRADE_VERIFY(a.isSmall());
+        CORRADE_COMPARE(a.size(), 0);
+        CORRADE_COMPARE(a.capacity(), 1);
+
+        /* The allocation was taken over */
+        CORRADE_COMPARE(Movable::moved, 0);
+    }
+    CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+void SmallArrayTest::moveAssign() {
+    SmallArray<2, int> a{InPlaceInit, {1, 2}};
+    SmallArray<2, int> b{InPlaceInit, {3, 4, 5}};
+
+    b = std::move(a);
+    CORRADE_VERIFY(b.isSmall());
+    CORRADE_COMPARE_AS(arrayView(b), arrayView({1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(a.size(), 0);
+}
+
+void SmallArrayTest::moveAssignHeap() {
+    SmallArray<2, int> a{InPlaceInit, {1, 2, 3}};
+    SmallArray<2, int> b{InPlaceInit, {4}};
+    const int* data = a.data();
+
+    b = std::move(a);
+    CORRADE_VERIFY(!b.isSmall());
+    CORRADE_COMPARE(b.data(), data);
+    CORRADE_COMPARE_AS(arrayView(b), arrayView({1, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.size(), 0);
+}
+
+void SmallArrayTest::destructNonTrivial() {
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+    {
+        SmallArray<2, Movable> a{DirectInit, 2, 5};
+        SmallArray<2, Movable> b{DirectInit, 7, 5};
+    }
+    CORRADE_COMPARE(Movable::constructed, 9);
+    CORRADE_COMPARE(Movable::destructed, 9);
+}
+
+void takesAView(ArrayView<int>) {}
+void takesAConstView(ArrayView<const int>) {}
+
+void SmallArrayTest::convertView() {
+    SmallArray<4, int> a{InPlaceInit, {1, 2, 3}};
+
+    ArrayView<int> b = a;
+    CORRADE_COMPARE(b.data(), a.data());
+    CORRADE_COMPARE(b.size(), 3);
+
+    ArrayView<const int> c = a;
+    CORRADE_COMPARE(c.data(), a.data());
+    CORRADE_COMPARE(c.size(), 3);
+
+    auto d = arrayView(a);
+    CORRADE_VERIFY((std::is_same<decltype(d), ArrayView<int>>::value));
+    CORRADE_COMPARE(d.data(), a.data());
+    CORRADE_COMPARE(d.size(), 3);
+
+    /* Implicit conversion in function calls */
+    takesAView(a);
+    takesAConstView(a);
+}
+
+void SmallArrayTest::convertConstView() {
+    const SmallArray<4, int> a{InPlaceInit, {1, 2, 3}};
+
+    ArrayView<const int> b = a;
+    CORRADE_COMPARE(b.data(), a.data());
+    CORRADE_COMPARE(b.size(), 3);
+
+    auto c = arrayView(a);
+    CORRADE_VERIFY((std::is_same<decltype(c), ArrayView<const int>>::value));
+    CORRADE_COMPARE(c.data(), a.data());
+
+    /* Only const views */
+    CORRADE_VERIFY((std::is_convertible<const SmallArray<4, int>&, ArrayView<const int>>::value));
+    CORRADE_VERIFY(!(std::is_convertible<const SmallArray<4, int>&, ArrayView<int>>::value));
+}
+
+void SmallArrayTest::convertStridedView() {
+    SmallArray<4, int> a{InPlaceInit, {1, 2, 3}};
+
+    StridedArrayView1D<int> b = a;
+    CORRADE_COMPARE(b.data(), a.data());
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b.stride(), 4);
+
+    StridedArrayView1D<const int> c = a;
+    CORRADE_COMPARE(c.data(), a.data());
+    CORRADE_COMPARE(c.size(), 3);
+}
+
+void SmallArrayTest::access() {
+    SmallArray<4, int> a{InPlaceInit, {1, 2, 3}};
+    CORRADE_COMPARE(a.front(), 1);
+    CORRADE_COMPARE(a.back(), 3);
+    CORRADE_COMPARE(a[1], 2);
+    CORRADE_COMPARE(*(a.begin() + 1), 2);
+    CORRADE_COMPARE(a.end() - a.begin(), 3);
+    CORRADE_COMPARE(a.cend() - a.cbegin(), 3);
+
+    a.back() = 7;
+    CORRADE_COMPARE(a[2], 7);
+}
+
+void SmallArrayTest::accessInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    SmallArray<4, int> a;
+    a.front();
+    a.back();
+    CORRADE_COMPARE(out.str(),
+        "Containers::SmallArray::front(): array is empty\n"
+        "Containers::SmallArray::back(): array is empty\n");
+}
+
+void SmallArrayTest::slice() {
+    SmallArray<8, int> a{InPlaceInit, {1, 2, 3, 4, 5}};
+    const SmallArray<8, int>& ca = a;
+
+    CORRADE_COMPARE_AS(a.slice(1, 4), arrayView({2, 3, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ca.slice(1, 4), arrayView({2, 3, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.prefix(2), arrayView({1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ca.prefix(2), arrayView({1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.suffix(3), arrayView({4, 5}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ca.suffix(3), arrayView({4, 5}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.except(2), arrayView({1, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ca.except(2), arrayView({1, 2, 3}),
+        TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::appendInline() {
+    SmallArray<4, int> a;
+    const int* data = a.data();
+
+    int& b = arrayAppend(a, 1);
+    CORRADE_COMPARE(&b, a.data());
+    arrayAppend(a, 2);
+    arrayAppend(a, 3);
+    arrayAppend(a, 4);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.data(), data);
+    CORRADE_COMPARE(arrayCapacity(a), 4);
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 2, 3, 4}),
+        TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::appendSpillToHeap() {
+    SmallArray<4, int> a{InPlaceInit, {1, 2, 3, 4}};
+    CORRADE_VERIFY(a.isSmall());
+
+    arrayAppend(a, 5);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.capacity(), 8);
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 2, 3, 4, 5}),
+        TestSuite::Compare::Container);
+
+    for(int i = 6; i <= 20; ++i) arrayAppend(a, i);
+    CORRADE_COMPARE(a.capacity(), 32);
+    CORRADE_COMPARE(a.size(), 20);
+    CORRADE_COMPARE(a[19], 20);
+}
+
+void SmallArrayTest::appendNonTrivial() {
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+    {
+        SmallArray<2, Movable> a;
+        arrayAppend(a, Movable{1});
+        arrayAppend(a, Movable{2});
+        CORRADE_VERIFY(a.isSmall());
+        CORRADE_COMPARE(Movable::moved, 2);
+
+        /* Spilling to heap moves the two existing elements */
+        arrayAppend(a, Movable{3});
+        CORRADE_VERIFY(!a.isSmall());
+        CORRADE_COMPARE(Movable::moved, 5);
+        CORRADE_COMPARE(a[0].a, 1);
+        CORRADE_COMPARE(a[2].a, 3);
+    }
+    CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+void SmallArrayTest::appendInPlace() {
+    SmallArray<2, std::string> a;
+    std::string& b = arrayAppend(a, InPlaceInit, "hello", std::size_t{3});
+    CORRADE_COMPARE(&b, a.data());
+    CORRADE_COMPARE(a[0], "hel");
+}
+
+void SmallArrayTest::appendList() {
+    SmallArray<4, int> a{InPlaceInit, {1, 2}};
+
+    ArrayView<int> b = arrayAppend(a, {3, 4});
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(b.data(), a.data() + 2);
+    CORRADE_COMPARE(b.size(), 2);
+
+    const int values[]{5, 6, 7};
+    arrayAppend(a, arrayView(values));
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 2, 3, 4, 5, 6, 7}),
+        TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::appendNoInit() {
+    SmallArray<4, int> a{InPlaceInit, {1}};
+
+    ArrayView<int> b = arrayAppend(a, NoInit, 10);
+    CORRADE_COMPARE(b.data(), a.data() + 1);
+    CORRADE_COMPARE(b.size(), 10);
+    CORRADE_COMPARE(a.size(), 11);
+    /* Desired size is larger than double the capacity */
+    CORRADE_COMPARE(a.capacity(), 11);
+}
+
+void SmallArrayTest::reserve() {
+    SmallArray<4, int> a{InPlaceInit, {1, 2}};
+
+    /* Fits into the inline storage, nothing done */
+    CORRADE_COMPARE(arrayReserve(a, 3), 4);
+    CORRADE_VERIFY(a.isSmall());
+
+    CORRADE_COMPARE(arrayReserve(a, 17), 17);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.capacity(), 17);
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 2}),
+        TestSuite::Compare::Container);
+}
+
+void SmallArrayTest::resize() {
+    SmallArray<4, int> a{InPlaceInit, {1, 2}};
+
+    arrayResize(a, 4);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 2, 0, 0}),
+        TestSuite::Compare::Container);
+
+    arrayResize(a, DirectInit, 6, 3);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 2, 0, 0, 3, 3}),
+        TestSuite::Compare::Container);
+
+    arrayResize(a, NoInit, 1);
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1}),
+        TestSuite::Compare::Container);
+
+    SmallArray<4, std::string> b;
+    arrayResize(b, DefaultInit, 2);
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b[1], "");
+}
+
+void SmallArrayTest::removeSuffix() {
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+    {
+        SmallArray<4, Movable> a{DirectInit, 3, 1};
+        arrayRemoveSuffix(a);
+        CORRADE_COMPARE(a.size(), 2);
+        CORRADE_COMPARE(Movable::destructed, 1);
+
+        arrayRemoveSuffix(a, 2);
+        CORRADE_COMPARE(a.size(), 0);
+        CORRADE_COMPARE(a.capacity(), 4);
+        CORRADE_COMPARE(Movable::destructed, 3);
+    }
+    CORRADE_COMPARE(Movable::constructed, 3);
+    CORRADE_COMPARE(Movable::destructed, 3);
+}
+
+void SmallArrayTest::removeSuffixInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    SmallArray<4, int> a{InPlaceInit, {1, 2}};
+    arrayRemoveSuffix(a, 3);
+    CORRADE_COMPARE(out.str(),
+        "Containers::arrayRemoveSuffix(): can't remove 3 elements from an array of size 2\n");
+}
+
+void SmallArrayTest::shrink() {
+    SmallArray<4, int> a{InPlaceInit, {1, 2, 3, 4, 5, 6}};
+    arrayReserve(a, 100);
+
+    /* Doesn't fit inline, shrinks to exact size on heap */
+    arrayShrink(a);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.capacity(), 6);
+
+    /* Fits inline, moves back */
+    arrayRemoveSuffix(a, 3);
+    arrayShrink(a);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.capacity(), 4);
+    CORRADE_COMPARE_AS(arrayView(a), arrayView({1, 2, 3}),
+        TestSuite::Compare::Container);
+
+    /* Inline stays inline */
+    arrayShrink(a);
+    CORRADE_VERIFY(a.isSmall());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::SmallArrayTest)
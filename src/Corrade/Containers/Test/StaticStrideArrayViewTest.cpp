@@ -0,0 +1,475 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Corrade/Containers/StaticStrideArrayView.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/Utility/DebugStl.h" /** @todo remove when <sstream> is gone */
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct StaticStrideArrayViewTest: TestSuite::Tester {
+    explicit StaticStrideArrayViewTest();
+
+    void constructEmpty();
+    void constructNullptr();
+    void construct();
+    void constructConstexpr();
+    void constructInvalid();
+    void constructFixedSize();
+    void constructArrayView();
+    void constructStaticArrayView();
+    void constructFromStrided();
+    void constructFromStridedInvalid();
+    void convertConst();
+    void convertToStrided();
+
+    void access();
+    void accessConst();
+    void accessInvalid();
+    void iterate();
+    void asContiguous();
+
+    void slice();
+    void sliceMemberPointer();
+    void sliceInvalid();
+    void every();
+    void everyRuntime();
+    void flipped();
+    void flippedEmpty();
+    void broadcasted();
+    void broadcastedInvalid();
+};
+
+StaticStrideArrayViewTest::StaticStrideArrayViewTest() {
+    addTests({&StaticStrideArrayViewTest::constructEmpty,
+              &StaticStrideArrayViewTest::constructNullptr,
+              &StaticStrideArrayViewTest::construct,
+              &StaticStrideArrayViewTest::constructConstexpr,
+              &StaticStrideArrayViewTest::constructInvalid,
+              &StaticStrideArrayViewTest::constructFixedSize,
+              &StaticStrideArrayViewTest::constructArrayView,
+              &StaticStrideArrayViewTest::constructStaticArrayView,
+              &StaticStrideArrayViewTest::constructFromStrided,
+              &StaticStrideArrayViewTest::constructFromStridedInvalid,
+              &StaticStrideArrayViewTest::convertConst,
+              &StaticStrideArrayViewTest::convertToStrided,
+
+              &StaticStrideArrayViewTest::access,
+              &StaticStrideArrayViewTest::accessConst,
+              &StaticStrideArrayViewTest::accessInvalid,
+              &StaticStrideArrayViewTest::iterate,
+              &StaticStrideArrayViewTest::asContiguous,
+
+              &StaticStrideArrayViewTest::slice,
+              &StaticStrideArrayViewTest::sliceMemberPointer,
+              &StaticStrideArrayViewTest::sliceInvalid,
+              &StaticStrideArrayViewTest::every,
+              &StaticStrideArrayViewTest::everyRuntime,
+              &StaticStrideArrayViewTest::flipped,
+              &StaticStrideArrayViewTest::flippedEmpty,
+              &StaticStrideArrayViewTest::broadcasted,
+              &StaticStrideArrayViewTest::broadcastedInvalid});
+}
+
+struct Vertex {
+    float position;
+    int id;
+};
+
+void StaticStrideArrayViewTest::constructEmpty() {
+    StaticStrideArrayView<8, int> a;
+    CORRADE_VERIFY(!a);
+    CORRADE_VERIFY(a.empty());
+    CORRADE_VERIFY(a.data() == nullptr);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.stride(), 8);
+
+    constexpr StaticStrideArrayView<8, int> ca;
+    CORRADE_VERIFY(ca.data() == nullptr);
+    CORRADE_COMPARE(ca.size(), 0);
+}
+
+void StaticStrideArrayViewTest::constructNullptr() {
+    StaticStrideArrayView<8, int> a = nullptr;
+    CORRADE_VERIFY(!a);
+    CORRADE_VERIFY(a.data() == nullptr);
+    CORRADE_COMPARE(a.size(), 0);
+}
+
+void StaticStrideArrayViewTest::construct() {
+    Vertex data[]{{1.0f, 11}, {2.0f, -22}, {3.0f, 33}};
+
+    StaticStrideArrayView<8, int> a{arrayView(data), &data[0].id, 3};
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(!a.empty());
+    CORRADE_VERIFY(a.data() == &data[0].id);
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.stride(), 8);
+    CORRADE_VERIFY(!a.isContiguous());
+    CORRADE_COMPARE(a[0], 11);
+    CORRADE_COMPARE(a[1], -22);
+    CORRADE_COMPARE(a[2], 33);
+
+    /* The stride is a compile-time constant */
+    constexpr std::ptrdiff_t stride = StaticStrideArrayView<8, int>::stride();
+    CORRADE_COMPARE(stride, 8);
+}
+
+constexpr int Array[]{2, 16, 7853, -3};
+
+void StaticStrideArrayViewTest::constructConstexpr() {
+    constexpr StaticStrideArrayView<8, const int> a{arrayView(Array), Array, 2};
+    constexpr const void* data = a.data();
+    constexpr std::size_t size = a.size();
+    CORRADE_VERIFY(data == Array);
+    CORRADE_COMPARE(size, 2);
+}
+
+void StaticStrideArrayViewTest::constructInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    int data[5]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    StaticStrideArrayView<8, int>{arrayView(data), data, 3};
+    StaticStrideArrayView<-8, int>{arrayView(data), data + 4, 3};
+    CORRADE_COMPARE(out.str(),
+        "Containers::StaticStrideArrayView: data size 20 is not enough for 3 elements of stride 8\n"
+        "Containers::StaticStrideArrayView: data size 20 is not enough for 3 elements of stride -8\n");
+}
+
+void StaticStrideArrayViewTest::constructFixedSize() {
+    int data[]{1, 2, 3};
+
+    StaticStrideArrayView<4, int> a = data;
+    CORRADE_VERIFY(a.data() == data);
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_VERIFY(a.isContiguous());
+
+    /* Not convertible if the stride doesn't match */
+    CORRADE_VERIFY((std::is_convertible<int(&)[3], StaticStrideArrayView<4, int>>::value));
+    CORRADE_VERIFY(!(std::is_convertible<int(&)[3], StaticStrideArrayView<8, int>>::value));
+}
+
+void StaticStrideArrayViewTest::constructArrayView() {
+    int data[]{1, 2, 3};
+    ArrayView<int> view = data;
+
+    StaticStrideArrayView<4, int> a = view;
+    CORRADE_VERIFY(a.data() == data);
+    CORRADE_COMPARE(a.size(), 3);
+
+    CORRADE_VERIFY((std::is_convertible<ArrayView<int>, StaticStrideArrayView<4, int>>::value));
+    CORRADE_VERIFY((std::is_convertible<ArrayView<int>, StaticStrideArrayView<4, const int>>::value));
+    CORRADE_VERIFY(!(std::is_convertible<ArrayView<const int>, StaticStrideArrayView<4, int>>::value));
+    CORRADE_VERIFY(!(std::is_convertible<ArrayView<int>, StaticStrideArrayView<8, int>>::value));
+}
+
+void StaticStrideArrayViewTest::constructStaticArrayView() {
+    int data[]{1, 2, 3};
+    StaticArrayView<3, int> view = data;
+
+    StaticStrideArrayView<4, int> a = view;
+    CORRADE_VERIFY(a.data() == data);
+    CORRADE_COMPARE(a.size(), 3);
+
+    CORRADE_VERIFY(!(std::is_convertible<StaticArrayView<3, int>, StaticStrideArrayView<8, int>>::value));
+}
+
+void StaticStrideArrayViewTest::constructFromStrided() {
+    Vertex data[]{{1.0f, 11}, {2.0f, -22}, {3.0f, 33}};
+    StridedArrayView1D<int> view{data, &data[0].id, 3, 8};
+
+    StaticStrideArrayView<8, int> a{view};
+    CORRADE_VERIFY(a.data() == &data[0].id);
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a[2], 33);
+
+    /* Only an explicit conversion as it needs to check the stride */
+    CORRADE_VERIFY((std::is_constructible<StaticStrideArrayView<8, int>, StridedArrayView1D<int>>::value));
+    CORRADE_VERIFY(!(std::is_convertible<StridedArrayView1D<int>, StaticStrideArrayView<8, int>>::value));
+}
+
+void StaticStrideArrayViewTest::constructFromStridedInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    int data[6]{};
+    StridedArrayView1D<int> view{data, 3, 8};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    StaticStrideArrayView<4, int>{view};
+    StaticStrideArrayView<-8, int>{view};
+    CORRADE_COMPARE(out.str(),
+        "Containers::StaticStrideArrayView: expected stride 4 but got 8\n"
+        "Containers::StaticStrideArrayView: expected stride -8 but got 8\n");
+}
+
+void StaticStrideArrayViewTest::convertConst() {
+    int data[]{1, 2, 3};
+    StaticStrideArrayView<4, int> a = data;
+
+    StaticStrideArrayView<4, const int> b = a;
+    CORRADE_VERIFY(b.data() == data);
+    CORRADE_COMPARE(b.size(), 3);
+
+    CORRADE_VERIFY((std::is_convertible<StaticStrideArrayView<4, int>, StaticStrideArrayView<4, const int>>::value));
+    CORRADE_VERIFY(!(std::is_convertible<StaticStrideArrayView<4, const int>, StaticStrideArrayView<4, int>>::value));
+}
+
+void StaticStrideArrayViewTest::convertToStrided() {
+    Vertex data[]{{1.0f, 11}, {2.0f, -22}, {3.0f, 33}};
+    StaticStrideArrayView<8, int> a{arrayView(data), &data[0].id, 3};
+
+    StridedArrayView1D<int> b = a;
+    CORRADE_VERIFY(b.data() == &data[0].id);
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b.stride(), 8);
+    CORRADE_COMPARE(b[1], -22);
+
+    StridedArrayView1D<const int> c = a;
+    CORRADE_VERIFY(c.data() == &data[0].id);
+    CORRADE_COMPARE(c.stride(), 8);
+
+    CORRADE_VERIFY((std::is_convertible<StaticStrideArrayView<8, int>, StridedArrayView1D<const int>>::value));
+    CORRADE_VERIFY(!(std::is_convertible<StaticStrideArrayView<8, const int>, StridedArrayView1D<int>>::value));
+}
+
+void StaticStrideArrayViewTest::access() {
+    Vertex data[]{{1.0f, 11}, {2.0f, -22}, {3.0f, 33}};
+    StaticStrideArrayView<8, int> a{arrayView(data), &data[0].id, 3};
+
+    CORRADE_COMPARE(a.front(), 11);
+    CORRADE_COMPARE(a.back(), 33);
+
+    a[1] = 777;
+    CORRADE_COMPARE(data[1].id, 777);
+    CORRADE_COMPARE(data[1].position, 2.0f);
+}
+
+void StaticStrideArrayViewTest::accessConst() {
+    const Vertex data[]{{1.0f, 11}, {2.0f, -22}, {3.0f, 33}};
+    StaticStrideArrayView<8, const int> a{arrayView(data), &data[0].id, 3};
+
+    CORRADE_COMPARE(a.front(), 11);
+    CORRADE_COMPARE(a[1], -22);
+    CORRADE_COMPARE(a.back(), 33);
+}
+
+void StaticStrideArrayViewTest::accessInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    int data[3]{};
+    StaticStrideArrayView<4, int> a = data;
+    StaticStrideArrayView<4, int> b;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a[3];
+    b.front();
+    b.back();
+    CORRADE_COMPARE(out.str(),
+        "Containers::StaticStrideArrayView::operator[](): index 3 out of range for 3 elements\n"
+        "Containers::StaticStrideArrayView::front(): view is empty\n"
+        "Containers::StaticStrideArrayView::back(): view is empty\n");
+}
+
+void StaticStrideArrayViewTest::iterate() {
+    Vertex data[]{{1.0f, 11}, {2.0f, -22}, {3.0f, 33}};
+    StaticStrideArrayView<8, int> a{arrayView(data), &data[0].id, 3};
+
+    int sum = 0;
+    for(int& i: a) sum += i;
+    CORRADE_COMPARE(sum, 22);
+    CORRADE_COMPARE(a.end() - a.begin(), 3);
+    CORRADE_COMPARE(*a.cbegin(), 11);
+    CORRADE_COMPARE(*(a.cend() - 1), 33);
+}
+
+void StaticStrideArrayViewTest::asContiguous() {
+    int data[]{1, 2, 3};
+    StaticStrideArrayView<4, int> a = data;
+    CORRADE_VERIFY(a.isContiguous());
+
+    ArrayView<int> b = a.asContiguous();
+    CORRADE_VERIFY(b.data() == data);
+    CORRADE_COMPARE(b.size(), 3);
+
+    /* Stride known at compile time, so is the contiguity */
+    constexpr bool contiguous = StaticStrideArrayView<8, int>::isContiguous();
+    CORRADE_VERIFY(!contiguous);
+}
+
+void StaticStrideArrayViewTest::slice() {
+    int data[]{1, 2, 3, 4, 5};
+    StaticStrideArrayView<4, int> a = data;
+
+    StaticStrideArrayView<4, int> b = a.slice(1, 4);
+    CORRADE_VERIFY(b.data() == data + 1);
+    CORRADE_COMPARE(b.size(), 3);
+
+    StaticStrideArrayView<4, int> c = a.prefix(3);
+    CORRADE_VERIFY(c.data() == data);
+    CORRADE_COMPARE(c.size(), 3);
+
+    StaticStrideArrayView<4, int> d = a.suffix(2);
+    CORRADE_VERIFY(d.data() == data + 2);
+    CORRADE_COMPARE(d.size(), 3);
+
+    StaticStrideArrayView<4, int> e = a.except(2);
+    CORRADE_VERIFY(e.data() == data);
+    CORRADE_COMPARE(e.size(), 3);
+}
+
+void StaticStrideArrayViewTest::sliceMemberPointer() {
+    Vertex data[]{{1.0f, 11}, {2.0f, -22}, {3.0f, 33}};
+    StaticStrideArrayView<8, Vertex> a = data;
+
+    StaticStrideArrayView<8, float> position = a.slice(&Vertex::position);
+    CORRADE_VERIFY(position.data() == &data[0].position);
+    CORRADE_COMPARE(position.size(), 3);
+    CORRADE_COMPARE(position[2], 3.0f);
+
+    StaticStrideArrayView<8, int> id = a.slice(&Vertex::id);
+    CORRADE_VERIFY(id.data() == &data[0].id);
+    CORRADE_COMPARE(id.size(), 3);
+    CORRADE_COMPARE(id[1], -22);
+
+    /* Constness is preserved */
+    StaticStrideArrayView<8, const Vertex> ca = a;
+    StaticStrideArrayView<8, const int> cid = ca.slice(&Vertex::id);
+    CORRADE_VERIFY(cid.data() == &data[0].id);
+    CORRADE_COMPARE(cid[2], 33);
+}
+
+void StaticStrideArrayViewTest::sliceInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    int data[5]{};
+    StaticStrideArrayView<4, int> a = data;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.slice(5, 6);
+    a.slice(2, 1);
+    CORRADE_COMPARE(out.str(),
+        "Containers::StaticStrideArrayView::slice(): slice [5:6] out of range for 5 elements\n"
+        "Containers::StaticStrideArrayView::slice(): slice [2:1] out of range for 5 elements\n");
+}
+
+void StaticStrideArrayViewTest::every() {
+    int data[]{1, 2, 3, 4, 5, 6};
+    StaticStrideArrayView<4, int> a = data;
+
+    /* Taking every 4th element of a 6-element array should result in 2
+       elements */
+    StaticStrideArrayView<16, int> b = a.every<4>();
+    CORRADE_VERIFY(b.data() == data);
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b[0], 1);
+    CORRADE_COMPARE(b[1], 5);
+
+    StaticStrideArrayView<8, int> c = a.every<2>();
+    CORRADE_COMPARE(c.size(), 3);
+    CORRADE_COMPARE(c[2], 5);
+}
+
+void StaticStrideArrayViewTest::everyRuntime() {
+    int data[]{1, 2, 3, 4, 5, 6};
+    StaticStrideArrayView<4, int> a = data;
+
+    StridedArrayView1D<int> b = a.every(-2);
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b.stride(), -8);
+    CORRADE_COMPARE_AS(b, stridedArrayView({6, 4, 2}),
+        TestSuite::Compare::Container);
+}
+
+void StaticStrideArrayViewTest::flipped() {
+    int data[]{1, 2, 3, 4, 5};
+    StaticStrideArrayView<4, int> a = data;
+
+    StaticStrideArrayView<-4, int> b = a.flipped();
+    CORRADE_VERIFY(b.data() == data + 4);
+    CORRADE_COMPARE(b.size(), 5);
+    CORRADE_COMPARE(b[0], 5);
+    CORRADE_COMPARE(b[4], 1);
+
+    /* Flipping back goes to the original */
+    StaticStrideArrayView<4, int> c = b.flipped();
+    CORRADE_VERIFY(c.data() == data);
+    CORRADE_COMPARE(c.size(), 5);
+}
+
+void StaticStrideArrayViewTest::flippedEmpty() {
+    int data[5]{};
+    StaticStrideArrayView<4, int> a = arrayView(data).prefix(std::size_t{});
+
+    StaticStrideArrayView<-4, int> b = a.flipped();
+    CORRADE_VERIFY(b.data() == data);
+    CORRADE_COMPARE(b.size(), 0);
+}
+
+void StaticStrideArrayViewTest::broadcasted() {
+    int data[]{1, 2, 3};
+    StaticStrideArrayView<4, int> a = data;
+
+    StaticStrideArrayView<0, int> b = a.suffix(2).broadcasted(4);
+    CORRADE_VERIFY(b.data() == data + 2);
+    CORRADE_COMPARE(b.size(), 4);
+    CORRADE_COMPARE_AS(StridedArrayView1D<int>{b}, stridedArrayView({3, 3, 3, 3}),
+        TestSuite::Compare::Container);
+}
+
+void StaticStrideArrayViewTest::broadcastedInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    int data[3]{};
+    StaticStrideArrayView<4, int> a = data;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.broadcasted(4);
+    CORRADE_COMPARE(out.str(),
+        "Containers::StaticStrideArrayView::broadcasted(): can't broadcast a view with 3 elements\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::StaticStrideArrayViewTest)
@@ -29,6 +29,7 @@
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/TestSuite/Compare/Container.h"
 #include "Corrade/Utility/DebugStl.h" /** @todo remove when <sstream> is gone */
+#include "Corrade/Utility/Macros.h"
 
 namespace {
 
@@ -191,6 +192,8 @@ struct StridedArrayViewTest: TestSuite::Tester {
     void accessZeroStride();
     void accessNegativeStride();
     void accessInvalid();
+    void accessAligned();
+    void accessAlignedInvalid();
 
     void access3D();
     void access3DConst();
@@ -392,6 +395,8 @@ StridedArrayViewTest::StridedArrayViewTest() {
               &StridedArrayViewTest::accessZeroStride,
               &StridedArrayViewTest::accessNegativeStride,
               &StridedArrayViewTest::accessInvalid,
+              &StridedArrayViewTest::accessAligned,
+              &StridedArrayViewTest::accessAlignedInvalid,
 
               &StridedArrayViewTest::access3D,
               &StridedArrayViewTest::access3DConst,
@@ -2224,6 +2229,37 @@ void StridedArrayViewTest::accessInvalid() {
         "Containers::StridedArrayView::operator[](): index 5 out of range for 5 elements\n");
 }
 
+void StridedArrayViewTest::accessAligned() {
+    CORRADE_ALIGNAS(64) int a[4*16]{};
+
+    /* Every row starts at a 64-byte boundary */
+    StridedArrayView2Di b{a, {4, 3}, {64, 4}};
+    CORRADE_VERIFY(b.alignedData<64>() == a);
+    CORRADE_VERIFY(b[2].alignedData<64>() == a + 32);
+    CORRADE_VERIFY((b.transposed<0, 1>().alignedData<64>() == a));
+
+    ConstStridedArrayView1Di c = b[1];
+    const void* data = c.alignedData<64>();
+    CORRADE_VERIFY(data == a + 16);
+}
+
+void StridedArrayViewTest::accessAlignedInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    CORRADE_ALIGNAS(64) int a[4*16]{};
+    StridedArrayView2Di b{a, {4, 3}, {64, 4}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    b.slice({0, 1}, {4, 3}).alignedData<64>();
+
+    std::ostringstream expected;
+    Debug{&expected} << "Containers::StridedArrayView::alignedData(): expected data to be aligned to 64 bytes but got" << reinterpret_cast<const void*>(a + 1);
+    CORRADE_COMPARE(out.str(), expected.str());
+}
+
 void StridedArrayViewTest::access3D() {
     Plane a[2]{
         {{{{{2, 23125}, {16, 1}, {7853268, -2}}},
@@ -0,0 +1,292 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Corrade/Containers/StridedBitArrayView.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/DebugStl.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct StridedBitArrayViewTest: TestSuite::Tester {
+    explicit StridedBitArrayViewTest();
+
+    void constructDefault();
+    void construct();
+    void constructInvalidOffset();
+    void constructFromView();
+    void constructMutableToConst();
+
+    void access();
+    void set();
+
+    void count();
+
+    void slice();
+    void sliceInvalid();
+    void every();
+    void everyInvalid();
+    void flipped();
+    void flippedEmpty();
+    void negativeStride();
+};
+
+StridedBitArrayViewTest::StridedBitArrayViewTest() {
+    addTests({&StridedBitArrayViewTest::constructDefault,
+              &StridedBitArrayViewTest::construct,
+              &StridedBitArrayViewTest::constructInvalidOffset,
+              &StridedBitArrayViewTest::constructFromView,
+              &StridedBitArrayViewTest::constructMutableToConst,
+
+              &StridedBitArrayViewTest::access,
+              &StridedBitArrayViewTest::set,
+
+              &StridedBitArrayViewTest::count,
+
+              &StridedBitArrayViewTest::slice,
+              &StridedBitArrayViewTest::sliceInvalid,
+              &StridedBitArrayViewTest::every,
+              &StridedBitArrayViewTest::everyInvalid,
+              &StridedBitArrayViewTest::flipped,
+              &StridedBitArrayViewTest::flippedEmpty,
+              &StridedBitArrayViewTest::negativeStride});
+}
+
+void StridedBitArrayViewTest::constructDefault() {
+    StridedBitArrayView a;
+    CORRADE_VERIFY(!a.data());
+    CORRADE_COMPARE(a.offset(), 0);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.stride(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+}
+
+void StridedBitArrayViewTest::construct() {
+    const char data[4]{};
+    StridedBitArrayView a{data, 5, 9, 3};
+    CORRADE_COMPARE(a.data(), &data[0]);
+    CORRADE_COMPARE(a.offset(), 5);
+    CORRADE_COMPARE(a.size(), 9);
+    CORRADE_COMPARE(a.stride(), 3);
+    CORRADE_VERIFY(!a.isEmpty());
+}
+
+void StridedBitArrayViewTest::constructInvalidOffset() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const char data[1]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    StridedBitArrayView{data, 8, 0, 1};
+    CORRADE_COMPARE(out.str(), "Containers::StridedBitArrayView: offset expected to be smaller than 8 bits, got 8\n");
+}
+
+void StridedBitArrayViewTest::constructFromView() {
+    char data[4]{};
+    MutableBitArrayView view{data, 3, 20};
+
+    StridedBitArrayView a = view;
+    CORRADE_COMPARE(a.data(), &data[0]);
+    CORRADE_COMPARE(a.offset(), 3);
+    CORRADE_COMPARE(a.size(), 20);
+    CORRADE_COMPARE(a.stride(), 1);
+
+    MutableStridedBitArrayView b = view;
+    CORRADE_COMPARE(b.data(), &data[0]);
+    CORRADE_COMPARE(b.stride(), 1);
+
+    CORRADE_VERIFY(!(std::is_convertible<BitArrayView, MutableStridedBitArrayView>::value));
+}
+
+void StridedBitArrayViewTest::constructMutableToConst() {
+    char data[4]{};
+    MutableStridedBitArrayView a{data, 3, 5, 4};
+    StridedBitArrayView b = a;
+    CORRADE_COMPARE(b.data(), &data[0]);
+    CORRADE_COMPARE(b.offset(), 3);
+    CORRADE_COMPARE(b.size(), 5);
+    CORRADE_COMPARE(b.stride(), 4);
+
+    CORRADE_VERIFY(!(std::is_convertible<StridedBitArrayView, MutableStridedBitArrayView>::value));
+}
+
+void StridedBitArrayViewTest::access() {
+    /* Every third bit starting at bit 1: bits 1, 4, 7, 10, 13 */
+    const char data[]{'\x82', '\x20'};
+    StridedBitArrayView a{data, 1, 5, 3};
+    CORRADE_VERIFY(a[0]);
+    CORRADE_VERIFY(!a[1]);
+    CORRADE_VERIFY(a[2]);
+    CORRADE_VERIFY(!a[3]);
+    CORRADE_VERIFY(a[4]);
+}
+
+void StridedBitArrayViewTest::set() {
+    char data[2]{};
+    MutableStridedBitArrayView a{data, 1, 5, 3};
+    a.set(0);
+    a.set(2);
+    a.set(4, true);
+    CORRADE_COMPARE(data[0], '\x82');
+    CORRADE_COMPARE(data[1], '\x20');
+
+    a.reset(2);
+    a.set(4, false);
+    CORRADE_COMPARE(data[0], '\x02');
+    CORRADE_COMPARE(data[1], '\x00');
+}
+
+void StridedBitArrayViewTest::count() {
+    const char data[]{'\xff', '\x0f'};
+    CORRADE_COMPARE((StridedBitArrayView{data, 0, 8, 2}.count()), 6);
+    CORRADE_COMPARE((StridedBitArrayView{data, 1, 5, 3}.count()), 4);
+}
+
+void StridedBitArrayViewTest::slice() {
+    const char data[4]{};
+    StridedBitArrayView a{data, 1, 10, 3};
+
+    StridedBitArrayView b = a.slice(3, 7);
+    CORRADE_COMPARE(b.data(), &data[1]);
+    CORRADE_COMPARE(b.offset(), 2);
+    CORRADE_COMPARE(b.size(), 4);
+    CORRADE_COMPARE(b.stride(), 3);
+
+    StridedBitArrayView prefix = a.prefix(4);
+    CORRADE_COMPARE(prefix.data(), &data[0]);
+    CORRADE_COMPARE(prefix.offset(), 1);
+    CORRADE_COMPARE(prefix.size(), 4);
+
+    StridedBitArrayView suffix = a.suffix(6);
+    CORRADE_COMPARE(suffix.data(), &data[2]);
+    CORRADE_COMPARE(suffix.offset(), 3);
+    CORRADE_COMPARE(suffix.size(), 4);
+}
+
+void StridedBitArrayViewTest::sliceInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const char data[4]{};
+    StridedBitArrayView a{data, 1, 10, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.slice(5, 11);
+    CORRADE_COMPARE(out.str(), "Containers::StridedBitArrayView::slice(): slice [5:11] out of range for 10 bits\n");
+}
+
+void StridedBitArrayViewTest::every() {
+    const char data[]{'\x55', '\x55'};
+    BitArrayView view{data, 0, 16};
+
+    StridedBitArrayView a = StridedBitArrayView{view}.every(2);
+    CORRADE_COMPARE(a.size(), 8);
+    CORRADE_COMPARE(a.stride(), 2);
+    CORRADE_COMPARE(a.count(), 8);
+
+    StridedBitArrayView b = StridedBitArrayView{view}.suffix(1).every(2);
+    CORRADE_COMPARE(b.size(), 8);
+    CORRADE_COMPARE(b.count(), 0);
+
+    /* Size gets rounded up */
+    StridedBitArrayView c = StridedBitArrayView{view}.prefix(15).every(7);
+    CORRADE_COMPARE(c.size(), 3);
+    CORRADE_COMPARE(c.stride(), 7);
+    CORRADE_VERIFY(c[0]);
+    CORRADE_VERIFY(!c[1]);
+    CORRADE_VERIFY(c[2]);
+}
+
+void StridedBitArrayViewTest::everyInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    StridedBitArrayView a;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.every(0);
+    CORRADE_COMPARE(out.str(), "Containers::StridedBitArrayView::every(): expected a non-zero step\n");
+}
+
+void StridedBitArrayViewTest::flipped() {
+    /* Bits 0, 1, 9 and 13 set */
+    const char data[]{'\x03', '\x22'};
+    StridedBitArrayView a{data, 0, 14, 1};
+
+    StridedBitArrayView b = a.flipped();
+    CORRADE_COMPARE(b.data(), &data[1]);
+    CORRADE_COMPARE(b.offset(), 5);
+    CORRADE_COMPARE(b.size(), 14);
+    CORRADE_COMPARE(b.stride(), -1);
+    for(std::size_t i = 0; i != 14; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(b[i], a[13 - i]);
+    }
+
+    /* Flipping twice gives back the original */
+    StridedBitArrayView c = b.flipped();
+    CORRADE_COMPARE(c.data(), &data[0]);
+    CORRADE_COMPARE(c.offset(), 0);
+    CORRADE_COMPARE(c.stride(), 1);
+}
+
+void StridedBitArrayViewTest::flippedEmpty() {
+    const char data[1]{};
+    StridedBitArrayView a{data, 3, 0, 2};
+    StridedBitArrayView b = a.flipped();
+    CORRADE_COMPARE(b.data(), &data[0]);
+    CORRADE_COMPARE(b.offset(), 3);
+    CORRADE_COMPARE(b.size(), 0);
+}
+
+void StridedBitArrayViewTest::negativeStride() {
+    /* Every other bit backwards from bit 14, crossing byte boundaries down
+       to bit 0 */
+    char data[2]{};
+    MutableStridedBitArrayView a{data + 1, 6, 8, -2};
+    for(std::size_t i = 0; i != 8; i += 2) a.set(i);
+    CORRADE_COMPARE(data[0], '\x44');
+    CORRADE_COMPARE(data[1], '\x44');
+    CORRADE_COMPARE(a.count(), 4);
+
+    /* Fourth item is bit 8 */
+    StridedBitArrayView b = a.slice(3, 6);
+    CORRADE_COMPARE(b.data(), &data[1]);
+    CORRADE_COMPARE(b.offset(), 0);
+    CORRADE_VERIFY(!b[0]);
+    CORRADE_VERIFY(b[1]);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::StridedBitArrayViewTest)
@@ -0,0 +1,198 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringBuilder.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct StringBuilderTest: TestSuite::Tester {
+    explicit StringBuilderTest();
+
+    void constructDefault();
+    void constructCapacity();
+    void copy();
+    void move();
+
+    void append();
+    void appendEmpty();
+    void appendGrow();
+    void clear();
+
+    void release();
+    void releaseSmall();
+    void releaseEmpty();
+};
+
+StringBuilderTest::StringBuilderTest() {
+    addTests({&StringBuilderTest::constructDefault,
+              &StringBuilderTest::constructCapacity,
+              &StringBuilderTest::copy,
+              &StringBuilderTest::move,
+
+              &StringBuilderTest::append,
+              &StringBuilderTest::appendEmpty,
+              &StringBuilderTest::appendGrow,
+              &StringBuilderTest::clear,
+
+              &StringBuilderTest::release,
+              &StringBuilderTest::releaseSmall,
+              &StringBuilderTest::releaseEmpty});
+}
+
+using namespace Literals;
+
+void StringBuilderTest::constructDefault() {
+    StringBuilder a;
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 0);
+    CORRADE_COMPARE(a.view(), "");
+}
+
+void StringBuilderTest::constructCapacity() {
+    StringBuilder a{100};
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(a.capacity(), 100);
+}
+
+void StringBuilderTest::copy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<StringBuilder>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<StringBuilder>{});
+}
+
+void StringBuilderTest::move() {
+    StringBuilder a;
+    a.append("hello");
+
+    StringBuilder b = std::move(a);
+    CORRADE_COMPARE(b.view(), "hello");
+
+    StringBuilder c;
+    c = std::move(b);
+    CORRADE_COMPARE(c.view(), "hello");
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<StringBuilder>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<StringBuilder>::value);
+}
+
+void StringBuilderTest::append() {
+    StringBuilder a;
+    a.append("hello"_s)
+     .append(',')
+     .append(' ')
+     .append(String{"world"});
+    CORRADE_VERIFY(!a.isEmpty());
+    CORRADE_COMPARE(a.size(), 12);
+    CORRADE_COMPARE(a.view(), "hello, world");
+}
+
+void StringBuilderTest::appendEmpty() {
+    StringBuilder a;
+    a.append(nullptr)
+     .append(""_s);
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(a.view(), "");
+}
+
+void StringBuilderTest::appendGrow() {
+    StringBuilder a;
+    std::size_t reallocations = 0;
+    const char* data = nullptr;
+    for(std::size_t i = 0; i != 10000; ++i) {
+        a.append("abc");
+        if(a.view().data() != data) {
+            data = a.view().data();
+            ++reallocations;
+        }
+    }
+    CORRADE_COMPARE(a.size(), 30000);
+    CORRADE_COMPARE(a.view().suffix(27000).prefix(3), "abc");
+
+    /* The growth is geometric, so there's just a handful of reallocations
+       for 10k appends. In practice it's even less if realloc() is able to
+       grow in-place. */
+    CORRADE_COMPARE_AS(reallocations, 30, TestSuite::Compare::Less);
+}
+
+void StringBuilderTest::clear() {
+    StringBuilder a;
+    a.append("hello world, this is a long string");
+    const std::size_t capacity = a.capacity();
+
+    a.clear();
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(a.capacity(), capacity);
+
+    a.append("hi");
+    CORRADE_COMPARE(a.view(), "hi");
+}
+
+void StringBuilderTest::release() {
+    StringBuilder a;
+    a.append("hello world, this is a long string");
+    const char* data = a.view().data();
+
+    /* The memory is transferred without a copy */
+    String b = a.release();
+    CORRADE_VERIFY(!b.isSmall());
+    CORRADE_COMPARE(b, "hello world, this is a long string");
+    CORRADE_VERIFY(b.data() == data);
+    CORRADE_COMPARE(b.data()[b.size()], '\0');
+
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(a.capacity(), 0);
+
+    /* Can be used again */
+    a.append("another long string that doesn't fit into SSO");
+    CORRADE_COMPARE(a.release(), "another long string that doesn't fit into SSO");
+}
+
+void StringBuilderTest::releaseSmall() {
+    StringBuilder a;
+    a.append("hello");
+    const std::size_t capacity = a.capacity();
+
+    String b = a.release();
+    CORRADE_VERIFY(b.isSmall());
+    CORRADE_COMPARE(b, "hello");
+
+    /* The memory is kept for reuse */
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(a.capacity(), capacity);
+}
+
+void StringBuilderTest::releaseEmpty() {
+    StringBuilder a;
+    String b = a.release();
+    CORRADE_VERIFY(b.isSmall());
+    CORRADE_COMPARE(b, "");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::StringBuilderTest)
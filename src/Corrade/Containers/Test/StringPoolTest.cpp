@@ -0,0 +1,204 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringPool.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/DebugStl.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct StringPoolTest: TestSuite::Tester {
+    explicit StringPoolTest();
+
+    void construct();
+    void constructCopy();
+    void constructMove();
+
+    void intern();
+    void internEmpty();
+    void internNewChunk();
+    void internLargerThanChunk();
+    void find();
+
+    void nullTerminatedGlobalView();
+};
+
+StringPoolTest::StringPoolTest() {
+    addTests({&StringPoolTest::construct,
+              &StringPoolTest::constructCopy,
+              &StringPoolTest::constructMove,
+
+              &StringPoolTest::intern,
+              &StringPoolTest::internEmpty,
+              &StringPoolTest::internNewChunk,
+              &StringPoolTest::internLargerThanChunk,
+              &StringPoolTest::find,
+
+              &StringPoolTest::nullTerminatedGlobalView});
+}
+
+using namespace Literals;
+
+void StringPoolTest::construct() {
+    StringPool a{128};
+    CORRADE_COMPARE(a.chunkSize(), 128);
+    CORRADE_COMPARE(a.count(), 0);
+
+    StringPool b;
+    CORRADE_COMPARE(b.chunkSize(), 4096);
+}
+
+void StringPoolTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<StringPool>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<StringPool>{});
+}
+
+void StringPoolTest::constructMove() {
+    StringPool a{128};
+    StringView hello = a.intern("hello");
+
+    /* The data stay where they were */
+    StringPool b = std::move(a);
+    CORRADE_COMPARE(b.count(), 1);
+    CORRADE_COMPARE(b.intern("hello").data(), hello.data());
+
+    StringPool c{64};
+    c = std::move(b);
+    CORRADE_COMPARE(c.chunkSize(), 128);
+    CORRADE_COMPARE(c.intern("hello").data(), hello.data());
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<StringPool>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<StringPool>::value);
+}
+
+void StringPoolTest::intern() {
+    StringPool a;
+
+    /* Passing a non-null-terminated view that's not global */
+    const char data[]{'h', 'e', 'l', 'l', 'o', '!'};
+    StringView hello = a.intern({data, 5});
+    CORRADE_COMPARE(hello, "hello");
+    CORRADE_VERIFY(hello.data() != data);
+    CORRADE_COMPARE(hello.flags(), StringViewFlag::Global|StringViewFlag::NullTerminated);
+    CORRADE_COMPARE(hello[hello.size()], '\0');
+
+    StringView world = a.intern("world"_s);
+    CORRADE_COMPARE(world, "world");
+    CORRADE_COMPARE(a.count(), 2);
+
+    /* Equal strings are deduplicated, so equality is a pointer compare */
+    String copy = "hello";
+    StringView hello2 = a.intern(copy);
+    CORRADE_COMPARE(a.count(), 2);
+    CORRADE_VERIFY(hello2.data() == hello.data());
+    CORRADE_COMPARE(hello2.size(), 5);
+    CORRADE_VERIFY(world.data() != hello.data());
+
+    /* A prefix is a different string */
+    StringView hell = a.intern("hell");
+    CORRADE_COMPARE(a.count(), 3);
+    CORRADE_VERIFY(hell.data() != hello.data());
+    CORRADE_COMPARE(hell, "hell");
+    CORRADE_COMPARE(hell[hell.size()], '\0');
+}
+
+void StringPoolTest::internEmpty() {
+    StringPool a;
+    StringView empty = a.intern(nullptr);
+    CORRADE_VERIFY(empty.data());
+    CORRADE_COMPARE(empty.size(), 0);
+    CORRADE_COMPARE(empty.flags(), StringViewFlag::Global|StringViewFlag::NullTerminated);
+    CORRADE_COMPARE(empty.data()[0], '\0');
+
+    /* An empty non-null view gives back the same */
+    CORRADE_VERIFY(a.intern("").data() == empty.data());
+    CORRADE_COMPARE(a.count(), 1);
+}
+
+void StringPoolTest::internNewChunk() {
+    StringPool a{16};
+
+    /* 12 bytes including the null terminator */
+    StringView first = a.intern("hello world");
+    /* Still fits, 16 bytes in total */
+    StringView second = a.intern("abc");
+    CORRADE_COMPARE(second.data(), first.data() + 12);
+    /* Doesn't fit anymore, goes to a new chunk */
+    StringView third = a.intern("def");
+    CORRADE_VERIFY(third.data() != second.data() + 4);
+
+    /* All stay valid */
+    CORRADE_COMPARE(first, "hello world");
+    CORRADE_COMPARE(second, "abc");
+    CORRADE_COMPARE(third, "def");
+    CORRADE_COMPARE(a.count(), 3);
+}
+
+void StringPoolTest::internLargerThanChunk() {
+    StringPool a{16};
+
+    StringView first = a.intern("abc");
+
+    /* Gets a dedicated allocation */
+    StringView large = a.intern("this is a string longer than a chunk");
+    CORRADE_COMPARE(large, "this is a string longer than a chunk");
+    CORRADE_COMPARE(large.flags(), StringViewFlag::Global|StringViewFlag::NullTerminated);
+
+    /* The original chunk continues to be used */
+    StringView second = a.intern("def");
+    CORRADE_COMPARE(second.data(), first.data() + 4);
+
+    CORRADE_COMPARE(a.count(), 3);
+}
+
+void StringPoolTest::find() {
+    StringPool a;
+    StringView hello = a.intern("hello");
+
+    StringView found = a.find("hello world"_s.prefix(5));
+    CORRADE_VERIFY(found.data() == hello.data());
+    CORRADE_COMPARE(found.flags(), StringViewFlag::Global|StringViewFlag::NullTerminated);
+
+    /* Not found returns a null view and doesn't add anything */
+    StringView notFound = a.find("world");
+    CORRADE_VERIFY(!notFound.data());
+    CORRADE_COMPARE(a.count(), 1);
+}
+
+void StringPoolTest::nullTerminatedGlobalView() {
+    StringPool a;
+    StringView hello = a.intern(String{"hello"});
+
+    /* The string doesn't make a copy */
+    String string = String::nullTerminatedGlobalView(hello);
+    CORRADE_VERIFY(string.data() == hello.data());
+    CORRADE_VERIFY(!string.isSmall());
+    CORRADE_VERIFY(string.deleter());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::StringPoolTest)
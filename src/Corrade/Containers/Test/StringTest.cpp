@@ -86,6 +86,8 @@ struct StringTest: TestSuite::Tester {
     void constructPointerSizeNullZero();
     void constructPointerSizeNullNonZero();
     void constructPointerSizeTooLarge();
+    void constructNoInit();
+    void constructNoInitSmall();
 
     void constructNullTerminatedGlobalView();
 
@@ -130,6 +132,12 @@ struct StringTest: TestSuite::Tester {
 
     void partition();
 
+    void join();
+    void joinEmpty();
+    void joinSmall();
+    void joinWithoutEmptyParts();
+    void concat();
+
     void hasPrefix();
     void hasSuffix();
 
@@ -161,6 +169,8 @@ StringTest::StringTest() {
               &StringTest::constructPointerSizeNullZero,
               &StringTest::constructPointerSizeNullNonZero,
               &StringTest::constructPointerSizeTooLarge,
+              &StringTest::constructNoInit,
+              &StringTest::constructNoInitSmall,
 
               &StringTest::constructNullTerminatedGlobalView,
 
@@ -205,6 +215,12 @@ StringTest::StringTest() {
 
               &StringTest::partition,
 
+              &StringTest::join,
+              &StringTest::joinEmpty,
+              &StringTest::joinSmall,
+              &StringTest::joinWithoutEmptyParts,
+              &StringTest::concat,
+
               &StringTest::hasPrefix,
               &StringTest::hasSuffix,
 
@@ -414,13 +430,36 @@ void StringTest::constructPointerSizeTooLarge() {
     Error redirectError{&out};
     String a{"abc", ~std::size_t{}};
     String aa{AllocatedInit, "abc", ~std::size_t{}};
+    String aaa{NoInit, ~std::size_t{}};
     CORRADE_COMPARE(out.str(), sizeof(std::size_t) == 4 ?
+        "Containers::String: string expected to be smaller than 2^30 bytes, got 4294967295\n"
         "Containers::String: string expected to be smaller than 2^30 bytes, got 4294967295\n"
         "Containers::String: string expected to be smaller than 2^30 bytes, got 4294967295\n" :
         "Containers::String: string expected to be smaller than 2^62 bytes, got 18446744073709551615\n"
+        "Containers::String: string expected to be smaller than 2^62 bytes, got 18446744073709551615\n"
         "Containers::String: string expected to be smaller than 2^62 bytes, got 18446744073709551615\n");
 }
 
+void StringTest::constructNoInit() {
+    String a{NoInit, 35};
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.size(), 35);
+    CORRADE_COMPARE(a.data()[a.size()], '\0');
+    CORRADE_VERIFY(!a.deleter());
+}
+
+void StringTest::constructNoInitSmall() {
+    String a{NoInit, 5};
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(a.data()[a.size()], '\0');
+
+    String b{NoInit, 0};
+    CORRADE_VERIFY(b.isSmall());
+    CORRADE_COMPARE(b.size(), 0);
+    CORRADE_COMPARE(b.data()[0], '\0');
+}
+
 void StringTest::constructNullTerminatedGlobalView() {
     using namespace Literals;
 
@@ -1262,6 +1301,65 @@ void StringTest::partition() {
     }
 }
 
+void StringTest::join() {
+    using namespace Literals;
+
+    const StringView strings[]{"hello"_s, "wonderful"_s, ""_s, "world"_s};
+    String a = String::join(strings, ", ");
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a, "hello, wonderful, , world");
+    CORRADE_COMPARE(a.data()[a.size()], '\0');
+
+    /* Initializer list, mixing different types convertible to a view */
+    String s = "wonderful";
+    CORRADE_COMPARE(String::join({"hello", s, "world"_s}, "--"_s),
+        "hello--wonderful--world");
+
+    /* Empty delimiter */
+    CORRADE_COMPARE(String::join({"hello", "world"}, {}), "helloworld");
+}
+
+void StringTest::joinEmpty() {
+    CORRADE_COMPARE(String::join(nullptr, ", "), "");
+    CORRADE_COMPARE(String::join({}, ", "), "");
+    CORRADE_COMPARE(String::join({""}, ", "), "");
+    CORRADE_COMPARE(String::join({"", ""}, ", "), ", ");
+    CORRADE_COMPARE(String::join({"hello"}, ", "), "hello");
+}
+
+void StringTest::joinSmall() {
+    /* Results that fit into SSO don't allocate */
+    String a = String::join({"a", "b", "c"}, ", ");
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a, "a, b, c");
+}
+
+void StringTest::joinWithoutEmptyParts() {
+    CORRADE_COMPARE(String::joinWithoutEmptyParts({"", "hello", "", "", "wonderful", "world", ""}, ", "),
+        "hello, wonderful, world");
+    CORRADE_COMPARE(String::joinWithoutEmptyParts({"", ""}, ", "), "");
+    CORRADE_COMPARE(String::joinWithoutEmptyParts({}, ", "), "");
+
+    const StringView strings[]{"", "hello", ""};
+    CORRADE_COMPARE(String::joinWithoutEmptyParts(strings, ", "), "hello");
+}
+
+void StringTest::concat() {
+    using namespace Literals;
+
+    String s = " wonderful";
+    String a = String::concat({"hello", s, " world"_s, "!"});
+    CORRADE_COMPARE(a, "hello wonderful world!");
+    CORRADE_COMPARE(a.data()[a.size()], '\0');
+
+    const StringView strings[]{"a", "", "b"};
+    String b = String::concat(strings);
+    CORRADE_VERIFY(b.isSmall());
+    CORRADE_COMPARE(b, "ab");
+
+    CORRADE_COMPARE(String::concat({}), "");
+}
+
 void StringTest::hasPrefix() {
     /* These rely on StringView conversion and then delegate there so we don't
        need to verify SSO behavior, only the basics */
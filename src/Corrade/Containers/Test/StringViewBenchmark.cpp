@@ -0,0 +1,295 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <string>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/StringView.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+using namespace Literals;
+
+constexpr StringView Needle = "e[needle]"_s;
+
+struct StringViewBenchmark: TestSuite::Tester {
+    explicit StringViewBenchmark();
+
+    void findString();
+    void findStringStlString();
+    #ifdef CORRADE_TARGET_UNIX
+    void findStringMemmem();
+    #endif
+    void findStringNaive();
+
+    void findLastString();
+    void findLastStringStlString();
+
+    void findCharacter();
+    void findCharacterStlString();
+    void findLastCharacter();
+    void findLastCharacterStlString();
+
+    void findAny();
+    void findAnyStlString();
+    void findAnyNaive();
+
+    void splitWhitespace();
+    void splitWhitespaceLazy();
+    void splitWhitespaceNaive();
+
+    private:
+        Array<char> _text;
+};
+
+StringViewBenchmark::StringViewBenchmark() {
+    addBenchmarks({&StringViewBenchmark::findString,
+                   &StringViewBenchmark::findStringStlString,
+                   #ifdef CORRADE_TARGET_UNIX
+                   &StringViewBenchmark::findStringMemmem,
+                   #endif
+                   &StringViewBenchmark::findStringNaive,
+
+                   &StringViewBenchmark::findLastString,
+                   &StringViewBenchmark::findLastStringStlString,
+
+                   &StringViewBenchmark::findCharacter,
+                   &StringViewBenchmark::findCharacterStlString,
+                   &StringViewBenchmark::findLastCharacter,
+                   &StringViewBenchmark::findLastCharacterStlString,
+
+                   &StringViewBenchmark::findAny,
+                   &StringViewBenchmark::findAnyStlString,
+                   &StringViewBenchmark::findAnyNaive,
+
+                   &StringViewBenchmark::splitWhitespace,
+                   &StringViewBenchmark::splitWhitespaceLazy,
+                   &StringViewBenchmark::splitWhitespaceNaive}, 10);
+
+    /* A megabyte of text, with the needle placed only at the very beginning
+       and at the very end, forward searches skip the first and backward
+       searches the last so they go through the whole thing. The needle starts
+       with a character that's common in the text, so an implementation that
+       just looks for the first character gets a lot of false positives. */
+    const char Lorem[] = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. ";
+    _text = Array<char>{NoInit, 1024*1024};
+    for(std::size_t i = 0; i != _text.size(); ++i)
+        _text[i] = Lorem[i % (sizeof(Lorem) - 1)];
+    std::memcpy(_text, Needle.data(), Needle.size());
+    std::memcpy(_text + _text.size() - Needle.size(), Needle.data(), Needle.size());
+}
+
+void StringViewBenchmark::findString() {
+    StringView text{_text, _text.size()};
+
+    const char* found{};
+    CORRADE_BENCHMARK(10)
+        found = text.suffix(Needle.size()).find(Needle).data();
+
+    CORRADE_COMPARE(std::size_t(found - _text.data()), _text.size() - Needle.size());
+}
+
+void StringViewBenchmark::findStringStlString() {
+    std::string text{_text, _text.size()};
+
+    std::size_t found{};
+    CORRADE_BENCHMARK(10)
+        found = text.find(Needle.data(), Needle.size(), Needle.size());
+
+    CORRADE_COMPARE(found, _text.size() - Needle.size());
+}
+
+#ifdef CORRADE_TARGET_UNIX
+void StringViewBenchmark::findStringMemmem() {
+    const char* found{};
+    CORRADE_BENCHMARK(10)
+        found = static_cast<const char*>(memmem(_text + Needle.size(), _text.size() - Needle.size(), Needle.data(), Needle.size()));
+
+    CORRADE_COMPARE(std::size_t(found - _text.data()), _text.size() - Needle.size());
+}
+#endif
+
+void StringViewBenchmark::findStringNaive() {
+    const char* found{};
+    CORRADE_BENCHMARK(10) {
+        found = nullptr;
+        for(const char* i = _text + Needle.size(), *end = _text.end() - Needle.size() + 1; i != end; ++i) {
+            if(std::memcmp(i, Needle.data(), Needle.size()) == 0) {
+                found = i;
+                break;
+            }
+        }
+    }
+
+    CORRADE_COMPARE(std::size_t(found - _text.data()), _text.size() - Needle.size());
+}
+
+void StringViewBenchmark::findLastString() {
+    StringView text{_text, _text.size()};
+
+    const char* found{};
+    CORRADE_BENCHMARK(10)
+        found = text.except(Needle.size()).findLast(Needle).data();
+
+    CORRADE_COMPARE(found, _text.data());
+}
+
+void StringViewBenchmark::findLastStringStlString() {
+    std::string text{_text, _text.size()};
+
+    std::size_t found{};
+    CORRADE_BENCHMARK(10)
+        found = text.rfind(Needle.data(), _text.size() - Needle.size() - 1, Needle.size());
+
+    CORRADE_COMPARE(found, 0);
+}
+
+void StringViewBenchmark::findCharacter() {
+    StringView text{_text, _text.size()};
+
+    const char* found{};
+    CORRADE_BENCHMARK(10)
+        found = text.suffix(Needle.size()).find('[').data();
+
+    CORRADE_COMPARE(std::size_t(found - _text.data()), _text.size() - Needle.size() + 1);
+}
+
+void StringViewBenchmark::findCharacterStlString() {
+    std::string text{_text, _text.size()};
+
+    std::size_t found{};
+    CORRADE_BENCHMARK(10)
+        found = text.find('[', Needle.size());
+
+    CORRADE_COMPARE(found, _text.size() - Needle.size() + 1);
+}
+
+void StringViewBenchmark::findLastCharacter() {
+    StringView text{_text, _text.size()};
+
+    const char* found{};
+    CORRADE_BENCHMARK(10)
+        found = text.except(Needle.size()).findLast(']').data();
+
+    CORRADE_COMPARE(found, _text.data() + Needle.size() - 1);
+}
+
+void StringViewBenchmark::findLastCharacterStlString() {
+    std::string text{_text, _text.size()};
+
+    std::size_t found{};
+    CORRADE_BENCHMARK(10)
+        found = text.rfind(']', _text.size() - Needle.size() - 1);
+
+    CORRADE_COMPARE(found, Needle.size() - 1);
+}
+
+/* None of these are in the text except for the needle */
+constexpr StringView Characters = "[]{}<>|\\"_s;
+
+void StringViewBenchmark::findAny() {
+    StringView text{_text, _text.size()};
+
+    const char* found{};
+    CORRADE_BENCHMARK(10)
+        found = text.suffix(Needle.size()).findAny(Characters).data();
+
+    CORRADE_COMPARE(std::size_t(found - _text.data()), _text.size() - Needle.size() + 1);
+}
+
+void StringViewBenchmark::findAnyStlString() {
+    std::string text{_text, _text.size()};
+
+    std::size_t found{};
+    CORRADE_BENCHMARK(10)
+        found = text.find_first_of(Characters.data(), Needle.size(), Characters.size());
+
+    CORRADE_COMPARE(found, _text.size() - Needle.size() + 1);
+}
+
+/* What StringView::splitWithoutEmptyParts() used originally */
+const char* findFirstOfNaive(const char* begin, const char* const end, const char* const characters, std::size_t characterCount) {
+    for(; begin != end; ++begin)
+        if(std::memchr(characters, *begin, characterCount)) return begin;
+    return end;
+}
+
+void StringViewBenchmark::findAnyNaive() {
+    const char* found{};
+    CORRADE_BENCHMARK(10)
+        found = findFirstOfNaive(_text + Needle.size(), _text.end(), Characters.data(), Characters.size());
+
+    CORRADE_COMPARE(std::size_t(found - _text.data()), _text.size() - Needle.size() + 1);
+}
+
+void StringViewBenchmark::splitWhitespace() {
+    StringView text{_text, _text.size()};
+
+    std::size_t count{};
+    CORRADE_BENCHMARK(1)
+        count = text.splitWithoutEmptyParts().size();
+
+    CORRADE_COMPARE(count, 160668);
+}
+
+void StringViewBenchmark::splitWhitespaceLazy() {
+    StringView text{_text, _text.size()};
+
+    std::size_t count{};
+    CORRADE_BENCHMARK(1) {
+        count = 0;
+        for(StringView part: text.splitLazyWithoutEmptyParts())
+            count += !part.isEmpty();
+    }
+
+    CORRADE_COMPARE(count, 160668);
+}
+
+void StringViewBenchmark::splitWhitespaceNaive() {
+    const char* const end = _text.end();
+    const char whitespace[]{' ', '\t', '\f', '\v', '\r', '\n'};
+
+    std::size_t count{};
+    CORRADE_BENCHMARK(1) {
+        Array<StringView> parts;
+        const char* oldpos = _text;
+        while(oldpos < end) {
+            const char* const pos = findFirstOfNaive(oldpos, end, whitespace, sizeof(whitespace));
+            if(pos != oldpos)
+                arrayAppend(parts, StringView{oldpos, std::size_t(pos - oldpos)});
+            oldpos = pos + 1;
+        }
+        count = parts.size();
+    }
+
+    CORRADE_COMPARE(count, 160668);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::StringViewBenchmark)
@@ -23,9 +23,12 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <iterator>
 #include <sstream>
 
 #include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/GrowableArray.h"
 #include "Corrade/Containers/StaticArray.h"
 #include "Corrade/Containers/StringView.h"
 #include "Corrade/TestSuite/Tester.h"
@@ -132,6 +135,16 @@ struct StringViewTest: TestSuite::Tester {
     void splitMultipleCharactersFlags();
     void splitNullView();
 
+    void splitLazy();
+    void splitLazyFlags();
+    void splitLazyMultipleCharacters();
+    void splitLazyMutable();
+    void splitLazyNullView();
+    void splitLazyIterator();
+    void splitLazyIteratorPastEnd();
+    void splitLazyStlAlgorithms();
+    void lines();
+
     void partition();
     void partitionFlags();
 
@@ -147,6 +160,26 @@ struct StringViewTest: TestSuite::Tester {
     void stripSuffixFlags();
     void stripSuffixInvalid();
 
+    void find();
+    void findEmpty();
+    void findFlags();
+    void findLong();
+    void findCharacter();
+    void findLast();
+    void findLastEmpty();
+    void findLastLong();
+    void findLastCharacter();
+    void contains();
+
+    void findAny();
+    void findAnyLong();
+    void findLastAny();
+    void containsAny();
+
+    void trimmed();
+    void trimmedFlags();
+    void trimmedNullView();
+
     void debugFlag();
     void debugFlags();
     void debug();
@@ -196,6 +229,16 @@ StringViewTest::StringViewTest() {
               &StringViewTest::splitMultipleCharactersFlags,
               &StringViewTest::splitNullView,
 
+              &StringViewTest::splitLazy,
+              &StringViewTest::splitLazyFlags,
+              &StringViewTest::splitLazyMultipleCharacters,
+              &StringViewTest::splitLazyMutable,
+              &StringViewTest::splitLazyNullView,
+              &StringViewTest::splitLazyIterator,
+              &StringViewTest::splitLazyIteratorPastEnd,
+              &StringViewTest::splitLazyStlAlgorithms,
+              &StringViewTest::lines,
+
               &StringViewTest::partition,
               &StringViewTest::partitionFlags,
 
@@ -211,6 +254,26 @@ StringViewTest::StringViewTest() {
               &StringViewTest::stripSuffixFlags,
               &StringViewTest::stripSuffixInvalid,
 
+              &StringViewTest::find,
+              &StringViewTest::findEmpty,
+              &StringViewTest::findFlags,
+              &StringViewTest::findLong,
+              &StringViewTest::findCharacter,
+              &StringViewTest::findLast,
+              &StringViewTest::findLastEmpty,
+              &StringViewTest::findLastLong,
+              &StringViewTest::findLastCharacter,
+              &StringViewTest::contains,
+
+              &StringViewTest::findAny,
+              &StringViewTest::findAnyLong,
+              &StringViewTest::findLastAny,
+              &StringViewTest::containsAny,
+
+              &StringViewTest::trimmed,
+              &StringViewTest::trimmedFlags,
+              &StringViewTest::trimmedNullView,
+
               &StringViewTest::debugFlag,
               &StringViewTest::debugFlags,
               &StringViewTest::debug});
@@ -968,6 +1031,167 @@ void StringViewTest::splitNullView() {
         TestSuite::Compare::Container);
 }
 
+template<class T> Array<BasicStringView<T>> collect(const StringSplit<T>& split) {
+    Array<BasicStringView<T>> out;
+    for(BasicStringView<T> part: split) arrayAppend(out, part);
+    return out;
+}
+
+void StringViewTest::splitLazy() {
+    /* Should give the same results as split() and splitWithoutEmptyParts() */
+    for(StringView string: {""_s, "/"_s, "abcdef"_s, "ab/c/def"_s, "ab//c/def//"_s, "//ab"_s}) {
+        CORRADE_ITERATION(string);
+        CORRADE_COMPARE_AS(collect(string.splitLazy('/')),
+            string.split('/'),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(collect(string.splitLazyWithoutEmptyParts('/')),
+            string.splitWithoutEmptyParts('/'),
+            TestSuite::Compare::Container);
+    }
+
+    /* Whitespace */
+    CORRADE_COMPARE_AS(collect(" \tab\n  c\r\fdef \v"_s.splitLazyWithoutEmptyParts()),
+        arrayView({"ab"_s, "c"_s, "def"_s}),
+        TestSuite::Compare::Container);
+}
+
+void StringViewTest::splitLazyFlags() {
+    /* Same as split(), all global, only the last null-terminated */
+    {
+        Array<StringView> a = collect("a/b/c"_s.splitLazy('/'));
+        CORRADE_COMPARE_AS(a, arrayView({"a"_s, "b"_s, "c"_s}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE(a[0].flags(), StringViewFlag::Global);
+        CORRADE_COMPARE(a[1].flags(), StringViewFlag::Global);
+        CORRADE_COMPARE(a[2].flags(), StringViewFlag::Global|StringViewFlag::NullTerminated);
+    } {
+        Array<StringView> a = collect("a/b/"_s.splitLazy('/'));
+        CORRADE_COMPARE_AS(a, arrayView({"a"_s, "b"_s, ""_s}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE(a[2].flags(), StringViewFlag::Global|StringViewFlag::NullTerminated);
+    } {
+        Array<StringView> a = collect("a//b"_s.splitLazyWithoutEmptyParts(".:/"));
+        CORRADE_COMPARE_AS(a, arrayView({"a"_s, "b"_s}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE(a[0].flags(), StringViewFlag::Global);
+        CORRADE_COMPARE(a[1].flags(), StringViewFlag::Global|StringViewFlag::NullTerminated);
+    }
+}
+
+void StringViewTest::splitLazyMultipleCharacters() {
+    constexpr Containers::StringView delimiters = ".:;"_s;
+
+    /* Should give the same results as splitWithoutEmptyParts(), test also
+       strings long enough to go through the SIMD paths */
+    for(StringView string: {""_s, ".:;"_s, "abcdef"_s, "ab:c;def"_s, "ab:c;;def."_s, ";;;ab"_s, "a.bcdefghijklmnopqrstuvwxyz.:;ABCDEFGHIJKLMNOPQRSTUVWXYZ;..0123456789;"_s}) {
+        CORRADE_ITERATION(string);
+        CORRADE_COMPARE_AS(collect(string.splitLazyWithoutEmptyParts(delimiters)),
+            string.splitWithoutEmptyParts(delimiters),
+            TestSuite::Compare::Container);
+    }
+}
+
+void StringViewTest::splitLazyMutable() {
+    char data[] = "a,b,c";
+    MutableStringView a = data;
+    for(MutableStringView part: a.splitLazy(','))
+        part[0] += 'A' - 'a';
+    CORRADE_COMPARE(StringView{a}, "A,B,C");
+}
+
+void StringViewTest::splitLazyNullView() {
+    CORRADE_VERIFY(StringView{}.splitLazy('/').begin() == StringView{}.splitLazy('/').end());
+    CORRADE_VERIFY(StringView{}.splitLazyWithoutEmptyParts('/').begin() == StringView{}.splitLazy('/').end());
+    CORRADE_VERIFY(StringView{}.splitLazyWithoutEmptyParts().begin() == StringView{}.splitLazy('/').end());
+    CORRADE_VERIFY(StringView{}.lines().begin() == StringView{}.lines().end());
+}
+
+void StringViewTest::splitLazyIterator() {
+    StringSplit<const char> split = "a/b"_s.splitLazy('/');
+
+    StringSplitIterator<const char> it = split.begin();
+    CORRADE_VERIFY(it == split.begin());
+    CORRADE_VERIFY(it != split.end());
+    CORRADE_COMPARE(*it, "a");
+    CORRADE_COMPARE(it->size(), 1);
+
+    ++it;
+    CORRADE_VERIFY(it != split.begin());
+    CORRADE_VERIFY(it != split.end());
+    CORRADE_COMPARE(*it, "b");
+
+    ++it;
+    CORRADE_VERIFY(it == split.end());
+}
+
+void StringViewTest::splitLazyIteratorPastEnd() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    StringSplitIterator<const char> it = "a"_s.splitLazy('/').end();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    ++it;
+    CORRADE_COMPARE(out.str(), "Containers::StringSplitIterator: can't advance past the end\n");
+}
+
+void StringViewTest::splitLazyStlAlgorithms() {
+    StringSplit<const char> split = "a,b,,c"_s.splitLazy(',');
+    CORRADE_COMPARE(std::distance(split.begin(), split.end()), 4);
+    CORRADE_COMPARE(std::count(split.begin(), split.end(), ""_s), 1);
+
+    StringSplit<const char> lines = "hello\nworld\n\nbye"_s.lines();
+    StringSplitIterator<const char> found = std::find(lines.begin(), lines.end(), "world"_s);
+    CORRADE_VERIFY(found != lines.end());
+    CORRADE_COMPARE(*found, "world");
+    CORRADE_COMPARE(*std::next(found), "");
+    CORRADE_COMPARE(std::distance(found, lines.end()), 3);
+
+    /* Postfix increment returns the previous position */
+    StringSplitIterator<const char> it = lines.begin();
+    CORRADE_COMPARE(*it++, "hello");
+    CORRADE_COMPARE(*it, "world");
+}
+
+void StringViewTest::lines() {
+    /* Empty, no lines */
+    CORRADE_COMPARE_AS(collect(""_s.lines()),
+        Array<StringView>{},
+        TestSuite::Compare::Container);
+
+    /* Just a newline, one empty line */
+    CORRADE_COMPARE_AS(collect("\n"_s.lines()),
+        arrayView({""_s}),
+        TestSuite::Compare::Container);
+
+    /* Trailing newline doesn't produce an extra line */
+    CORRADE_COMPARE_AS(collect("a\nb\n"_s.lines()),
+        arrayView({"a"_s, "b"_s}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(collect("a\nb"_s.lines()),
+        arrayView({"a"_s, "b"_s}),
+        TestSuite::Compare::Container);
+
+    /* Windows line endings, mixed with Unix ones, empty lines kept */
+    CORRADE_COMPARE_AS(collect("a\r\n\r\nb\n\nc\r\n"_s.lines()),
+        arrayView({"a"_s, ""_s, "b"_s, ""_s, "c"_s}),
+        TestSuite::Compare::Container);
+
+    /* A \r not followed by \n is kept */
+    CORRADE_COMPARE_AS(collect("a\rb\r"_s.lines()),
+        arrayView({"a\rb\r"_s}),
+        TestSuite::Compare::Container);
+
+    /* Only the last line is null-terminated, and only if there's no trailing
+       newline */
+    Array<StringView> a = collect("a\r\nb"_s.lines());
+    CORRADE_COMPARE(a[0].flags(), StringViewFlag::Global);
+    CORRADE_COMPARE(a[1].flags(), StringViewFlag::Global|StringViewFlag::NullTerminated);
+    CORRADE_COMPARE(collect("a\n"_s.lines())[0].flags(), StringViewFlag::Global);
+}
+
 void StringViewTest::partition() {
     /* Happy case */
     CORRADE_COMPARE_AS("ab=c"_s.partition('='),
@@ -1129,6 +1353,314 @@ void StringViewTest::stripSuffixInvalid() {
     CORRADE_COMPARE(out.str(), "Containers::StringView::stripSuffix(): string doesn't end with over\n");
 }
 
+void StringViewTest::find() {
+    StringView a = "hello world, hello again";
+
+    StringView found = a.find("hello");
+    CORRADE_COMPARE(found, "hello");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data());
+
+    found = a.find("lo a");
+    CORRADE_COMPARE(found, "lo a");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + 16);
+
+    /* Two-character substring, the smallest one taking the non-memchr path */
+    found = a.find("ld");
+    CORRADE_COMPARE(found, "ld");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + 9);
+
+    /* Single character */
+    found = a.find("w");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + 6);
+
+    /* The whole string */
+    found = a.find(a);
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data());
+    CORRADE_COMPARE(found.size(), a.size());
+
+    /* First and last character match but the middle not */
+    CORRADE_VERIFY(!a.find("hxllo").data());
+    /* Larger than the string */
+    CORRADE_VERIFY(!"hell"_s.find("hello").data());
+    /* Not found */
+    found = a.find("help");
+    CORRADE_VERIFY(found.isEmpty());
+    CORRADE_VERIFY(!found.data());
+}
+
+void StringViewTest::findEmpty() {
+    StringView a = "hello";
+
+    /* Empty substring is found at the beginning */
+    StringView found = a.find("");
+    CORRADE_VERIFY(found.isEmpty());
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data());
+
+    /* Empty string, empty substring -- still found at the beginning */
+    StringView empty = ""_s;
+    found = empty.find("");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), empty.data());
+
+    /* Nothing is found in an empty or null string */
+    CORRADE_VERIFY(!empty.find("a").data());
+    CORRADE_VERIFY(!StringView{}.find("a").data());
+    CORRADE_VERIFY(!StringView{}.find('a').data());
+}
+
+void StringViewTest::findFlags() {
+    /* Global flag is always propagated, null-terminated only if at the end */
+    CORRADE_COMPARE("hello world"_s.find("hello").flags(),
+        StringViewFlag::Global);
+    CORRADE_COMPARE("hello world"_s.find("world").flags(),
+        StringViewFlag::Global|StringViewFlag::NullTerminated);
+    CORRADE_COMPARE("hello world"_s.findLast('d').flags(),
+        StringViewFlag::Global|StringViewFlag::NullTerminated);
+    CORRADE_COMPARE(StringView{"hello world"}.find("lo").flags(),
+        StringViewFlags{});
+
+    /* Mutable view results in a mutable view */
+    char data[] = "hello world";
+    MutableStringView a = data;
+    MutableStringView found = a.find("wor");
+    found[0] = 'W';
+    CORRADE_COMPARE(StringView{a}, "hello World");
+}
+
+void StringViewTest::findLong() {
+    /* Verify that matches are correctly found at all positions, including
+       across 16- and 32-byte block boundaries and in the scalar remainder */
+    char data[131];
+    for(std::size_t i = 0; i != sizeof(data); ++i) data[i] = 'a' + i%7;
+    const StringView haystack{data, sizeof(data)};
+
+    for(std::size_t substringSize: {2, 3, 5, 17, 33}) {
+        for(std::size_t i = 0; i + substringSize <= sizeof(data); ++i) {
+            CORRADE_ITERATION(substringSize << Debug::nospace << "@" << Debug::nospace << i);
+
+            char original[33];
+            for(std::size_t j = 0; j != substringSize; ++j) {
+                original[j] = data[i + j];
+                data[i + j] = 'x' + j%2;
+            }
+            /* Make the first and last character the same as in the match to
+               exercise the full comparison */
+            data[i] = 'X';
+            data[i + substringSize - 1] = 'Y';
+
+            /* Search for a copy so it doesn't trivially match itself */
+            char copy[33];
+            for(std::size_t j = 0; j != substringSize; ++j)
+                copy[j] = data[i + j];
+            const StringView substring{copy, substringSize};
+            CORRADE_COMPARE(static_cast<const void*>(haystack.find(substring).data()), data + i);
+            CORRADE_COMPARE(static_cast<const void*>(haystack.findLast(substring).data()), data + i);
+
+            /* Mismatch in the middle, or at the end for two-char substrings */
+            copy[1] = substringSize > 2 ? 'z' : 'Z';
+            CORRADE_VERIFY(!haystack.find(substring).data());
+            CORRADE_VERIFY(!haystack.findLast(substring).data());
+
+            for(std::size_t j = 0; j != substringSize; ++j)
+                data[i + j] = original[j];
+        }
+    }
+}
+
+void StringViewTest::findCharacter() {
+    StringView a = "hello world";
+
+    StringView found = a.find('o');
+    CORRADE_COMPARE(found, "o");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + 4);
+
+    CORRADE_VERIFY(!a.find('x').data());
+}
+
+void StringViewTest::findLast() {
+    StringView a = "hello world, hello again";
+
+    StringView found = a.findLast("hello");
+    CORRADE_COMPARE(found, "hello");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + 13);
+
+    /* Two-character substring */
+    found = a.findLast("ll");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + 15);
+
+    /* Single character */
+    found = a.findLast("o");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + 17);
+
+    /* The whole string */
+    found = a.findLast(a);
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data());
+
+    CORRADE_VERIFY(!a.findLast("hxllo").data());
+    CORRADE_VERIFY(!"hell"_s.findLast("hello").data());
+}
+
+void StringViewTest::findLastEmpty() {
+    StringView a = "hello";
+
+    /* Empty substring is found at the end */
+    StringView found = a.findLast("");
+    CORRADE_VERIFY(found.isEmpty());
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + 5);
+
+    CORRADE_VERIFY(!""_s.findLast("a").data());
+    CORRADE_VERIFY(!StringView{}.findLast("a").data());
+    CORRADE_VERIFY(!StringView{}.findLast('a').data());
+}
+
+void StringViewTest::findLastLong() {
+    /* Single character search going through the SIMD blocks */
+    char data[77];
+    for(std::size_t i = 0; i != sizeof(data); ++i) data[i] = 'a';
+    const StringView haystack{data, sizeof(data)};
+    CORRADE_VERIFY(!haystack.findLast('b').data());
+
+    for(std::size_t i = 0; i != sizeof(data); ++i) {
+        CORRADE_ITERATION(i);
+        data[i] = 'b';
+        CORRADE_COMPARE(static_cast<const void*>(haystack.findLast('b').data()), data + i);
+        CORRADE_COMPARE(static_cast<const void*>(haystack.findLast("b").data()), data + i);
+        /* The first occurence is found by a forward search */
+        CORRADE_COMPARE(static_cast<const void*>(haystack.find('b').data()), data);
+    }
+}
+
+void StringViewTest::findLastCharacter() {
+    StringView a = "hello world";
+
+    StringView found = a.findLast('o');
+    CORRADE_COMPARE(found, "o");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + 7);
+
+    CORRADE_VERIFY(!a.findLast('x').data());
+}
+
+void StringViewTest::contains() {
+    StringView a = "hello world";
+
+    CORRADE_VERIFY(a.contains("hello"));
+    CORRADE_VERIFY(a.contains("o w"));
+    CORRADE_VERIFY(a.contains("d"));
+    CORRADE_VERIFY(a.contains(""));
+    CORRADE_VERIFY(a.contains('w'));
+    CORRADE_VERIFY(!a.contains("worlds"));
+    CORRADE_VERIFY(!a.contains("hello world!"));
+    CORRADE_VERIFY(!a.contains('x'));
+
+    CORRADE_VERIFY(StringView{}.contains(""));
+    CORRADE_VERIFY(!StringView{}.contains("a"));
+    CORRADE_VERIFY(!StringView{}.contains('a'));
+}
+
+void StringViewTest::findAny() {
+    StringView a = "hello, world!";
+
+    StringView found = a.findAny(",!");
+    CORRADE_COMPARE(found, ",");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + 5);
+
+    found = a.findAny("wo");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + 4);
+
+    CORRADE_VERIFY(!a.findAny("xyz").data());
+    CORRADE_VERIFY(!a.findAny("").data());
+    CORRADE_VERIFY(!StringView{}.findAny("a").data());
+
+    CORRADE_COMPARE("hello, world!"_s.findAny("!").flags(),
+        StringViewFlag::Global|StringViewFlag::NullTerminated);
+}
+
+void StringViewTest::findAnyLong() {
+    /* Verify that all 256 characters are classified correctly in both the
+       vectorized and scalar code paths -- one character from the set is
+       placed at all positions of a string consisting of characters outside
+       of the set */
+    char data[77];
+    const StringView haystack{data, sizeof(data)};
+
+    for(int c = 0; c != 256; ++c) {
+        CORRADE_ITERATION(c);
+
+        /* The set contains the character and its neighbors in the other half
+           of the table, to verify the halves don't mix */
+        const char set[]{char(c), char(c ^ 0x70)};
+        const char other = char(c ^ 0x80);
+        for(char& i: data) i = other;
+
+        CORRADE_VERIFY(!haystack.findAny({set, 2}).data());
+        CORRADE_VERIFY(!haystack.findLastAny({set, 2}).data());
+        CORRADE_COMPARE(static_cast<const void*>(haystack.trimmed({&other, 1}).data()), data + sizeof(data));
+
+        for(std::size_t i: {0, 5, 15, 16, 31, 32, 33, 63, 64, 76}) {
+            data[i] = char(c);
+            CORRADE_COMPARE(static_cast<const void*>(haystack.findAny({set, 2}).data()), data + i);
+            CORRADE_COMPARE(static_cast<const void*>(haystack.findLastAny({set, 2}).data()), data + i);
+            CORRADE_COMPARE(static_cast<const void*>(haystack.trimmedPrefix({&other, 1}).data()), data + i);
+            CORRADE_COMPARE(haystack.trimmedSuffix({&other, 1}).size(), i + 1);
+            data[i] = other;
+        }
+    }
+}
+
+void StringViewTest::findLastAny() {
+    StringView a = "hello, world!";
+
+    StringView found = a.findLastAny("lo");
+    CORRADE_COMPARE(found, "l");
+    CORRADE_COMPARE(static_cast<const void*>(found.data()), a.data() + 10);
+
+    CORRADE_VERIFY(!a.findLastAny("xyz").data());
+    CORRADE_VERIFY(!a.findLastAny("").data());
+    CORRADE_VERIFY(!StringView{}.findLastAny("a").data());
+}
+
+void StringViewTest::containsAny() {
+    CORRADE_VERIFY("hello, world!"_s.containsAny("xyz!"));
+    CORRADE_VERIFY(!"hello, world!"_s.containsAny("xyz"));
+    CORRADE_VERIFY(!"hello, world!"_s.containsAny(""));
+    CORRADE_VERIFY(!StringView{}.containsAny("abc"));
+}
+
+void StringViewTest::trimmed() {
+    CORRADE_COMPARE(" \t\n  hello world \r\v \f"_s.trimmed(), "hello world");
+    CORRADE_COMPARE(" \t\n  hello world \r\v \f"_s.trimmedPrefix(), "hello world \r\v \f");
+    CORRADE_COMPARE(" \t\n  hello world \r\v \f"_s.trimmedSuffix(), " \t\n  hello world");
+
+    CORRADE_COMPARE("..,,hello world,,.."_s.trimmed(".,"), "hello world");
+    CORRADE_COMPARE("..,,hello world,,.."_s.trimmedPrefix(".,"), "hello world,,..");
+    CORRADE_COMPARE("..,,hello world,,.."_s.trimmedSuffix(".,"), "..,,hello world");
+
+    /* Nothing to trim */
+    CORRADE_COMPARE("hello"_s.trimmed(), "hello");
+    CORRADE_COMPARE("hello"_s.trimmed(""), "hello");
+
+    /* Everything trimmed, the view still points to existing memory. Prefix
+       trimming leaves the view at the end, suffix trimming at the start. */
+    StringView a = "   \n ";
+    CORRADE_VERIFY(a.trimmed().isEmpty());
+    CORRADE_COMPARE(static_cast<const void*>(a.trimmedPrefix().data()), a.end());
+    CORRADE_COMPARE(static_cast<const void*>(a.trimmedSuffix().data()), a.data());
+}
+
+void StringViewTest::trimmedFlags() {
+    CORRADE_COMPARE("  hello  "_s.trimmedPrefix().flags(),
+        StringViewFlag::Global|StringViewFlag::NullTerminated);
+    CORRADE_COMPARE("  hello  "_s.trimmedSuffix().flags(),
+        StringViewFlag::Global);
+    CORRADE_COMPARE("  hello"_s.trimmed().flags(),
+        StringViewFlag::Global|StringViewFlag::NullTerminated);
+}
+
+void StringViewTest::trimmedNullView() {
+    CORRADE_VERIFY(!StringView{}.trimmed().data());
+    CORRADE_VERIFY(!StringView{}.trimmedPrefix().data());
+    CORRADE_VERIFY(!StringView{}.trimmedSuffix().data());
+}
+
 void StringViewTest::debugFlag() {
     std::ostringstream out;
 
@@ -0,0 +1,107 @@
+#ifndef Corrade_Containers_bitHelpers_h
+#define Corrade_Containers_bitHelpers_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "Corrade/configure.h"
+
+#ifdef CORRADE_TARGET_MSVC
+#include <intrin.h>
+#endif
+
+namespace Corrade { namespace Containers { namespace Implementation {
+
+/* Count of set bits. GCC and Clang turn the builtin into a POPCNT
+   instruction if it's enabled for the target and into a branchless bit
+   twiddling sequence otherwise, which is the same as the fallback below. On
+   MSVC the POPCNT intrinsics are used if it's enabled at compile time. Bulk
+   counting in bitArrayCount() picks a POPCNT or AVX2 variant at runtime
+   independently of this. */
+inline std::size_t bitCount(std::uint64_t value) {
+    #ifdef CORRADE_TARGET_GCC
+    return __builtin_popcountll(value);
+    #elif defined(CORRADE_TARGET_MSVC) && defined(CORRADE_TARGET_POPCNT)
+    /* __popcnt64() isn't available on 32-bit targets */
+    #ifdef _M_X64
+    return __popcnt64(value);
+    #else
+    return __popcnt(std::uint32_t(value)) + __popcnt(std::uint32_t(value >> 32));
+    #endif
+    #else
+    value = value - ((value >> 1) & 0x5555555555555555ull);
+    value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+    value = (value + (value >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return std::size_t((value*0x0101010101010101ull) >> 56);
+    #endif
+}
+
+/* Index of the lowest set bit, value is expected to be non-zero */
+inline std::size_t bitCountTrailingZeros(const std::uint64_t value) {
+    #ifdef CORRADE_TARGET_GCC
+    return __builtin_ctzll(value);
+    #else
+    /* _BitScanForward64() isn't available on 32-bit targets */
+    unsigned long bit;
+    if(_BitScanForward(&bit, std::uint32_t(value))) return bit;
+    _BitScanForward(&bit, std::uint32_t(value >> 32));
+    return bit + 32;
+    #endif
+}
+
+/* Loads `count` bits (1 to 64) starting at bit `bit` of `data`, where bit
+   `i` is stored in byte `i/8` at position `i%8`. The result has the first
+   bit in the lowest position and all bits above `count` cleared. Touches
+   only the bytes that contain the requested bits. */
+inline std::uint64_t bitLoad(const char* const data, const std::size_t bit, const std::size_t count) {
+    const unsigned char* const bytes = reinterpret_cast<const unsigned char*>(data) + (bit >> 3);
+    const std::size_t shift = bit & 7;
+    const std::size_t byteCount = (shift + count + 7) >> 3;
+
+    std::uint64_t out;
+    #ifndef CORRADE_TARGET_BIG_ENDIAN
+    if(byteCount >= 8) std::memcpy(&out, bytes, 8);
+    else
+    #endif
+    {
+        out = 0;
+        for(std::size_t i = 0, end = byteCount < 8 ? byteCount : 8; i != end; ++i)
+            out |= std::uint64_t(bytes[i]) << (i*8);
+    }
+
+    if(shift) {
+        out >>= shift;
+        if(byteCount == 9) out |= std::uint64_t(bytes[8]) << (64 - shift);
+    }
+
+    return count == 64 ? out : out & ((std::uint64_t{1} << count) - 1);
+}
+
+}}}
+
+#endif
@@ -112,6 +112,33 @@ read/write access to global data.
 #define CORRADE_BUILD_MULTITHREADED
 #undef CORRADE_BUILD_MULTITHREADED
 
+/**
+@brief Build with runtime CPU dispatch
+@m_since_latest
+
+Defined if the library is built with all SIMD variants of performance-critical
+code, picking the best one for the CPU it runs on at runtime. If not defined,
+only the variants enabled at compile time are built. See
+@ref Corrade::Utility::Cpu "Utility::Cpu" for more information.
+@see @ref CORRADE_CPU_USE_IFUNC, @ref building-corrade, @ref corrade-cmake
+*/
+#define CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+#undef CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+
+/**
+@brief Use GNU IFUNC for runtime CPU dispatch
+@m_since_latest
+
+Defined if @ref CORRADE_BUILD_CPU_RUNTIME_DISPATCH is enabled and the
+dispatched functions are resolved by the dynamic linker using
+[GNU IFUNC](https://sourceware.org/glibc/wiki/GNU_IFUNC) instead of through a
+function pointer. Available only with glibc on Linux. See
+@ref CORRADE_CPU_DISPATCHED_IFUNC() for more information.
+@see @ref building-corrade, @ref corrade-cmake
+*/
+#define CORRADE_CPU_USE_IFUNC
+#undef CORRADE_CPU_USE_IFUNC
+
 /**
 @brief Debug build
 
@@ -464,6 +491,164 @@ so (unlike AVX and newer) this feature doesn't need any runtime detection.
 #define CORRADE_TARGET_SSE2
 #undef CORRADE_TARGET_SSE2
 
+/**
+@brief SSE3 target
+@m_since_latest
+
+Defined on x86 if [SSE3](https://en.wikipedia.org/wiki/SSE3) instructions are
+enabled at compile time (`-msse3` or higher on GCC/Clang, `/arch:AVX` or
+higher on MSVC). Implies @ref CORRADE_TARGET_SSE2.
+@see @ref Corrade::Utility::Cpu "Utility::Cpu"
+*/
+#define CORRADE_TARGET_SSE3
+#undef CORRADE_TARGET_SSE3
+
+/**
+@brief SSSE3 target
+@m_since_latest
+
+Defined on x86 if [SSSE3](https://en.wikipedia.org/wiki/SSSE3) instructions
+are enabled at compile time (`-mssse3` or higher on GCC/Clang, `/arch:AVX` or
+higher on MSVC, as it doesn't have a dedicated option for SSSE3). Implies
+@ref CORRADE_TARGET_SSE2.
+*/
+#define CORRADE_TARGET_SSSE3
+#undef CORRADE_TARGET_SSSE3
+
+/**
+@brief SSE4.1 target
+@m_since_latest
+
+Defined on x86 if [SSE4.1](https://en.wikipedia.org/wiki/SSE4#SSE4.1)
+instructions are enabled at compile time (`-msse4.1` or higher on GCC/Clang,
+`/arch:AVX` or higher on MSVC). Implies @ref CORRADE_TARGET_SSSE3.
+@see @ref Corrade::Utility::Cpu "Utility::Cpu"
+*/
+#define CORRADE_TARGET_SSE41
+#undef CORRADE_TARGET_SSE41
+
+/**
+@brief SSE4.2 target
+@m_since_latest
+
+Defined on x86 if [SSE4.2](https://en.wikipedia.org/wiki/SSE4#SSE4.2)
+instructions, including CRC32, are enabled at compile time (`-msse4.2` or
+higher on GCC/Clang, `/arch:AVX` or higher on MSVC). Implies
+@ref CORRADE_TARGET_SSE41.
+@see @ref Corrade::Utility::Cpu "Utility::Cpu"
+*/
+#define CORRADE_TARGET_SSE42
+#undef CORRADE_TARGET_SSE42
+
+/**
+@brief AVX target
+@m_since_latest
+
+Defined on x86 if [AVX](https://en.wikipedia.org/wiki/Advanced_Vector_Extensions)
+instructions are enabled at compile time (`-mavx` or higher on GCC/Clang,
+`/arch:AVX` or higher on MSVC). Implies @ref CORRADE_TARGET_SSE42.
+@see @ref Corrade::Utility::Cpu "Utility::Cpu"
+*/
+#define CORRADE_TARGET_AVX
+#undef CORRADE_TARGET_AVX
+
+/**
+@brief AVX2 target
+@m_since_latest
+
+Defined on x86 if [AVX2](https://en.wikipedia.org/wiki/Advanced_Vector_Extensions#Advanced_Vector_Extensions_2)
+instructions are enabled at compile time (`-mavx2` or higher on GCC/Clang,
+`/arch:AVX2` or higher on MSVC). Implies @ref CORRADE_TARGET_SSE2 and
+@ref CORRADE_TARGET_SSSE3. Unlike SSE2, AVX2 isn't available on all x86 CPUs,
+so code relying on this macro will only run on machines that support it.
+*/
+#define CORRADE_TARGET_AVX2
+#undef CORRADE_TARGET_AVX2
+
+/**
+@brief AVX-512 Foundation target
+@m_since_latest
+
+Defined on x86 if [AVX-512 Foundation](https://en.wikipedia.org/wiki/AVX-512)
+instructions are enabled at compile time (`-mavx512f` or higher on GCC/Clang,
+`/arch:AVX512` on MSVC). Implies @ref CORRADE_TARGET_AVX2.
+@see @ref Corrade::Utility::Cpu "Utility::Cpu"
+*/
+#define CORRADE_TARGET_AVX512F
+#undef CORRADE_TARGET_AVX512F
+
+/**
+@brief POPCNT target
+@m_since_latest
+
+Defined on x86 if the [POPCNT](https://en.wikipedia.org/wiki/X86_Bit_manipulation_instruction_set#ABM_(Advanced_Bit_Manipulation))
+instruction is enabled at compile time (`-mpopcnt` on GCC/Clang, `/arch:AVX` or
+higher on MSVC).
+@see @ref Corrade::Utility::Cpu "Utility::Cpu"
+*/
+#define CORRADE_TARGET_POPCNT
+#undef CORRADE_TARGET_POPCNT
+
+/**
+@brief LZCNT target
+@m_since_latest
+
+Defined on x86 if the [LZCNT](https://en.wikipedia.org/wiki/X86_Bit_manipulation_instruction_set#ABM_(Advanced_Bit_Manipulation))
+instruction is enabled at compile time (`-mlzcnt` on GCC/Clang, `/arch:AVX2` on
+MSVC).
+@see @ref Corrade::Utility::Cpu "Utility::Cpu"
+*/
+#define CORRADE_TARGET_LZCNT
+#undef CORRADE_TARGET_LZCNT
+
+/**
+@brief BMI1 target
+@m_since_latest
+
+Defined on x86 if [BMI1](https://en.wikipedia.org/wiki/X86_Bit_manipulation_instruction_set#BMI1_(Bit_Manipulation_Instruction_Set_1))
+instructions are enabled at compile time (`-mbmi` on GCC/Clang, `/arch:AVX2`
+on MSVC).
+@see @ref Corrade::Utility::Cpu "Utility::Cpu"
+*/
+#define CORRADE_TARGET_BMI1
+#undef CORRADE_TARGET_BMI1
+
+/**
+@brief BMI2 target
+@m_since_latest
+
+Defined on x86 if [BMI2](https://en.wikipedia.org/wiki/X86_Bit_manipulation_instruction_set#BMI2_(Bit_Manipulation_Instruction_Set_2))
+instructions are enabled at compile time (`-mbmi2` on GCC/Clang, `/arch:AVX2`
+on MSVC).
+@see @ref Corrade::Utility::Cpu "Utility::Cpu"
+*/
+#define CORRADE_TARGET_BMI2
+#undef CORRADE_TARGET_BMI2
+
+/**
+@brief SHA target
+@m_since_latest
+
+Defined on x86 if [SHA](https://en.wikipedia.org/wiki/Intel_SHA_extensions)
+instructions are enabled at compile time (`-msha` on GCC/Clang, MSVC has no
+dedicated option for these).
+@see @ref Corrade::Utility::Cpu "Utility::Cpu"
+*/
+#define CORRADE_TARGET_SHA
+#undef CORRADE_TARGET_SHA
+
+/**
+@brief NEON target
+@m_since_latest
+
+Defined on ARM if [NEON](https://en.wikipedia.org/wiki/ARM_architecture#Advanced_SIMD_(Neon))
+instructions are enabled at compile time (`-mfpu=neon` on 32-bit GCC/Clang,
+always on 64-bit ARM).
+@see @ref CORRADE_TARGET_ARM
+*/
+#define CORRADE_TARGET_NEON
+#undef CORRADE_TARGET_NEON
+
 /**
 @brief PluginManager doesn't have dynamic plugin support on this platform
 
@@ -25,14 +25,20 @@
 
 #include "Emitter.h"
 
+#include "Corrade/Containers/SmallArray.h"
 #include "Corrade/Interconnect/Receiver.h"
 #include "Corrade/Interconnect/Implementation/ReceiverConnection.h"
 #include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/XxHash3.h"
 
 namespace Corrade { namespace Interconnect {
 
 namespace Implementation {
 
+std::size_t SignalDataHash::operator()(const SignalData& data) const {
+    return Utility::Implementation::xxHash3(reinterpret_cast<const char*>(data.data), sizeof(data.data), 0);
+}
+
 ConnectionData::ConnectionData(ConnectionData&& other) noexcept:
     storage(other.storage), /* GCC 4.8 needs () */
     call{other.call},
@@ -80,8 +86,11 @@ Implementation::ConnectionData& Emitter::connectInternal(const Implementation::S
     _connectionsChanged = true;
 
     /* Add connection to receiver, if this is member function connection */
-    if(data.type == Implementation::ConnectionType::Member)
-        out.storage.member.receiver->_connections.emplace_back(*this, signal, out);
+    if(data.type == Implementation::ConnectionType::Member) {
+        Receiver& receiver = *out.storage.member.receiver;
+        if(!receiver._state) receiver._state.emplace();
+        arrayAppend(receiver._state->connections, Containers::InPlaceInit, *this, signal, out);
+    }
 
     /* Return reference to the final position */
     return out;
@@ -107,11 +116,14 @@ void Emitter::disconnectAllSignals() {
 void Emitter::disconnectFromReceiver(const Implementation::ConnectionData& data) {
     if(data.type != Implementation::ConnectionType::Member) return;
 
-    auto& receiverConnections = data.storage.member.receiver->_connections;
-    for(auto end = receiverConnections.end(), rit = receiverConnections.begin(); rit != end; ++rit) {
-        if(&*rit->data != &data) continue;
+    Containers::SmallArray<2, Implementation::ReceiverConnection>& receiverConnections = data.storage.member.receiver->_state->connections;
+    for(Implementation::ReceiverConnection& connection: receiverConnections) {
+        if(&*connection.data != &data) continue;
 
-        receiverConnections.erase(rit);
+        /* The order doesn't matter, so replacing the removed connection with
+           the last one instead of shifting everything after */
+        connection = receiverConnections.back();
+        arrayRemoveSuffix(receiverConnections);
         return;
     }
 
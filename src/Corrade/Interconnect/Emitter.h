@@ -49,13 +49,11 @@ template<class T> struct Identity {
     typedef T Type;
 };
 
-struct SignalDataHash {
-    std::size_t operator()(const SignalData& data) const {
-        std::size_t hash = 0;
-        for(std::size_t i = 0; i != FunctionPointerSize; ++i)
-            hash ^= data.data[i];
-        return hash;
-    }
+/* Hashes the whole member function pointer representation with XXH3, which
+   unlike XORing the words together doesn't lose bits of the this-adjustment
+   or virtual table offset */
+struct CORRADE_INTERCONNECT_EXPORT SignalDataHash {
+    std::size_t operator()(const SignalData& data) const;
 };
 
 enum class ConnectionType: std::uint8_t {
@@ -26,7 +26,9 @@
 */
 
 #include "Corrade/Containers/Reference.h"
+#include "Corrade/Containers/SmallArray.h"
 #include "Corrade/Interconnect/Connection.h"
+#include "Corrade/Interconnect/Receiver.h"
 
 namespace Corrade { namespace Interconnect { namespace Implementation {
 
@@ -38,6 +40,14 @@ struct ReceiverConnection {
     Containers::Reference<Implementation::ConnectionData> data;
 };
 
-}}}
+}
+
+struct Receiver::State {
+    /* Most receivers are connected to just a few signals, so the first two
+       connections are stored inline */
+    Containers::SmallArray<2, Implementation::ReceiverConnection> connections;
+};
+
+}}
 
 #endif
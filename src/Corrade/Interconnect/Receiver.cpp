@@ -25,7 +25,6 @@
 
 #include "Receiver.h"
 
-#include "Corrade/Interconnect/Connection.h"
 #include "Corrade/Interconnect/Emitter.h"
 #include "Corrade/Interconnect/Implementation/ReceiverConnection.h"
 #include "Corrade/Utility/Assert.h"
@@ -36,12 +35,15 @@ Receiver::Receiver() = default;
 
 Receiver::~Receiver() { disconnectAllSlots(); }
 
-bool Receiver::hasSlotConnections() const { return !_connections.empty(); }
+bool Receiver::hasSlotConnections() const { return _state && !_state->connections.empty(); }
 
-std::size_t Receiver::slotConnectionCount() const { return _connections.size(); }
+std::size_t Receiver::slotConnectionCount() const { return _state ? _state->connections.size() : 0; }
 
 void Receiver::disconnectAllSlots() {
-    for(Implementation::ReceiverConnection& connection: _connections) {
+    if(!_state) return;
+
+    Containers::SmallArray<2, Implementation::ReceiverConnection>& connections = _state->connections;
+    for(Implementation::ReceiverConnection& connection: connections) {
         auto range = connection.emitter->_connections.equal_range(connection.signal);
         for(auto it = range.first; it != range.second; ++it) {
             if(&it->second != &*connection.data) continue;
@@ -52,7 +54,7 @@ void Receiver::disconnectAllSlots() {
         }
     }
 
-    _connections.clear();
+    arrayRemoveSuffix(connections, connections.size());
 }
 
 }}
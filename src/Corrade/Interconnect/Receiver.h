@@ -30,15 +30,13 @@
  */
 
 #include <cstddef>
-#include <vector>
 
+#include "Corrade/Containers/Pointer.h"
 #include "Corrade/Interconnect/Interconnect.h"
 #include "Corrade/Interconnect/visibility.h"
 
 namespace Corrade { namespace Interconnect {
 
-namespace Implementation { struct ReceiverConnection; }
-
 /**
 @brief Receiver object
 
@@ -99,7 +97,11 @@ class CORRADE_INTERCONNECT_EXPORT Receiver {
         friend Emitter;
         #endif
 
-        std::vector<Implementation::ReceiverConnection> _connections;
+        struct State;
+
+        /* Allocated on first connection, so unconnected receivers don't
+           allocate anything */
+        Containers::Pointer<State> _state;
 };
 
 }}
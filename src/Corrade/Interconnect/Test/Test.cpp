@@ -25,6 +25,7 @@
 
 #include <functional>
 #include <sstream>
+#include <vector>
 
 #include "Corrade/Interconnect/Emitter.h"
 #include "Corrade/Interconnect/Receiver.h"
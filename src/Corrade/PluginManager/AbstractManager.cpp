@@ -28,12 +28,12 @@
 #include <cstring>
 #include <algorithm>
 #include <functional>
-#include <map>
 #include <set>
 #include <sstream>
 #include <utility>
 
 #include "Corrade/Containers/EnumSet.hpp"
+#include "Corrade/Containers/FlatMap.h"
 #include "Corrade/Containers/Optional.h"
 #include "Corrade/Containers/Reference.h"
 #include "Corrade/Containers/Implementation/RawForwardList.h"
@@ -139,8 +139,10 @@ struct AbstractManager::State {
     #endif
     std::string pluginMetadataSuffix;
 
-    std::map<std::string, Containers::Pointer<Plugin>> plugins;
-    std::map<std::string, Plugin&> aliases;
+    /* Sorted arrays, lookups are a binary search without any per-node
+       allocation. Iteration order is the same as with a std::map. */
+    Containers::FlatMap<std::string, Containers::Pointer<Plugin>> plugins;
+    Containers::FlatMap<std::string, Containers::Reference<Plugin>> aliases;
 
     #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
     std::set<AbstractManager*> externalManagers;
@@ -262,29 +264,19 @@ AbstractManager::AbstractManager(std::string pluginInterface, std::string plugin
         /* Insert the plugin into our list. The names should be globally
            unique, so the insertion is expected to always succeed (if it
            wouldn't, we would have a leak here). */
-        const auto inserted = _state->plugins.emplace(staticPlugin->plugin, Containers::pointer(new Plugin{*staticPlugin, std::move(configuration)}));
-        CORRADE_INTERNAL_ASSERT(inserted.second);
-        Plugin& p = *inserted.first->second;
+        CORRADE_INTERNAL_ASSERT(!_state->plugins.contains(staticPlugin->plugin));
+        Plugin& p = *_state->plugins.emplace(staticPlugin->plugin, Containers::pointer(new Plugin{*staticPlugin, std::move(configuration)}));
 
         p.staticPlugin->initializer();
 
         /* The plugin is the best version of itself. If there was already
            an alias for this name, replace it. */
-        {
-            const auto alias = _state->aliases.find(inserted.first->first);
-            if(alias != _state->aliases.end()) _state->aliases.erase(alias);
-            CORRADE_INTERNAL_ASSERT_OUTPUT(_state->aliases.insert({inserted.first->first, p}).second);
-        }
+        _state->aliases.set(staticPlugin->plugin, p);
 
         /* Add aliases to the list (only the ones that aren't already there
            are added) */
-        for(const std::string& alias: p.metadata._provides) {
-            /* Libc++ frees the passed Plugin& reference when using
-               emplace(), causing double-free memory corruption later.
-               Everything is okay with insert(). */
-            /** @todo put back emplace() here when libc++ is fixed */
-            _state->aliases.insert({alias, p});
-        }
+        for(const std::string& alias: p.metadata._provides)
+            _state->aliases.emplace(alias, p);
     }
 
     #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
@@ -309,7 +301,7 @@ AbstractManager::AbstractManager(std::string pluginInterface, std::string plugin
            CorradeUtility.dll as a plugin. Don't print the warning in case
            we have static plugins (the aliases are non-empty) -- in that case
            assume the user might want to only use static plugins. */
-        if(_state->pluginDirectory.empty() && _state->aliases.empty())
+        if(_state->pluginDirectory.empty() && _state->aliases.isEmpty())
             Warning{} << "PluginManager::Manager::Manager(): none of the plugin search paths in" << pluginSearchPaths << "exists and pluginDirectory was not set, skipping plugin discovery";
     }
     #endif
@@ -338,15 +330,15 @@ AbstractManager::~AbstractManager() {
     #endif
 
     /* Unload all plugins */
-    for(std::pair<const std::string, Containers::Pointer<Plugin>>& plugin: _state->plugins) {
+    for(Containers::Pointer<Plugin>& plugin: _state->plugins.values()) {
         #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
         /* Try to unload the plugin (and all plugins that depend on it) */
-        unloadRecursiveInternal(*plugin.second);
+        unloadRecursiveInternal(*plugin);
         #endif
 
         /* Finalize static plugins before they get removed from the list */
-        if(plugin.second->loadState == LoadState::Static)
-            plugin.second->staticPlugin->finalizer();
+        if(plugin->loadState == LoadState::Static)
+            plugin->staticPlugin->finalizer();
     }
 }
 
@@ -358,9 +350,9 @@ LoadState AbstractManager::unloadRecursiveInternal(Plugin& plugin) {
        external dependencies, so everything the usedBy list is in this manager
        as well */
     while(!plugin.metadata._usedBy.empty()) {
-        const auto found = _state->plugins.find(plugin.metadata._usedBy.front());
-        CORRADE_INTERNAL_ASSERT(found != _state->plugins.end());
-        return unloadRecursiveInternal(*found->second);
+        Containers::Pointer<Plugin>* const found = _state->plugins.find(plugin.metadata._usedBy.front());
+        CORRADE_INTERNAL_ASSERT(found);
+        return unloadRecursiveInternal(**found);
     }
 
     /* Unload the plugin */
@@ -384,19 +376,15 @@ void AbstractManager::setPluginDirectory(std::string directory) {
 
     /* Remove aliases for unloaded plugins from the container. They need to be
        removed before plugins themselves */
-    auto ait = _state->aliases.cbegin();
-    while(ait != _state->aliases.cend()) {
-        if(ait->second.loadState & (LoadState::NotLoaded|LoadState::WrongMetadataFile))
-            ait = _state->aliases.erase(ait);
-        else ++ait;
+    for(std::size_t i = _state->aliases.size(); i != 0; --i) {
+        if(_state->aliases.values()[i - 1]->loadState & (LoadState::NotLoaded|LoadState::WrongMetadataFile))
+            _state->aliases.removeAt(i - 1);
     }
 
     /* Remove all unloaded plugins from the container */
-    auto it = _state->plugins.cbegin();
-    while(it != _state->plugins.cend()) {
-        if(it->second->loadState & (LoadState::NotLoaded|LoadState::WrongMetadataFile))
-            it = _state->plugins.erase(it);
-        else ++it;
+    for(std::size_t i = _state->plugins.size(); i != 0; --i) {
+        if(_state->plugins.values()[i - 1]->loadState & (LoadState::NotLoaded|LoadState::WrongMetadataFile))
+            _state->plugins.removeAt(i - 1);
     }
 
     /* Find plugin files in the directory. Sort the list so we have predictable
@@ -414,7 +402,7 @@ void AbstractManager::setPluginDirectory(std::string directory) {
         const std::string name = filename.substr(0, filename.length() - _state->pluginSuffix.size());
 
         /* Skip the plugin if it is among loaded */
-        if(_state->plugins.find(name) != _state->plugins.end()) continue;
+        if(_state->plugins.contains(name)) continue;
 
         registerDynamicPlugin(name, Containers::pointer(new Plugin{name,
             _state->pluginMetadataSuffix.empty() ? std::string{} :
@@ -424,16 +412,11 @@ void AbstractManager::setPluginDirectory(std::string directory) {
     /* If some of the currently loaded plugins aliased plugins that were in the
        old plugin directory, these are no longer there. Refresh the alias list
        with the new plugins. */
-    for(std::pair<const std::string, Containers::Pointer<Plugin>>& p: _state->plugins) {
+    for(Containers::Pointer<Plugin>& p: _state->plugins.values()) {
         /* Add aliases to the list (only the ones that aren't already there are
-           added, calling insert() won't overwrite the existing value) */
-        for(const std::string& alias: p.second->metadata._provides) {
-            /* Libc++ frees the passed Plugin& reference when using emplace(),
-               causing double-free memory corruption later. Everything is okay
-               with insert(). */
-            /** @todo put back emplace() here when libc++ is fixed */
-            _state->aliases.insert({alias, *p.second});
-        }
+           added, calling emplace() won't overwrite the existing value) */
+        for(const std::string& alias: p->metadata._provides)
+            _state->aliases.emplace(alias, *p);
     }
 }
 
@@ -443,54 +426,55 @@ void AbstractManager::reloadPluginDirectory() {
 #endif
 
 void AbstractManager::setPreferredPlugins(const std::string& alias, const std::initializer_list<std::string> plugins) {
-    auto foundAlias = _state->aliases.find(alias);
-    CORRADE_ASSERT(foundAlias != _state->aliases.end(),
+    Containers::Reference<Plugin>* const foundAlias = _state->aliases.find(alias);
+    CORRADE_ASSERT(foundAlias,
         "PluginManager::Manager::setPreferredPlugins():" << alias << "is not a known alias", );
 
     /* Replace the alias with the first candidate that exists */
     for(const std::string& plugin: plugins) {
-        auto foundPlugin = _state->plugins.find(plugin);
-        if(foundPlugin == _state->plugins.end())
+        Containers::Pointer<Plugin>* const foundPlugin = _state->plugins.find(plugin);
+        if(!foundPlugin)
             continue;
 
-        CORRADE_ASSERT(std::find(foundPlugin->second->metadata.provides().begin(), foundPlugin->second->metadata.provides().end(), alias) != foundPlugin->second->metadata.provides().end(),
+        CORRADE_ASSERT(std::find((*foundPlugin)->metadata.provides().begin(), (*foundPlugin)->metadata.provides().end(), alias) != (*foundPlugin)->metadata.provides().end(),
             "PluginManager::Manager::setPreferredPlugins():" << plugin << "does not provide" << alias, );
-        _state->aliases.erase(foundAlias);
-        _state->aliases.insert({alias, *foundPlugin->second});
+        *foundAlias = **foundPlugin;
         break;
     }
 }
 
 std::vector<std::string> AbstractManager::pluginList() const {
     std::vector<std::string> names;
-    for(const std::pair<const std::string, Containers::Pointer<Plugin>>& plugin: _state->plugins)
-        names.push_back(plugin.first);
+    names.reserve(_state->plugins.size());
+    for(const std::string& plugin: _state->plugins.keys())
+        names.push_back(plugin);
     return names;
 }
 
 std::vector<std::string> AbstractManager::aliasList() const {
     std::vector<std::string> names;
-    for(const auto& alias: _state->aliases) names.push_back(alias.first);
+    names.reserve(_state->aliases.size());
+    for(const std::string& alias: _state->aliases.keys()) names.push_back(alias);
     return names;
 }
 
 const PluginMetadata* AbstractManager::metadata(const std::string& plugin) const {
-    auto found = _state->aliases.find(plugin);
-    if(found != _state->aliases.end()) return &found->second.metadata;
+    const Containers::Reference<Plugin>* const found = _state->aliases.find(plugin);
+    if(found) return &(*found)->metadata;
 
     return nullptr;
 }
 
 PluginMetadata* AbstractManager::metadata(const std::string& plugin) {
-    auto found = _state->aliases.find(plugin);
-    if(found != _state->aliases.end()) return &found->second.metadata;
+    const Containers::Reference<Plugin>* const found = _state->aliases.find(plugin);
+    if(found) return &(*found)->metadata;
 
     return nullptr;
 }
 
 LoadState AbstractManager::loadState(const std::string& plugin) const {
-    auto found = _state->aliases.find(plugin);
-    if(found != _state->aliases.end()) return found->second.loadState;
+    const Containers::Reference<Plugin>* const found = _state->aliases.find(plugin);
+    if(found) return (*found)->loadState;
 
     return LoadState::NotFound;
 }
@@ -502,8 +486,8 @@ LoadState AbstractManager::load(const std::string& plugin) {
         /* Dig plugin name from filename and verify it's not loaded at the moment */
         const std::string filename = Utility::Directory::filename(plugin);
         const std::string name = filename.substr(0, filename.length() - _state->pluginSuffix.size());
-        const auto found = _state->plugins.find(name);
-        if(found != _state->plugins.end() && (found->second->loadState & LoadState::Loaded)) {
+        const std::size_t found = _state->plugins.findIndex(name);
+        if(found != _state->plugins.size() && (_state->plugins.values()[found]->loadState & LoadState::Loaded)) {
             Error{} << "PluginManager::load():" << filename << "conflicts with currently loaded plugin of the same name";
             return LoadState::Used;
         }
@@ -518,18 +502,16 @@ LoadState AbstractManager::load(const std::string& plugin) {
         if(state & LoadState::Loaded) {
             /* Remove the potential plugin with the same name (we already
                checked above that it's *not* loaded) */
-            if(found != _state->plugins.end()) {
+            if(found != _state->plugins.size()) {
                 /* Erase all aliases that reference this plugin, as they would
                    be dangling now. */
-                auto ait = _state->aliases.cbegin();
-                while(ait != _state->aliases.cend()) {
-                    if(&ait->second == found->second.get())
-                        ait = _state->aliases.erase(ait);
-                    else ++ait;
+                for(std::size_t i = _state->aliases.size(); i != 0; --i) {
+                    if(&*_state->aliases.values()[i - 1] == _state->plugins.values()[found].get())
+                        _state->aliases.removeAt(i - 1);
                 }
 
                 /* Erase the plugin from the plugin map */
-                _state->plugins.erase(found);
+                _state->plugins.removeAt(found);
             }
 
             registerDynamicPlugin(name, std::move(data));
@@ -538,12 +520,12 @@ LoadState AbstractManager::load(const std::string& plugin) {
     }
     #endif
 
-    auto found = _state->aliases.find(plugin);
-    if(found != _state->aliases.end()) {
+    Containers::Reference<Plugin>* const found = _state->aliases.find(plugin);
+    if(found) {
         #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        return loadInternal(found->second);
+        return loadInternal(**found);
         #else
-        return found->second.loadState;
+        return (*found)->loadState;
         #endif
     }
 
@@ -577,23 +559,23 @@ LoadState AbstractManager::loadInternal(Plugin& plugin, const std::string& filen
         /* If the dependency is not in our plugin manager, check the registered
            external managers as well */
         AbstractManager* dependencyManager = nullptr;
-        auto foundDependency = _state->plugins.find(dependency);
-        if(foundDependency != _state->plugins.end())
+        Containers::Pointer<Plugin>* foundDependency = _state->plugins.find(dependency);
+        if(foundDependency)
             dependencyManager = this;
         else for(AbstractManager* other: _state->externalManagers) {
             foundDependency = other->_state->plugins.find(dependency);
-            if(foundDependency != other->_state->plugins.end()) {
+            if(foundDependency) {
                 dependencyManager = other;
                 break;
             }
         }
 
-        if(!dependencyManager || !(dependencyManager->loadInternal(*foundDependency->second) & LoadState::Loaded)) {
+        if(!dependencyManager || !(dependencyManager->loadInternal(**foundDependency) & LoadState::Loaded)) {
             Error() << "PluginManager::Manager::load(): unresolved dependency" << dependency << "of plugin" << plugin.metadata._name;
             return LoadState::UnresolvedDependency;
         }
 
-        dependencies.emplace_back(*foundDependency->second);
+        dependencies.emplace_back(**foundDependency);
     }
 
     /* Open plugin file, make symbols globally available for next libs (which
@@ -793,12 +775,12 @@ LoadState AbstractManager::loadInternal(Plugin& plugin, const std::string& filen
 #endif
 
 LoadState AbstractManager::unload(const std::string& plugin) {
-    auto found = _state->aliases.find(plugin);
-    if(found != _state->aliases.end()) {
+    Containers::Reference<Plugin>* const found = _state->aliases.find(plugin);
+    if(found) {
         #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        return unloadInternal(found->second);
+        return unloadInternal(**found);
         #else
-        return found->second.loadState;
+        return (*found)->loadState;
         #endif
     }
 
@@ -847,13 +829,13 @@ LoadState AbstractManager::unloadInternal(Plugin& plugin) {
        in this manager, try in registered external managers. */
     for(auto it = plugin.metadata.depends().cbegin(); it != plugin.metadata.depends().cend(); ++it) {
         Plugin* dependency = nullptr;
-        auto foundDependency = _state->plugins.find(*it);
-        if(foundDependency != _state->plugins.end())
-            dependency = foundDependency->second.get();
+        Containers::Pointer<Plugin>* foundDependency = _state->plugins.find(*it);
+        if(foundDependency)
+            dependency = foundDependency->get();
         else for(AbstractManager* other: _state->externalManagers) {
             foundDependency = other->_state->plugins.find(*it);
-            if(foundDependency != other->_state->plugins.end()) {
-                dependency = foundDependency->second.get();
+            if(foundDependency) {
+                dependency = foundDependency->get();
                 break;
             }
         }
@@ -915,58 +897,49 @@ void AbstractManager::registerExternalManager(AbstractManager& manager) {
 
 void AbstractManager::registerDynamicPlugin(const std::string& name, Containers::Pointer<Plugin>&& plugin) {
     /* Insert plugin to list */
-    const auto result = _state->plugins.emplace(name, std::move(plugin));
-    CORRADE_INTERNAL_ASSERT(result.second);
+    CORRADE_INTERNAL_ASSERT(!_state->plugins.contains(name));
+    Plugin& p = *_state->plugins.emplace(name, std::move(plugin));
 
     /* The plugin is the best version of itself. If there was already an
        alias for this name, replace it. */
-    {
-        const auto alias = _state->aliases.find(name);
-        if(alias != _state->aliases.end()) _state->aliases.erase(alias);
-        CORRADE_INTERNAL_ASSERT_OUTPUT(_state->aliases.insert({name, *result.first->second}).second);
-    }
+    _state->aliases.set(name, p);
 
-    /* Add aliases to the list. Calling insert() won't overwrite the
+    /* Add aliases to the list. Calling emplace() won't overwrite the
        existing value, which ensures that the above note is still held. */
-    for(const std::string& alias: result.first->second->metadata._provides) {
-        /* Libc++ frees the passed Plugin& reference when using emplace(),
-           causing double-free memory corruption later. Everything is okay
-           with insert(). */
-        /** @todo put back emplace() here when libc++ is fixed */
-        _state->aliases.insert({alias, *result.first->second});
-    }
+    for(const std::string& alias: p.metadata._provides)
+        _state->aliases.emplace(alias, p);
 }
 
 void AbstractManager::registerInstance(const std::string& plugin, AbstractPlugin& instance, const PluginMetadata*& metadata) {
     /** @todo assert proper interface */
-    auto found = _state->aliases.find(plugin);
-    CORRADE_ASSERT(found != _state->aliases.end(),
+    Containers::Reference<Plugin>* const found = _state->aliases.find(plugin);
+    CORRADE_ASSERT(found,
         "PluginManager::AbstractPlugin::AbstractPlugin(): attempt to register instance of plugin not known to given manager", );
 
-    found->second.instances.push_back(&instance);
-    metadata = &found->second.metadata;
+    (*found)->instances.push_back(&instance);
+    metadata = &(*found)->metadata;
 }
 
 void AbstractManager::reregisterInstance(const std::string& plugin, AbstractPlugin& oldInstance, AbstractPlugin* const newInstance) {
-    auto found = _state->aliases.find(plugin);
-    CORRADE_INTERNAL_ASSERT(found != _state->aliases.end());
+    Containers::Reference<Plugin>* const found = _state->aliases.find(plugin);
+    CORRADE_INTERNAL_ASSERT(found);
 
-    auto pos = std::find(found->second.instances.begin(), found->second.instances.end(), &oldInstance);
-    CORRADE_INTERNAL_ASSERT(pos != found->second.instances.end());
+    auto pos = std::find((*found)->instances.begin(), (*found)->instances.end(), &oldInstance);
+    CORRADE_INTERNAL_ASSERT(pos != (*found)->instances.end());
 
     /* If the plugin is being moved, replace the instance pointer. Otherwise
        remove it from the list, and if the list is empty, delete it fully. */
     if(newInstance) *pos = newInstance;
-    else found->second.instances.erase(pos);
+    else (*found)->instances.erase(pos);
 }
 
 Containers::Pointer<AbstractPlugin> AbstractManager::instantiateInternal(const std::string& plugin) {
-    auto found = _state->aliases.find(plugin);
+    Containers::Reference<Plugin>* const found = _state->aliases.find(plugin);
 
-    CORRADE_ASSERT(found != _state->aliases.end() && (found->second.loadState & LoadState::Loaded),
+    CORRADE_ASSERT(found && ((*found)->loadState & LoadState::Loaded),
         "PluginManager::Manager::instantiate(): plugin" << plugin << "is not loaded", nullptr);
 
-    return Containers::pointer(static_cast<AbstractPlugin*>(found->second.instancer(*this, plugin)));
+    return Containers::pointer(static_cast<AbstractPlugin*>((*found)->instancer(*this, plugin)));
 }
 
 Containers::Pointer<AbstractPlugin> AbstractManager::loadAndInstantiateInternal(const std::string& plugin) {
@@ -977,15 +950,15 @@ Containers::Pointer<AbstractPlugin> AbstractManager::loadAndInstantiateInternal(
     if(Utility::String::endsWith(plugin, _state->pluginSuffix)) {
         const std::string filename = Utility::Directory::filename(plugin);
         const std::string name = filename.substr(0, filename.length() - _state->pluginSuffix.size());
-        auto found = _state->aliases.find(name);
-        CORRADE_INTERNAL_ASSERT(found != _state->aliases.end());
-        return Containers::pointer(static_cast<AbstractPlugin*>(found->second.instancer(*this, name)));
+        Containers::Reference<Plugin>* const found = _state->aliases.find(name);
+        CORRADE_INTERNAL_ASSERT(found);
+        return Containers::pointer(static_cast<AbstractPlugin*>((*found)->instancer(*this, name)));
     }
     #endif
 
-    auto found = _state->aliases.find(plugin);
-    CORRADE_INTERNAL_ASSERT(found != _state->aliases.end());
-    return Containers::pointer(static_cast<AbstractPlugin*>(found->second.instancer(*this, plugin)));
+    Containers::Reference<Plugin>* const found = _state->aliases.find(plugin);
+    CORRADE_INTERNAL_ASSERT(found);
+    return Containers::pointer(static_cast<AbstractPlugin*>((*found)->instancer(*this, plugin)));
 }
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
@@ -240,6 +240,18 @@ void TargetTest::simd() {
     Debug{&out} << "CORRADE_TARGET_SSE2";
     #endif
 
+    #ifdef CORRADE_TARGET_SSSE3
+    Debug{&out} << "CORRADE_TARGET_SSSE3";
+    #endif
+
+    #ifdef CORRADE_TARGET_AVX2
+    Debug{&out} << "CORRADE_TARGET_AVX2";
+    #endif
+
+    #ifdef CORRADE_TARGET_NEON
+    Debug{&out} << "CORRADE_TARGET_NEON";
+    #endif
+
     Debug{Debug::Flag::NoNewlineAtTheEnd} << out.str();
     if(out.str().empty()) Debug{} << "No suitable CORRADE_TARGET_* defined";
     CORRADE_VERIFY(true);
@@ -25,10 +25,28 @@
 
 #include "Algorithms.h"
 
+#include <cstdlib>
 #include <cstring>
+#include <type_traits>
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
 /* CORRADE_FALLTHROUGH, needed on Clang when CORRADE_NO_ASSERT is defined */
 #include <Corrade/Utility/Macros.h>
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include "Corrade/Containers/Array.h"
+#endif
+#include "Corrade/Utility/Cpu.h"
+#include "Corrade/Utility/Implementation/algorithms.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef CORRADE_ENABLE_AVX2
+#include <immintrin.h>
+#endif
+
 namespace Corrade { namespace Utility {
 
 /* I might be going a bit overboard with the avoidance of inline function calls
@@ -41,6 +59,64 @@ namespace Corrade { namespace Utility {
    OTOH the ArrayView overhead can delegate directly to a memcpy, so for code
    size savings it shouldn't be handled in the complex stride-aware code. */
 
+namespace {
+
+/* Tile size in elements. With 32x32 tiles and elements up to 16 bytes, the
+   source and destination tile together take 32 kB at most, which fits into
+   L1 on most current CPUs. */
+constexpr std::size_t CopyTileSize = 32;
+
+/* The fixed-size memcpy() compiles down to a single load and store (two for
+   12 and 16 bytes) on all relevant compilers, which is significantly faster than
+   calling memcpy() or looping byte-by-byte for each element. */
+template<std::size_t elementSize> void copyElementTile(const char* const srcPtr, char* const dstPtr, const std::size_t size1, const std::size_t size2, const std::ptrdiff_t srcStride1, const std::ptrdiff_t srcStride2, const std::ptrdiff_t dstStride1, const std::ptrdiff_t dstStride2) {
+    for(std::size_t i1 = 0; i1 != size1; ++i1) {
+        const char* srcPtr1 = srcPtr + i1*srcStride1;
+        char* dstPtr1 = dstPtr + i1*dstStride1;
+        for(std::size_t i2 = 0; i2 != size2; ++i2)
+            std::memcpy(dstPtr1 + i2*dstStride2,
+                        srcPtr1 + i2*srcStride2, elementSize);
+    }
+}
+
+/* Copies a 3D view of elements of given size. If the innermost dimension
+   isn't accessed linearly in either of the views (such as with a transposed
+   view), going row by row would mean touching a different cache line and
+   often a different page for every element, so the last two dimensions are
+   split into tiles that stay in cache for the whole time they're copied. */
+template<std::size_t elementSize> void copyElements(const char* const srcPtr, char* const dstPtr, const std::size_t* const size, const std::ptrdiff_t* const srcStride, const std::ptrdiff_t* const dstStride) {
+    const bool tiled = size[1] > CopyTileSize && size[2] > CopyTileSize &&
+        (std::size_t(std::abs(srcStride[2])) != elementSize ||
+         std::size_t(std::abs(dstStride[2])) != elementSize);
+
+    for(std::size_t i0 = 0; i0 != size[0]; ++i0) {
+        const char* srcPtr0 = srcPtr + i0*srcStride[0];
+        char* dstPtr0 = dstPtr + i0*dstStride[0];
+
+        if(!tiled) {
+            copyElementTile<elementSize>(srcPtr0, dstPtr0, size[1], size[2],
+                srcStride[1], srcStride[2], dstStride[1], dstStride[2]);
+            continue;
+        }
+
+        for(std::size_t j1 = 0; j1 < size[1]; j1 += CopyTileSize) {
+            const std::size_t tileSize1 = size[1] - j1 < CopyTileSize ?
+                size[1] - j1 : CopyTileSize;
+            for(std::size_t j2 = 0; j2 < size[2]; j2 += CopyTileSize) {
+                const std::size_t tileSize2 = size[2] - j2 < CopyTileSize ?
+                    size[2] - j2 : CopyTileSize;
+                copyElementTile<elementSize>(
+                    srcPtr0 + j1*srcStride[1] + j2*srcStride[2],
+                    dstPtr0 + j1*dstStride[1] + j2*dstStride[2],
+                    tileSize1, tileSize2,
+                    srcStride[1], srcStride[2], dstStride[1], dstStride[2]);
+            }
+        }
+    }
+}
+
+}
+
 void copy(const Containers::ArrayView<const void>& src, const Containers::ArrayView<void>& dst) {
     const std::size_t srcSize = src.size();
     #ifndef CORRADE_NO_ASSERT
@@ -164,10 +240,41 @@ void copy(const Containers::StridedArrayView4D<const char>& src, const Container
                                     srcPtr0 + i1*srcStride[1], size23);
                 }
             } else {
-                /* On Clang, for smaller sizes in the last dimension we prefer
-                   Duff's device. The size is chosen based on the benchmark in
-                   the test, might need to adjust for different platforms. For
-                   Clang on Mac, copyBenchmark3DNonContiguous() numbers:
+                /* If the last dimension is contiguous and has a size of 1,
+                   2, 4, 8, 12 or 16 bytes, it's an element of a typed view
+                   (or a view of a type that can be copied the same way) and
+                   gets copied using a dedicated kernel. If the last dimension
+                   isn't contiguous and the first dimension has a size of one
+                   (which is always the case for the 1D, 2D and 3D overloads),
+                   it's a view on single bytes, which can be handled by a
+                   dedicated kernel as well. */
+                void(*copyElementsImplementation)(const char*, char*, const std::size_t*, const std::ptrdiff_t*, const std::ptrdiff_t*) = nullptr;
+                std::size_t elementDimensionOffset = 0;
+                if(src.isContiguous<3>() && dst.isContiguous<3>()) switch(size[3]) {
+                    case 1: copyElementsImplementation = copyElements<1>; break;
+                    case 2: copyElementsImplementation = copyElements<2>; break;
+                    case 4: copyElementsImplementation = copyElements<4>; break;
+                    case 8: copyElementsImplementation = copyElements<8>; break;
+                    /* Three-component float vectors, common in vertex data */
+                    case 12: copyElementsImplementation = copyElements<12>; break;
+                    case 16: copyElementsImplementation = copyElements<16>; break;
+                } else if(size[0] == 1) {
+                    copyElementsImplementation = copyElements<1>;
+                    elementDimensionOffset = 1;
+                }
+
+                if(copyElementsImplementation) copyElementsImplementation(
+                    srcPtr, dstPtr,
+                    size + elementDimensionOffset,
+                    srcStride + elementDimensionOffset,
+                    dstStride + elementDimensionOffset);
+
+                /* For the remaining sizes, on Clang, for smaller sizes in the
+                   last dimension we prefer Duff's device. The size is chosen
+                   based on the benchmark in the test, might need to adjust
+                   for different platforms. For Clang on Mac,
+                   copyBenchmark3DNonContiguous() numbers before the
+                   dedicated kernels above were added:
 
                     bytes   memcpy  loop    duff
                     ------- ------- ------- -----
@@ -178,7 +285,7 @@ void copy(const Containers::StridedArrayView4D<const char>& src, const Container
                    It becomes slightly worse in Debug (but not slower than a
                    hand-written loop using operator[], so I think that's still
                    acceptable). OTOH, GCC is slower with Duff in both Debug and Release, so there we use the loop instead. */
-                if(src.isContiguous<3>() && dst.isContiguous<3>() && size[3] >= 8) {
+                else if(src.isContiguous<3>() && dst.isContiguous<3>() && size[3] >= 8) {
                     for(std::size_t i0 = 0; i0 != size[0]; ++i0) {
                         const char* srcPtr0 = srcPtr + i0*srcStride[0];
                         char* dstPtr0 = dstPtr + i0*dstStride[0];
@@ -251,4 +358,760 @@ void copy(const Containers::StridedArrayView4D<const char>& src, const Container
     }
 }
 
+namespace {
+
+/* Minimal amount of bytes a thread should copy in the parallel copy(), below
+   that the thread creation overhead outweighs the gains */
+constexpr std::size_t ParallelCopyMinBytesPerThread = 1024*1024;
+
+template<unsigned dimensions> void copyParallel(const Containers::StridedArrayView<dimensions, const char>& src, const Containers::StridedArrayView<dimensions, char>& dst, std::size_t threadCount) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Utility::Algorithms::copy(): sizes" << src.size() << "and" << dst.size() << "don't match", );
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    const Containers::StridedDimensions<dimensions, std::size_t> size = src.size();
+    std::size_t byteCount = 1;
+    for(std::size_t i = 0; i != dimensions; ++i) byteCount *= size[i];
+
+    /* There's no point in having more threads than slices in the outermost
+       dimension or than there's data to copy */
+    if(!threadCount) threadCount = std::thread::hardware_concurrency();
+    if(threadCount > size[0]) threadCount = size[0];
+    if(threadCount > byteCount/ParallelCopyMinBytesPerThread)
+        threadCount = byteCount/ParallelCopyMinBytesPerThread;
+
+    if(threadCount > 1) {
+        /* The last slice is copied on the calling thread */
+        Containers::Array<std::thread> threads{threadCount - 1};
+        for(std::size_t i = 0; i != threads.size(); ++i) {
+            const std::size_t begin = size[0]*i/threadCount;
+            const std::size_t end = size[0]*(i + 1)/threadCount;
+            threads[i] = std::thread{[&src, &dst, begin, end]() {
+                copy(src.slice(begin, end), dst.slice(begin, end));
+            }};
+        }
+
+        const std::size_t begin = size[0]*(threadCount - 1)/threadCount;
+        copy(src.suffix(begin), dst.suffix(begin));
+
+        for(std::thread& thread: threads) thread.join();
+        return;
+    }
+    #else
+    static_cast<void>(threadCount);
+    #endif
+
+    copy(src, dst);
+}
+
+}
+
+void copy(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<char>& dst, const std::size_t threadCount) {
+    copyParallel(src, dst, threadCount);
+}
+
+void copy(const Containers::StridedArrayView3D<const char>& src, const Containers::StridedArrayView3D<char>& dst, const std::size_t threadCount) {
+    copyParallel(src, dst, threadCount);
+}
+
+void copy(const Containers::StridedArrayView4D<const char>& src, const Containers::StridedArrayView4D<char>& dst, const std::size_t threadCount) {
+    copyParallel(src, dst, threadCount);
+}
+
+namespace {
+
+/* Scalar variants of the kernels declared in Implementation/algorithms.h,
+   also used for the remainder that didn't fit into a full SIMD block. Same as
+   elsewhere, the fixed-size memcpy() compiles down to a plain load and
+   store. */
+template<std::size_t size> inline void fillScalar(char* dst, char* const end, const char* const value) {
+    for(; dst != end; dst += size)
+        std::memcpy(dst, value, size);
+}
+
+template<std::size_t size, class I> inline void gatherScalar(const char* const src, const I* indices, char* dst, char* const end) {
+    for(; dst != end; dst += size, ++indices)
+        std::memcpy(dst, src + std::size_t(*indices)*size, size);
+}
+
+template<std::size_t size> inline void interleaveScalar(const char* src, const char* const end, char* dst, const std::ptrdiff_t dstStride) {
+    for(; src != end; src += size, dst += dstStride)
+        std::memcpy(dst, src, size);
+}
+
+template<std::size_t size> inline void deinterleaveScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, char* const end) {
+    for(; dst != end; dst += size, src += srcStride)
+        std::memcpy(dst, src, size);
+}
+
+void fillScalar(char* const dst, const std::size_t count, const std::size_t size, const char* const value) {
+    char* const end = dst + count*size;
+    switch(size) {
+        case 4: return fillScalar<4>(dst, end, value);
+        case 8: return fillScalar<8>(dst, end, value);
+        case 16: return fillScalar<16>(dst, end, value);
+    }
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+template<class I> void gatherScalar(const char* const src, const I* const indices, char* const dst, const std::size_t count, const std::size_t size) {
+    char* const end = dst + count*size;
+    switch(size) {
+        case 4: return gatherScalar<4>(src, indices, dst, end);
+        case 8: return gatherScalar<8>(src, indices, dst, end);
+        case 16: return gatherScalar<16>(src, indices, dst, end);
+    }
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+void gatherScalar(const char* const src, const char* const indices, const std::size_t indexSize, char* const dst, const std::size_t count, const std::size_t size) {
+    switch(indexSize) {
+        case 1: return gatherScalar(src, reinterpret_cast<const std::uint8_t*>(indices), dst, count, size);
+        case 2: return gatherScalar(src, reinterpret_cast<const std::uint16_t*>(indices), dst, count, size);
+        case 4: return gatherScalar(src, reinterpret_cast<const std::uint32_t*>(indices), dst, count, size);
+    }
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+void interleaveScalar(const char* const src, char* const dst, const std::ptrdiff_t dstStride, const std::size_t count, const std::size_t size) {
+    const char* const end = src + count*size;
+    switch(size) {
+        case 4: return interleaveScalar<4>(src, end, dst, dstStride);
+        case 8: return interleaveScalar<8>(src, end, dst, dstStride);
+        case 16: return interleaveScalar<16>(src, end, dst, dstStride);
+    }
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+void deinterleaveScalar(const char* const src, const std::ptrdiff_t srcStride, char* const dst, const std::size_t count, const std::size_t size) {
+    char* const end = dst + count*size;
+    switch(size) {
+        case 4: return deinterleaveScalar<4>(src, srcStride, dst, end);
+        case 8: return deinterleaveScalar<8>(src, srcStride, dst, end);
+        case 16: return deinterleaveScalar<16>(src, srcStride, dst, end);
+    }
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+/* Assembles a 16-byte block from 16/size items at given locations. There's
+   no gather instruction in SSE2, but loading all items first and then doing
+   a single store is still faster than a store per item, as the compiler
+   can't reorder the loads and stores in the scalar loop because they could
+   alias. */
+CORRADE_ENABLE_SSE2 inline __m128i loadBlockSse2(const char* const* const items, std::integral_constant<std::size_t, 4>) {
+    int a, b, c, d;
+    std::memcpy(&a, items[0], 4);
+    std::memcpy(&b, items[1], 4);
+    std::memcpy(&c, items[2], 4);
+    std::memcpy(&d, items[3], 4);
+    return _mm_set_epi32(d, c, b, a);
+}
+CORRADE_ENABLE_SSE2 inline __m128i loadBlockSse2(const char* const* const items, std::integral_constant<std::size_t, 8>) {
+    return _mm_unpacklo_epi64(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(items[0])),
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(items[1])));
+}
+CORRADE_ENABLE_SSE2 inline __m128i loadBlockSse2(const char* const* const items, std::integral_constant<std::size_t, 16>) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(items[0]));
+}
+
+/* Inverse of the above, splitting a 16-byte block to 16/size items */
+CORRADE_ENABLE_SSE2 inline void storeBlockSse2(const __m128i block, char* const* const items, std::integral_constant<std::size_t, 4>) {
+    const int a = _mm_cvtsi128_si32(block);
+    const int b = _mm_cvtsi128_si32(_mm_shuffle_epi32(block, _MM_SHUFFLE(1, 1, 1, 1)));
+    const int c = _mm_cvtsi128_si32(_mm_shuffle_epi32(block, _MM_SHUFFLE(2, 2, 2, 2)));
+    const int d = _mm_cvtsi128_si32(_mm_shuffle_epi32(block, _MM_SHUFFLE(3, 3, 3, 3)));
+    std::memcpy(items[0], &a, 4);
+    std::memcpy(items[1], &b, 4);
+    std::memcpy(items[2], &c, 4);
+    std::memcpy(items[3], &d, 4);
+}
+CORRADE_ENABLE_SSE2 inline void storeBlockSse2(const __m128i block, char* const* const items, std::integral_constant<std::size_t, 8>) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(items[0]), block);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(items[1]), _mm_unpackhi_epi64(block, block));
+}
+CORRADE_ENABLE_SSE2 inline void storeBlockSse2(const __m128i block, char* const* const items, std::integral_constant<std::size_t, 16>) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(items[0]), block);
+}
+
+/* The value is repeated to fill a whole 16-byte block, which is then stored
+   as many times as it fits. The remainder is less than 16 bytes and a
+   multiple of the item size, so it's copied from the block as well. */
+CORRADE_ENABLE_SSE2 void fillSse2(char* dst, const std::size_t count, const std::size_t size, const char* const value) {
+    char pattern[16];
+    for(std::size_t i = 0; i != 16; i += size)
+        std::memcpy(pattern + i, value, size);
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern));
+
+    char* const end = dst + count*size;
+    for(; end - dst >= 16; dst += 16)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), block);
+    std::memcpy(dst, pattern, end - dst);
+}
+
+template<std::size_t size, class I> CORRADE_ENABLE_SSE2 void gatherSse2(const char* const src, const I* indices, char* dst, char* const end) {
+    for(; end - dst >= 16; dst += 16, indices += 16/size) {
+        const char* items[16/size];
+        for(std::size_t i = 0; i != 16/size; ++i)
+            items[i] = src + std::size_t(indices[i])*size;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), loadBlockSse2(items, std::integral_constant<std::size_t, size>{}));
+    }
+    gatherScalar<size>(src, indices, dst, end);
+}
+
+template<class I> CORRADE_ENABLE_SSE2 void gatherSse2(const char* const src, const I* const indices, char* const dst, const std::size_t count, const std::size_t size) {
+    char* const end = dst + count*size;
+    switch(size) {
+        case 4: return gatherSse2<4>(src, indices, dst, end);
+        case 8: return gatherSse2<8>(src, indices, dst, end);
+        case 16: return gatherSse2<16>(src, indices, dst, end);
+    }
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+CORRADE_ENABLE_SSE2 void gatherSse2(const char* const src, const char* const indices, const std::size_t indexSize, char* const dst, const std::size_t count, const std::size_t size) {
+    switch(indexSize) {
+        case 1: return gatherSse2(src, reinterpret_cast<const std::uint8_t*>(indices), dst, count, size);
+        case 2: return gatherSse2(src, reinterpret_cast<const std::uint16_t*>(indices), dst, count, size);
+        case 4: return gatherSse2(src, reinterpret_cast<const std::uint32_t*>(indices), dst, count, size);
+    }
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+template<std::size_t size> CORRADE_ENABLE_SSE2 void interleaveSse2(const char* src, const char* const end, char* dst, const std::ptrdiff_t dstStride) {
+    for(; end - src >= 16; src += 16) {
+        char* items[16/size];
+        for(std::size_t i = 0; i != 16/size; ++i, dst += dstStride)
+            items[i] = dst;
+        storeBlockSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), items, std::integral_constant<std::size_t, size>{});
+    }
+    interleaveScalar<size>(src, end, dst, dstStride);
+}
+
+CORRADE_ENABLE_SSE2 void interleaveSse2(const char* const src, char* const dst, const std::ptrdiff_t dstStride, const std::size_t count, const std::size_t size) {
+    const char* const end = src + count*size;
+    switch(size) {
+        case 4: return interleaveSse2<4>(src, end, dst, dstStride);
+        case 8: return interleaveSse2<8>(src, end, dst, dstStride);
+        case 16: return interleaveSse2<16>(src, end, dst, dstStride);
+    }
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+template<std::size_t size> CORRADE_ENABLE_SSE2 void deinterleaveSse2(const char* src, const std::ptrdiff_t srcStride, char* dst, char* const end) {
+    for(; end - dst >= 16; dst += 16) {
+        const char* items[16/size];
+        for(std::size_t i = 0; i != 16/size; ++i, src += srcStride)
+            items[i] = src;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), loadBlockSse2(items, std::integral_constant<std::size_t, size>{}));
+    }
+    deinterleaveScalar<size>(src, srcStride, dst, end);
+}
+
+CORRADE_ENABLE_SSE2 void deinterleaveSse2(const char* const src, const std::ptrdiff_t srcStride, char* const dst, const std::size_t count, const std::size_t size) {
+    char* const end = dst + count*size;
+    switch(size) {
+        case 4: return deinterleaveSse2<4>(src, srcStride, dst, end);
+        case 8: return deinterleaveSse2<8>(src, srcStride, dst, end);
+        case 16: return deinterleaveSse2<16>(src, srcStride, dst, end);
+    }
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+/* Same as fillSse2(), just with 32-byte blocks */
+CORRADE_ENABLE_AVX2 void fillAvx2(char* dst, const std::size_t count, const std::size_t size, const char* const value) {
+    char pattern[32];
+    for(std::size_t i = 0; i != 32; i += size)
+        std::memcpy(pattern + i, value, size);
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pattern));
+
+    char* const end = dst + count*size;
+    for(; end - dst >= 32; dst += 32)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), block);
+    std::memcpy(dst, pattern, end - dst);
+}
+
+/* Loads eight indices, zero-extended to 32 bits */
+CORRADE_ENABLE_AVX2 inline __m256i loadIndicesAvx2(const std::uint8_t* const indices) {
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(indices)));
+}
+CORRADE_ENABLE_AVX2 inline __m256i loadIndicesAvx2(const std::uint16_t* const indices) {
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices)));
+}
+CORRADE_ENABLE_AVX2 inline __m256i loadIndicesAvx2(const std::uint32_t* const indices) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices));
+}
+
+/* The gather instructions take signed 32-bit offsets, which is why the
+   indexed items are expected to be in the first 2 GB of the source. Eight
+   items are processed in each iteration. The 16-byte items are fetched as
+   pairs of 8-byte halves, with the indices duplicated and scaled to match. */
+template<class I> CORRADE_ENABLE_AVX2 void gatherAvx2(const char* const src, const I* indices, char* dst, const std::size_t count, const std::size_t size) {
+    char* const end = dst + count*size;
+    const int* const src4 = reinterpret_cast<const int*>(src);
+    const long long* const src8 = reinterpret_cast<const long long*>(src);
+    if(size == 4) for(; end - dst >= 32; dst += 32, indices += 8) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_i32gather_epi32(src4, loadIndicesAvx2(indices), 4));
+    } else if(size == 8) for(; end - dst >= 64; dst += 64, indices += 8) {
+        const __m256i offsets = loadIndicesAvx2(indices);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_i32gather_epi64(src8, _mm256_castsi256_si128(offsets), 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32), _mm256_i32gather_epi64(src8, _mm256_extracti128_si256(offsets, 1), 8));
+    } else if(size == 16) for(; end - dst >= 128; dst += 128, indices += 8) {
+        const __m256i first = _mm256_slli_epi32(loadIndicesAvx2(indices), 1);
+        const __m256i second = _mm256_add_epi32(first, _mm256_set1_epi32(1));
+        /* Items 0, 1, 4, 5 and 2, 3, 6, 7, as the unpack works on 128-bit
+           lanes */
+        const __m256i offsets0145 = _mm256_unpacklo_epi32(first, second);
+        const __m256i offsets2367 = _mm256_unpackhi_epi32(first, second);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_i32gather_epi64(src8, _mm256_castsi256_si128(offsets0145), 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32), _mm256_i32gather_epi64(src8, _mm256_castsi256_si128(offsets2367), 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 64), _mm256_i32gather_epi64(src8, _mm256_extracti128_si256(offsets0145, 1), 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 96), _mm256_i32gather_epi64(src8, _mm256_extracti128_si256(offsets2367, 1), 8));
+    } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+    gatherScalar(src, indices, dst, (end - dst)/size, size);
+}
+
+CORRADE_ENABLE_AVX2 void gatherAvx2(const char* const src, const char* const indices, const std::size_t indexSize, char* const dst, const std::size_t count, const std::size_t size) {
+    switch(indexSize) {
+        case 1: return gatherAvx2(src, reinterpret_cast<const std::uint8_t*>(indices), dst, count, size);
+        case 2: return gatherAvx2(src, reinterpret_cast<const std::uint16_t*>(indices), dst, count, size);
+        case 4: return gatherAvx2(src, reinterpret_cast<const std::uint32_t*>(indices), dst, count, size);
+    }
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* The 4- and 8-byte items are fetched with a gather of constant offsets
+   derived from the stride, if they fit into 32 bits. The 16-byte items are
+   loaded in pairs and stored as a single 32-byte block. */
+CORRADE_ENABLE_AVX2 void deinterleaveAvx2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::size_t count, const std::size_t size) {
+    char* const end = dst + count*size;
+    if(size == 16) for(; end - dst >= 32; dst += 32, src += 2*srcStride) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + srcStride));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_inserti128_si256(_mm256_castsi128_si256(a), b, 1));
+    } else if((srcStride < 0 ? -srcStride : srcStride) <= 0x7fffffff/8) {
+        const int stride = int(srcStride);
+        if(size == 4) {
+            const __m256i offsets = _mm256_setr_epi32(0, stride, 2*stride, 3*stride, 4*stride, 5*stride, 6*stride, 7*stride);
+            for(; end - dst >= 32; dst += 32, src += 8*srcStride)
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_i32gather_epi32(reinterpret_cast<const int*>(src), offsets, 1));
+        } else if(size == 8) {
+            const __m128i offsets = _mm_setr_epi32(0, stride, 2*stride, 3*stride);
+            for(; end - dst >= 32; dst += 32, src += 4*srcStride)
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_i32gather_epi64(reinterpret_cast<const long long*>(src), offsets, 1));
+        } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    deinterleaveScalar(src, srcStride, dst, (end - dst)/size, size);
+}
+#endif
+
+}
+
+namespace Implementation {
+
+AlgorithmsFillFunction algorithmsFillImplementation(Cpu::ScalarT) {
+    return fillScalar;
+}
+
+AlgorithmsGatherFunction algorithmsGatherImplementation(Cpu::ScalarT) {
+    return gatherScalar;
+}
+
+AlgorithmsInterleaveFunction algorithmsInterleaveImplementation(Cpu::ScalarT) {
+    return interleaveScalar;
+}
+
+AlgorithmsDeinterleaveFunction algorithmsDeinterleaveImplementation(Cpu::ScalarT) {
+    return deinterleaveScalar;
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+AlgorithmsFillFunction algorithmsFillImplementation(Cpu::Sse2T) {
+    return fillSse2;
+}
+
+AlgorithmsGatherFunction algorithmsGatherImplementation(Cpu::Sse2T) {
+    return gatherSse2;
+}
+
+AlgorithmsInterleaveFunction algorithmsInterleaveImplementation(Cpu::Sse2T) {
+    return interleaveSse2;
+}
+
+AlgorithmsDeinterleaveFunction algorithmsDeinterleaveImplementation(Cpu::Sse2T) {
+    return deinterleaveSse2;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+AlgorithmsFillFunction algorithmsFillImplementation(Cpu::Avx2T) {
+    return fillAvx2;
+}
+
+AlgorithmsGatherFunction algorithmsGatherImplementation(Cpu::Avx2T) {
+    return gatherAvx2;
+}
+
+AlgorithmsDeinterleaveFunction algorithmsDeinterleaveImplementation(Cpu::Avx2T) {
+    return deinterleaveAvx2;
+}
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+CORRADE_CPU_DISPATCHER(fillDispatcher, Utility::Implementation::algorithmsFillImplementation)
+CORRADE_CPU_DISPATCHER(gatherDispatcher, Utility::Implementation::algorithmsGatherImplementation)
+CORRADE_CPU_DISPATCHER(interleaveDispatcher, Utility::Implementation::algorithmsInterleaveImplementation)
+CORRADE_CPU_DISPATCHER(deinterleaveDispatcher, Utility::Implementation::algorithmsDeinterleaveImplementation)
+#ifdef CORRADE_CPU_USE_IFUNC
+CORRADE_CPU_DISPATCHED_IFUNC(fillDispatcher, void fillContiguous(char*, std::size_t, std::size_t, const char*))
+CORRADE_CPU_DISPATCHED_IFUNC(gatherDispatcher, void gatherContiguous(const char*, const char*, std::size_t, char*, std::size_t, std::size_t))
+CORRADE_CPU_DISPATCHED_IFUNC(interleaveDispatcher, void interleaveContiguous(const char*, char*, std::ptrdiff_t, std::size_t, std::size_t))
+CORRADE_CPU_DISPATCHED_IFUNC(deinterleaveDispatcher, void deinterleaveContiguous(const char*, std::ptrdiff_t, char*, std::size_t, std::size_t))
+#else
+CORRADE_CPU_DISPATCHED_POINTER(fillDispatcher, Implementation::AlgorithmsFillFunction fillContiguous)
+CORRADE_CPU_DISPATCHED_POINTER(gatherDispatcher, Implementation::AlgorithmsGatherFunction gatherContiguous)
+CORRADE_CPU_DISPATCHED_POINTER(interleaveDispatcher, Implementation::AlgorithmsInterleaveFunction interleaveContiguous)
+CORRADE_CPU_DISPATCHED_POINTER(deinterleaveDispatcher, Implementation::AlgorithmsDeinterleaveFunction deinterleaveContiguous)
+#endif
+#else
+/* Picking the best variant enabled at compile time */
+void fillContiguous(char* const dst, const std::size_t count, const std::size_t size, const char* const value) {
+    Implementation::algorithmsFillImplementation(Cpu::DefaultBase)(dst, count, size, value);
+}
+void gatherContiguous(const char* const src, const char* const indices, const std::size_t indexSize, char* const dst, const std::size_t count, const std::size_t size) {
+    Implementation::algorithmsGatherImplementation(Cpu::DefaultBase)(src, indices, indexSize, dst, count, size);
+}
+void interleaveContiguous(const char* const src, char* const dst, const std::ptrdiff_t dstStride, const std::size_t count, const std::size_t size) {
+    Implementation::algorithmsInterleaveImplementation(Cpu::DefaultBase)(src, dst, dstStride, count, size);
+}
+void deinterleaveContiguous(const char* const src, const std::ptrdiff_t srcStride, char* const dst, const std::size_t count, const std::size_t size) {
+    Implementation::algorithmsDeinterleaveImplementation(Cpu::DefaultBase)(src, srcStride, dst, count, size);
+}
+#endif
+
+/* Item sizes the above kernels handle */
+inline bool isKernelItemSize(const std::size_t size) {
+    return size == 4 || size == 8 || size == 16;
+}
+
+}
+
+namespace {
+
+/* Copies items by an index array, either gathering (dst[i] = src[indices[i]])
+   or scattering (dst[indices[i]] = src[i]). An element size of 0 means the
+   size is known only at runtime. */
+template<std::size_t elementSize, class I, bool scatter> void copyIndexedElements(const char* const srcPtr, const std::ptrdiff_t srcStride, const char* const indexPtr, const std::ptrdiff_t indexStride, char* const dstPtr, const std::ptrdiff_t dstStride, const std::size_t count, const std::size_t runtimeElementSize) {
+    const std::size_t size = elementSize ? elementSize : runtimeElementSize;
+
+    /* If all views are contiguous, which is the most common case, the
+       strides are known at compile time, saving a multiplication and
+       allowing the compiler to unroll the loop */
+    if(elementSize && srcStride == std::ptrdiff_t(size) &&
+       dstStride == std::ptrdiff_t(size) &&
+       indexStride == std::ptrdiff_t(sizeof(I))) {
+        const I* const indexData = reinterpret_cast<const I*>(indexPtr);
+        for(std::size_t i = 0; i != count; ++i) {
+            if(scatter) std::memcpy(dstPtr + indexData[i]*elementSize,
+                                    srcPtr + i*elementSize, elementSize);
+            else std::memcpy(dstPtr + i*elementSize,
+                             srcPtr + indexData[i]*elementSize, elementSize);
+        }
+        return;
+    }
+
+    for(std::size_t i = 0; i != count; ++i) {
+        const std::size_t index = *reinterpret_cast<const I*>(indexPtr + i*indexStride);
+        if(scatter) std::memcpy(dstPtr + index*dstStride,
+                                srcPtr + i*srcStride, size);
+        else std::memcpy(dstPtr + i*dstStride,
+                         srcPtr + index*srcStride, size);
+    }
+}
+
+template<class I, bool scatter> void copyIndexed(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const I>& indices, const Containers::StridedArrayView2D<char>& dst) {
+    const std::size_t count = indices.size();
+    const std::size_t elementSize = src.size()[1];
+    #ifndef CORRADE_NO_ASSERT
+    const char* const name = scatter ? "scatter" : "copy";
+    CORRADE_ASSERT(elementSize == dst.size()[1],
+        "Utility::Algorithms::" << Debug::nospace << name << Debug::nospace << "(): item sizes" << elementSize << "and" << dst.size()[1] << "don't match", );
+    const std::size_t indexedSize = scatter ? dst.size()[0] : src.size()[0];
+    const std::size_t itemCount = scatter ? src.size()[0] : dst.size()[0];
+    CORRADE_ASSERT(count == itemCount,
+        "Utility::Algorithms::" << Debug::nospace << name << Debug::nospace << "(): expected" << itemCount << "indices but got" << count, );
+    /* Checking the bounds upfront so the copy loop isn't slowed down by the
+       asserts. If the index type can't represent an out-of-range value, there's
+       nothing to check. Otherwise it's just an "any out of range" reduction in
+       the index type, which the compiler can vectorize even on plain SSE2,
+       unlike an unsigned max, and the offending index is looked up only if
+       it fails. */
+    if(indexedSize <= std::size_t(I(~I{}))) {
+        const I limit = I(indexedSize);
+        I outOfRange = 0;
+        if(indices.isContiguous()) {
+            const I* const indexData = static_cast<const I*>(indices.data());
+            for(std::size_t i = 0; i != count; ++i)
+                outOfRange |= I(indexData[i] >= limit);
+        } else for(const I index: indices)
+            outOfRange |= I(index >= limit);
+        if(outOfRange) for(const I index: indices) {
+            CORRADE_ASSERT(index < limit,
+                "Utility::Algorithms::" << Debug::nospace << name << Debug::nospace << "(): index" << std::size_t(index) << "out of range for" << indexedSize << (scatter ? "destination" : "source") << "items", );
+        }
+    }
+    #endif
+
+    if(!count || !elementSize) return;
+
+    /* If the item bytes aren't contiguous (which can only happen when passing
+       a char view directly), copy each item as a whole */
+    if(!src.isContiguous<1>() || !dst.isContiguous<1>()) {
+        for(std::size_t i = 0; i != count; ++i) {
+            if(scatter) copy(src[i], dst[indices[i]]);
+            else copy(src[indices[i]], dst[i]);
+        }
+        return;
+    }
+
+    /* Contiguous gathers of 4-, 8- and 16-byte items go to the SIMD kernels,
+       if all items are within the 2 GB they can address */
+    if(!scatter && isKernelItemSize(elementSize) &&
+       src.stride()[0] == std::ptrdiff_t(elementSize) &&
+       dst.stride()[0] == std::ptrdiff_t(elementSize) &&
+       indices.stride() == std::ptrdiff_t(sizeof(I)) &&
+       src.size()[0]*elementSize <= 0x80000000ull) {
+        gatherContiguous(static_cast<const char*>(src.data()),
+            static_cast<const char*>(indices.data()), sizeof(I),
+            static_cast<char*>(dst.data()), count, elementSize);
+        return;
+    }
+
+    void(*copyIndexedElementsImplementation)(const char*, std::ptrdiff_t, const char*, std::ptrdiff_t, char*, std::ptrdiff_t, std::size_t, std::size_t);
+    switch(elementSize) {
+        case 1: copyIndexedElementsImplementation = copyIndexedElements<1, I, scatter>; break;
+        case 2: copyIndexedElementsImplementation = copyIndexedElements<2, I, scatter>; break;
+        case 4: copyIndexedElementsImplementation = copyIndexedElements<4, I, scatter>; break;
+        case 8: copyIndexedElementsImplementation = copyIndexedElements<8, I, scatter>; break;
+        case 12: copyIndexedElementsImplementation = copyIndexedElements<12, I, scatter>; break;
+        case 16: copyIndexedElementsImplementation = copyIndexedElements<16, I, scatter>; break;
+        default: copyIndexedElementsImplementation = copyIndexedElements<0, I, scatter>;
+    }
+
+    copyIndexedElementsImplementation(
+        static_cast<const char*>(src.data()), src.stride()[0],
+        static_cast<const char*>(indices.data()), indices.stride(),
+        static_cast<char*>(dst.data()), dst.stride()[0],
+        count, elementSize);
+}
+
+}
+
+void copy(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const std::uint32_t>& indices, const Containers::StridedArrayView2D<char>& dst) {
+    copyIndexed<std::uint32_t, false>(src, indices, dst);
+}
+
+void copy(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const std::uint16_t>& indices, const Containers::StridedArrayView2D<char>& dst) {
+    copyIndexed<std::uint16_t, false>(src, indices, dst);
+}
+
+void copy(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const std::uint8_t>& indices, const Containers::StridedArrayView2D<char>& dst) {
+    copyIndexed<std::uint8_t, false>(src, indices, dst);
+}
+
+void scatter(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const std::uint32_t>& indices, const Containers::StridedArrayView2D<char>& dst) {
+    copyIndexed<std::uint32_t, true>(src, indices, dst);
+}
+
+void scatter(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const std::uint16_t>& indices, const Containers::StridedArrayView2D<char>& dst) {
+    copyIndexed<std::uint16_t, true>(src, indices, dst);
+}
+
+void scatter(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const std::uint8_t>& indices, const Containers::StridedArrayView2D<char>& dst) {
+    copyIndexed<std::uint8_t, true>(src, indices, dst);
+}
+
+namespace {
+
+/* Same as with copyElementTile(), the fixed-size memcpy() compiles down to a
+   plain store (or two), and if the innermost dimension is contiguous, the
+   compiler can vectorize the loop. An element size of 0 means the size is known only at
+   runtime. */
+template<std::size_t elementSize> void fillElements(char* const dstPtr, const std::size_t* const size, const std::ptrdiff_t* const stride, const char* const value) {
+    const std::size_t valueSize = elementSize ? elementSize : size[3];
+    for(std::size_t i0 = 0; i0 != size[0]; ++i0) {
+        char* dstPtr0 = dstPtr + i0*stride[0];
+        for(std::size_t i1 = 0; i1 != size[1]; ++i1) {
+            char* dstPtr1 = dstPtr0 + i1*stride[1];
+            if(stride[2] == std::ptrdiff_t(valueSize)) {
+                for(std::size_t i2 = 0; i2 != size[2]; ++i2)
+                    std::memcpy(dstPtr1 + i2*valueSize, value, valueSize);
+            } else {
+                for(std::size_t i2 = 0; i2 != size[2]; ++i2)
+                    std::memcpy(dstPtr1 + i2*stride[2], value, valueSize);
+            }
+        }
+    }
+}
+
+}
+
+namespace Implementation {
+
+void fill(const Containers::StridedArrayView4D<char>& dst, const void* const value) {
+    const Containers::StridedDimensions<4, std::size_t> size_ = dst.size();
+    const Containers::StridedDimensions<4, std::ptrdiff_t> stride_ = dst.stride();
+    const std::size_t* const size = size_.begin();
+    const std::ptrdiff_t* const stride = stride_.begin();
+    for(std::size_t i = 0; i != 4; ++i) if(!size[i]) return;
+
+    /* Copying the value to a local so the compiler knows it doesn't alias the
+       destination */
+    char valueCopy[16];
+    const char* valuePtr = static_cast<const char*>(value);
+    if(size[3] <= 16) {
+        std::memcpy(valueCopy, value, size[3]);
+        valuePtr = valueCopy;
+    }
+
+    auto* const dstPtr = static_cast<char*>(dst.data());
+
+    /* Contiguous rows of 4-, 8- and 16-byte items go to the SIMD kernels, if
+       the whole view is contiguous it's just a single call */
+    if(isKernelItemSize(size[3]) && stride[2] == std::ptrdiff_t(size[3])) {
+        if(stride[1] == std::ptrdiff_t(size[2]*size[3]) &&
+           stride[0] == std::ptrdiff_t(size[1])*stride[1])
+            return fillContiguous(dstPtr, size[0]*size[1]*size[2], size[3], valuePtr);
+
+        for(std::size_t i0 = 0; i0 != size[0]; ++i0)
+            for(std::size_t i1 = 0; i1 != size[1]; ++i1)
+                fillContiguous(dstPtr + i0*stride[0] + i1*stride[1], size[2], size[3], valuePtr);
+        return;
+    }
+
+    switch(size[3]) {
+        case 1: return fillElements<1>(dstPtr, size, stride, valuePtr);
+        case 2: return fillElements<2>(dstPtr, size, stride, valuePtr);
+        case 4: return fillElements<4>(dstPtr, size, stride, valuePtr);
+        case 8: return fillElements<8>(dstPtr, size, stride, valuePtr);
+        case 12: return fillElements<12>(dstPtr, size, stride, valuePtr);
+        case 16: return fillElements<16>(dstPtr, size, stride, valuePtr);
+        default: return fillElements<0>(dstPtr, size, stride, valuePtr);
+    }
+}
+
+}
+
+namespace {
+
+/* Amount of destination bytes processed at once in interleave() and
+   deinterleave(), so the interleaved items stay in cache while all attributes
+   are copied to (or from) them */
+constexpr std::size_t InterleaveBlockBytes = 16384;
+
+/* If the whole interleaved buffer is at most this large, it's processed at
+   once instead, as the per-block overhead of slicing all views would outweigh
+   any cache benefit */
+constexpr std::size_t InterleaveSingleBlockBytes = 262144;
+
+std::size_t interleaveBlockSize(const std::size_t count, const std::size_t rowSize) {
+    if(!rowSize || count*rowSize <= InterleaveSingleBlockBytes) return count;
+    return rowSize < InterleaveBlockBytes ? InterleaveBlockBytes/rowSize : 1;
+}
+
+/* Attributes with contiguous 4-, 8- and 16-byte items go to the SIMD kernels,
+   everything else through the generic copy() */
+void interleaveAttribute(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<char>& dst) {
+    const std::size_t size = src.size()[1];
+    if(isKernelItemSize(size) && src.stride()[0] == std::ptrdiff_t(size) &&
+       src.stride()[1] == 1 && dst.stride()[1] == 1)
+        return interleaveContiguous(static_cast<const char*>(src.data()),
+            static_cast<char*>(dst.data()), dst.stride()[0],
+            src.size()[0], size);
+
+    copy(src, dst);
+}
+
+void deinterleaveAttribute(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<char>& dst) {
+    const std::size_t size = dst.size()[1];
+    if(isKernelItemSize(size) && dst.stride()[0] == std::ptrdiff_t(size) &&
+       dst.stride()[1] == 1 && src.stride()[1] == 1)
+        return deinterleaveContiguous(static_cast<const char*>(src.data()),
+            src.stride()[0], static_cast<char*>(dst.data()),
+            dst.size()[0], size);
+
+    copy(src, dst);
+}
+
+}
+
+void interleave(const Containers::ArrayView<const Containers::StridedArrayView2D<const char>>& src, const Containers::StridedArrayView2D<char>& dst) {
+    const std::size_t count = dst.size()[0];
+    #ifndef CORRADE_NO_ASSERT
+    std::size_t totalSize = 0;
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        CORRADE_ASSERT(src[i].size()[0] == count,
+            "Utility::Algorithms::interleave(): expected attribute" << i << "to have" << count << "items but got" << src[i].size()[0], );
+        totalSize += src[i].size()[1];
+    }
+    CORRADE_ASSERT(totalSize <= dst.size()[1],
+        "Utility::Algorithms::interleave(): attributes take" << totalSize << "bytes but the destination has only" << dst.size()[1], );
+    #endif
+
+    const std::size_t blockSize = interleaveBlockSize(count, dst.size()[1]);
+    for(std::size_t begin = 0; begin < count; begin += blockSize) {
+        const std::size_t end = begin + blockSize < count ? begin + blockSize : count;
+        std::size_t offset = 0;
+        for(const Containers::StridedArrayView2D<const char>& attribute: src) {
+            const std::size_t size = attribute.size()[1];
+            interleaveAttribute(attribute.slice(begin, end),
+                dst.slice({begin, offset}, {end, offset + size}));
+            offset += size;
+        }
+    }
+}
+
+void interleave(const std::initializer_list<Containers::StridedArrayView2D<const char>> src, const Containers::StridedArrayView2D<char>& dst) {
+    interleave(Containers::arrayView(src), dst);
+}
+
+void deinterleave(const Containers::StridedArrayView2D<const char>& src, const Containers::ArrayView<const Containers::StridedArrayView2D<char>>& dst) {
+    const std::size_t count = src.size()[0];
+    #ifndef CORRADE_NO_ASSERT
+    std::size_t totalSize = 0;
+    for(std::size_t i = 0; i != dst.size(); ++i) {
+        CORRADE_ASSERT(dst[i].size()[0] == count,
+            "Utility::Algorithms::deinterleave(): expected attribute" << i << "to have" << count << "items but got" << dst[i].size()[0], );
+        totalSize += dst[i].size()[1];
+    }
+    CORRADE_ASSERT(totalSize <= src.size()[1],
+        "Utility::Algorithms::deinterleave(): attributes take" << totalSize << "bytes but the source has only" << src.size()[1], );
+    #endif
+
+    const std::size_t blockSize = interleaveBlockSize(count, src.size()[1]);
+    for(std::size_t begin = 0; begin < count; begin += blockSize) {
+        const std::size_t end = begin + blockSize < count ? begin + blockSize : count;
+        std::size_t offset = 0;
+        for(const Containers::StridedArrayView2D<char>& attribute: dst) {
+            const std::size_t size = attribute.size()[1];
+            deinterleaveAttribute(src.slice({begin, offset}, {end, offset + size}),
+                attribute.slice(begin, end));
+            offset += size;
+        }
+    }
+}
+
+void deinterleave(const Containers::StridedArrayView2D<const char>& src, const std::initializer_list<Containers::StridedArrayView2D<char>> dst) {
+    deinterleave(src, Containers::arrayView(dst));
+}
+
 }}
@@ -26,10 +26,13 @@
 */
 
 /** @file
- * @brief Function @ref Corrade::Utility::copy()
+ * @brief Function @ref Corrade::Utility::copy(), @ref Corrade::Utility::scatter(), @ref Corrade::Utility::fill(), @ref Corrade::Utility::interleave(), @ref Corrade::Utility::deinterleave()
  * @m_since{2020,06}
  */
 
+#include <cstdint>
+#include <initializer_list>
+
 #include "Corrade/Containers/StridedArrayView.h"
 #include "Corrade/Utility/visibility.h"
 
@@ -70,10 +73,13 @@ template<class T> inline void copy(const Containers::ArrayView<const T>& src, co
 @m_since{2020,06}
 
 Optimized to call @ref std::memcpy() on largest contiguous sub-dimensions,
-looping over the non-contiguous dimensions (except when memcpy would be called
-for very small pieces of memory, in which case either a loop or a variant of
+looping over the non-contiguous dimensions. Elements of 1, 2, 4, 8, 12 and 16
+bytes are copied with dedicated kernels instead of calling memcpy for each of them,
+and if the innermost dimension isn't accessed linearly (such as when copying
+from or to a transposed view), the copy is done in tiles that fit into the
+cache. For other element sizes either a loop or a variant of
 <a href="https://en.wikipedia.org/wiki/Duff's_device">Duff's device</a> is
-used, depending on which is faster on given compiler). The function has
+used, depending on which is faster on given compiler. The function has
 specializations for 1D, 2D, 3D and 4D, higher dimensions recurse into these.
 Expects that both arrays have the same size.
 @see @ref Containers::StridedArrayView::isContiguous()
@@ -127,6 +133,102 @@ template<unsigned dimensions, class T> void copy(const Containers::StridedArrayV
                 Containers::arrayCast<dimensions + 1, char>(dst));
 }
 
+/**
+@brief Copy a strided array view to another in parallel
+@m_since_latest
+
+Splits the outermost dimension into @p threadCount slices of roughly the same
+size and copies each of them on a separate thread using
+@ref copy(const Containers::StridedArrayView<dimensions, const char>&, const Containers::StridedArrayView<dimensions, char>&),
+with the last slice being copied on the calling thread. If @p threadCount is
+@cpp 0 @ce, @ref std::thread::hardware_concurrency() is used. The thread count
+is limited to the size of the outermost dimension and so each thread copies at
+least a megabyte, which means smaller views are copied serially without any
+threads being spawned. On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the copy
+is always serial. Expects that both arrays have the same size.
+
+The threads are created for each call, so this function is meant for copying
+views of several megabytes and more, where the thread creation overhead is
+negligible compared to the copy itself.
+*/
+CORRADE_UTILITY_EXPORT void copy(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<char>& dst, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+CORRADE_UTILITY_EXPORT void copy(const Containers::StridedArrayView3D<const char>& src, const Containers::StridedArrayView3D<char>& dst, std::size_t threadCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+CORRADE_UTILITY_EXPORT void copy(const Containers::StridedArrayView4D<const char>& src, const Containers::StridedArrayView4D<char>& dst, std::size_t threadCount);
+
+/**
+@brief Copy a strided array view to another in parallel
+@m_since_latest
+
+Casts views into a @cpp char @ce type of one dimension more (where the last
+dimension has a size of @cpp sizeof(T) @ce and delegates into
+@ref copy(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView2D<char>&, std::size_t)
+or its 3D and 4D variants. Expects that both arrays have the same size and
+@p T is a trivially copyable type.
+*/
+template<unsigned dimensions, class T> void copy(const Containers::StridedArrayView<dimensions, const T>& src, const Containers::StridedArrayView<dimensions, T>& dst, std::size_t threadCount) {
+    static_assert(
+        #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+        std::is_trivially_copyable<T>::value
+        #else
+        __has_trivial_copy(T) && __has_trivial_destructor(T)
+        #endif
+        , "types must be trivially copyable");
+    static_assert(dimensions <= 3, "parallel copy is implemented only for up to three-dimensional views");
+
+    return copy(Containers::arrayCast<dimensions + 1, const char>(src),
+                Containers::arrayCast<dimensions + 1, char>(dst), threadCount);
+}
+
+/**
+@brief Copy a view with a compile-time stride to another
+@m_since_latest
+
+Unlike @ref copy(const Containers::StridedArrayView<dimensions, const T>&, const Containers::StridedArrayView<dimensions, T>&),
+which dispatches to a generic byte-wise implementation, this overload is
+inlined and copies whole elements in a loop with both strides known at compile
+time, allowing the compiler to unroll and vectorize it. If both views are
+contiguous, it delegates to
+@ref copy(const Containers::ArrayView<const void>&, const Containers::ArrayView<void>&)
+instead. Expects that both views have the same size and @p T is a trivially
+copyable type. You need to include
+@ref Corrade/Containers/StaticStrideArrayView.h in order to use this
+overload.
+*/
+template<std::ptrdiff_t srcStride, std::ptrdiff_t dstStride, class U, class T> void copy(const Containers::StaticStrideArrayView<srcStride, U>& src, const Containers::StaticStrideArrayView<dstStride, T>& dst) {
+    static_assert(std::is_same<typename std::remove_const<U>::type, T>::value, "can't copy between views of different types");
+    static_assert(
+        #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+        std::is_trivially_copyable<T>::value
+        #else
+        __has_trivial_copy(T) && __has_trivial_destructor(T)
+        #endif
+        , "types must be trivially copyable");
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Utility::Algorithms::copy(): sizes" << src.size() << "and" << dst.size() << "don't match", );
+
+    const std::size_t size = src.size();
+    if(Containers::StaticStrideArrayView<srcStride, U>::isContiguous() &&
+       Containers::StaticStrideArrayView<dstStride, T>::isContiguous())
+        return copy(Containers::ArrayView<const void>{src.data(), size*sizeof(T)},
+                    Containers::ArrayView<void>{dst.data(), size*sizeof(T)});
+
+    const char* const srcData = static_cast<const char*>(src.data());
+    char* const dstData = static_cast<char*>(dst.data());
+    for(std::size_t i = 0; i != size; ++i)
+        *reinterpret_cast<T*>(dstData + std::ptrdiff_t(i)*dstStride) =
+            *reinterpret_cast<const T*>(srcData + std::ptrdiff_t(i)*srcStride);
+}
+
 namespace Implementation {
 
 /* Vaguely inspired by the Utility::IsIterable type trait */
@@ -177,6 +279,254 @@ template<class From, class To, class FromView = decltype(Implementation::strided
     copy(srcV, dstV);
 }
 
+/**
+@brief Copy a view to another in parallel
+@m_since_latest
+
+Converts @p src and @p dst to a common @ref Containers::StridedArrayView type
+and then calls
+@ref copy(const Containers::StridedArrayView<dimensions, const T>&, const Containers::StridedArrayView<dimensions, T>&, std::size_t).
+Works with any type that's convertible to @ref Containers::StridedArrayView,
+expects that both views have the same underlying type and the same dimension
+count and the @p dst is not @cpp const @ce.
+*/
+template<class From, class To, class FromView = decltype(Implementation::stridedArrayViewTypeFor(std::declval<From&&>())), class ToView = decltype(Implementation::stridedArrayViewTypeFor(std::declval<To&&>()))> void copy(From&& src, To&& dst, std::size_t threadCount) {
+    typedef typename std::remove_const<typename FromView::Type>::type T;
+    static_assert(std::is_same<T, typename std::remove_const<typename ToView::Type>::type>::value, "can't copy between views of different types");
+    static_assert(!std::is_const<typename ToView::Type>::value, "can't copy to a const view");
+    static_assert(unsigned(Implementation::StridedArrayViewType<FromView>::Dimensions) ==
+        unsigned(Implementation::StridedArrayViewType<ToView>::Dimensions),
+        "can't copy between views of different dimensions");
+    /* We need to pass const& to the copy(), passing temporary instances
+       directly would lead to infinite recursion */
+    const Containers::StridedArrayView<Implementation::StridedArrayViewType<FromView>::Dimensions, const T> srcV{src};
+    const Containers::StridedArrayView<Implementation::StridedArrayViewType<FromView>::Dimensions, T> dstV{dst};
+    copy(srcV, dstV, threadCount);
+}
+
+/**
+@brief Copy items of a view to another view by an index array
+@m_since_latest
+
+Gathers items from the first dimension of @p src into @p dst, i.e. the
+@cpp i @ce-th item of @p dst is the @cpp indices[i] @ce-th item of @p src. The
+second dimension is the item bytes and is expected to have the same size in
+both views. If all views are contiguous and the size is 4, 8 or 16 bytes, the
+items are gathered using SSE2 or AVX2 if available. With
+@ref CORRADE_BUILD_CPU_RUNTIME_DISPATCH enabled the implementation is picked
+at runtime based on @ref Cpu::runtimeFeatures(). Otherwise, if the second
+dimension is contiguous and the size is 1, 2, 4, 8, 12 or 16 bytes, the items
+are copied using a dedicated kernel, otherwise with @ref std::memcpy() or, if
+the second dimension isn't contiguous, using
+@ref copy(const Containers::StridedArrayView1D<const char>&, const Containers::StridedArrayView1D<char>&)
+for every item. Expects that @p indices have the same size as @p dst and that
+all indices are in bounds for @p src.
+@see @ref scatter()
+*/
+CORRADE_UTILITY_EXPORT void copy(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const std::uint32_t>& indices, const Containers::StridedArrayView2D<char>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+CORRADE_UTILITY_EXPORT void copy(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const std::uint16_t>& indices, const Containers::StridedArrayView2D<char>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+CORRADE_UTILITY_EXPORT void copy(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const std::uint8_t>& indices, const Containers::StridedArrayView2D<char>& dst);
+
+/**
+@brief Copy items of a view to another view by an index array
+@m_since_latest
+
+Casts views into a @cpp char @ce type of one dimension more (where the last
+dimension has a size of @cpp sizeof(T) @ce) and delegates into
+@ref copy(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<const std::uint32_t>&, const Containers::StridedArrayView2D<char>&)
+or its 8- and 16-bit index variant. Expects that @p indices have the same size
+as @p dst, all indices are in bounds for @p src and @p T is a trivially
+copyable type.
+
+@snippet Utility.cpp copy-indexed
+*/
+template<class U, class I, class T> void copy(const Containers::StridedArrayView1D<U>& src, const Containers::StridedArrayView1D<I>& indices, const Containers::StridedArrayView1D<T>& dst) {
+    static_assert(std::is_same<typename std::remove_const<U>::type, T>::value, "can't copy between views of different types");
+    static_assert(
+        #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+        std::is_trivially_copyable<T>::value
+        #else
+        __has_trivial_copy(T) && __has_trivial_destructor(T)
+        #endif
+        , "types must be trivially copyable");
+
+    return copy(Containers::arrayCast<2, const char>(Containers::StridedArrayView1D<const T>{src}),
+        Containers::StridedArrayView1D<const typename std::remove_const<I>::type>{indices},
+        Containers::arrayCast<2, char>(dst));
+}
+
+/**
+@brief Copy items of a view to another view at positions given by an index array
+@m_since_latest
+
+Inverse of @ref copy(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<const std::uint32_t>&, const Containers::StridedArrayView2D<char>&)
+--- scatters items from the first dimension of @p src into @p dst, i.e. the
+@cpp i @ce-th item of @p src gets copied to the @cpp indices[i] @ce-th item of
+@p dst. Items of @p dst that aren't referenced by any index are left
+untouched, if an index is present more than once, the last item referencing it
+wins. Expects that @p indices have the same size as @p src and that all
+indices are in bounds for @p dst.
+*/
+CORRADE_UTILITY_EXPORT void scatter(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const std::uint32_t>& indices, const Containers::StridedArrayView2D<char>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+CORRADE_UTILITY_EXPORT void scatter(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const std::uint16_t>& indices, const Containers::StridedArrayView2D<char>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+CORRADE_UTILITY_EXPORT void scatter(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView1D<const std::uint8_t>& indices, const Containers::StridedArrayView2D<char>& dst);
+
+/**
+@brief Copy items of a view to another view at positions given by an index array
+@m_since_latest
+
+Casts views into a @cpp char @ce type of one dimension more (where the last
+dimension has a size of @cpp sizeof(T) @ce) and delegates into
+@ref scatter(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<const std::uint32_t>&, const Containers::StridedArrayView2D<char>&)
+or its 8- and 16-bit index variant. Expects that @p indices have the same size
+as @p src, all indices are in bounds for @p dst and @p T is a trivially
+copyable type.
+*/
+template<class U, class I, class T> void scatter(const Containers::StridedArrayView1D<U>& src, const Containers::StridedArrayView1D<I>& indices, const Containers::StridedArrayView1D<T>& dst) {
+    static_assert(std::is_same<typename std::remove_const<U>::type, T>::value, "can't copy between views of different types");
+    static_assert(
+        #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+        std::is_trivially_copyable<T>::value
+        #else
+        __has_trivial_copy(T) && __has_trivial_destructor(T)
+        #endif
+        , "types must be trivially copyable");
+
+    return scatter(Containers::arrayCast<2, const char>(Containers::StridedArrayView1D<const T>{src}),
+        Containers::StridedArrayView1D<const typename std::remove_const<I>::type>{indices},
+        Containers::arrayCast<2, char>(dst));
+}
+
+namespace Implementation {
+
+/* The last dimension is the (contiguous) value bytes */
+CORRADE_UTILITY_EXPORT void fill(const Containers::StridedArrayView4D<char>& dst, const void* value);
+
+/* Expands a view to four dimensions by prepending dimensions of size 1, same
+   as what's done by the copy() overloads internally */
+template<unsigned dimensions> Containers::StridedArrayView4D<char> stridedArrayView4D(const Containers::StridedArrayView<dimensions, char>& view) {
+    static_assert(dimensions <= 4, "can't expand a view with more than four dimensions");
+    Containers::StridedDimensions<4, std::size_t> size{1, 1, 1, 1};
+    Containers::StridedDimensions<4, std::ptrdiff_t> stride;
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        size[4 - dimensions + i] = view.size()[i];
+        stride[4 - dimensions + i] = view.stride()[i];
+    }
+    /* Using ~std::size_t{} for arrayview size as a shortcut -- there it's
+       just for the size assert anyway */
+    return {{static_cast<char*>(view.data()), ~std::size_t{}}, size, stride};
+}
+
+}
+
+/**
+@brief Fill a strided array view with a value
+@m_since_latest
+
+If the innermost dimension is contiguous, values of 4, 8 and 16 bytes are
+written using SSE2 or AVX2 if available. With
+@ref CORRADE_BUILD_CPU_RUNTIME_DISPATCH enabled the implementation is picked
+at runtime based on @ref Cpu::runtimeFeatures(). Other values of 1, 2, 4, 8,
+12 and 16 bytes are written using dedicated kernels, other sizes with a
+@ref std::memcpy() for each item. Expects that @p T is a trivially copyable
+type. The function is implemented for up to
+three-dimensional views.
+*/
+template<unsigned dimensions, class T> void fill(const Containers::StridedArrayView<dimensions, T>& dst, const T& value) {
+    static_assert(
+        #ifdef CORRADE_STD_IS_TRIVIALLY_TRAITS_SUPPORTED
+        std::is_trivially_copyable<T>::value
+        #else
+        __has_trivial_copy(T) && __has_trivial_destructor(T)
+        #endif
+        , "types must be trivially copyable");
+    static_assert(dimensions <= 3, "fill is implemented only for up to three-dimensional views");
+
+    Implementation::fill(Implementation::stridedArrayView4D(Containers::arrayCast<dimensions + 1, char>(dst)), &value);
+}
+
+/**
+@brief Fill a view with a value
+@m_since_latest
+
+Converts @p dst to a @ref Containers::StridedArrayView and calls
+@ref fill(const Containers::StridedArrayView<dimensions, T>&, const T&). Works
+with any type that's convertible to @ref Containers::StridedArrayView, expects
+that @p dst is not @cpp const @ce.
+*/
+template<class To, class T, class ToView = decltype(Implementation::stridedArrayViewTypeFor(std::declval<To&&>()))> void fill(To&& dst, const T& value) {
+    static_assert(!std::is_const<typename ToView::Type>::value, "can't fill a const view");
+    /* We need to pass const& to the fill(), passing temporary instances
+       directly would lead to infinite recursion */
+    const Containers::StridedArrayView<Implementation::StridedArrayViewType<ToView>::Dimensions, typename ToView::Type> dstV{dst};
+    fill<Implementation::StridedArrayViewType<ToView>::Dimensions, typename ToView::Type>(dstV, value);
+}
+
+/**
+@brief Interleave attribute streams
+@m_since_latest
+
+Copies the @p src views next to each other into @p dst, in the order they're
+passed. Each view in @p src is a list of items in the first dimension and item
+bytes in the second dimension, @p dst is the interleaved list of items in the
+first dimension and bytes of all attributes in the second dimension. Bytes of
+@p dst not covered by any attribute are left untouched. To stay in cache for
+large inputs, the copy is done in blocks of items, with all attributes copied
+for each block before continuing to the next. Contiguous attributes of 4-, 8-
+and 16-byte items are copied using SSE2 if available, picked at runtime the
+same way as in @ref fill(). Expects that all views have the same item count and
+that the attributes fit into the second dimension of @p dst.
+
+@snippet Utility.cpp interleave
+@see @ref Containers::arrayCast(const StridedArrayView<dimensions, T>&)
+*/
+CORRADE_UTILITY_EXPORT void interleave(const Containers::ArrayView<const Containers::StridedArrayView2D<const char>>& src, const Containers::StridedArrayView2D<char>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+CORRADE_UTILITY_EXPORT void interleave(std::initializer_list<Containers::StridedArrayView2D<const char>> src, const Containers::StridedArrayView2D<char>& dst);
+
+/**
+@brief Deinterleave attribute streams
+@m_since_latest
+
+Inverse of @ref interleave() --- copies bytes from the second dimension of
+@p src to the @p dst views, in the order they're passed, with bytes not
+covered by any of the @p dst views being skipped. Contiguous attributes of 4-,
+8- and 16-byte items are copied using SSE2 or AVX2 if available, picked at
+runtime the same way as in @ref fill(). Expects that all views have the same
+item count and that the attributes fit into the second dimension of @p src.
+*/
+CORRADE_UTILITY_EXPORT void deinterleave(const Containers::StridedArrayView2D<const char>& src, const Containers::ArrayView<const Containers::StridedArrayView2D<char>>& dst);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+CORRADE_UTILITY_EXPORT void deinterleave(const Containers::StridedArrayView2D<const char>& src, std::initializer_list<Containers::StridedArrayView2D<char>> dst);
+
 template<unsigned dimensions> void copy(const Containers::StridedArrayView<dimensions, const char>& src, const Containers::StridedArrayView<dimensions, char>& dst) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Utility::Algorithms::copy(): sizes" << src.size() << "and" << dst.size() << "don't match", );
@@ -0,0 +1,130 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Cpu.h"
+
+#if defined(CORRADE_TARGET_X86) && defined(CORRADE_TARGET_MSVC)
+#include <intrin.h>
+#endif
+
+#include "Corrade/Containers/EnumSet.hpp"
+#include "Corrade/Utility/Debug.h"
+
+namespace Corrade { namespace Utility { namespace Cpu {
+
+Features runtimeFeatures() {
+    #if defined(CORRADE_TARGET_X86) && defined(CORRADE_TARGET_MSVC)
+    /* Same as Implementation::runtimeFeatures() in the header, just with the
+       MSVC intrinsics. Not inline as MSVC doesn't support IFUNC anyway. */
+    Features features;
+
+    int cpuInfo[4];
+    __cpuid(cpuInfo, 0);
+    const int maxLeaf = cpuInfo[0];
+    if(maxLeaf < 1) return features;
+
+    __cpuid(cpuInfo, 1);
+    const int ecx = cpuInfo[2];
+    const int edx = cpuInfo[3];
+    if(edx & (1 << 26)) features |= Feature::Sse2;
+    if(ecx & (1 << 0)) features |= Feature::Sse3;
+    if(ecx & (1 << 9)) features |= Feature::Ssse3;
+    if(ecx & (1 << 19)) features |= Feature::Sse41;
+    if(ecx & (1 << 20)) features |= Feature::Sse42;
+    if(ecx & (1 << 23)) features |= Feature::Popcnt;
+
+    const unsigned long long xcr0 = (ecx & (1 << 27)) ? _xgetbv(0) : 0;
+    const bool avxUsable = (xcr0 & 0x06) == 0x06;
+    const bool avx512Usable = (xcr0 & 0xe6) == 0xe6;
+    if(avxUsable && (ecx & (1 << 28))) features |= Feature::Avx;
+
+    if(maxLeaf >= 7) {
+        __cpuidex(cpuInfo, 7, 0);
+        const int ebx = cpuInfo[1];
+        if(avxUsable && (ebx & (1 << 5))) features |= Feature::Avx2;
+        if(avx512Usable && (ebx & (1 << 16))) features |= Feature::Avx512f;
+        if(ebx & (1 << 3)) features |= Feature::Bmi1;
+        if(ebx & (1 << 8)) features |= Feature::Bmi2;
+        if(ebx & (1 << 29)) features |= Feature::Sha;
+    }
+
+    __cpuid(cpuInfo, 0x80000000);
+    if(unsigned(cpuInfo[0]) >= 0x80000001) {
+        __cpuid(cpuInfo, 0x80000001);
+        if(cpuInfo[2] & (1 << 5)) features |= Feature::Lzcnt;
+    }
+
+    return features;
+    #elif defined(CORRADE_TARGET_MSVC)
+    return compiledFeatures;
+    #else
+    return Implementation::runtimeFeatures();
+    #endif
+}
+
+Debug& operator<<(Debug& debug, const Feature value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case Feature::value: return debug << "Utility::Cpu::Feature::" #value;
+        _c(Sse2)
+        _c(Sse3)
+        _c(Ssse3)
+        _c(Sse41)
+        _c(Sse42)
+        _c(Avx)
+        _c(Avx2)
+        _c(Avx512f)
+        _c(Popcnt)
+        _c(Lzcnt)
+        _c(Bmi1)
+        _c(Bmi2)
+        _c(Sha)
+        _c(Neon)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Utility::Cpu::Feature(" << Debug::nospace << reinterpret_cast<void*>(std::uint32_t(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const Features value) {
+    return Containers::enumSetDebugOutput(debug, value, "Utility::Cpu::Features{}", {
+        Feature::Sse2,
+        Feature::Sse3,
+        Feature::Ssse3,
+        Feature::Sse41,
+        Feature::Sse42,
+        Feature::Avx,
+        Feature::Avx2,
+        Feature::Avx512f,
+        Feature::Popcnt,
+        Feature::Lzcnt,
+        Feature::Bmi1,
+        Feature::Bmi2,
+        Feature::Sha,
+        Feature::Neon});
+}
+
+}}}
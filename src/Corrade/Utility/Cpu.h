@@ -0,0 +1,855 @@
+#ifndef Corrade_Utility_Cpu_h
+#define Corrade_Utility_Cpu_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Namespace @ref Corrade::Utility::Cpu, enum @ref Corrade::Utility::Cpu::Feature, enum set @ref Corrade::Utility::Cpu::Features, macro @ref CORRADE_CPU_DISPATCHER(), @ref CORRADE_CPU_DISPATCHED_POINTER(), @ref CORRADE_CPU_DISPATCHED_IFUNC(), @ref CORRADE_ENABLE_SSE2, @ref CORRADE_ENABLE_SSE3, @ref CORRADE_ENABLE_SSSE3, @ref CORRADE_ENABLE_SSE41, @ref CORRADE_ENABLE_SSE42, @ref CORRADE_ENABLE_AVX, @ref CORRADE_ENABLE_AVX2, @ref CORRADE_ENABLE_AVX512F, @ref CORRADE_ENABLE_POPCNT, @ref CORRADE_ENABLE_LZCNT, @ref CORRADE_ENABLE_BMI1, @ref CORRADE_ENABLE_BMI2, @ref CORRADE_ENABLE_SHA, @ref CORRADE_ENABLE_NEON
+ * @m_since_latest
+ */
+
+#include <cstdint>
+
+#include "Corrade/Containers/EnumSet.h"
+#include "Corrade/Utility/Utility.h"
+#include "Corrade/Utility/visibility.h"
+
+#if defined(CORRADE_TARGET_X86) && defined(CORRADE_TARGET_GCC)
+#include <cpuid.h>
+#endif
+
+namespace Corrade { namespace Utility {
+
+/**
+@brief CPU feature detection and dispatch
+@m_since_latest
+
+Provides a way to pick the best implementation of a function for given CPU,
+either at compile time or at runtime.
+
+@section Utility-Cpu-tags Compile-time dispatch using tags
+
+Each instruction set in the x86 chain from SSE2 up to AVX-512 has a tag type,
+derived from the tag of the previous instruction set, with @ref ScalarT being
+the base of all. On ARM, @ref NeonT is derived directly from @ref ScalarT.
+Implementations of a function are then overloads taking a tag as the first
+argument, and overload resolution picks the most advanced one that's
+available for given tag. Calling such function with @ref DefaultBase, which is
+a tag for the most advanced instruction set enabled at compile time, picks
+the best implementation the compiler can produce code for:
+
+@snippet Utility.cpp Cpu-tags
+
+@section Utility-Cpu-runtime Runtime dispatch
+
+Enabling instruction sets at compile time means the resulting binary will run
+only on machines that support them. To build a portable binary that still
+makes use of the best instruction set available, the implementations are
+compiled for given instruction sets with the @ref CORRADE_ENABLE_SSE2 "CORRADE_ENABLE_*"
+function attributes instead, and the best one is picked based on
+@ref runtimeFeatures(). The @ref CORRADE_CPU_DISPATCHER() macro generates a
+dispatcher function that does exactly that for a set of overloads returning
+function pointers, and @ref CORRADE_CPU_DISPATCHED_POINTER() or
+@ref CORRADE_CPU_DISPATCHED_IFUNC() then resolve the dispatcher once at load
+time:
+
+@snippet Utility.cpp Cpu-dispatch
+
+If Corrade is built with @ref CORRADE_BUILD_CPU_RUNTIME_DISPATCH enabled, its
+own performance-critical code is dispatched this way as well. If
+@ref CORRADE_CPU_USE_IFUNC is enabled, it uses GNU IFUNC, which avoids the
+additional indirection of a function pointer.
+*/
+namespace Cpu {
+
+namespace Implementation {
+    struct InitT {};
+    constexpr InitT Init{};
+}
+
+/**
+@brief Scalar tag type
+@m_since_latest
+
+Base of all other tag types. See @ref Utility-Cpu-tags for more information.
+@see @ref Scalar
+*/
+struct ScalarT {
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    constexpr explicit ScalarT(Implementation::InitT) {}
+    #endif
+};
+
+/**
+@brief SSE2 tag type
+@m_since_latest
+
+See @ref Utility-Cpu-tags for more information.
+@see @ref Sse2, @ref Feature::Sse2
+*/
+struct Sse2T: ScalarT {
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    constexpr explicit Sse2T(Implementation::InitT): ScalarT{Implementation::Init} {}
+    #endif
+};
+
+/**
+@brief SSE3 tag type
+@m_since_latest
+
+See @ref Utility-Cpu-tags for more information.
+@see @ref Sse3, @ref Feature::Sse3
+*/
+struct Sse3T: Sse2T {
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    constexpr explicit Sse3T(Implementation::InitT): Sse2T{Implementation::Init} {}
+    #endif
+};
+
+/**
+@brief SSSE3 tag type
+@m_since_latest
+
+See @ref Utility-Cpu-tags for more information.
+@see @ref Ssse3, @ref Feature::Ssse3
+*/
+struct Ssse3T: Sse3T {
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    constexpr explicit Ssse3T(Implementation::InitT): Sse3T{Implementation::Init} {}
+    #endif
+};
+
+/**
+@brief SSE4.1 tag type
+@m_since_latest
+
+See @ref Utility-Cpu-tags for more information.
+@see @ref Sse41, @ref Feature::Sse41
+*/
+struct Sse41T: Ssse3T {
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    constexpr explicit Sse41T(Implementation::InitT): Ssse3T{Implementation::Init} {}
+    #endif
+};
+
+/**
+@brief SSE4.2 tag type
+@m_since_latest
+
+See @ref Utility-Cpu-tags for more information.
+@see @ref Sse42, @ref Feature::Sse42
+*/
+struct Sse42T: Sse41T {
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    constexpr explicit Sse42T(Implementation::InitT): Sse41T{Implementation::Init} {}
+    #endif
+};
+
+/**
+@brief AVX tag type
+@m_since_latest
+
+See @ref Utility-Cpu-tags for more information.
+@see @ref Avx, @ref Feature::Avx
+*/
+struct AvxT: Sse42T {
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    constexpr explicit AvxT(Implementation::InitT): Sse42T{Implementation::Init} {}
+    #endif
+};
+
+/**
+@brief AVX2 tag type
+@m_since_latest
+
+See @ref Utility-Cpu-tags for more information.
+@see @ref Avx2, @ref Feature::Avx2
+*/
+struct Avx2T: AvxT {
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    constexpr explicit Avx2T(Implementation::InitT): AvxT{Implementation::Init} {}
+    #endif
+};
+
+/**
+@brief AVX-512 Foundation tag type
+@m_since_latest
+
+See @ref Utility-Cpu-tags for more information.
+@see @ref Avx512f, @ref Feature::Avx512f
+*/
+struct Avx512fT: Avx2T {
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    constexpr explicit Avx512fT(Implementation::InitT): Avx2T{Implementation::Init} {}
+    #endif
+};
+
+/**
+@brief NEON tag type
+@m_since_latest
+
+See @ref Utility-Cpu-tags for more information.
+@see @ref Neon, @ref Feature::Neon
+*/
+struct NeonT: ScalarT {
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    constexpr explicit NeonT(Implementation::InitT): ScalarT{Implementation::Init} {}
+    #endif
+};
+
+/**
+@brief Scalar tag
+@m_since_latest
+*/
+constexpr ScalarT Scalar{Implementation::Init};
+
+/**
+@brief SSE2 tag
+@m_since_latest
+*/
+constexpr Sse2T Sse2{Implementation::Init};
+
+/**
+@brief SSE3 tag
+@m_since_latest
+*/
+constexpr Sse3T Sse3{Implementation::Init};
+
+/**
+@brief SSSE3 tag
+@m_since_latest
+*/
+constexpr Ssse3T Ssse3{Implementation::Init};
+
+/**
+@brief SSE4.1 tag
+@m_since_latest
+*/
+constexpr Sse41T Sse41{Implementation::Init};
+
+/**
+@brief SSE4.2 tag
+@m_since_latest
+*/
+constexpr Sse42T Sse42{Implementation::Init};
+
+/**
+@brief AVX tag
+@m_since_latest
+*/
+constexpr AvxT Avx{Implementation::Init};
+
+/**
+@brief AVX2 tag
+@m_since_latest
+*/
+constexpr Avx2T Avx2{Implementation::Init};
+
+/**
+@brief AVX-512 Foundation tag
+@m_since_latest
+*/
+constexpr Avx512fT Avx512f{Implementation::Init};
+
+/**
+@brief NEON tag
+@m_since_latest
+*/
+constexpr NeonT Neon{Implementation::Init};
+
+#ifdef DOXYGEN_GENERATING_OUTPUT
+/**
+@brief Default base tag type
+@m_since_latest
+
+Tag type of the most advanced instruction set in the x86 or ARM chain that's
+enabled at compile time. @ref ScalarT if none is.
+@see @ref DefaultBase, @ref compiledFeatures
+*/
+typedef ScalarT DefaultBaseT;
+#elif defined(CORRADE_TARGET_AVX512F)
+typedef Avx512fT DefaultBaseT;
+#elif defined(CORRADE_TARGET_AVX2)
+typedef Avx2T DefaultBaseT;
+#elif defined(CORRADE_TARGET_AVX)
+typedef AvxT DefaultBaseT;
+#elif defined(CORRADE_TARGET_SSE42)
+typedef Sse42T DefaultBaseT;
+#elif defined(CORRADE_TARGET_SSE41)
+typedef Sse41T DefaultBaseT;
+#elif defined(CORRADE_TARGET_SSSE3)
+typedef Ssse3T DefaultBaseT;
+#elif defined(CORRADE_TARGET_SSE3)
+typedef Sse3T DefaultBaseT;
+#elif defined(CORRADE_TARGET_SSE2)
+typedef Sse2T DefaultBaseT;
+#elif defined(CORRADE_TARGET_NEON)
+typedef NeonT DefaultBaseT;
+#else
+typedef ScalarT DefaultBaseT;
+#endif
+
+/**
+@brief Default base tag
+@m_since_latest
+
+See @ref DefaultBaseT and @ref Utility-Cpu-tags for more information.
+*/
+constexpr DefaultBaseT DefaultBase{Implementation::Init};
+
+/**
+@brief CPU feature
+@m_since_latest
+
+@see @ref Features, @ref compiledFeatures, @ref runtimeFeatures()
+*/
+enum class Feature: std::uint32_t {
+    /**
+     * SSE2. Available on all 64-bit x86 CPUs.
+     * @see @ref Sse2T, @ref CORRADE_TARGET_SSE2, @ref CORRADE_ENABLE_SSE2
+     */
+    Sse2 = 1 << 0,
+
+    /**
+     * SSE3
+     * @see @ref Sse3T, @ref CORRADE_TARGET_SSE3, @ref CORRADE_ENABLE_SSE3
+     */
+    Sse3 = 1 << 1,
+
+    /**
+     * SSSE3
+     * @see @ref Ssse3T, @ref CORRADE_TARGET_SSSE3, @ref CORRADE_ENABLE_SSSE3
+     */
+    Ssse3 = 1 << 2,
+
+    /**
+     * SSE4.1
+     * @see @ref Sse41T, @ref CORRADE_TARGET_SSE41, @ref CORRADE_ENABLE_SSE41
+     */
+    Sse41 = 1 << 3,
+
+    /**
+     * SSE4.2, including the CRC32 instruction
+     * @see @ref Sse42T, @ref CORRADE_TARGET_SSE42, @ref CORRADE_ENABLE_SSE42
+     */
+    Sse42 = 1 << 4,
+
+    /**
+     * AVX. Reported by @ref runtimeFeatures() only if the operating system
+     * saves the AVX registers on context switch as well.
+     * @see @ref AvxT, @ref CORRADE_TARGET_AVX, @ref CORRADE_ENABLE_AVX
+     */
+    Avx = 1 << 5,
+
+    /**
+     * AVX2. Reported by @ref runtimeFeatures() only if the operating system
+     * saves the AVX registers on context switch as well.
+     * @see @ref Avx2T, @ref CORRADE_TARGET_AVX2, @ref CORRADE_ENABLE_AVX2
+     */
+    Avx2 = 1 << 6,
+
+    /**
+     * AVX-512 Foundation. Reported by @ref runtimeFeatures() only if the
+     * operating system saves the AVX-512 registers on context switch as well.
+     * @see @ref Avx512fT, @ref CORRADE_TARGET_AVX512F,
+     *      @ref CORRADE_ENABLE_AVX512F
+     */
+    Avx512f = 1 << 7,
+
+    /**
+     * POPCNT
+     * @see @ref CORRADE_TARGET_POPCNT, @ref CORRADE_ENABLE_POPCNT
+     */
+    Popcnt = 1 << 8,
+
+    /**
+     * LZCNT
+     * @see @ref CORRADE_TARGET_LZCNT, @ref CORRADE_ENABLE_LZCNT
+     */
+    Lzcnt = 1 << 9,
+
+    /**
+     * BMI1
+     * @see @ref CORRADE_TARGET_BMI1, @ref CORRADE_ENABLE_BMI1
+     */
+    Bmi1 = 1 << 10,
+
+    /**
+     * BMI2
+     * @see @ref CORRADE_TARGET_BMI2, @ref CORRADE_ENABLE_BMI2
+     */
+    Bmi2 = 1 << 11,
+
+    /**
+     * SHA extensions
+     * @see @ref CORRADE_TARGET_SHA, @ref CORRADE_ENABLE_SHA
+     */
+    Sha = 1 << 12,
+
+    /**
+     * NEON. Reported by @ref runtimeFeatures() only if enabled at compile
+     * time, as there's no portable way to detect it at runtime.
+     * @see @ref NeonT, @ref CORRADE_TARGET_NEON, @ref CORRADE_ENABLE_NEON
+     */
+    Neon = 1 << 13
+};
+
+/**
+@brief CPU features
+@m_since_latest
+
+@see @ref compiledFeatures, @ref runtimeFeatures()
+*/
+typedef Containers::EnumSet<Feature> Features;
+
+CORRADE_ENUMSET_OPERATORS(Features)
+
+/** @debugoperatorenum{Feature} */
+CORRADE_UTILITY_EXPORT Debug& operator<<(Debug& debug, Feature value);
+
+/** @debugoperatorenum{Features} */
+CORRADE_UTILITY_EXPORT Debug& operator<<(Debug& debug, Features value);
+
+/**
+@brief Features enabled at compile time
+@m_since_latest
+
+Based on the @ref CORRADE_TARGET_SSE2 "CORRADE_TARGET_*" macros. Always a
+subset of @ref runtimeFeatures().
+*/
+constexpr Features compiledFeatures = Features{}
+    #ifdef CORRADE_TARGET_SSE2
+    |Feature::Sse2
+    #endif
+    #ifdef CORRADE_TARGET_SSE3
+    |Feature::Sse3
+    #endif
+    #ifdef CORRADE_TARGET_SSSE3
+    |Feature::Ssse3
+    #endif
+    #ifdef CORRADE_TARGET_SSE41
+    |Feature::Sse41
+    #endif
+    #ifdef CORRADE_TARGET_SSE42
+    |Feature::Sse42
+    #endif
+    #ifdef CORRADE_TARGET_AVX
+    |Feature::Avx
+    #endif
+    #ifdef CORRADE_TARGET_AVX2
+    |Feature::Avx2
+    #endif
+    #ifdef CORRADE_TARGET_AVX512F
+    |Feature::Avx512f
+    #endif
+    #ifdef CORRADE_TARGET_POPCNT
+    |Feature::Popcnt
+    #endif
+    #ifdef CORRADE_TARGET_LZCNT
+    |Feature::Lzcnt
+    #endif
+    #ifdef CORRADE_TARGET_BMI1
+    |Feature::Bmi1
+    #endif
+    #ifdef CORRADE_TARGET_BMI2
+    |Feature::Bmi2
+    #endif
+    #ifdef CORRADE_TARGET_SHA
+    |Feature::Sha
+    #endif
+    #ifdef CORRADE_TARGET_NEON
+    |Feature::Neon
+    #endif
+    ;
+
+#if defined(CORRADE_TARGET_X86) && defined(CORRADE_TARGET_GCC)
+namespace Implementation {
+
+/* Inline so it can be called from IFUNC resolvers, which may run before
+   relocations of the library containing them are processed and thus can't
+   call any external function */
+inline Features runtimeFeatures() {
+    Features features;
+
+    unsigned int eax, ebx, ecx, edx;
+    const unsigned int maxLeaf = __get_cpuid_max(0, nullptr);
+    if(maxLeaf < 1) return features;
+
+    __cpuid(1, eax, ebx, ecx, edx);
+    if(edx & (1 << 26)) features |= Feature::Sse2;
+    if(ecx & (1 << 0)) features |= Feature::Sse3;
+    if(ecx & (1 << 9)) features |= Feature::Ssse3;
+    if(ecx & (1 << 19)) features |= Feature::Sse41;
+    if(ecx & (1 << 20)) features |= Feature::Sse42;
+    if(ecx & (1 << 23)) features |= Feature::Popcnt;
+
+    /* AVX registers are usable only if the OS saves them on context switch,
+       which is reported by XGETBV if OSXSAVE is set. Bits 1 and 2 are the
+       SSE and AVX state, bits 5 to 7 the AVX-512 state. */
+    unsigned int xcr0 = 0;
+    if(ecx & (1 << 27)) {
+        unsigned int xcr0High;
+        __asm__("xgetbv" : "=a"(xcr0), "=d"(xcr0High) : "c"(0));
+    }
+    const bool avxUsable = (xcr0 & 0x06) == 0x06;
+    const bool avx512Usable = (xcr0 & 0xe6) == 0xe6;
+    if(avxUsable && (ecx & (1 << 28))) features |= Feature::Avx;
+
+    if(maxLeaf >= 7) {
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        if(avxUsable && (ebx & (1 << 5))) features |= Feature::Avx2;
+        if(avx512Usable && (ebx & (1 << 16))) features |= Feature::Avx512f;
+        if(ebx & (1 << 3)) features |= Feature::Bmi1;
+        if(ebx & (1 << 8)) features |= Feature::Bmi2;
+        if(ebx & (1 << 29)) features |= Feature::Sha;
+    }
+
+    if(__get_cpuid_max(0x80000000, nullptr) >= 0x80000001) {
+        __cpuid(0x80000001, eax, ebx, ecx, edx);
+        if(ecx & (1 << 5)) features |= Feature::Lzcnt;
+    }
+
+    return features;
+}
+
+}
+#elif !defined(CORRADE_TARGET_MSVC)
+namespace Implementation {
+
+inline Features runtimeFeatures() {
+    return compiledFeatures;
+}
+
+}
+#endif
+
+/**
+@brief Detect features available at runtime
+@m_since_latest
+
+On x86 uses the CPUID instruction. On other platforms returns
+@ref compiledFeatures, as there's no portable way to query CPU features at
+runtime. The result isn't cached, so it's recommended to call the function
+just once and reuse the result, such as with @ref CORRADE_CPU_DISPATCHED_POINTER()
+or @ref CORRADE_CPU_DISPATCHED_IFUNC().
+*/
+CORRADE_UTILITY_EXPORT Features runtimeFeatures();
+
+}
+
+}}
+
+#ifdef DOXYGEN_GENERATING_OUTPUT
+/**
+@brief Enable SSE2 for given function
+@m_since_latest
+
+On GCC 4.9+ and Clang expands to @cpp __attribute__((__target__("sse2"))) @ce,
+allowing the compiler to use SSE2 instructions and intrinsics in given function
+even if they're not enabled for the whole translation unit. On MSVC, where
+this isn't needed, expands to nothing. Defined only on x86 and, with older GCC
+versions, only if @ref CORRADE_TARGET_SSE2 is defined.
+
+The other @cpp CORRADE_ENABLE_* @ce macros are analogous.
+@see @ref Utility-Cpu-runtime
+*/
+#define CORRADE_ENABLE_SSE2
+
+/**
+@brief Enable SSE3 for given function
+@m_since_latest
+
+See @ref CORRADE_ENABLE_SSE2 for more information.
+*/
+#define CORRADE_ENABLE_SSE3
+
+/**
+@brief Enable SSSE3 for given function
+@m_since_latest
+
+See @ref CORRADE_ENABLE_SSE2 for more information.
+*/
+#define CORRADE_ENABLE_SSSE3
+
+/**
+@brief Enable SSE4.1 for given function
+@m_since_latest
+
+See @ref CORRADE_ENABLE_SSE2 for more information.
+*/
+#define CORRADE_ENABLE_SSE41
+
+/**
+@brief Enable SSE4.2 for given function
+@m_since_latest
+
+See @ref CORRADE_ENABLE_SSE2 for more information.
+*/
+#define CORRADE_ENABLE_SSE42
+
+/**
+@brief Enable AVX for given function
+@m_since_latest
+
+See @ref CORRADE_ENABLE_SSE2 for more information.
+*/
+#define CORRADE_ENABLE_AVX
+
+/**
+@brief Enable AVX2 for given function
+@m_since_latest
+
+See @ref CORRADE_ENABLE_SSE2 for more information.
+*/
+#define CORRADE_ENABLE_AVX2
+
+/**
+@brief Enable AVX-512 Foundation for given function
+@m_since_latest
+
+See @ref CORRADE_ENABLE_SSE2 for more information.
+*/
+#define CORRADE_ENABLE_AVX512F
+
+/**
+@brief Enable POPCNT for given function
+@m_since_latest
+
+See @ref CORRADE_ENABLE_SSE2 for more information.
+*/
+#define CORRADE_ENABLE_POPCNT
+
+/**
+@brief Enable LZCNT for given function
+@m_since_latest
+
+See @ref CORRADE_ENABLE_SSE2 for more information.
+*/
+#define CORRADE_ENABLE_LZCNT
+
+/**
+@brief Enable BMI1 for given function
+@m_since_latest
+
+See @ref CORRADE_ENABLE_SSE2 for more information.
+*/
+#define CORRADE_ENABLE_BMI1
+
+/**
+@brief Enable BMI2 for given function
+@m_since_latest
+
+See @ref CORRADE_ENABLE_SSE2 for more information.
+*/
+#define CORRADE_ENABLE_BMI2
+
+/**
+@brief Enable SHA for given function
+@m_since_latest
+
+See @ref CORRADE_ENABLE_SSE2 for more information. As all CPUs with the SHA
+extensions support SSE4.1 as well and the SHA instructions are rarely useful
+without the SSSE3 and SSE4.1 shuffles and extracts, enables SSE4.1 too. Code
+dispatched to a function with this attribute should thus check for both
+@ref Utility::Cpu::Feature::Sha and @ref Utility::Cpu::Feature::Sse41.
+*/
+#define CORRADE_ENABLE_SHA
+
+/**
+@brief Enable NEON for given function
+@m_since_latest
+
+Expands to nothing. Defined only if @ref CORRADE_TARGET_NEON is defined, as
+NEON can't be enabled just for a single function on all compilers.
+*/
+#define CORRADE_ENABLE_NEON
+#elif defined(CORRADE_TARGET_X86) && (defined(CORRADE_TARGET_CLANG) || (defined(CORRADE_TARGET_GCC) && __GNUC__*100 + __GNUC_MINOR__ >= 409))
+#define CORRADE_ENABLE_SSE2 __attribute__((__target__("sse2")))
+#define CORRADE_ENABLE_SSE3 __attribute__((__target__("sse3")))
+#define CORRADE_ENABLE_SSSE3 __attribute__((__target__("ssse3")))
+#define CORRADE_ENABLE_SSE41 __attribute__((__target__("sse4.1")))
+#define CORRADE_ENABLE_SSE42 __attribute__((__target__("sse4.2")))
+#define CORRADE_ENABLE_AVX __attribute__((__target__("avx")))
+#define CORRADE_ENABLE_AVX2 __attribute__((__target__("avx2")))
+#define CORRADE_ENABLE_AVX512F __attribute__((__target__("avx512f")))
+#define CORRADE_ENABLE_POPCNT __attribute__((__target__("popcnt")))
+#define CORRADE_ENABLE_LZCNT __attribute__((__target__("lzcnt")))
+#define CORRADE_ENABLE_BMI1 __attribute__((__target__("bmi")))
+#define CORRADE_ENABLE_BMI2 __attribute__((__target__("bmi2")))
+#define CORRADE_ENABLE_SHA __attribute__((__target__("sha,sse4.1")))
+#elif defined(CORRADE_TARGET_X86) && defined(CORRADE_TARGET_MSVC)
+/* MSVC allows using any intrinsics anywhere */
+#define CORRADE_ENABLE_SSE2
+#define CORRADE_ENABLE_SSE3
+#define CORRADE_ENABLE_SSSE3
+#define CORRADE_ENABLE_SSE41
+#define CORRADE_ENABLE_SSE42
+#define CORRADE_ENABLE_AVX
+#define CORRADE_ENABLE_AVX2
+#define CORRADE_ENABLE_AVX512F
+#define CORRADE_ENABLE_POPCNT
+#define CORRADE_ENABLE_LZCNT
+#define CORRADE_ENABLE_BMI1
+#define CORRADE_ENABLE_BMI2
+#define CORRADE_ENABLE_SHA
+#else
+/* Older GCC can't use intrinsics of instruction sets not enabled for the
+   whole translation unit, so only the compiled ones are usable there */
+#ifdef CORRADE_TARGET_SSE2
+#define CORRADE_ENABLE_SSE2
+#endif
+#ifdef CORRADE_TARGET_SSE3
+#define CORRADE_ENABLE_SSE3
+#endif
+#ifdef CORRADE_TARGET_SSSE3
+#define CORRADE_ENABLE_SSSE3
+#endif
+#ifdef CORRADE_TARGET_SSE41
+#define CORRADE_ENABLE_SSE41
+#endif
+#ifdef CORRADE_TARGET_SSE42
+#define CORRADE_ENABLE_SSE42
+#endif
+#ifdef CORRADE_TARGET_AVX
+#define CORRADE_ENABLE_AVX
+#endif
+#ifdef CORRADE_TARGET_AVX2
+#define CORRADE_ENABLE_AVX2
+#endif
+#ifdef CORRADE_TARGET_AVX512F
+#define CORRADE_ENABLE_AVX512F
+#endif
+#ifdef CORRADE_TARGET_POPCNT
+#define CORRADE_ENABLE_POPCNT
+#endif
+#ifdef CORRADE_TARGET_LZCNT
+#define CORRADE_ENABLE_LZCNT
+#endif
+#ifdef CORRADE_TARGET_BMI1
+#define CORRADE_ENABLE_BMI1
+#endif
+#ifdef CORRADE_TARGET_BMI2
+#define CORRADE_ENABLE_BMI2
+#endif
+#if defined(CORRADE_TARGET_SHA) && defined(CORRADE_TARGET_SSE41)
+#define CORRADE_ENABLE_SHA
+#endif
+#endif
+
+#if !defined(DOXYGEN_GENERATING_OUTPUT) && defined(CORRADE_TARGET_NEON)
+#define CORRADE_ENABLE_NEON
+#endif
+
+/**
+@brief Define a runtime dispatcher function
+@m_since_latest
+
+Defines a function named @p dispatcher taking @ref Corrade::Utility::Cpu::Features "Utility::Cpu::Features"
+and returning the result of calling @p function with a tag of the most
+advanced instruction set present in the features. The @p function is expected
+to be a set of overloads taking a tag and returning a function pointer, as
+shown in @ref Utility-Cpu-runtime. On x86 the instruction sets from
+@ref Corrade::Utility::Cpu::Avx512f "Avx512f" to
+@ref Corrade::Utility::Cpu::Sse2 "Sse2" are tried, picking the first for
+which all instruction sets down to SSE2 are present, on ARM
+@ref Corrade::Utility::Cpu::Neon "Neon" is tried, with
+@ref Corrade::Utility::Cpu::Scalar "Scalar" being the fallback everywhere.
+Extra instruction sets such as @ref Corrade::Utility::Cpu::Feature::Popcnt "Feature::Popcnt"
+or @ref Corrade::Utility::Cpu::Feature::Sha "Feature::Sha" aren't handled,
+write the dispatcher manually for those.
+*/
+#if defined(CORRADE_TARGET_X86) || defined(DOXYGEN_GENERATING_OUTPUT)
+#define CORRADE_CPU_DISPATCHER(dispatcher, function)                        \
+    auto dispatcher(const Corrade::Utility::Cpu::Features features) -> decltype(function(Corrade::Utility::Cpu::Scalar)) { \
+        using namespace Corrade::Utility::Cpu;                              \
+        constexpr Features sse2 = Feature::Sse2;                            \
+        constexpr Features sse3 = sse2|Feature::Sse3;                       \
+        constexpr Features ssse3 = sse3|Feature::Ssse3;                     \
+        constexpr Features sse41 = ssse3|Feature::Sse41;                    \
+        constexpr Features sse42 = sse41|Feature::Sse42;                    \
+        constexpr Features avx = sse42|Feature::Avx;                        \
+        constexpr Features avx2 = avx|Feature::Avx2;                        \
+        constexpr Features avx512f = avx2|Feature::Avx512f;                 \
+        if(features >= avx512f) return function(Avx512f);                   \
+        if(features >= avx2) return function(Avx2);                         \
+        if(features >= avx) return function(Avx);                           \
+        if(features >= sse42) return function(Sse42);                       \
+        if(features >= sse41) return function(Sse41);                       \
+        if(features >= ssse3) return function(Ssse3);                       \
+        if(features >= sse3) return function(Sse3);                         \
+        if(features >= sse2) return function(Sse2);                         \
+        return function(Scalar);                                            \
+    }
+#elif defined(CORRADE_TARGET_ARM)
+#define CORRADE_CPU_DISPATCHER(dispatcher, function)                        \
+    auto dispatcher(const Corrade::Utility::Cpu::Features features) -> decltype(function(Corrade::Utility::Cpu::Scalar)) { \
+        using namespace Corrade::Utility::Cpu;                              \
+        if(features & Feature::Neon) return function(Neon);                 \
+        return function(Scalar);                                            \
+    }
+#else
+#define CORRADE_CPU_DISPATCHER(dispatcher, function)                        \
+    auto dispatcher(Corrade::Utility::Cpu::Features) -> decltype(function(Corrade::Utility::Cpu::Scalar)) { \
+        return function(Corrade::Utility::Cpu::Scalar);                     \
+    }
+#endif
+
+/**
+@brief Function pointer resolved by a runtime dispatcher
+@m_since_latest
+
+Expands to a declaration of a function pointer given in the variadic
+arguments, initialized at load time with the result of calling @p dispatcher
+with @ref Corrade::Utility::Cpu::runtimeFeatures() "Utility::Cpu::runtimeFeatures()".
+The dispatcher is usually defined with @ref CORRADE_CPU_DISPATCHER(). Calling
+the function involves an indirect call.
+@see @ref CORRADE_CPU_DISPATCHED_IFUNC()
+*/
+#define CORRADE_CPU_DISPATCHED_POINTER(dispatcher, ...)                     \
+    __VA_ARGS__ = dispatcher(Corrade::Utility::Cpu::runtimeFeatures());
+
+#if defined(CORRADE_CPU_USE_IFUNC) || defined(DOXYGEN_GENERATING_OUTPUT)
+/**
+@brief Function resolved by a runtime dispatcher using GNU IFUNC
+@m_since_latest
+
+Expands to a declaration of a function given in the variadic arguments, which
+the dynamic linker resolves at load time to the result of calling
+@p dispatcher with the CPU features detected at runtime. Compared to
+@ref CORRADE_CPU_DISPATCHED_POINTER() there's no additional indirection when
+calling the function. The dispatcher is usually defined with
+@ref CORRADE_CPU_DISPATCHER() and has to be defined in the same translation
+unit. Defined only if @ref CORRADE_CPU_USE_IFUNC is enabled.
+*/
+#define CORRADE_CPU_DISPATCHED_IFUNC(dispatcher, ...)                       \
+    extern "C" {                                                            \
+        static decltype(dispatcher(Corrade::Utility::Cpu::Features{})) dispatcher ## Ifunc() { \
+            return dispatcher(Corrade::Utility::Cpu::Implementation::runtimeFeatures()); \
+        }                                                                   \
+    }                                                                       \
+    __VA_ARGS__ __attribute__((ifunc(#dispatcher "Ifunc")));
+#endif
+
+#endif
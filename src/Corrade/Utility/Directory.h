@@ -534,6 +534,10 @@ not exist yet, it is created, if it exists, it's truncated --- thus no data
 is preserved. The array deleter takes care of unmapping, however the file is
 not deleted after unmapping. If an error occurs, @cpp nullptr @ce is returned
 and a message is printed to @ref Error. Expects that the filename is in UTF-8.
+
+The returned array has a fixed size. Use @ref Containers::arrayMapFileWrite()
+together with @ref Containers::ArrayMappedFileAllocator if you need to grow
+it.
 @see @ref map(), @ref mapRead(), @ref read(), @ref write()
 @partialsupport Available only on @ref CORRADE_TARGET_UNIX "Unix" and non-RT
     @ref CORRADE_TARGET_WINDOWS "Windows" platforms.
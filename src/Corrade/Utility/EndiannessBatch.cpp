@@ -0,0 +1,298 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "EndiannessBatch.h"
+
+#include <cstring>
+#include <type_traits>
+
+#include "Corrade/Utility/Cpu.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef CORRADE_ENABLE_SSSE3
+#include <tmmintrin.h>
+#endif
+#ifdef CORRADE_ENABLE_AVX2
+#include <immintrin.h>
+#endif
+#ifdef CORRADE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
+#include "Corrade/Utility/Algorithms.h"
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/Debug.h"
+#include "Corrade/Utility/Macros.h"
+
+namespace Corrade { namespace Utility { namespace Endianness { namespace Implementation {
+
+namespace {
+
+/* Swaps count values from src to dst. The pointers can be the same for an
+   in-place swap but otherwise the memory shouldn't overlap. Neither of them
+   is expected to be aligned. */
+typedef void(*SwapFunction)(const char*, char*, std::size_t);
+
+/* Scalar variant, also used for the remainder that didn't fit into a full
+   SIMD block. Going through memcpy() to not need any alignment. */
+template<class T> inline void swapScalar(const char* src, const char* const end, char* dst) {
+    for(; src != end; src += sizeof(T), dst += sizeof(T)) {
+        T value;
+        std::memcpy(&value, src, sizeof(T));
+        value = swap(value);
+        std::memcpy(dst, &value, sizeof(T));
+    }
+}
+
+template<class T> SwapFunction swapImplementation(Cpu::ScalarT) {
+    return [](const char* const src, char* const dst, const std::size_t count) {
+        swapScalar<T>(src, src + count*sizeof(T), dst);
+    };
+}
+
+#if defined(CORRADE_ENABLE_SSSE3) || defined(CORRADE_ENABLE_AVX2)
+/* Byte shuffle masks reversing the order of bytes in each 2-, 4- and 8-byte
+   value of a 16-byte block. For AVX2 the same mask is used for both 128-bit
+   lanes, as _mm256_shuffle_epi8() can't cross them anyway. */
+CORRADE_ALIGNAS(16) const char SwapShuffle2[16]{
+    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
+};
+CORRADE_ALIGNAS(16) const char SwapShuffle4[16]{
+    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12
+};
+CORRADE_ALIGNAS(16) const char SwapShuffle8[16]{
+    7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8
+};
+
+inline const char* swapShuffle(std::integral_constant<std::size_t, 2>) {
+    return SwapShuffle2;
+}
+inline const char* swapShuffle(std::integral_constant<std::size_t, 4>) {
+    return SwapShuffle4;
+}
+inline const char* swapShuffle(std::integral_constant<std::size_t, 8>) {
+    return SwapShuffle8;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+/* Plain SSE2 has no byte shuffle, so the 16-bit halves are swapped first
+   using word shuffles and then bytes in each of them using shifts */
+CORRADE_ENABLE_SSE2 inline __m128i swapBlockSse2(const __m128i value, std::integral_constant<std::size_t, 2>) {
+    return _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+}
+CORRADE_ENABLE_SSE2 inline __m128i swapBlockSse2(const __m128i value, std::integral_constant<std::size_t, 4>) {
+    return swapBlockSse2(_mm_shufflehi_epi16(_mm_shufflelo_epi16(value, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1)), std::integral_constant<std::size_t, 2>{});
+}
+CORRADE_ENABLE_SSE2 inline __m128i swapBlockSse2(const __m128i value, std::integral_constant<std::size_t, 8>) {
+    return swapBlockSse2(_mm_shufflehi_epi16(_mm_shufflelo_epi16(value, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3)), std::integral_constant<std::size_t, 2>{});
+}
+
+template<class T> CORRADE_ENABLE_SSE2 void swapSse2(const char* src, char* dst, const std::size_t count) {
+    const char* const end = src + count*sizeof(T);
+    for(; end - src >= 16; src += 16, dst += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), swapBlockSse2(block, std::integral_constant<std::size_t, sizeof(T)>{}));
+    }
+    swapScalar<T>(src, end, dst);
+}
+
+template<class T> SwapFunction swapImplementation(Cpu::Sse2T) {
+    return swapSse2<T>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSSE3
+template<class T> CORRADE_ENABLE_SSSE3 void swapSsse3(const char* src, char* dst, const std::size_t count) {
+    const char* const end = src + count*sizeof(T);
+    const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(swapShuffle(std::integral_constant<std::size_t, sizeof(T)>{})));
+    for(; end - src >= 16; src += 16, dst += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_shuffle_epi8(block, mask));
+    }
+    swapScalar<T>(src, end, dst);
+}
+
+template<class T> SwapFunction swapImplementation(Cpu::Ssse3T) {
+    return swapSsse3<T>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+template<class T> CORRADE_ENABLE_AVX2 void swapAvx2(const char* src, char* dst, const std::size_t count) {
+    const char* const end = src + count*sizeof(T);
+    const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(swapShuffle(std::integral_constant<std::size_t, sizeof(T)>{})));
+    const __m256i mask2 = _mm256_broadcastsi128_si256(mask);
+    for(; end - src >= 32; src += 32, dst += 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_shuffle_epi8(block, mask2));
+    }
+    /* At most one 16-byte block remaining */
+    if(end - src >= 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_shuffle_epi8(block, mask));
+        src += 16;
+        dst += 16;
+    }
+    swapScalar<T>(src, end, dst);
+}
+
+template<class T> SwapFunction swapImplementation(Cpu::Avx2T) {
+    return swapAvx2<T>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_NEON
+inline uint8x16_t swapBlockNeon(const uint8x16_t value, std::integral_constant<std::size_t, 2>) {
+    return vrev16q_u8(value);
+}
+inline uint8x16_t swapBlockNeon(const uint8x16_t value, std::integral_constant<std::size_t, 4>) {
+    return vrev32q_u8(value);
+}
+inline uint8x16_t swapBlockNeon(const uint8x16_t value, std::integral_constant<std::size_t, 8>) {
+    return vrev64q_u8(value);
+}
+
+template<class T> void swapNeon(const char* src, char* dst, const std::size_t count) {
+    const char* const end = src + count*sizeof(T);
+    for(; end - src >= 16; src += 16, dst += 16) {
+        const uint8x16_t block = vld1q_u8(reinterpret_cast<const std::uint8_t*>(src));
+        vst1q_u8(reinterpret_cast<std::uint8_t*>(dst), swapBlockNeon(block, std::integral_constant<std::size_t, sizeof(T)>{}));
+    }
+    swapScalar<T>(src, end, dst);
+}
+
+template<class T> SwapFunction swapImplementation(Cpu::NeonT) {
+    return swapNeon<T>;
+}
+#endif
+
+#ifdef CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+CORRADE_CPU_DISPATCHER(swap2Dispatcher, swapImplementation<std::uint16_t>)
+CORRADE_CPU_DISPATCHER(swap4Dispatcher, swapImplementation<std::uint32_t>)
+CORRADE_CPU_DISPATCHER(swap8Dispatcher, swapImplementation<std::uint64_t>)
+#ifdef CORRADE_CPU_USE_IFUNC
+CORRADE_CPU_DISPATCHED_IFUNC(swap2Dispatcher, void swapContiguous2(const char*, char*, std::size_t))
+CORRADE_CPU_DISPATCHED_IFUNC(swap4Dispatcher, void swapContiguous4(const char*, char*, std::size_t))
+CORRADE_CPU_DISPATCHED_IFUNC(swap8Dispatcher, void swapContiguous8(const char*, char*, std::size_t))
+#else
+CORRADE_CPU_DISPATCHED_POINTER(swap2Dispatcher, SwapFunction swapContiguous2)
+CORRADE_CPU_DISPATCHED_POINTER(swap4Dispatcher, SwapFunction swapContiguous4)
+CORRADE_CPU_DISPATCHED_POINTER(swap8Dispatcher, SwapFunction swapContiguous8)
+#endif
+#else
+/* Picking the best variant enabled at compile time. The function pointer is
+   a constant expression so the compiler can call the variant directly. */
+void swapContiguous2(const char* const src, char* const dst, const std::size_t count) {
+    swapImplementation<std::uint16_t>(Cpu::DefaultBase)(src, dst, count);
+}
+void swapContiguous4(const char* const src, char* const dst, const std::size_t count) {
+    swapImplementation<std::uint32_t>(Cpu::DefaultBase)(src, dst, count);
+}
+void swapContiguous8(const char* const src, char* const dst, const std::size_t count) {
+    swapImplementation<std::uint64_t>(Cpu::DefaultBase)(src, dst, count);
+}
+#endif
+
+inline void swapContiguous(std::uint16_t, const char* const src, char* const dst, const std::size_t count) {
+    swapContiguous2(src, dst, count);
+}
+inline void swapContiguous(std::uint32_t, const char* const src, char* const dst, const std::size_t count) {
+    swapContiguous4(src, dst, count);
+}
+inline void swapContiguous(std::uint64_t, const char* const src, char* const dst, const std::size_t count) {
+    swapContiguous8(src, dst, count);
+}
+
+template<class T> void swapInPlaceImplementation(const Containers::StridedArrayView1D<T>& values) {
+    if(values.isContiguous()) {
+        char* const data = static_cast<char*>(values.data());
+        return swapContiguous(T{}, data, data, values.size());
+    }
+
+    for(T& value: values) value = swap(value);
+}
+
+template<class T> void swapIntoImplementation(const Containers::StridedArrayView1D<const T>& src, const Containers::StridedArrayView1D<T>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Utility::Endianness::swapInto(): sizes" << src.size() << "and" << dst.size() << "don't match", );
+
+    if(src.isContiguous() && dst.isContiguous())
+        return swapContiguous(T{}, static_cast<const char*>(src.data()), static_cast<char*>(dst.data()), src.size());
+
+    for(std::size_t i = 0; i != src.size(); ++i) dst[i] = swap(src[i]);
+}
+
+}
+
+void swapInPlaceBatch(const Containers::StridedArrayView1D<std::uint16_t>& values) {
+    swapInPlaceImplementation(values);
+}
+
+void swapInPlaceBatch(const Containers::StridedArrayView1D<std::uint32_t>& values) {
+    swapInPlaceImplementation(values);
+}
+
+void swapInPlaceBatch(const Containers::StridedArrayView1D<std::uint64_t>& values) {
+    swapInPlaceImplementation(values);
+}
+
+void swapIntoBatch(const Containers::StridedArrayView1D<const std::uint8_t>& src, const Containers::StridedArrayView1D<std::uint8_t>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Utility::Endianness::swapInto(): sizes" << src.size() << "and" << dst.size() << "don't match", );
+
+    /* Nothing to swap, just copy */
+    Utility::copy(src, dst);
+}
+
+void swapIntoBatch(const Containers::StridedArrayView1D<const std::uint16_t>& src, const Containers::StridedArrayView1D<std::uint16_t>& dst) {
+    swapIntoImplementation(src, dst);
+}
+
+void swapIntoBatch(const Containers::StridedArrayView1D<const std::uint32_t>& src, const Containers::StridedArrayView1D<std::uint32_t>& dst) {
+    swapIntoImplementation(src, dst);
+}
+
+void swapIntoBatch(const Containers::StridedArrayView1D<const std::uint64_t>& src, const Containers::StridedArrayView1D<std::uint64_t>& dst) {
+    swapIntoImplementation(src, dst);
+}
+
+void copyBatch(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<char>& dst) {
+    /* Called only from the variant that doesn't need to swap on this
+       platform */
+    #ifndef CORRADE_TARGET_BIG_ENDIAN
+    CORRADE_ASSERT(src.size()[0] == dst.size()[0],
+        "Utility::Endianness::littleEndianInto(): sizes" << src.size()[0] << "and" << dst.size()[0] << "don't match", );
+    #else
+    CORRADE_ASSERT(src.size()[0] == dst.size()[0],
+        "Utility::Endianness::bigEndianInto(): sizes" << src.size()[0] << "and" << dst.size()[0] << "don't match", );
+    #endif
+
+    Utility::copy(src, dst);
+}
+
+}}}}
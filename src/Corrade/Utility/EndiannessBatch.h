@@ -32,29 +32,53 @@
 
 #include "Corrade/Containers/StridedArrayView.h"
 #include "Corrade/Utility/Endianness.h"
+#include "Corrade/Utility/visibility.h"
 
 namespace Corrade { namespace Utility { namespace Endianness {
 
 namespace Implementation {
-    template<class T> inline void swapInPlace(const Containers::StridedArrayView1D<T>& values) {
-        /** @todo maybe we could speed this up via some SIMD? also, what about
-            alignment? */
-        for(T& value: values) Implementation::swapInPlace(value);
-    }
+    /* Contiguous views are processed with SIMD kernels, strided views with a
+       scalar loop */
+    inline void swapInPlaceBatch(const Containers::StridedArrayView1D<std::uint8_t>&) {}
+    CORRADE_UTILITY_EXPORT void swapInPlaceBatch(const Containers::StridedArrayView1D<std::uint16_t>& values);
+    CORRADE_UTILITY_EXPORT void swapInPlaceBatch(const Containers::StridedArrayView1D<std::uint32_t>& values);
+    CORRADE_UTILITY_EXPORT void swapInPlaceBatch(const Containers::StridedArrayView1D<std::uint64_t>& values);
+
+    CORRADE_UTILITY_EXPORT void swapIntoBatch(const Containers::StridedArrayView1D<const std::uint8_t>& src, const Containers::StridedArrayView1D<std::uint8_t>& dst);
+    CORRADE_UTILITY_EXPORT void swapIntoBatch(const Containers::StridedArrayView1D<const std::uint16_t>& src, const Containers::StridedArrayView1D<std::uint16_t>& dst);
+    CORRADE_UTILITY_EXPORT void swapIntoBatch(const Containers::StridedArrayView1D<const std::uint32_t>& src, const Containers::StridedArrayView1D<std::uint32_t>& dst);
+    CORRADE_UTILITY_EXPORT void swapIntoBatch(const Containers::StridedArrayView1D<const std::uint64_t>& src, const Containers::StridedArrayView1D<std::uint64_t>& dst);
+
+    /* Used by littleEndianInto() / bigEndianInto() when no swap is needed,
+       the second dimension is the value bytes */
+    CORRADE_UTILITY_EXPORT void copyBatch(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<char>& dst);
+
+    /* The source is in a non-deduced context so it's enough to have T
+       deduced from the destination, and mutable source views can be passed
+       as well */
+    template<class T> struct BatchSourceType {
+        typedef const typename std::remove_const<T>::type Type;
+    };
 }
 
 /**
 @brief Endian-swap bytes of each argument in-place
 @m_since{2020,06}
 
-Equivalent to calling @ref swap() on each value.
+Equivalent to calling @ref swap() on each value. If the view is contiguous,
+2-, 4- and 8-byte values are swapped using
+@ref CORRADE_TARGET_SSSE3 "SSSE3", @ref CORRADE_TARGET_AVX2 "AVX2" or
+@ref CORRADE_TARGET_NEON "NEON" byte shuffles, if enabled at compile time,
+and on @ref CORRADE_TARGET_SSE2 "SSE2" using 16-bit word shuffles combined
+with vector shifts.
 @see @ref littleEndianInPlace(const Containers::StridedArrayView1D<T>&),
-    @ref bigEndianInPlace(const Containers::StridedArrayView1D<T>&)
+    @ref bigEndianInPlace(const Containers::StridedArrayView1D<T>&),
+    @ref swapInto(const Containers::StridedArrayView1D<typename Implementation::BatchSourceType<T>::Type>&, const Containers::StridedArrayView1D<T>&)
 */
 template<class T> void swapInPlace(const Containers::StridedArrayView1D<T>& values) {
     /* Done like this instead of calling swap() in a loop on the original type,
        as that involves a lot function calls and memcpying and stuff */
-    return Implementation::swapInPlace(Containers::arrayCast<typename Implementation::TypeFor<sizeof(T)>::Type>(values));
+    return Implementation::swapInPlaceBatch(Containers::arrayCast<typename Implementation::TypeFor<sizeof(T)>::Type>(values));
 }
 
 /**
@@ -72,7 +96,8 @@ template<class T> void swapInPlace(const Containers::ArrayView<T>& values) {
 On Big-Endian systems calls @ref swapInPlace(const Containers::StridedArrayView1D<T>&),
 on Little-Endian systems does nothing.
 @see @ref isBigEndian(), @ref CORRADE_TARGET_BIG_ENDIAN, @ref littleEndian(),
-    @ref bigEndianInPlace(const Containers::StridedArrayView1D<T>&)
+    @ref bigEndianInPlace(const Containers::StridedArrayView1D<T>&),
+    @ref littleEndianInto(const Containers::StridedArrayView1D<typename Implementation::BatchSourceType<T>::Type>&, const Containers::StridedArrayView1D<T>&)
 */
 template<class T> inline void littleEndianInPlace(const Containers::StridedArrayView1D<T>& values) {
     #ifdef CORRADE_TARGET_BIG_ENDIAN
@@ -97,7 +122,8 @@ template<class T> void littleEndianInPlace(const Containers::ArrayView<T>& value
 On Little-Endian systems calls @ref swapInPlace(const Containers::StridedArrayView1D<T>&),
 on Big-Endian systems does nothing.
 @see @ref isBigEndian(), @ref CORRADE_TARGET_BIG_ENDIAN, @ref bigEndian(),
-    @ref littleEndianInPlace(const Containers::StridedArrayView1D<T>&)
+    @ref littleEndianInPlace(const Containers::StridedArrayView1D<T>&),
+    @ref bigEndianInto(const Containers::StridedArrayView1D<typename Implementation::BatchSourceType<T>::Type>&, const Containers::StridedArrayView1D<T>&)
 */
 template<class T> inline void bigEndianInPlace(const Containers::StridedArrayView1D<T>& values) {
     #ifndef CORRADE_TARGET_BIG_ENDIAN
@@ -115,6 +141,83 @@ template<class T> void bigEndianInPlace(const Containers::ArrayView<T>& values)
     return bigEndianInPlace(Containers::stridedArrayView(values));
 }
 
+/**
+@brief Endian-swap bytes of each value while copying them to a destination
+@m_since_latest
+
+Equivalent to calling @ref swap() on each value of @p src and storing the
+result to @p dst, but done in a single pass over the data, which is faster
+than a @ref Utility::copy() followed by
+@ref swapInPlace(const Containers::StridedArrayView1D<T>&). Expects that both
+views have the same size and don't overlap. Contiguous views are processed
+with the same SIMD kernels as in @ref swapInPlace(const Containers::StridedArrayView1D<T>&).
+@see @ref littleEndianInto(), @ref bigEndianInto()
+*/
+template<class T> void swapInto(const Containers::StridedArrayView1D<typename Implementation::BatchSourceType<T>::Type>& src, const Containers::StridedArrayView1D<T>& dst) {
+    typedef typename Implementation::TypeFor<sizeof(T)>::Type Type;
+    return Implementation::swapIntoBatch(Containers::arrayCast<const Type>(src), Containers::arrayCast<Type>(dst));
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class T> void swapInto(const Containers::ArrayView<typename Implementation::BatchSourceType<T>::Type>& src, const Containers::ArrayView<T>& dst) {
+    return swapInto<T>(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+}
+
+/**
+@brief Convert values from or to Little-Endian while copying them to a destination
+@m_since_latest
+
+On Big-Endian systems calls @ref swapInto(const Containers::StridedArrayView1D<typename Implementation::BatchSourceType<T>::Type>&, const Containers::StridedArrayView1D<T>&),
+on Little-Endian systems only copies the values.
+@see @ref isBigEndian(), @ref CORRADE_TARGET_BIG_ENDIAN,
+    @ref littleEndianInPlace(const Containers::StridedArrayView1D<T>&),
+    @ref bigEndianInto()
+*/
+template<class T> void littleEndianInto(const Containers::StridedArrayView1D<typename Implementation::BatchSourceType<T>::Type>& src, const Containers::StridedArrayView1D<T>& dst) {
+    #ifdef CORRADE_TARGET_BIG_ENDIAN
+    swapInto<T>(src, dst);
+    #else
+    Implementation::copyBatch(Containers::arrayCast<2, const char>(src), Containers::arrayCast<2, char>(dst));
+    #endif
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class T> void littleEndianInto(const Containers::ArrayView<typename Implementation::BatchSourceType<T>::Type>& src, const Containers::ArrayView<T>& dst) {
+    return littleEndianInto<T>(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+}
+
+/**
+@brief Convert values from or to Big-Endian while copying them to a destination
+@m_since_latest
+
+On Little-Endian systems calls @ref swapInto(const Containers::StridedArrayView1D<typename Implementation::BatchSourceType<T>::Type>&, const Containers::StridedArrayView1D<T>&),
+on Big-Endian systems only copies the values.
+@see @ref isBigEndian(), @ref CORRADE_TARGET_BIG_ENDIAN,
+    @ref bigEndianInPlace(const Containers::StridedArrayView1D<T>&),
+    @ref littleEndianInto()
+*/
+template<class T> void bigEndianInto(const Containers::StridedArrayView1D<typename Implementation::BatchSourceType<T>::Type>& src, const Containers::StridedArrayView1D<T>& dst) {
+    #ifndef CORRADE_TARGET_BIG_ENDIAN
+    swapInto<T>(src, dst);
+    #else
+    Implementation::copyBatch(Containers::arrayCast<2, const char>(src), Containers::arrayCast<2, char>(dst));
+    #endif
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class T> void bigEndianInto(const Containers::ArrayView<typename Implementation::BatchSourceType<T>::Type>& src, const Containers::ArrayView<T>& dst) {
+    return bigEndianInto<T>(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+}
+
 }}}
 
 #endif
@@ -0,0 +1,74 @@
+#ifndef Corrade_Utility_Implementation_algorithms_h
+#define Corrade_Utility_Implementation_algorithms_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Corrade/Utility/Cpu.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Utility { namespace Implementation {
+
+/* Needs to be exposed like this so we can test all variants, not just the
+   one picked by the dispatcher. All kernels accept only item sizes of 4, 8
+   and 16 bytes, other sizes are handled by the generic code in
+   Algorithms.cpp. */
+
+/* Fills count contiguous items with value */
+typedef void(*AlgorithmsFillFunction)(char* dst, std::size_t count, std::size_t size, const char* value);
+
+/* Gathers count contiguous items from src into contiguous dst by contiguous
+   indices of indexSize bytes. Offsets of all indexed items in src are
+   expected to be less than 2 GB. */
+typedef void(*AlgorithmsGatherFunction)(const char* src, const char* indices, std::size_t indexSize, char* dst, std::size_t count, std::size_t size);
+
+/* Copies count contiguous items from src to dst with given stride */
+typedef void(*AlgorithmsInterleaveFunction)(const char* src, char* dst, std::ptrdiff_t dstStride, std::size_t count, std::size_t size);
+
+/* Copies count items from src with given stride to contiguous dst */
+typedef void(*AlgorithmsDeinterleaveFunction)(const char* src, std::ptrdiff_t srcStride, char* dst, std::size_t count, std::size_t size);
+
+CORRADE_UTILITY_EXPORT AlgorithmsFillFunction algorithmsFillImplementation(Cpu::ScalarT);
+CORRADE_UTILITY_EXPORT AlgorithmsGatherFunction algorithmsGatherImplementation(Cpu::ScalarT);
+CORRADE_UTILITY_EXPORT AlgorithmsInterleaveFunction algorithmsInterleaveImplementation(Cpu::ScalarT);
+CORRADE_UTILITY_EXPORT AlgorithmsDeinterleaveFunction algorithmsDeinterleaveImplementation(Cpu::ScalarT);
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_EXPORT AlgorithmsFillFunction algorithmsFillImplementation(Cpu::Sse2T);
+CORRADE_UTILITY_EXPORT AlgorithmsGatherFunction algorithmsGatherImplementation(Cpu::Sse2T);
+CORRADE_UTILITY_EXPORT AlgorithmsInterleaveFunction algorithmsInterleaveImplementation(Cpu::Sse2T);
+CORRADE_UTILITY_EXPORT AlgorithmsDeinterleaveFunction algorithmsDeinterleaveImplementation(Cpu::Sse2T);
+#endif
+/* There's no scatter instruction in AVX2, so interleaving stays at the SSE2
+   variant */
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_UTILITY_EXPORT AlgorithmsFillFunction algorithmsFillImplementation(Cpu::Avx2T);
+CORRADE_UTILITY_EXPORT AlgorithmsGatherFunction algorithmsGatherImplementation(Cpu::Avx2T);
+CORRADE_UTILITY_EXPORT AlgorithmsDeinterleaveFunction algorithmsDeinterleaveImplementation(Cpu::Avx2T);
+#endif
+
+}}}
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef Corrade_Utility_Implementation_xxHash3_h
+#define Corrade_Utility_Implementation_xxHash3_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Corrade/Utility/Cpu.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Utility { namespace Implementation {
+
+/* Needs to be exposed like this so we can test all variants, not just the
+   one picked by the dispatcher */
+
+/* Processes count 64-byte stripes of data, stripeCount is the position in
+   the current block of 16 stripes */
+typedef void(*XxHash3ProcessStripesFunction)(unsigned long long* accumulators, std::size_t& stripeCount, const char* data, std::size_t count, const char* secret);
+
+CORRADE_UTILITY_EXPORT XxHash3ProcessStripesFunction xxHash3ProcessStripesImplementation(Cpu::ScalarT);
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_EXPORT XxHash3ProcessStripesFunction xxHash3ProcessStripesImplementation(Cpu::Sse2T);
+#endif
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_UTILITY_EXPORT XxHash3ProcessStripesFunction xxHash3ProcessStripesImplementation(Cpu::Avx2T);
+#endif
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_EXPORT XxHash3ProcessStripesFunction xxHash3ProcessStripesImplementation(Cpu::Avx512fT);
+#endif
+
+/* Same as the xxHash3() in XxHash3.h, but with inputs over 240 bytes
+   processed with given function instead of the dispatched one */
+CORRADE_UTILITY_EXPORT unsigned long long xxHash3(const char* data, std::size_t size, unsigned long long seed, XxHash3ProcessStripesFunction processStripes);
+
+}}}
+
+#endif
@@ -25,66 +25,89 @@
 
 #include "MurmurHash2.h"
 
-namespace Corrade { namespace Utility { namespace Implementation {
+#include <cstring>
+#include <string>
 
-unsigned int MurmurHash2<4>::operator()(const unsigned int seed, const char* const signedData, unsigned int size) const {
-    const unsigned char* const data = reinterpret_cast<const unsigned char*>(signedData);
+#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Utility/Assert.h"
+
+namespace Corrade { namespace Utility {
+
+namespace Implementation {
 
-    /* m and r are mixing constants generated offline. They're not really
-       magic, they just happen to work well. */
-    const unsigned int m = 0x5bd1e995;
-    const int r = 24;
+namespace {
+
+/* m and r are mixing constants generated offline. They're not really magic,
+   they just happen to work well. */
+constexpr unsigned int M32 = 0x5bd1e995;
+constexpr int R32 = 24;
+constexpr unsigned long long M64 = 0xc6a4a7935bd1e995ull;
+constexpr int R64 = 47;
+
+}
 
+unsigned int MurmurHash2<4>::initialize(const unsigned int seed, const unsigned int size) {
     /* Initialize the hash to a random value */
-    unsigned int h = seed^size;
+    return seed^size;
+}
+
+unsigned int MurmurHash2<4>::mix(unsigned int h, const char* const signedData, const std::size_t blockCount) {
+    const unsigned char* const data = reinterpret_cast<const unsigned char*>(signedData);
 
     /* Mix 4 bytes at a time into the hash */
-    for(std::size_t i = 0; i+4 <= size; i += 4) {
+    for(std::size_t i = 0; i != blockCount*4; i += 4) {
         /* Can't use *reinterpret_cast<const unsigned int*>(data+i), as it is
            unaligned read (not supported on ARM or in Emscripten) */
         unsigned int k =
-            data[i + 3] << 24 |
-            data[i + 2] << 16 |
-            data[i + 1] <<  8 |
-            data[i + 0];
+            static_cast<unsigned int>(data[i + 3]) << 24 |
+            static_cast<unsigned int>(data[i + 2]) << 16 |
+            static_cast<unsigned int>(data[i + 1]) <<  8 |
+            static_cast<unsigned int>(data[i + 0]);
 
-        k *= m;
-        k ^= k >> r;
-        k *= m;
+        k *= M32;
+        k ^= k >> R32;
+        k *= M32;
 
-        h *= m;
+        h *= M32;
         h ^= k;
     }
 
+    return h;
+}
+
+unsigned int MurmurHash2<4>::finalize(unsigned int h, const char* const signedData, const std::size_t size) {
+    const unsigned char* const data = reinterpret_cast<const unsigned char*>(signedData);
+
     /* Handle the last few bytes of the input array */
-    if(size & 0x03) {
-        while(size-- & 0x03)
-            h ^= data[size] << (8 * (size & 0x03));
-        h *= m;
+    if(size) {
+        for(std::size_t i = 0; i != size; ++i)
+            h ^= static_cast<unsigned int>(data[i]) << (8*i);
+        h *= M32;
     }
 
     /* Do a few final mixes of the hash to ensure the last few bytes are
        well-incorporated. */
     h ^= h >> 13;
-    h *= m;
+    h *= M32;
     h ^= h >> 15;
 
     return h;
 }
 
-unsigned long long MurmurHash2<8>::operator()(const unsigned long long seed, const char* const signedData, unsigned long long size) const {
-    const unsigned char* const data = reinterpret_cast<const unsigned char*>(signedData);
-
-    /* m and r are mixing constants generated offline. They're not really
-       magic, they just happen to work well. */
-    const unsigned long long m = 0xc6a4a7935bd1e995ull;
-    const int r = 47;
+unsigned int MurmurHash2<4>::operator()(const unsigned int seed, const char* const data, const unsigned int size) const {
+    return finalize(mix(initialize(seed, size), data, size/4), data + (size & ~0x03u), size & 0x03);
+}
 
+unsigned long long MurmurHash2<8>::initialize(const unsigned long long seed, const unsigned long long size) {
     /* Initialize the hash to a random value */
-    unsigned long long h = seed^(size*m);
+    return seed^(size*M64);
+}
+
+unsigned long long MurmurHash2<8>::mix(unsigned long long h, const char* const signedData, const std::size_t blockCount) {
+    const unsigned char* const data = reinterpret_cast<const unsigned char*>(signedData);
 
     /* Mix 8 bytes at a time into the hash */
-    for(std::size_t i = 0; i+8 <= size; i += 8) {
+    for(std::size_t i = 0; i != blockCount*8; i += 8) {
         /* Can't use *reinterpret_cast<const unsigned int*>(data+i), as it is
            unaligned read (not supported on ARM or in Emscripten) */
         unsigned long long k =
@@ -97,28 +120,105 @@ unsigned long long MurmurHash2<8>::operator()(const unsigned long long seed, con
             static_cast<unsigned long long>(data[i + 1]) <<  8 |
             static_cast<unsigned long long>(data[i + 0]);
 
-        k *= m;
-        k ^= k >> r;
-        k *= m;
+        k *= M64;
+        k ^= k >> R64;
+        k *= M64;
 
         h ^= k;
-        h *= m;
+        h *= M64;
     }
 
+    return h;
+}
+
+unsigned long long MurmurHash2<8>::finalize(unsigned long long h, const char* const signedData, const std::size_t size) {
+    const unsigned char* const data = reinterpret_cast<const unsigned char*>(signedData);
+
     /* Handle the last few bytes of the input array */
-    if(size & 0x07) {
-        while(size-- & 0x07)
-            h ^= static_cast<unsigned long long>(data[size]) << (8 * (size & 0x07));
-        h *= m;
+    if(size) {
+        for(std::size_t i = 0; i != size; ++i)
+            h ^= static_cast<unsigned long long>(data[i]) << (8*i);
+        h *= M64;
     }
 
     /* Do a few final mixes of the hash to ensure the last few bytes are
        well-incorporated. */
-    h ^= h >> r;
-    h *= m;
-    h ^= h >> r;
+    h ^= h >> R64;
+    h *= M64;
+    h ^= h >> R64;
 
     return h;
 }
 
-}}}
+unsigned long long MurmurHash2<8>::operator()(const unsigned long long seed, const char* const data, const unsigned long long size) const {
+    return finalize(mix(initialize(seed, size), data, size/8), data + (size & ~0x07ull), size & 0x07);
+}
+
+}
+
+MurmurHash2& MurmurHash2::setDataSize(const std::size_t size) {
+    CORRADE_ASSERT(!_dataSize,
+        "Utility::MurmurHash2::setDataSize(): can't be called after data were added", *this);
+    _expectedDataSize = size;
+    return *this;
+}
+
+MurmurHash2& MurmurHash2::operator<<(const Containers::ArrayView<const char> data) {
+    CORRADE_ASSERT(_dataSize + data.size() <= _expectedDataSize,
+        "Utility::MurmurHash2::operator<<(): adding" << data.size() << "bytes to" << _dataSize << "would exceed the data size of" << _expectedDataSize << "bytes", *this);
+
+    typedef Implementation::MurmurHash2<sizeof(std::size_t)> Hash;
+    constexpr std::size_t BlockSize = sizeof(std::size_t);
+
+    /* The size is mixed into the initial state, so it's known only now */
+    if(!_dataSize) _state = Hash::initialize(_seed, _expectedDataSize);
+    _dataSize += data.size();
+
+    /* Not enough for a whole block, keep it for later */
+    const char* begin = data.begin();
+    const char* const end = data.end();
+    if(_bufferSize + data.size() < BlockSize) {
+        std::memcpy(_buffer + _bufferSize, begin, data.size());
+        _bufferSize += data.size();
+        return *this;
+    }
+
+    /* Complete the buffered block and mix it in */
+    if(_bufferSize) {
+        const std::size_t fill = BlockSize - _bufferSize;
+        std::memcpy(_buffer + _bufferSize, begin, fill);
+        begin += fill;
+        _state = Hash::mix(_state, _buffer, 1);
+    }
+
+    /* Mix all whole blocks directly and keep the rest for later */
+    const std::size_t blockCount = (end - begin)/BlockSize;
+    _state = Hash::mix(_state, begin, blockCount);
+    begin += blockCount*BlockSize;
+    _bufferSize = end - begin;
+    std::memcpy(_buffer, begin, _bufferSize);
+    return *this;
+}
+
+MurmurHash2& MurmurHash2::operator<<(const std::string& data) {
+    return *this << Containers::arrayView(data.data(), data.size());
+}
+
+MurmurHash2::Digest MurmurHash2::digest() {
+    CORRADE_ASSERT(_dataSize == _expectedDataSize,
+        "Utility::MurmurHash2::digest(): expected" << _expectedDataSize << "bytes but got" << _dataSize, {});
+
+    typedef Implementation::MurmurHash2<sizeof(std::size_t)> Hash;
+
+    /* If no data were added, the state wasn't initialized yet */
+    const std::size_t d = Hash::finalize(_dataSize ? _state : Hash::initialize(_seed, 0), _buffer, _bufferSize);
+
+    /* Clear data and return */
+    _state = 0;
+    _bufferSize = 0;
+    _dataSize = 0;
+    _expectedDataSize = 0;
+    return Digest::fromByteArray(reinterpret_cast<const char*>(&d));
+}
+
+}}
@@ -32,17 +32,30 @@
 #include <cstddef>
 #include <string>
 
+#include "Corrade/Containers/Containers.h"
 #include "Corrade/Utility/AbstractHash.h"
 #include "Corrade/Utility/visibility.h"
 
 namespace Corrade { namespace Utility {
 
 namespace Implementation {
+    /* The one-shot operator() is composed of the three static steps, which
+       are used by the incremental MurmurHash2 interface as well. The mix()
+       takes a count of whole 4- or 8-byte blocks, finalize() the remaining
+       bytes. */
     template<std::size_t> struct MurmurHash2;
     template<> struct CORRADE_UTILITY_EXPORT MurmurHash2<4> {
+        static unsigned int initialize(unsigned int seed, unsigned int size);
+        static unsigned int mix(unsigned int h, const char* data, std::size_t blockCount);
+        static unsigned int finalize(unsigned int h, const char* data, std::size_t size);
+
         unsigned int operator()(unsigned int seed, const char* data, unsigned int size) const;
     };
     template<> struct CORRADE_UTILITY_EXPORT MurmurHash2<8> {
+        static unsigned long long initialize(unsigned long long seed, unsigned long long size);
+        static unsigned long long mix(unsigned long long h, const char* data, std::size_t blockCount);
+        static unsigned long long finalize(unsigned long long h, const char* data, std::size_t size);
+
         unsigned long long operator()(unsigned long long seed, const char* data, unsigned long long size) const;
     };
 }
@@ -54,6 +67,16 @@ Based on algorithm copyright Austin Appleby, http://code.google.com/p/smhasher/
 The digest is 32bit or 64bit, depending on @cpp sizeof(std::size_t) @ce and
 thus usable for hashing in e.g. @ref std::unordered_map.
 
+@section Utility-MurmurHash2-incremental Incremental hashing
+
+Apart from hashing the data at once using @ref operator()(), the data can be
+also added piece by piece similarly to @ref Sha1, without having to
+concatenate them first. The result is the same as with the one-shot variant.
+Because the algorithm mixes the total input size into the initial state, the
+size has to be announced upfront using @ref setDataSize():
+
+@snippet Utility.cpp MurmurHash2-incremental
+
 @todo constexpr algorithm
 */
 class CORRADE_UTILITY_EXPORT MurmurHash2: public AbstractHash<sizeof(std::size_t)> {
@@ -72,9 +95,17 @@ class CORRADE_UTILITY_EXPORT MurmurHash2: public AbstractHash<sizeof(std::size_t
          * @brief Constructor
          * @param seed      Seed to initialize the hash
          */
-        constexpr explicit MurmurHash2(std::size_t seed = 0): _seed(seed) {}
+        constexpr explicit MurmurHash2(std::size_t seed = 0): _seed(seed), _state{}, _buffer{}, _bufferSize{}, _dataSize{}, _expectedDataSize{} {}
+
+        /** @brief Seed */
+        constexpr std::size_t seed() const { return _seed; }
 
-        /** @brief Compute digest of given data */
+        /**
+         * @brief Compute digest of given data
+         *
+         * Uses the seed passed in the constructor, doesn't affect any data
+         * added using @ref operator<<().
+         */
         Digest operator()(const std::string& data) const {
             return operator()(data.data(), data.size());
         }
@@ -91,8 +122,68 @@ class CORRADE_UTILITY_EXPORT MurmurHash2: public AbstractHash<sizeof(std::size_t
             return Digest::fromByteArray(reinterpret_cast<const char*>(&d));
         }
 
+        /**
+         * @brief Total size of data for incremental hashing
+         * @m_since_latest
+         *
+         * Initially @cpp 0 @ce.
+         */
+        std::size_t dataSize() const { return _expectedDataSize; }
+
+        /**
+         * @brief Set total size of data for incremental hashing
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Has to be called before adding any data using @ref operator<<(),
+         * the sum of sizes of all data added afterwards is expected to match
+         * @p size.
+         * @see @ref Utility-MurmurHash2-incremental
+         */
+        MurmurHash2& setDataSize(std::size_t size);
+
+        /**
+         * @brief Add data for digesting
+         * @m_since_latest
+         *
+         * Expects that the total size of added data doesn't exceed
+         * @ref dataSize().
+         */
+        MurmurHash2& operator<<(Containers::ArrayView<const char> data);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        MurmurHash2& operator<<(const std::string& data);
+
+        /**
+         * @brief @cpp operator<< @ce with C strings is not allowed
+         * @m_since_latest
+         *
+         * To clarify your intent with handling the @cpp '\0' @ce delimiter,
+         * cast to @ref Containers::ArrayView or @ref std::string instead.
+         */
+        MurmurHash2& operator<<(const char*) = delete;
+
+        /**
+         * @brief Digest of all added data
+         * @m_since_latest
+         *
+         * Expects that the total size of added data matches
+         * @ref dataSize(). Afterwards the hash is reset to the initial state,
+         * keeping the seed and with @ref dataSize() set back to @cpp 0 @ce.
+         */
+        Digest digest();
+
     private:
         std::size_t _seed;
+        /* Incremental state. The buffer contains data that don't form a
+           whole 4- or 8-byte block yet. */
+        std::size_t _state;
+        char _buffer[sizeof(std::size_t)];
+        std::size_t _bufferSize;
+        std::size_t _dataSize, _expectedDataSize;
 };
 
 }}
@@ -29,11 +29,13 @@
 #include <algorithm> /* std::max() */
 #endif
 #include <iomanip>
-#include <map>
 #include <sstream>
 #include <vector>
 
 #include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/HashMap.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringView.h"
 #include "Corrade/Containers/Implementation/RawForwardList.h"
 #include "Corrade/Utility/Assert.h"
 #include "Corrade/Utility/Configuration.h"
@@ -64,7 +66,7 @@ struct ResourceGlobals {
     /* Overriden groups. This is only allocated if the user calls
        Resource::overrideGroup() and stores a pointer to a function-local
        static variable from there. */
-    std::map<std::string, std::string>* overrideGroups;
+    Containers::HashMap<Containers::String, std::string>* overrideGroups;
 };
 
 /* What the hell is going on here with the #ifdefs?! */
@@ -120,7 +122,7 @@ ResourceGlobals& windowsResourceGlobals() {
 
 struct Resource::OverrideData {
     const Configuration conf;
-    std::map<std::string, Containers::Array<char>> data;
+    Containers::HashMap<Containers::String, Containers::Array<char>> data;
 
     explicit OverrideData(const std::string& filename): conf(filename) {}
 };
@@ -348,15 +350,15 @@ namespace {
 
 void Resource::overrideGroup(const std::string& group, const std::string& configurationFile) {
     if(!resourceGlobals.overrideGroups) {
-        static std::map<std::string, std::string> overrideGroups;
+        static Containers::HashMap<Containers::String, std::string> overrideGroups;
         resourceGlobals.overrideGroups = &overrideGroups;
     }
 
     CORRADE_ASSERT(findGroup({group.data(), group.size()}),
         "Utility::Resource::overrideGroup(): group" << '\'' + group + '\'' << "was not found", );
-    /* This group can be already overriden from before, so insert if not there
-       yet and then update the filename */
-    resourceGlobals.overrideGroups->emplace(group, std::string{}).first->second = configurationFile;
+    /* This group can be already overriden from before, in which case just
+       the filename gets updated */
+    resourceGlobals.overrideGroups->set(Containers::StringView{group.data(), group.size()}, configurationFile);
 }
 
 bool Resource::hasGroup(const std::string& group) {
@@ -374,11 +376,11 @@ Resource::Resource(const Containers::ArrayView<const char> group, void*): _group
 
     if(resourceGlobals.overrideGroups) {
         const std::string groupString{group.data(), group.size()};
-        auto overriden = resourceGlobals.overrideGroups->find(groupString);
-        if(overriden != resourceGlobals.overrideGroups->end()) {
+        const std::string* const overriden = resourceGlobals.overrideGroups->find(Containers::StringView{group.data(), group.size()});
+        if(overriden) {
             Debug{}
-                << "Utility::Resource: group '" << Debug::nospace << groupString << Debug::nospace << "' overriden with '" << Debug::nospace << overriden->second << Debug::nospace << "\'";
-            _overrideGroup = new OverrideData(overriden->second);
+                << "Utility::Resource: group '" << Debug::nospace << groupString << Debug::nospace << "' overriden with '" << Debug::nospace << *overriden << Debug::nospace << "\'";
+            _overrideGroup = new OverrideData(*overriden);
 
             if(_overrideGroup->conf.value("group") != groupString) Warning{}
                 << "Utility::Resource: overriden with different group, found '"
@@ -418,9 +420,8 @@ Containers::ArrayView<const char> Resource::getInternal(const Containers::ArrayV
         const std::string filenameString{filename.data(), filename.size()};
 
         /* The file is already loaded */
-        auto it = _overrideGroup->data.find(filenameString);
-        if(it != _overrideGroup->data.end())
-            return it->second;
+        if(const Containers::Array<char>* const found = _overrideGroup->data.find(Containers::StringView{filename.data(), filename.size()}))
+            return *found;
 
         /* Load the file and save it for later use. Linear search is not an
            issue, as this shouldn't be used in production code anyway. */
@@ -439,8 +440,7 @@ Containers::ArrayView<const char> Resource::getInternal(const Containers::ArrayV
             }
 
             /* Save the file for later use and return */
-            it = _overrideGroup->data.emplace(filenameString, std::move(data)).first;
-            return it->second;
+            return _overrideGroup->data.emplace(Containers::StringView{filename.data(), filename.size()}, std::move(data));
         }
 
         /* The file was not found, fallback to compiled-in ones */
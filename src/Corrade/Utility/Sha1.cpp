@@ -27,10 +27,21 @@
 #include "Sha1.h"
 
 #include <cstddef>
+#include <cstring>
 #include <string>
 
-#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/Cpu.h"
 #include "Corrade/Utility/Endianness.h"
+#include "Corrade/Utility/Implementation/sha1.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(CORRADE_ENABLE_SHA) || defined(CORRADE_ENABLE_AVX2) || defined(CORRADE_ENABLE_AVX512F)
+#include <immintrin.h>
+#endif
 
 namespace Corrade { namespace Utility {
 
@@ -51,6 +62,528 @@ unsigned int leftrotate(unsigned int data, unsigned int shift) {
     return data << shift | data >> (32 - shift);
 }
 
+/* Processes count 64-byte chunks of data, updating the digest. The data
+   don't need to be aligned. */
+typedef void(*ProcessChunksFunction)(unsigned int*, const char*, std::size_t);
+
+void processChunksScalar(unsigned int* const digest, const char* data, std::size_t count) {
+    for(; count; --count, data += 64) {
+        /* Extend the data to 80 bytes, make it big endian */
+        unsigned int extended[80];
+        /* Some memory juggling to avoid unaligned reads on platforms that
+           don't like it (Emscripten). The data don't have any endianness, so
+           take the first byte first, as usual. */
+        for(int i = 0; i != 16; ++i)
+            extended[i] =
+                (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 0])) << 24) |
+                (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 1])) << 16) |
+                (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 2])) <<  8) |
+                (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 3])) <<  0);
+        for(int i = 16; i != 80; ++i)
+            extended[i] = leftrotate((extended[i-3] ^ extended[i-8] ^ extended[i-14] ^ extended[i-16]), 1);
+
+        /* Initialize value for this chunk */
+        unsigned int d[5];
+        unsigned int f, constant, temp;
+        std::copy(digest, digest+5, d);
+
+        /* Main loop */
+        for(int i = 0; i != 80; ++i) {
+            if(i < 20) {
+                f = d[3] ^ (d[1] & (d[2] ^ d[3]));
+                constant = Constants[0];
+            } else if(i < 40) {
+                f = d[1] ^ d[2] ^ d[3];
+                constant = Constants[1];
+            } else if(i < 60) {
+                f = (d[1] & d[2]) | (d[3] & (d[1] | d[2]));
+                constant = Constants[2];
+            } else {
+                f = d[1] ^ d[2] ^ d[3];
+                constant = Constants[3];
+            }
+
+            temp =
+                leftrotate(d[0], 5) + f + d[4] + constant + extended[i];
+            d[4] = d[3];
+            d[3] = d[2];
+            d[2] = leftrotate(d[1], 30);
+            d[1] = d[0];
+            d[0] = temp;
+        }
+
+        /* Add the values to digest */
+        for(int i = 0; i != 5; ++i)
+            digest[i] += d[i];
+    }
+}
+
+#if (defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH) && defined(CORRADE_ENABLE_SHA)) || (defined(CORRADE_TARGET_SHA) && defined(CORRADE_TARGET_SSE41))
+/* Each _mm_sha1rnds4_epu32() does four rounds, with the round function
+   selected by the immediate. _mm_sha1nexte_epu32() calculates E for the next
+   four rounds from the current A and adds it to the next four message words,
+   _mm_sha1msg1_epu32() and _mm_sha1msg2_epu32() together with a XOR calculate
+   the message schedule. The A, B, C, D state is kept in a single register in
+   reverse order, E in the top lane of another. */
+CORRADE_ENABLE_SHA void processChunksSha(unsigned int* const digest, const char* data, std::size_t count) {
+    /* Reverses bytes in all four words to make them big endian */
+    const __m128i shuffle = _mm_set_epi64x(0x0001020304050607ull, 0x08090a0b0c0d0e0full);
+
+    __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digest)), 0x1b);
+    __m128i e0 = _mm_set_epi32(int(digest[4]), 0, 0, 0);
+    __m128i e1;
+
+    for(; count; --count, data += 64) {
+        const __m128i abcdPrevious = abcd;
+        const __m128i ePrevious = e0;
+
+        /* Rounds 0-3 */
+        __m128i msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), shuffle);
+        e0 = _mm_add_epi32(e0, msg0);
+        e1 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+        /* Rounds 4-7 */
+        __m128i msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), shuffle);
+        e1 = _mm_sha1nexte_epu32(e1, msg1);
+        e0 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+        msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+
+        /* Rounds 8-11 */
+        __m128i msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), shuffle);
+        e0 = _mm_sha1nexte_epu32(e0, msg2);
+        e1 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+        msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+        msg0 = _mm_xor_si128(msg0, msg2);
+
+        /* Rounds 12-15 */
+        __m128i msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), shuffle);
+        e1 = _mm_sha1nexte_epu32(e1, msg3);
+        e0 = abcd;
+        msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+        msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+        msg1 = _mm_xor_si128(msg1, msg3);
+
+        /* Rounds 16-63 follow the same pattern, with the round function
+           changing every twenty rounds. The a and b arguments alternate
+           between e0 / e1, and the message words rotate. */
+        #define CORRADE_SHA1_ROUNDS(ea, eb, function, msgA, msgB, msgC, msgD) \
+            ea = _mm_sha1nexte_epu32(ea, msgA);                             \
+            eb = abcd;                                                      \
+            msgB = _mm_sha1msg2_epu32(msgB, msgA);                          \
+            abcd = _mm_sha1rnds4_epu32(abcd, ea, function);                 \
+            msgD = _mm_sha1msg1_epu32(msgD, msgA);                          \
+            msgC = _mm_xor_si128(msgC, msgA);
+        CORRADE_SHA1_ROUNDS(e0, e1, 0, msg0, msg1, msg2, msg3) /* 16-19 */
+        CORRADE_SHA1_ROUNDS(e1, e0, 1, msg1, msg2, msg3, msg0) /* 20-23 */
+        CORRADE_SHA1_ROUNDS(e0, e1, 1, msg2, msg3, msg0, msg1) /* 24-27 */
+        CORRADE_SHA1_ROUNDS(e1, e0, 1, msg3, msg0, msg1, msg2) /* 28-31 */
+        CORRADE_SHA1_ROUNDS(e0, e1, 1, msg0, msg1, msg2, msg3) /* 32-35 */
+        CORRADE_SHA1_ROUNDS(e1, e0, 1, msg1, msg2, msg3, msg0) /* 36-39 */
+        CORRADE_SHA1_ROUNDS(e0, e1, 2, msg2, msg3, msg0, msg1) /* 40-43 */
+        CORRADE_SHA1_ROUNDS(e1, e0, 2, msg3, msg0, msg1, msg2) /* 44-47 */
+        CORRADE_SHA1_ROUNDS(e0, e1, 2, msg0, msg1, msg2, msg3) /* 48-51 */
+        CORRADE_SHA1_ROUNDS(e1, e0, 2, msg1, msg2, msg3, msg0) /* 52-55 */
+        CORRADE_SHA1_ROUNDS(e0, e1, 2, msg2, msg3, msg0, msg1) /* 56-59 */
+        CORRADE_SHA1_ROUNDS(e1, e0, 3, msg3, msg0, msg1, msg2) /* 60-63 */
+        #undef CORRADE_SHA1_ROUNDS
+
+        /* Rounds 64-67, from here on only the remaining message words are
+           calculated */
+        e0 = _mm_sha1nexte_epu32(e0, msg0);
+        e1 = abcd;
+        msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+        msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+        msg2 = _mm_xor_si128(msg2, msg0);
+
+        /* Rounds 68-71 */
+        e1 = _mm_sha1nexte_epu32(e1, msg1);
+        e0 = abcd;
+        msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+        msg3 = _mm_xor_si128(msg3, msg1);
+
+        /* Rounds 72-75 */
+        e0 = _mm_sha1nexte_epu32(e0, msg2);
+        e1 = abcd;
+        msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+
+        /* Rounds 76-79 */
+        e1 = _mm_sha1nexte_epu32(e1, msg3);
+        e0 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+        /* Add the values to digest */
+        e0 = _mm_sha1nexte_epu32(e0, ePrevious);
+        abcd = _mm_add_epi32(abcd, abcdPrevious);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(digest), _mm_shuffle_epi32(abcd, 0x1b));
+    digest[4] = _mm_extract_epi32(e0, 3);
+}
+#endif
+
+/* The SHA instructions are an extension on top of the regular instruction
+   sets, so they can't be picked by CORRADE_CPU_DISPATCHER(). All CPUs with
+   SHA have SSE4.1 and SSSE3 as well, but check those anyway. */
+#ifdef CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+ProcessChunksFunction processChunksDispatcher(const Cpu::Features features) {
+    #ifdef CORRADE_ENABLE_SHA
+    if(features >= (Cpu::Feature::Sse2|Cpu::Feature::Ssse3|Cpu::Feature::Sse41|Cpu::Feature::Sha))
+        return processChunksSha;
+    #else
+    static_cast<void>(features);
+    #endif
+    return processChunksScalar;
+}
+
+#ifdef CORRADE_CPU_USE_IFUNC
+CORRADE_CPU_DISPATCHED_IFUNC(processChunksDispatcher, void processChunks(unsigned int*, const char*, std::size_t))
+#else
+CORRADE_CPU_DISPATCHED_POINTER(processChunksDispatcher, ProcessChunksFunction processChunks)
+#endif
+#else
+/* Picking the SHA variant if it's enabled at compile time */
+void processChunks(unsigned int* const digest, const char* const data, const std::size_t count) {
+    #if defined(CORRADE_TARGET_SHA) && defined(CORRADE_TARGET_SSE41)
+    processChunksSha(digest, data, count);
+    #else
+    processChunksScalar(digest, data, count);
+    #endif
+}
+#endif
+
+/* Here the regular single-buffer code path is used, which is the SHA
+   extensions if available */
+void digestBatchScalar(const Containers::ArrayView<const Containers::ArrayView<const char>> data, const Containers::ArrayView<Sha1::Digest> out) {
+    Sha1 hasher;
+    for(std::size_t i = 0; i != data.size(); ++i)
+        out[i] = (hasher << data[i]).digest();
+}
+
+/* Multi-buffer variant, processing one 64-byte chunk of Lanes::Count inputs
+   at once. Lanes::process() takes the message words and the state with the
+   lanes interleaved, the scheduling of inputs to lanes is done here. Each
+   lane hashes its current input until the end, including the padding, and
+   then continues with the next input that's not hashed yet. */
+template<class Lanes> void digestBatchLanes(const Containers::ArrayView<const Containers::ArrayView<const char>> data, const Containers::ArrayView<Sha1::Digest> out) {
+    constexpr std::size_t LaneCount = Lanes::Count;
+
+    struct Lane {
+        std::size_t input;
+        std::size_t chunk;
+        std::size_t fullChunkCount;
+        std::size_t chunkCount;
+        /* Last one or two chunks of the input, padded */
+        char tail[128];
+    } lanes[LaneCount];
+
+    alignas(64) unsigned int state[5][LaneCount];
+    alignas(64) unsigned int words[16][LaneCount]{};
+
+    /* Assigns the next input to given lane, returns false if there's
+       nothing left */
+    std::size_t next = 0;
+    const auto start = [&](const std::size_t i) {
+        if(next == data.size()) return false;
+
+        Lane& lane = lanes[i];
+        lane.input = next++;
+        lane.chunk = 0;
+
+        const Containers::ArrayView<const char> input = data[lane.input];
+        const std::size_t leftover = input.size() % 64;
+        lane.fullChunkCount = input.size()/64;
+        lane.chunkCount = lane.fullChunkCount + (leftover < 56 ? 1 : 2);
+
+        /* Add '1' bit to the leftovers, pad and add size of the data in bits
+           in big endian */
+        const std::size_t tailSize = (lane.chunkCount - lane.fullChunkCount)*64;
+        std::memcpy(lane.tail, input.data() + lane.fullChunkCount*64, leftover);
+        lane.tail[leftover] = '\x80';
+        std::memset(lane.tail + leftover + 1, 0, tailSize - leftover - 9);
+        const unsigned long long sizeBigEndian = Endianness::bigEndian<unsigned long long>(input.size()*8ull);
+        std::memcpy(lane.tail + tailSize - 8, &sizeBigEndian, 8);
+
+        for(std::size_t j = 0; j != 5; ++j)
+            state[j][i] = InitialDigest[j];
+        return true;
+    };
+
+    std::size_t active = 0;
+    bool activeLanes[LaneCount];
+    for(std::size_t i = 0; i != LaneCount; ++i)
+        active += activeLanes[i] = start(i);
+
+    while(active) {
+        /* Gather the current chunk of each lane, made big endian. Inactive
+           lanes keep whatever was there before, their result isn't used. */
+        for(std::size_t i = 0; i != LaneCount; ++i) {
+            if(!activeLanes[i]) continue;
+
+            const Lane& lane = lanes[i];
+            const char* const chunk = lane.chunk < lane.fullChunkCount ?
+                data[lane.input].data() + lane.chunk*64 :
+                lane.tail + (lane.chunk - lane.fullChunkCount)*64;
+            for(std::size_t j = 0; j != 16; ++j) {
+                unsigned int word;
+                std::memcpy(&word, chunk + j*4, 4);
+                words[j][i] = Endianness::bigEndian(word);
+            }
+        }
+
+        Lanes::process(state, words);
+
+        /* Save digests of inputs that are done and continue with next ones */
+        for(std::size_t i = 0; i != LaneCount; ++i) {
+            if(!activeLanes[i] || ++lanes[i].chunk != lanes[i].chunkCount)
+                continue;
+
+            unsigned int digest[5];
+            for(std::size_t j = 0; j != 5; ++j)
+                digest[j] = Endianness::bigEndian(state[j][i]);
+            out[lanes[i].input] = Sha1::Digest::fromByteArray(reinterpret_cast<const char*>(digest));
+
+            if(!start(i)) {
+                activeLanes[i] = false;
+                --active;
+            }
+        }
+    }
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+struct Sse2Lanes {
+    enum: std::size_t { Count = 4 };
+
+    template<int shift> CORRADE_ENABLE_SSE2 static __m128i rotateLeft(const __m128i a) {
+        return _mm_or_si128(_mm_slli_epi32(a, shift), _mm_srli_epi32(a, 32 - shift));
+    }
+
+    CORRADE_ENABLE_SSE2 static void process(unsigned int(&state)[5][Count], const unsigned int(&words)[16][Count]) {
+        __m128i w[16];
+        for(std::size_t i = 0; i != 16; ++i)
+            w[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(words[i]));
+        __m128i d[5];
+        for(std::size_t i = 0; i != 5; ++i)
+            d[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(state[i]));
+        __m128i a = d[0], b = d[1], c = d[2], e = d[4];
+        __m128i dd = d[3];
+
+        for(std::size_t i = 0; i != 80; ++i) {
+            /* The message schedule is calculated in a 16-word ring buffer */
+            if(i >= 16) w[i & 15] = rotateLeft<1>(_mm_xor_si128(
+                _mm_xor_si128(w[(i - 3) & 15], w[(i - 8) & 15]),
+                _mm_xor_si128(w[(i - 14) & 15], w[i & 15])));
+
+            __m128i f;
+            if(i < 20)
+                f = _mm_xor_si128(dd, _mm_and_si128(b, _mm_xor_si128(c, dd)));
+            else if(i < 40 || i >= 60)
+                f = _mm_xor_si128(_mm_xor_si128(b, c), dd);
+            else
+                f = _mm_or_si128(_mm_and_si128(b, c), _mm_and_si128(dd, _mm_or_si128(b, c)));
+
+            const __m128i temp = _mm_add_epi32(
+                _mm_add_epi32(rotateLeft<5>(a), f),
+                _mm_add_epi32(_mm_add_epi32(e, _mm_set1_epi32(int(Constants[i/20]))), w[i & 15]));
+            e = dd;
+            dd = c;
+            c = rotateLeft<30>(b);
+            b = a;
+            a = temp;
+        }
+
+        _mm_store_si128(reinterpret_cast<__m128i*>(state[0]), _mm_add_epi32(d[0], a));
+        _mm_store_si128(reinterpret_cast<__m128i*>(state[1]), _mm_add_epi32(d[1], b));
+        _mm_store_si128(reinterpret_cast<__m128i*>(state[2]), _mm_add_epi32(d[2], c));
+        _mm_store_si128(reinterpret_cast<__m128i*>(state[3]), _mm_add_epi32(d[3], dd));
+        _mm_store_si128(reinterpret_cast<__m128i*>(state[4]), _mm_add_epi32(d[4], e));
+    }
+};
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+/* Same as Sse2Lanes, just with eight lanes */
+struct Avx2Lanes {
+    enum: std::size_t { Count = 8 };
+
+    template<int shift> CORRADE_ENABLE_AVX2 static __m256i rotateLeft(const __m256i a) {
+        return _mm256_or_si256(_mm256_slli_epi32(a, shift), _mm256_srli_epi32(a, 32 - shift));
+    }
+
+    CORRADE_ENABLE_AVX2 static void process(unsigned int(&state)[5][Count], const unsigned int(&words)[16][Count]) {
+        __m256i w[16];
+        for(std::size_t i = 0; i != 16; ++i)
+            w[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(words[i]));
+        __m256i d[5];
+        for(std::size_t i = 0; i != 5; ++i)
+            d[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[i]));
+        __m256i a = d[0], b = d[1], c = d[2], e = d[4];
+        __m256i dd = d[3];
+
+        for(std::size_t i = 0; i != 80; ++i) {
+            if(i >= 16) w[i & 15] = rotateLeft<1>(_mm256_xor_si256(
+                _mm256_xor_si256(w[(i - 3) & 15], w[(i - 8) & 15]),
+                _mm256_xor_si256(w[(i - 14) & 15], w[i & 15])));
+
+            __m256i f;
+            if(i < 20)
+                f = _mm256_xor_si256(dd, _mm256_and_si256(b, _mm256_xor_si256(c, dd)));
+            else if(i < 40 || i >= 60)
+                f = _mm256_xor_si256(_mm256_xor_si256(b, c), dd);
+            else
+                f = _mm256_or_si256(_mm256_and_si256(b, c), _mm256_and_si256(dd, _mm256_or_si256(b, c)));
+
+            const __m256i temp = _mm256_add_epi32(
+                _mm256_add_epi32(rotateLeft<5>(a), f),
+                _mm256_add_epi32(_mm256_add_epi32(e, _mm256_set1_epi32(int(Constants[i/20]))), w[i & 15]));
+            e = dd;
+            dd = c;
+            c = rotateLeft<30>(b);
+            b = a;
+            a = temp;
+        }
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state[0]), _mm256_add_epi32(d[0], a));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state[1]), _mm256_add_epi32(d[1], b));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state[2]), _mm256_add_epi32(d[2], c));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state[3]), _mm256_add_epi32(d[3], dd));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state[4]), _mm256_add_epi32(d[4], e));
+    }
+};
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+/* Same as Sse2Lanes, with sixteen lanes. AVX-512 has a dedicated rotate
+   instruction, and the round functions are a single ternary logic
+   instruction each. */
+struct Avx512fLanes {
+    enum: std::size_t { Count = 16 };
+
+    /* The zero-masked variant with all lanes enabled is the same instruction,
+       but unlike _mm512_rol_epi32() it doesn't go through
+       _mm512_undefined_epi32(), which triggers -Wuninitialized on GCC 12 */
+    template<int shift> CORRADE_ENABLE_AVX512F static __m512i rotateLeft(const __m512i a) {
+        return _mm512_maskz_rol_epi32(0xffff, a, shift);
+    }
+
+    CORRADE_ENABLE_AVX512F static void process(unsigned int(&state)[5][Count], const unsigned int(&words)[16][Count]) {
+        __m512i w[16];
+        for(std::size_t i = 0; i != 16; ++i)
+            w[i] = _mm512_load_si512(words[i]);
+        __m512i d[5];
+        for(std::size_t i = 0; i != 5; ++i)
+            d[i] = _mm512_load_si512(state[i]);
+        __m512i a = d[0], b = d[1], c = d[2], e = d[4];
+        __m512i dd = d[3];
+
+        for(std::size_t i = 0; i != 80; ++i) {
+            if(i >= 16) w[i & 15] = rotateLeft<1>(_mm512_ternarylogic_epi32(
+                _mm512_xor_si512(w[(i - 3) & 15], w[(i - 8) & 15]),
+                w[(i - 14) & 15], w[i & 15], 0x96));
+
+            /* The immediates are the truth tables of the round functions
+               applied to (b, c, d): 0xca is b ? c : d, 0x96 is b ^ c ^ d
+               and 0xe8 the majority */
+            __m512i f;
+            if(i < 20)
+                f = _mm512_ternarylogic_epi32(b, c, dd, 0xca);
+            else if(i < 40 || i >= 60)
+                f = _mm512_ternarylogic_epi32(b, c, dd, 0x96);
+            else
+                f = _mm512_ternarylogic_epi32(b, c, dd, 0xe8);
+
+            const __m512i temp = _mm512_add_epi32(
+                _mm512_add_epi32(rotateLeft<5>(a), f),
+                _mm512_add_epi32(_mm512_add_epi32(e, _mm512_set1_epi32(int(Constants[i/20]))), w[i & 15]));
+            e = dd;
+            dd = c;
+            c = rotateLeft<30>(b);
+            b = a;
+            a = temp;
+        }
+
+        _mm512_store_si512(state[0], _mm512_add_epi32(d[0], a));
+        _mm512_store_si512(state[1], _mm512_add_epi32(d[1], b));
+        _mm512_store_si512(state[2], _mm512_add_epi32(d[2], c));
+        _mm512_store_si512(state[3], _mm512_add_epi32(d[3], dd));
+        _mm512_store_si512(state[4], _mm512_add_epi32(d[4], e));
+    }
+};
+#endif
+
+}
+
+namespace Implementation {
+
+Sha1DigestBatchFunction sha1DigestBatchImplementation(Cpu::ScalarT) {
+    return digestBatchScalar;
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+Sha1DigestBatchFunction sha1DigestBatchImplementation(Cpu::Sse2T) {
+    return digestBatchLanes<Sse2Lanes>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+Sha1DigestBatchFunction sha1DigestBatchImplementation(Cpu::Avx2T) {
+    return digestBatchLanes<Avx2Lanes>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+Sha1DigestBatchFunction sha1DigestBatchImplementation(Cpu::Avx512fT) {
+    return digestBatchLanes<Avx512fLanes>;
+}
+#endif
+
+}
+
+namespace {
+
+/* Hashing the inputs one by one using the SHA extensions is faster than the
+   SSE2 and AVX2 multi-buffer variants, only the AVX-512 one beats it. As the
+   SHA extensions aren't handled by CORRADE_CPU_DISPATCHER(), the dispatcher is
+   written by hand. It's used for picking the variant for a build without
+   runtime dispatch as well, with just the compile-time features. */
+Implementation::Sha1DigestBatchFunction digestBatchDispatcher(const Cpu::Features features) {
+    #ifdef CORRADE_ENABLE_AVX512F
+    if(features & Cpu::Feature::Avx512f)
+        return Implementation::sha1DigestBatchImplementation(Cpu::Avx512f);
+    #endif
+    #ifdef CORRADE_ENABLE_SHA
+    if(features >= (Cpu::Feature::Sse2|Cpu::Feature::Ssse3|Cpu::Feature::Sse41|Cpu::Feature::Sha))
+        return Implementation::sha1DigestBatchImplementation(Cpu::Scalar);
+    #endif
+    #ifdef CORRADE_ENABLE_AVX2
+    if(features & Cpu::Feature::Avx2)
+        return Implementation::sha1DigestBatchImplementation(Cpu::Avx2);
+    #endif
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Feature::Sse2)
+        return Implementation::sha1DigestBatchImplementation(Cpu::Sse2);
+    #endif
+    return Implementation::sha1DigestBatchImplementation(Cpu::Scalar);
+}
+
+#ifdef CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+#ifdef CORRADE_CPU_USE_IFUNC
+CORRADE_CPU_DISPATCHED_IFUNC(digestBatchDispatcher, void digestBatch(Containers::ArrayView<const Containers::ArrayView<const char>>, Containers::ArrayView<Sha1::Digest>))
+#else
+CORRADE_CPU_DISPATCHED_POINTER(digestBatchDispatcher, Implementation::Sha1DigestBatchFunction digestBatch)
+#endif
+#else
+void digestBatch(const Containers::ArrayView<const Containers::ArrayView<const char>> data, const Containers::ArrayView<Sha1::Digest> out) {
+    digestBatchDispatcher(Cpu::compiledFeatures)(data, out);
+}
+#endif
 }
 
 Sha1::Sha1(): _digest{InitialDigest[0], InitialDigest[1], InitialDigest[2], InitialDigest[3], InitialDigest[4]} {}
@@ -71,11 +604,10 @@ Sha1& Sha1::operator<<(Containers::ArrayView<const char> data) {
         /* Append few last bytes to have the buffer at 64 bytes */
         std::memcpy(_buffer + _bufferSize, data.data(), dataOffset);
         _bufferSize += dataOffset;
-        processChunk(_buffer);
+        processChunks(_digest, _buffer, 1);
     }
 
-    for(std::size_t i = dataOffset; i + 64 <= data.size(); i += 64)
-        processChunk(data.data() + i);
+    processChunks(_digest, data.data() + dataOffset, (data.size() - dataOffset)/64);
 
     /* Save last unfinished 512-bit chunk of data */
     auto leftOver = data.suffix(dataOffset + ((data.size() - dataOffset)/64)*64);
@@ -85,6 +617,12 @@ Sha1& Sha1::operator<<(Containers::ArrayView<const char> data) {
     return *this;
 }
 
+Containers::Array<Sha1::Digest> Sha1::digestBatch(const Containers::ArrayView<const Containers::ArrayView<const char>> data) {
+    Containers::Array<Digest> out{data.size()};
+    Utility::digestBatch(data, out);
+    return out;
+}
+
 Sha1& Sha1::operator<<(const std::string& data) {
     return *this << Containers::arrayView(data.data(), data.size());
 }
@@ -117,9 +655,7 @@ Sha1::Digest Sha1::digest() {
     _bufferSize += 8;
 
     /* Process remaining chunks */
-    for(std::size_t i = 0; i != _bufferSize/64; ++i) {
-        processChunk(_buffer+i*64);
-    }
+    processChunks(_digest, _buffer, _bufferSize/64);
 
     /* Convert digest from big endian */
     unsigned int digest[5];
@@ -137,54 +673,4 @@ Sha1::Digest Sha1::digest() {
 #pragma GCC pop_options
 #endif
 
-void Sha1::processChunk(const char* data) {
-    /* Extend the data to 80 bytes, make it big endian */
-    unsigned int extended[80];
-    /* Some memory juggling to avoid unaligned reads on platforms that don't
-       like it (Emscripten). The data don't have any endianness, so take the
-       first byte first, as usual. */
-    for(int i = 0; i != 16; ++i)
-        extended[i] =
-            (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 0])) << 24) |
-            (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 1])) << 16) |
-            (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 2])) <<  8) |
-            (static_cast<unsigned int>(static_cast<unsigned char>(data[i*4 + 3])) <<  0);
-    for(int i = 16; i != 80; ++i)
-        extended[i] = leftrotate((extended[i-3] ^ extended[i-8] ^ extended[i-14] ^ extended[i-16]), 1);
-
-    /* Initialize value for this chunk */
-    unsigned int d[5];
-    unsigned int f, constant, temp;
-    std::copy(_digest, _digest+5, d);
-
-    /* Main loop */
-    for(int i = 0; i != 80; ++i) {
-        if(i < 20) {
-            f = d[3] ^ (d[1] & (d[2] ^ d[3]));
-            constant = Constants[0];
-        } else if(i < 40) {
-            f = d[1] ^ d[2] ^ d[3];
-            constant = Constants[1];
-        } else if(i < 60) {
-            f = (d[1] & d[2]) | (d[3] & (d[1] | d[2]));
-            constant = Constants[2];
-        } else {
-            f = d[1] ^ d[2] ^ d[3];
-            constant = Constants[3];
-        }
-
-        temp =
-            leftrotate(d[0], 5) + f + d[4] + constant + extended[i];
-        d[4] = d[3];
-        d[3] = d[2];
-        d[2] = leftrotate(d[1], 30);
-        d[1] = d[0];
-        d[0] = temp;
-    }
-
-    /* Add the values to digest */
-    for(int i = 0; i != 5; ++i)
-        _digest[i] += d[i];
-}
-
 }}
@@ -37,12 +37,15 @@ namespace Corrade { namespace Utility { namespace String {
 
 namespace Implementation {
 
+/* These use the same character set search as Containers::StringView, which
+   is O(1) per byte independently of the set size, unlike the STL
+   find_first_not_of() / find_last_not_of() */
 void ltrimInPlace(std::string& string, const Containers::ArrayView<const char> characters) {
-    string.erase(0, string.find_first_not_of(characters, 0, characters.size()));
+    string.erase(0, Containers::StringView{string}.trimmedPrefix(characters).data() - string.data());
 }
 
 void rtrimInPlace(std::string& string, const Containers::ArrayView<const char> characters) {
-    string.erase(string.find_last_not_of(characters, std::string::npos, characters.size())+1);
+    string.erase(Containers::StringView{string}.trimmedSuffix(characters).size());
 }
 
 void trimInPlace(std::string& string, const Containers::ArrayView<const char> characters) {
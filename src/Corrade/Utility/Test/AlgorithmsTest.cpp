@@ -24,14 +24,18 @@
 */
 
 #include <algorithm>
+#include <cstring>
 #include <sstream>
 
 #include "Corrade/Containers/Array.h"
 #include "Corrade/Containers/ArrayViewStl.h"
+#include "Corrade/Containers/StaticStrideArrayView.h"
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/TestSuite/Compare/Container.h"
 #include "Corrade/Utility/Algorithms.h"
+#include "Corrade/Utility/Arguments.h"
 #include "Corrade/Utility/DebugStl.h"
+#include "Corrade/Utility/Implementation/algorithms.h"
 
 namespace Corrade { namespace Utility { namespace Test {
 
@@ -43,10 +47,43 @@ struct AlgorithmsTest: TestSuite::Tester {
     template<class T> void copyStrided2D();
     template<class T> void copyStrided3D();
     template<class T> void copyStrided4D();
+    template<class T> void copyStridedTiled();
     void copyZeroSizeStrided();
+    void copyStaticStride();
+    void copyStaticStrideContiguous();
+    void copyParallel();
+    void copyParallel1D();
 
     void copyNonMatchingSizes();
     void copyDifferentViewTypes();
+    void copyStaticStrideNonMatchingSizes();
+    void copyParallelNonMatchingSizes();
+
+    template<class I> void copyIndexed();
+    template<class T> void copyIndexedItemSize();
+    void copyIndexedNonContiguousItems();
+    void copyIndexedEmpty();
+    void copyIndexedInvalid();
+    template<class I> void scatter();
+    template<class T> void scatterItemSize();
+    void scatterNonContiguousItems();
+    void scatterInvalid();
+
+    template<class T> void fill();
+    void fillContiguous();
+    void fillEmpty();
+
+    void interleave();
+    void interleaveBlocks();
+    void interleaveInvalid();
+    void deinterleave();
+    void deinterleaveBlocks();
+    void deinterleaveInvalid();
+
+    void fillImplementation();
+    void gatherImplementation();
+    void interleaveImplementation();
+    void deinterleaveImplementation();
 
     void copyBenchmarkFlatStdCopy();
     void copyBenchmarkFlatLoop();
@@ -64,8 +101,31 @@ struct AlgorithmsTest: TestSuite::Tester {
     void copyBenchmark3DLastContiguous();
 
     void copyBenchmark1DNonContiguous();
+    void copyBenchmark1DNonContiguousStaticStride();
     void copyBenchmark2DNonContiguous();
     template<class T> void copyBenchmark3DNonContiguous();
+
+    void copyBenchmark2DTransposedLoop();
+    template<class T> void copyBenchmark2DTransposed();
+    void copyBenchmark2DFlippedLoop();
+    void copyBenchmark2DFlipped();
+    void copyBenchmark2DTransposedParallel();
+
+    void copyIndexedBenchmarkLoop();
+    void copyIndexedBenchmark();
+    void scatterBenchmarkLoop();
+    void scatterBenchmark();
+    void fillBenchmarkLoop();
+    void fillBenchmark();
+    void fillBenchmarkStrided();
+    void interleaveBenchmarkLoop();
+    void interleaveBenchmark();
+    void deinterleaveBenchmark();
+
+    void fillImplementationBenchmark();
+    void gatherImplementationBenchmark();
+    void interleaveImplementationBenchmark();
+    void deinterleaveImplementationBenchmark();
 };
 
 const struct {
@@ -127,6 +187,110 @@ const struct {
     {"contiguous transposed", {105, 15, 5, 1}, {105, 15, 5, 1}, false, true}
 };
 
+const struct {
+    const char* name;
+    bool transposedSrc, transposedDst, flippedSrc, flippedDst;
+} CopyTiledData[]{
+    {"transposed src", true, false, false, false},
+    {"transposed dst", false, true, false, false},
+    {"transposed src and dst", true, true, false, false},
+    {"transposed src, flipped dst", true, false, false, true},
+    {"flipped src", false, false, true, false},
+    {"transposed and flipped src", true, false, true, false}
+};
+
+const struct {
+    const char* name;
+    std::size_t threadCount;
+    std::size_t size;
+} CopyParallelData[]{
+    {"hardware concurrency", 0, 64},
+    {"one thread", 1, 64},
+    {"three threads", 3, 64},
+    /* Gets limited to 3 threads so each copies at least a megabyte */
+    {"eight threads", 8, 64},
+    /* Gets limited to 2 threads as there's just two slices */
+    {"eight threads, two slices", 8, 2},
+    /* Not enough data for more than one thread */
+    {"eight threads, small size", 8, 4}
+};
+
+/* Sorted by size. Only the 1K x 1K instances are run by default to keep the
+   test fast, pass `--algorithms-max-size 4096` to run the 4K x 4K ones as
+   well. */
+const struct {
+    const char* name;
+    std::size_t size;
+} CopyBenchmarkSizeData[]{
+    {"1K x 1K", 1024},
+    {"4K x 4K", 4096}
+};
+
+/* Same as above, pass `--algorithms-parallel-max-size 4096` to run the 4K x 4K
+   ones as well. */
+const struct {
+    const char* name;
+    std::size_t size;
+    std::size_t threadCount;
+} CopyParallelBenchmarkData[]{
+    /* More than 4 threads would get clamped for a 1K x 1K int view, as each
+       thread gets at least 1 MB */
+    {"1K x 1K, 1 thread", 1024, 1},
+    {"1K x 1K, 2 threads", 1024, 2},
+    {"1K x 1K, 4 threads", 1024, 4},
+    {"4K x 4K, 1 thread", 4096, 1},
+    {"4K x 4K, 8 threads", 4096, 8},
+    {"4K x 4K, 16 threads", 4096, 16}
+};
+
+/* Each variant is tested directly as the dispatcher picks just one. There's
+   no AVX2 variant of interleaving, so the AVX2 case picks the SSE2 one
+   there. */
+const struct {
+    const char* name;
+    Cpu::Features features;
+    Implementation::AlgorithmsFillFunction(*fill)();
+    Implementation::AlgorithmsGatherFunction(*gather)();
+    Implementation::AlgorithmsInterleaveFunction(*interleave)();
+    Implementation::AlgorithmsDeinterleaveFunction(*deinterleave)();
+} ImplementationData[]{
+    {"scalar", {}, [] {
+        return Implementation::algorithmsFillImplementation(Cpu::Scalar);
+    }, [] {
+        return Implementation::algorithmsGatherImplementation(Cpu::Scalar);
+    }, [] {
+        return Implementation::algorithmsInterleaveImplementation(Cpu::Scalar);
+    }, [] {
+        return Implementation::algorithmsDeinterleaveImplementation(Cpu::Scalar);
+    }},
+    #ifdef CORRADE_ENABLE_SSE2
+    {"SSE2", Cpu::Feature::Sse2, [] {
+        return Implementation::algorithmsFillImplementation(Cpu::Sse2);
+    }, [] {
+        return Implementation::algorithmsGatherImplementation(Cpu::Sse2);
+    }, [] {
+        return Implementation::algorithmsInterleaveImplementation(Cpu::Sse2);
+    }, [] {
+        return Implementation::algorithmsDeinterleaveImplementation(Cpu::Sse2);
+    }},
+    #endif
+    #ifdef CORRADE_ENABLE_AVX2
+    {"AVX2", Cpu::Feature::Avx2, [] {
+        return Implementation::algorithmsFillImplementation(Cpu::Avx2);
+    }, [] {
+        return Implementation::algorithmsGatherImplementation(Cpu::Avx2);
+    }, [] {
+        return Implementation::algorithmsInterleaveImplementation(Cpu::Avx2);
+    }, [] {
+        return Implementation::algorithmsDeinterleaveImplementation(Cpu::Avx2);
+    }},
+    #endif
+};
+
+/* Item count for the above, chosen so there's a partial block at the end in
+   all variants */
+constexpr std::size_t ImplementationCount = 37;
+
 /* For testing large types (and the Duff's device branch, which is 8 bytes and
    above right now) */
 template<std::size_t size> struct Data {
@@ -149,6 +313,15 @@ template<std::size_t size> Debug& operator<<(Debug& debug, const Data<size>& val
 }
 
 template<class> struct TypeName;
+template<> struct TypeName<std::uint8_t> {
+    static const char* name() { return "std::uint8_t"; }
+};
+template<> struct TypeName<std::uint16_t> {
+    static const char* name() { return "std::uint16_t"; }
+};
+template<> struct TypeName<std::uint32_t> {
+    static const char* name() { return "std::uint32_t"; }
+};
 template<> struct TypeName<char> {
     static const char* name() { return "char"; }
 };
@@ -158,6 +331,12 @@ template<> struct TypeName<int> {
 template<> struct TypeName<Data<1>> {
     static const char* name() { return "1B"; }
 };
+template<> struct TypeName<Data<2>> {
+    static const char* name() { return "2B"; }
+};
+template<> struct TypeName<Data<3>> {
+    static const char* name() { return "3B"; }
+};
 template<> struct TypeName<Data<4>> {
     static const char* name() { return "4B"; }
 };
@@ -171,7 +350,22 @@ template<> struct TypeName<Data<32>> {
     static const char* name() { return "32B"; }
 };
 
-AlgorithmsTest::AlgorithmsTest() {
+AlgorithmsTest::AlgorithmsTest(): TestSuite::Tester{TesterConfiguration{}.setSkippedArgumentPrefixes({"algorithms"})} {
+    Utility::Arguments args{"algorithms"};
+    args.addOption("max-size", "1024").setHelp("max-size", "max edge size of the transposed and flipped copy benchmarks", "N")
+        .addOption("parallel-max-size", "1024").setHelp("parallel-max-size", "max edge size of the parallel copy benchmark", "N")
+        .parse(arguments().first, arguments().second);
+    const std::size_t maxSize = args.value<std::size_t>("max-size");
+    const std::size_t parallelMaxSize = args.value<std::size_t>("parallel-max-size");
+
+    std::size_t copyBenchmarkSizeInstanceCount = 0;
+    while(copyBenchmarkSizeInstanceCount != Containers::arraySize(CopyBenchmarkSizeData) && CopyBenchmarkSizeData[copyBenchmarkSizeInstanceCount].size <= maxSize)
+        ++copyBenchmarkSizeInstanceCount;
+
+    std::size_t copyParallelBenchmarkInstanceCount = 0;
+    while(copyParallelBenchmarkInstanceCount != Containers::arraySize(CopyParallelBenchmarkData) && CopyParallelBenchmarkData[copyParallelBenchmarkInstanceCount].size <= parallelMaxSize)
+        ++copyParallelBenchmarkInstanceCount;
+
     addTests({&AlgorithmsTest::copy});
 
     addInstancedTests<AlgorithmsTest>({
@@ -192,9 +386,78 @@ AlgorithmsTest::AlgorithmsTest() {
         &AlgorithmsTest::copyStrided4D<Data<32>>,
         }, Containers::arraySize(Copy4DData));
 
+    addInstancedTests<AlgorithmsTest>({
+        &AlgorithmsTest::copyStridedTiled<char>,
+        &AlgorithmsTest::copyStridedTiled<Data<1>>,
+        &AlgorithmsTest::copyStridedTiled<Data<2>>,
+        &AlgorithmsTest::copyStridedTiled<Data<3>>,
+        &AlgorithmsTest::copyStridedTiled<int>,
+        &AlgorithmsTest::copyStridedTiled<Data<8>>,
+        &AlgorithmsTest::copyStridedTiled<Data<16>>,
+        &AlgorithmsTest::copyStridedTiled<Data<32>>,
+        }, Containers::arraySize(CopyTiledData));
+
     addTests({&AlgorithmsTest::copyZeroSizeStrided,
+              &AlgorithmsTest::copyStaticStride,
+              &AlgorithmsTest::copyStaticStrideContiguous});
+
+    addInstancedTests({&AlgorithmsTest::copyParallel},
+        Containers::arraySize(CopyParallelData));
+
+    addTests({&AlgorithmsTest::copyParallel1D,
               &AlgorithmsTest::copyNonMatchingSizes,
-              &AlgorithmsTest::copyDifferentViewTypes});
+              &AlgorithmsTest::copyDifferentViewTypes,
+              &AlgorithmsTest::copyStaticStrideNonMatchingSizes,
+              &AlgorithmsTest::copyParallelNonMatchingSizes,
+
+              &AlgorithmsTest::copyIndexed<std::uint8_t>,
+              &AlgorithmsTest::copyIndexed<std::uint16_t>,
+              &AlgorithmsTest::copyIndexed<std::uint32_t>,
+              &AlgorithmsTest::copyIndexedItemSize<Data<1>>,
+              &AlgorithmsTest::copyIndexedItemSize<Data<2>>,
+              &AlgorithmsTest::copyIndexedItemSize<Data<3>>,
+              &AlgorithmsTest::copyIndexedItemSize<Data<4>>,
+              &AlgorithmsTest::copyIndexedItemSize<Data<8>>,
+              &AlgorithmsTest::copyIndexedItemSize<Data<16>>,
+              &AlgorithmsTest::copyIndexedItemSize<Data<32>>,
+              &AlgorithmsTest::copyIndexedNonContiguousItems,
+              &AlgorithmsTest::copyIndexedEmpty,
+              &AlgorithmsTest::copyIndexedInvalid,
+              &AlgorithmsTest::scatter<std::uint8_t>,
+              &AlgorithmsTest::scatter<std::uint16_t>,
+              &AlgorithmsTest::scatter<std::uint32_t>,
+              &AlgorithmsTest::scatterItemSize<Data<1>>,
+              &AlgorithmsTest::scatterItemSize<Data<2>>,
+              &AlgorithmsTest::scatterItemSize<Data<3>>,
+              &AlgorithmsTest::scatterItemSize<Data<4>>,
+              &AlgorithmsTest::scatterItemSize<Data<8>>,
+              &AlgorithmsTest::scatterItemSize<Data<16>>,
+              &AlgorithmsTest::scatterItemSize<Data<32>>,
+              &AlgorithmsTest::scatterNonContiguousItems,
+              &AlgorithmsTest::scatterInvalid,
+
+              &AlgorithmsTest::fill<Data<1>>,
+              &AlgorithmsTest::fill<Data<2>>,
+              &AlgorithmsTest::fill<Data<3>>,
+              &AlgorithmsTest::fill<Data<4>>,
+              &AlgorithmsTest::fill<Data<8>>,
+              &AlgorithmsTest::fill<Data<16>>,
+              &AlgorithmsTest::fill<Data<32>>,
+              &AlgorithmsTest::fillContiguous,
+              &AlgorithmsTest::fillEmpty,
+
+              &AlgorithmsTest::interleave,
+              &AlgorithmsTest::interleaveBlocks,
+              &AlgorithmsTest::interleaveInvalid,
+              &AlgorithmsTest::deinterleave,
+              &AlgorithmsTest::deinterleaveBlocks,
+              &AlgorithmsTest::deinterleaveInvalid});
+
+    addInstancedTests({&AlgorithmsTest::fillImplementation,
+                       &AlgorithmsTest::gatherImplementation,
+                       &AlgorithmsTest::interleaveImplementation,
+                       &AlgorithmsTest::deinterleaveImplementation},
+        Containers::arraySize(ImplementationData));
 
     addBenchmarks({&AlgorithmsTest::copyBenchmarkFlatStdCopy,
                    &AlgorithmsTest::copyBenchmarkFlatLoop,
@@ -212,12 +475,42 @@ AlgorithmsTest::AlgorithmsTest() {
                    &AlgorithmsTest::copyBenchmark3DLastContiguous,
 
                    &AlgorithmsTest::copyBenchmark1DNonContiguous,
+                   &AlgorithmsTest::copyBenchmark1DNonContiguousStaticStride,
                    &AlgorithmsTest::copyBenchmark2DNonContiguous,
                    &AlgorithmsTest::copyBenchmark3DNonContiguous<Data<1>>,
                    &AlgorithmsTest::copyBenchmark3DNonContiguous<Data<4>>,
                    &AlgorithmsTest::copyBenchmark3DNonContiguous<Data<8>>,
                    &AlgorithmsTest::copyBenchmark3DNonContiguous<Data<16>>,
                    &AlgorithmsTest::copyBenchmark3DNonContiguous<Data<32>>}, 100);
+
+    addInstancedBenchmarks<AlgorithmsTest>({
+        &AlgorithmsTest::copyBenchmark2DTransposedLoop,
+        &AlgorithmsTest::copyBenchmark2DTransposed<char>,
+        &AlgorithmsTest::copyBenchmark2DTransposed<int>,
+        &AlgorithmsTest::copyBenchmark2DTransposed<Data<8>>,
+        &AlgorithmsTest::copyBenchmark2DFlippedLoop,
+        &AlgorithmsTest::copyBenchmark2DFlipped}, 5,
+        copyBenchmarkSizeInstanceCount);
+
+    addInstancedBenchmarks({&AlgorithmsTest::copyBenchmark2DTransposedParallel}, 5,
+        copyParallelBenchmarkInstanceCount);
+
+    addBenchmarks({&AlgorithmsTest::copyIndexedBenchmarkLoop,
+                   &AlgorithmsTest::copyIndexedBenchmark,
+                   &AlgorithmsTest::scatterBenchmarkLoop,
+                   &AlgorithmsTest::scatterBenchmark,
+                   &AlgorithmsTest::fillBenchmarkLoop,
+                   &AlgorithmsTest::fillBenchmark,
+                   &AlgorithmsTest::fillBenchmarkStrided,
+                   &AlgorithmsTest::interleaveBenchmarkLoop,
+                   &AlgorithmsTest::interleaveBenchmark,
+                   &AlgorithmsTest::deinterleaveBenchmark}, 100);
+
+    addInstancedBenchmarks({&AlgorithmsTest::fillImplementationBenchmark,
+                            &AlgorithmsTest::gatherImplementationBenchmark,
+                            &AlgorithmsTest::interleaveImplementationBenchmark,
+                            &AlgorithmsTest::deinterleaveImplementationBenchmark}, 100,
+        Containers::arraySize(ImplementationData));
 }
 
 void AlgorithmsTest::copy() {
@@ -381,6 +674,48 @@ template<class T> void AlgorithmsTest::copyStrided4D() {
                 CORRADE_COMPARE_AS(dst[i][j][k], src[i][j][k], TestSuite::Compare::Container);
 }
 
+template<class T> void AlgorithmsTest::copyStridedTiled() {
+    auto&& data = CopyTiledData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Large enough and not a multiple of the tile size in either dimension
+       so both full and partial tiles get copied */
+    Containers::Array<T> srcData{Containers::NoInit, 2*67*45};
+    Containers::Array<T> dstData{Containers::ValueInit, 2*67*45};
+
+    /* Fill all bytes so all of them are verified, not just the first */
+    Containers::ArrayView<char> srcBytes = Containers::arrayCast<char>(srcData);
+    for(std::size_t i = 0; i != srcBytes.size(); ++i)
+        srcBytes[i] = char(i*7 + i/251);
+
+    Containers::StridedArrayView3D<T> src;
+    if(data.transposedSrc)
+        src = Containers::StridedArrayView3D<T>{srcData, {2, 45, 67}}.template transposed<1, 2>();
+    else
+        src = Containers::StridedArrayView3D<T>{srcData, {2, 67, 45}};
+    if(data.flippedSrc)
+        src = src.template flipped<2>();
+
+    Containers::StridedArrayView3D<T> dst;
+    if(data.transposedDst)
+        dst = Containers::StridedArrayView3D<T>{dstData, {2, 45, 67}}.template transposed<1, 2>();
+    else
+        dst = Containers::StridedArrayView3D<T>{dstData, {2, 67, 45}};
+    if(data.flippedDst)
+        dst = dst.template flipped<2>();
+
+    Utility::copy(src, dst);
+
+    std::size_t mismatches = 0;
+    for(std::size_t i = 0; i != 2; ++i)
+        for(std::size_t j = 0; j != 67; ++j)
+            for(std::size_t k = 0; k != 45; ++k)
+                if(std::memcmp(&dst[i][j][k], &src[i][j][k], sizeof(T)) != 0)
+                    ++mismatches;
+    CORRADE_COMPARE(mismatches, 0);
+}
+
 void AlgorithmsTest::copyZeroSizeStrided() {
     Containers::StridedArrayView1D<char> src{nullptr, 0, 16};
     Containers::StridedArrayView1D<char> dst{nullptr, 0, 16};
@@ -391,6 +726,74 @@ void AlgorithmsTest::copyZeroSizeStrided() {
     CORRADE_VERIFY(true);
 }
 
+void AlgorithmsTest::copyStaticStride() {
+    struct Vertex {
+        float position;
+        int id;
+    } src[]{
+        {1.0f, 11},
+        {2.0f, -22},
+        {3.0f, 33}
+    };
+    int dst[6]{};
+
+    Utility::copy(Containers::StaticStrideArrayView<8, Vertex>{src}.slice(&Vertex::id),
+        Containers::StaticStrideArrayView<8, int>{Containers::arrayView(dst), 3}.flipped());
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView({33, 0, -22, 0, 11, 0}),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::copyStaticStrideContiguous() {
+    int src[]{11, -22, 33, -44};
+    int dst[4]{};
+
+    /* Delegates to the memcpy() variant */
+    Utility::copy(Containers::StaticStrideArrayView<4, const int>{src},
+                  Containers::StaticStrideArrayView<4, int>{dst});
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(src),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::copyParallel() {
+    auto&& data = CopyParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* With a size of 64 it's 3 MB, enough for three threads */
+    Containers::Array<int> srcData{Containers::NoInit, data.size*96*128};
+    Containers::Array<int> dstData{Containers::ValueInit, data.size*96*128};
+    for(std::size_t i = 0; i != srcData.size(); ++i) srcData[i] = i;
+
+    /* Transposed so it's not just a contiguous copy of each slice, and
+       non-const to test the conversion overload as well */
+    Containers::StridedArrayView3D<int> src = Containers::StridedArrayView3D<int>{srcData, {data.size, 128, 96}}.transposed<1, 2>();
+    Containers::StridedArrayView3D<int> dst{dstData, {data.size, 96, 128}};
+
+    Utility::copy(src, dst, data.threadCount);
+
+    std::size_t mismatches = 0;
+    for(std::size_t i = 0; i != data.size; ++i)
+        for(std::size_t j = 0; j != 96; ++j)
+            for(std::size_t k = 0; k != 128; ++k)
+                if(dst[i][j][k] != src[i][j][k]) ++mismatches;
+    CORRADE_COMPARE(mismatches, 0);
+}
+
+void AlgorithmsTest::copyParallel1D() {
+    /* 4 MB, enough for four threads */
+    Containers::Array<int> srcData{Containers::NoInit, 1024*1024};
+    Containers::Array<int> dstData{Containers::ValueInit, 1024*1024/2};
+    for(std::size_t i = 0; i != srcData.size(); ++i) srcData[i] = i;
+
+    Utility::copy(Containers::stridedArrayView(srcData).every(2), dstData, 4);
+
+    std::size_t mismatches = 0;
+    for(std::size_t i = 0; i != dstData.size(); ++i)
+        if(dstData[i] != int(i*2)) ++mismatches;
+    CORRADE_COMPARE(mismatches, 0);
+}
+
 void AlgorithmsTest::copyNonMatchingSizes() {
     #ifdef CORRADE_NO_ASSERT
     CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
@@ -455,6 +858,605 @@ void AlgorithmsTest::copyDifferentViewTypes() {
         TestSuite::Compare::Container);
 }
 
+void AlgorithmsTest::copyParallelNonMatchingSizes() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char a[2*3*5*7]{};
+    int b[2*3*5*7]{};
+
+    Utility::copy(Containers::StridedArrayView2D<const char>{a, {2, 3}},
+                  Containers::StridedArrayView2D<char>{a, {2, 4}}, 4);
+    Utility::copy(Containers::StridedArrayView3D<const char>{a, {2, 3, 5}},
+                  Containers::StridedArrayView3D<char>{a, {2, 4, 5}}, 4);
+    Utility::copy(Containers::StridedArrayView4D<const char>{a, {2, 3, 5, 7}},
+                  Containers::StridedArrayView4D<char>{a, {2, 3, 5, 6}}, 4);
+
+    /* Templated variant */
+    Utility::copy(Containers::StridedArrayView3D<const int>{b, {2, 3, 5}},
+                  Containers::StridedArrayView3D<int>{b, {2, 3, 4}}, 4);
+
+    CORRADE_COMPARE(out.str(),
+        "Utility::Algorithms::copy(): sizes {2, 3} and {2, 4} don't match\n"
+        "Utility::Algorithms::copy(): sizes {2, 3, 5} and {2, 4, 5} don't match\n"
+        "Utility::Algorithms::copy(): sizes {2, 3, 5, 7} and {2, 3, 5, 6} don't match\n"
+        "Utility::Algorithms::copy(): sizes {2, 3, 5, 4} and {2, 3, 4, 4} don't match\n");
+}
+
+void AlgorithmsTest::copyStaticStrideNonMatchingSizes() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    int a[6]{};
+    Utility::copy(Containers::StaticStrideArrayView<8, const int>{Containers::arrayView(a), 2},
+                  Containers::StaticStrideArrayView<8, int>{Containers::arrayView(a), 3});
+    CORRADE_COMPARE(out.str(),
+        "Utility::Algorithms::copy(): sizes 2 and 3 don't match\n");
+}
+
+template<class I> void AlgorithmsTest::copyIndexed() {
+    setTestCaseTemplateName(TypeName<I>::name());
+
+    const int src[]{10, 20, 30, 40, 50};
+    const I indices[]{4, 0, 0, 2, 3, 1};
+    int dst[6]{};
+
+    Utility::copy(Containers::stridedArrayView(src),
+                  Containers::stridedArrayView(indices),
+                  Containers::stridedArrayView(dst));
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView({50, 10, 10, 30, 40, 20}),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void AlgorithmsTest::copyIndexedItemSize() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Sparse source and destination to verify strides are used, all bytes
+       filled so all of them get verified, not just the first */
+    T srcData[10];
+    Containers::ArrayView<char> srcBytes = Containers::arrayCast<char>(Containers::arrayView(srcData));
+    for(std::size_t i = 0; i != srcBytes.size(); ++i)
+        srcBytes[i] = char(i*3 + 1);
+    T dstData[8]{};
+    const std::uint32_t indices[]{2, 0, 4, 2};
+
+    Containers::StridedArrayView1D<const T> src = Containers::stridedArrayView(srcData).every(2);
+    Containers::StridedArrayView1D<T> dst = Containers::stridedArrayView(dstData).every(2);
+    Utility::copy(src, Containers::stridedArrayView(indices), dst);
+
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(std::memcmp(&dst[i], &src[indices[i]], sizeof(T)), 0);
+    }
+
+    /* Items between the sparse ones are untouched */
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dstData[i*2 + 1].data[0], 0);
+    }
+}
+
+void AlgorithmsTest::copyIndexedNonContiguousItems() {
+    const char src[]{'a', 'A', 'b', 'B', 'c', 'C'};
+    const std::uint16_t indices[]{2, 1, 2};
+    char dst[6]{};
+
+    /* Two-byte items with the bytes being three bytes apart, i.e. "aB",
+       "Ac" and "bC" */
+    Utility::copy(Containers::StridedArrayView2D<const char>{src, {3, 2}, {1, 3}},
+        Containers::stridedArrayView(indices),
+        Containers::StridedArrayView2D<char>{dst, {3, 2}});
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView({'b', 'C', 'A', 'c', 'b', 'C'}),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::copyIndexedEmpty() {
+    /* Shouldn't crash, and shouldn't complain about out-of-bounds indices
+       either */
+    Utility::copy(Containers::StridedArrayView1D<const int>{},
+                  Containers::StridedArrayView1D<const std::uint32_t>{},
+                  Containers::StridedArrayView1D<int>{});
+    CORRADE_VERIFY(true);
+}
+
+void AlgorithmsTest::copyIndexedInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const char src[12]{};
+    char dst[12]{};
+    const std::uint32_t indices[]{0, 3, 1};
+
+    Utility::copy(Containers::StridedArrayView2D<const char>{src, {4, 3}},
+        Containers::stridedArrayView(indices),
+        Containers::StridedArrayView2D<char>{dst, {3, 4}});
+    Utility::copy(Containers::StridedArrayView2D<const char>{src, {4, 3}},
+        Containers::stridedArrayView(indices),
+        Containers::StridedArrayView2D<char>{dst, {4, 3}});
+    Utility::copy(Containers::StridedArrayView2D<const char>{src, {3, 4}},
+        Containers::stridedArrayView(indices),
+        Containers::StridedArrayView2D<char>{dst, {3, 4}});
+    CORRADE_COMPARE(out.str(),
+        "Utility::Algorithms::copy(): item sizes 3 and 4 don't match\n"
+        "Utility::Algorithms::copy(): expected 4 indices but got 3\n"
+        "Utility::Algorithms::copy(): index 3 out of range for 3 source items\n");
+}
+
+template<class I> void AlgorithmsTest::scatter() {
+    setTestCaseTemplateName(TypeName<I>::name());
+
+    const int src[]{10, 20, 30, 40};
+    const I indices[]{4, 0, 2, 3};
+    int dst[6]{};
+
+    Utility::scatter(Containers::stridedArrayView(src),
+                     Containers::stridedArrayView(indices),
+                     Containers::stridedArrayView(dst));
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView({20, 0, 30, 40, 10, 0}),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void AlgorithmsTest::scatterItemSize() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Sparse source and destination to verify strides are used, all bytes
+       filled so all of them get verified, not just the first */
+    T srcData[8];
+    Containers::ArrayView<char> srcBytes = Containers::arrayCast<char>(Containers::arrayView(srcData));
+    for(std::size_t i = 0; i != srcBytes.size(); ++i)
+        srcBytes[i] = char(i*3 + 1);
+    T dstData[10]{};
+    const std::uint32_t indices[]{2, 0, 4, 1};
+
+    Containers::StridedArrayView1D<const T> src = Containers::stridedArrayView(srcData).every(2);
+    Containers::StridedArrayView1D<T> dst = Containers::stridedArrayView(dstData).every(2);
+    Utility::scatter(src, Containers::stridedArrayView(indices), dst);
+
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(std::memcmp(&dst[indices[i]], &src[i], sizeof(T)), 0);
+    }
+
+    /* Items not referenced by any index are untouched */
+    CORRADE_COMPARE(dst[3].data[0], 0);
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dstData[i*2 + 1].data[0], 0);
+    }
+}
+
+void AlgorithmsTest::scatterNonContiguousItems() {
+    const char src[]{'a', 'A', 'b', 'B', 'c', 'C'};
+    const std::uint8_t indices[]{2, 0, 1};
+    char dst[6]{};
+
+    /* Two-byte items in the destination have the bytes three bytes apart */
+    Utility::scatter(Containers::StridedArrayView2D<const char>{src, {3, 2}},
+        Containers::stridedArrayView(indices),
+        Containers::StridedArrayView2D<char>{dst, {3, 2}, {1, 3}});
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView({'b', 'c', 'a', 'B', 'C', 'A'}),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::scatterInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const char src[12]{};
+    char dst[12]{};
+    const std::uint8_t indices[]{0, 3, 1};
+
+    Utility::scatter(Containers::StridedArrayView2D<const char>{src, {3, 4}},
+        Containers::stridedArrayView(indices),
+        Containers::StridedArrayView2D<char>{dst, {4, 3}});
+    Utility::scatter(Containers::StridedArrayView2D<const char>{src, {4, 3}},
+        Containers::stridedArrayView(indices),
+        Containers::StridedArrayView2D<char>{dst, {4, 3}});
+    Utility::scatter(Containers::StridedArrayView2D<const char>{src, {3, 4}},
+        Containers::stridedArrayView(indices),
+        Containers::StridedArrayView2D<char>{dst, {3, 4}});
+    CORRADE_COMPARE(out.str(),
+        "Utility::Algorithms::scatter(): item sizes 4 and 3 don't match\n"
+        "Utility::Algorithms::scatter(): expected 4 indices but got 3\n"
+        "Utility::Algorithms::scatter(): index 3 out of range for 3 destination items\n");
+}
+
+template<class T> void AlgorithmsTest::fill() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* All bytes set so all of them get verified, not just the first */
+    T value;
+    for(std::size_t i = 0; i != sizeof(T); ++i)
+        value.data[i] = char(i*7 + 3);
+
+    /* Sparse in the last dimension, contiguous in the middle one */
+    T data[2*3*8]{};
+    Containers::StridedArrayView3D<T> view{data, {2, 3, 4}, {
+        std::ptrdiff_t(3*8*sizeof(T)),
+        std::ptrdiff_t(8*sizeof(T)),
+        std::ptrdiff_t(2*sizeof(T))}};
+    Utility::fill(view, value);
+
+    /* Transposed and flipped, to test non-contiguous and negative strides in
+       the innermost dimension. Fills the remaining items of the first slice
+       with the value as well. */
+    Utility::fill(Containers::StridedArrayView2D<T>{Containers::arrayView(data).suffix(1), {3, 4}, {
+        std::ptrdiff_t(8*sizeof(T)),
+        std::ptrdiff_t(2*sizeof(T))}}.template transposed<0, 1>().template flipped<1>(), value);
+
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        /* The second slice has only every second item filled */
+        if(i >= 3*8 && i % 2)
+            CORRADE_COMPARE(data[i].data[0], 0);
+        else
+            CORRADE_COMPARE(std::memcmp(&data[i], &value, sizeof(T)), 0);
+    }
+}
+
+void AlgorithmsTest::fillContiguous() {
+    /* Goes through the overload converting from an arbitrary type */
+    Containers::Array<int> data{Containers::NoInit, 37};
+    Utility::fill(data, 1337);
+    CORRADE_COMPARE_AS(data,
+        (Containers::Array<int>{Containers::DirectInit, 37, 1337}),
+        TestSuite::Compare::Container);
+
+    char bytes[5]{};
+    Utility::fill(Containers::arrayView(bytes).prefix(4), 'x');
+    CORRADE_COMPARE_AS(Containers::arrayView(bytes),
+        Containers::arrayView({'x', 'x', 'x', 'x', '\0'}),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::fillEmpty() {
+    /* Shouldn't crash */
+    Utility::fill(Containers::StridedArrayView2D<int>{nullptr, {0, 3}, {12, 4}}, 5);
+    CORRADE_VERIFY(true);
+}
+
+void AlgorithmsTest::interleave() {
+    const float a[]{1.0f, 2.0f, 3.0f};
+    const std::uint16_t b[]{4, 5, 6};
+    const char c[]{'x', 'y', 'z'};
+
+    struct Vertex {
+        float a;
+        std::uint16_t b;
+        char c;
+        char padding;
+    } vertices[3]{};
+    for(Vertex& i: vertices) i.padding = '!';
+
+    Utility::interleave({
+        Containers::arrayCast<2, const char>(Containers::stridedArrayView(a)),
+        Containers::arrayCast<2, const char>(Containers::stridedArrayView(b)),
+        Containers::arrayCast<2, const char>(Containers::stridedArrayView(c))
+    }, Containers::arrayCast<2, char>(Containers::stridedArrayView(vertices)));
+
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(vertices[i].a, a[i]);
+        CORRADE_COMPARE(vertices[i].b, b[i]);
+        CORRADE_COMPARE(vertices[i].c, c[i]);
+        /* Not covered by any attribute, untouched */
+        CORRADE_COMPARE(vertices[i].padding, '!');
+    }
+}
+
+void AlgorithmsTest::interleaveBlocks() {
+    /* Large enough to not be processed all at once but split into several
+       blocks, with the last one partial */
+    Containers::Array<int> a{Containers::NoInit, 50000};
+    Containers::Array<Data<3>> b{Containers::NoInit, 50000};
+    for(std::size_t i = 0; i != a.size(); ++i) {
+        a[i] = i;
+        b[i] = char(i);
+    }
+
+    Containers::Array<char> interleaved{Containers::ValueInit, 50000*7};
+    Containers::StridedArrayView2D<char> dst{interleaved, {50000, 7}};
+    Utility::interleave({
+        Containers::arrayCast<2, const char>(Containers::stridedArrayView(a)),
+        Containers::arrayCast<2, const char>(Containers::stridedArrayView(b)),
+    }, dst);
+
+    std::size_t mismatches = 0;
+    for(std::size_t i = 0; i != a.size(); ++i) {
+        int aValue;
+        std::memcpy(&aValue, &dst[i][0], 4);
+        if(aValue != int(i) || dst[i][4] != char(i)) ++mismatches;
+    }
+    CORRADE_COMPARE(mismatches, 0);
+}
+
+void AlgorithmsTest::interleaveInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const char a[12]{};
+    char dst[24]{};
+
+    Utility::interleave({
+        Containers::StridedArrayView2D<const char>{a, {3, 4}},
+        Containers::StridedArrayView2D<const char>{a, {4, 3}}
+    }, Containers::StridedArrayView2D<char>{dst, {3, 8}});
+    Utility::interleave({
+        Containers::StridedArrayView2D<const char>{a, {3, 4}},
+        Containers::StridedArrayView2D<const char>{a, {3, 4}}
+    }, Containers::StridedArrayView2D<char>{dst, {3, 7}});
+    CORRADE_COMPARE(out.str(),
+        "Utility::Algorithms::interleave(): expected attribute 1 to have 3 items but got 4\n"
+        "Utility::Algorithms::interleave(): attributes take 8 bytes but the destination has only 7\n");
+}
+
+void AlgorithmsTest::deinterleave() {
+    const struct Vertex {
+        float a;
+        std::uint16_t b;
+        char c;
+        char padding;
+    } vertices[]{
+        {1.0f, 4, 'x', '!'},
+        {2.0f, 5, 'y', '!'},
+        {3.0f, 6, 'z', '!'}
+    };
+
+    float a[3]{};
+    std::uint16_t b[3]{};
+    char c[4]{};
+
+    Utility::deinterleave(Containers::arrayCast<2, const char>(Containers::stridedArrayView(vertices)), {
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(a)),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(b)),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(c).prefix(3))
+    });
+
+    CORRADE_COMPARE_AS(Containers::arrayView(a),
+        Containers::arrayView({1.0f, 2.0f, 3.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(b),
+        Containers::arrayView<std::uint16_t>({4, 5, 6}),
+        TestSuite::Compare::Container);
+    /* The padding is skipped */
+    CORRADE_COMPARE_AS(Containers::arrayView(c),
+        Containers::arrayView({'x', 'y', 'z', '\0'}),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::deinterleaveBlocks() {
+    /* Large enough to not be processed all at once but split into several
+       blocks, with the last one partial */
+    Containers::Array<char> interleaved{Containers::NoInit, 50000*7};
+    Containers::StridedArrayView2D<char> src{interleaved, {50000, 7}};
+    for(std::size_t i = 0; i != 50000; ++i) {
+        const int aValue = i;
+        std::memcpy(&src[i][0], &aValue, 4);
+        src[i][4] = char(i);
+    }
+
+    Containers::Array<int> a{Containers::ValueInit, 50000};
+    Containers::Array<Data<3>> b{Containers::ValueInit, 50000};
+    Utility::deinterleave(src, {
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(a)),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(b)),
+    });
+
+    std::size_t mismatches = 0;
+    for(std::size_t i = 0; i != a.size(); ++i)
+        if(a[i] != int(i) || b[i].data[0] != char(i)) ++mismatches;
+    CORRADE_COMPARE(mismatches, 0);
+}
+
+void AlgorithmsTest::deinterleaveInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const char src[24]{};
+    char a[12]{};
+
+    Utility::deinterleave(Containers::StridedArrayView2D<const char>{src, {3, 8}}, {
+        Containers::StridedArrayView2D<char>{a, {3, 4}},
+        Containers::StridedArrayView2D<char>{a, {4, 3}}
+    });
+    Utility::deinterleave(Containers::StridedArrayView2D<const char>{src, {3, 7}}, {
+        Containers::StridedArrayView2D<char>{a, {3, 4}},
+        Containers::StridedArrayView2D<char>{a, {3, 4}}
+    });
+    CORRADE_COMPARE(out.str(),
+        "Utility::Algorithms::deinterleave(): expected attribute 1 to have 3 items but got 4\n"
+        "Utility::Algorithms::deinterleave(): attributes take 8 bytes but the source has only 7\n");
+}
+
+void AlgorithmsTest::fillImplementation() {
+    auto&& data = ImplementationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(Cpu::runtimeFeatures() >= data.features))
+        CORRADE_SKIP("Feature not supported by this CPU");
+
+    const Implementation::AlgorithmsFillFunction fill = data.fill();
+
+    char value[16];
+    for(std::size_t i = 0; i != 16; ++i) value[i] = char('a' + i);
+
+    for(const std::size_t size: {4, 8, 16}) {
+        CORRADE_ITERATION(size);
+
+        /* The byte after the last item should stay untouched */
+        char dst[ImplementationCount*16 + 1];
+        char expected[ImplementationCount*16 + 1];
+        std::memset(dst, '-', sizeof(dst));
+        std::memset(expected, '-', sizeof(expected));
+        for(std::size_t i = 0; i != ImplementationCount*size; ++i)
+            expected[i] = value[i % size];
+
+        fill(dst, ImplementationCount, size, value);
+        CORRADE_COMPARE_AS(Containers::ArrayView<const char>{dst}.prefix(ImplementationCount*size + 1),
+            Containers::ArrayView<const char>{expected}.prefix(ImplementationCount*size + 1),
+            TestSuite::Compare::Container);
+    }
+}
+
+void AlgorithmsTest::gatherImplementation() {
+    auto&& data = ImplementationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(Cpu::runtimeFeatures() >= data.features))
+        CORRADE_SKIP("Feature not supported by this CPU");
+
+    const Implementation::AlgorithmsGatherFunction gather = data.gather();
+
+    char src[100*16];
+    for(std::size_t i = 0; i != sizeof(src); ++i) src[i] = char(i*7);
+
+    /* The same shuffled indices in all three types */
+    std::uint8_t indices8[ImplementationCount];
+    std::uint16_t indices16[ImplementationCount];
+    std::uint32_t indices32[ImplementationCount];
+    for(std::size_t i = 0; i != ImplementationCount; ++i) {
+        const std::size_t index = (i*13 + 5) % 100;
+        indices8[i] = index;
+        indices16[i] = index;
+        indices32[i] = index;
+    }
+    const struct {
+        std::size_t size;
+        const char* data;
+    } indices[]{
+        {1, reinterpret_cast<const char*>(indices8)},
+        {2, reinterpret_cast<const char*>(indices16)},
+        {4, reinterpret_cast<const char*>(indices32)}
+    };
+
+    for(const std::size_t size: {4, 8, 16}) {
+        CORRADE_ITERATION(size);
+
+        char expected[ImplementationCount*16 + 1];
+        std::memset(expected, '-', sizeof(expected));
+        for(std::size_t i = 0; i != ImplementationCount; ++i)
+            std::memcpy(expected + i*size, src + indices32[i]*size, size);
+
+        for(auto&& index: indices) {
+            CORRADE_ITERATION(index.size);
+
+            char dst[ImplementationCount*16 + 1];
+            std::memset(dst, '-', sizeof(dst));
+            gather(src, index.data, index.size, dst, ImplementationCount, size);
+            CORRADE_COMPARE_AS(Containers::ArrayView<const char>{dst}.prefix(ImplementationCount*size + 1),
+                Containers::ArrayView<const char>{expected}.prefix(ImplementationCount*size + 1),
+                TestSuite::Compare::Container);
+        }
+    }
+}
+
+void AlgorithmsTest::interleaveImplementation() {
+    auto&& data = ImplementationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(Cpu::runtimeFeatures() >= data.features))
+        CORRADE_SKIP("Feature not supported by this CPU");
+
+    const Implementation::AlgorithmsInterleaveFunction interleave = data.interleave();
+
+    char src[ImplementationCount*16];
+    for(std::size_t i = 0; i != sizeof(src); ++i) src[i] = char(i*7);
+
+    for(const std::size_t size: {4, 8, 16}) {
+        CORRADE_ITERATION(size);
+
+        /* An odd stride so the items aren't aligned, and a negative one to
+           verify the pointer arithmetic */
+        const std::ptrdiff_t stride = size + 3;
+        for(const bool flipped: {false, true}) {
+            CORRADE_ITERATION(flipped);
+
+            char dst[ImplementationCount*(16 + 3)];
+            char expected[ImplementationCount*(16 + 3)];
+            std::memset(dst, '-', sizeof(dst));
+            std::memset(expected, '-', sizeof(expected));
+            char* const begin = flipped ? dst + (ImplementationCount - 1)*stride : dst;
+            char* const expectedBegin = flipped ? expected + (ImplementationCount - 1)*stride : expected;
+            const std::ptrdiff_t dstStride = flipped ? -stride : stride;
+            for(std::size_t i = 0; i != ImplementationCount; ++i)
+                std::memcpy(expectedBegin + i*dstStride, src + i*size, size);
+
+            interleave(src, begin, dstStride, ImplementationCount, size);
+            CORRADE_COMPARE_AS(Containers::ArrayView<const char>{dst},
+                Containers::ArrayView<const char>{expected},
+                TestSuite::Compare::Container);
+        }
+    }
+}
+
+void AlgorithmsTest::deinterleaveImplementation() {
+    auto&& data = ImplementationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(Cpu::runtimeFeatures() >= data.features))
+        CORRADE_SKIP("Feature not supported by this CPU");
+
+    const Implementation::AlgorithmsDeinterleaveFunction deinterleave = data.deinterleave();
+
+    char src[ImplementationCount*(16 + 3)];
+    for(std::size_t i = 0; i != sizeof(src); ++i) src[i] = char(i*7);
+
+    for(const std::size_t size: {4, 8, 16}) {
+        CORRADE_ITERATION(size);
+
+        /* An odd stride so the items aren't aligned, and a negative one to
+           verify the pointer arithmetic */
+        const std::ptrdiff_t stride = size + 3;
+        for(const bool flipped: {false, true}) {
+            CORRADE_ITERATION(flipped);
+
+            const char* const begin = flipped ? src + (ImplementationCount - 1)*stride : src;
+            const std::ptrdiff_t srcStride = flipped ? -stride : stride;
+
+            /* The byte after the last item should stay untouched */
+            char dst[ImplementationCount*16 + 1];
+            char expected[ImplementationCount*16 + 1];
+            std::memset(dst, '-', sizeof(dst));
+            std::memset(expected, '-', sizeof(expected));
+            for(std::size_t i = 0; i != ImplementationCount; ++i)
+                std::memcpy(expected + i*size, begin + i*srcStride, size);
+
+            deinterleave(begin, srcStride, dst, ImplementationCount, size);
+            CORRADE_COMPARE_AS(Containers::ArrayView<const char>{dst}.prefix(ImplementationCount*size + 1),
+                Containers::ArrayView<const char>{expected}.prefix(ImplementationCount*size + 1),
+                TestSuite::Compare::Container);
+        }
+    }
+}
+
 constexpr std::size_t Size = 16;
 constexpr std::size_t Size2 = 64;
 static_assert(Size*Size*Size == Size2*Size2, "otherwise the times won't match");
@@ -725,6 +1727,27 @@ void AlgorithmsTest::copyBenchmark1DNonContiguous() {
     CORRADE_COMPARE(dst[Size*Size*Size - 1], Size*Size*Size + 10 - 1);
 }
 
+void AlgorithmsTest::copyBenchmark1DNonContiguousStaticStride() {
+    int srcData[Size*Size*Size*2];
+    int dstData[Size*Size*Size*2];
+    Containers::StaticStrideArrayView<8, int> src{Containers::arrayView(srcData), Size*Size*Size};
+    Containers::StaticStrideArrayView<8, int> dst{Containers::arrayView(dstData), Size*Size*Size};
+    CORRADE_VERIFY(!src.isContiguous());
+    CORRADE_VERIFY(!dst.isContiguous());
+
+    int base = 0;
+    CORRADE_BENCHMARK(10) {
+        int n = base;
+        for(int& i: src) i = ++n;
+
+        Utility::copy(src, dst);
+
+        ++base;
+    }
+
+    CORRADE_COMPARE(dst[Size*Size*Size - 1], Size*Size*Size + 10 - 1);
+}
+
 void AlgorithmsTest::copyBenchmark2DNonContiguous() {
     int srcData[Size2*Size2*2];
     int dstData[Size2*Size2*2];
@@ -773,6 +1796,369 @@ template<class T> void AlgorithmsTest::copyBenchmark3DNonContiguous() {
     CORRADE_COMPARE(dstData[Size*Size*Size*4/sizeof(T) - 2].data[0], (Size*Size*Size*4/sizeof(T) + 10 - 2)%256);
 }
 
+void AlgorithmsTest::copyBenchmark2DTransposedLoop() {
+    auto&& data = CopyBenchmarkSizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> srcData{Containers::NoInit, data.size*data.size};
+    Containers::Array<int> dstData{Containers::NoInit, data.size*data.size};
+    for(std::size_t i = 0; i != srcData.size(); ++i) srcData[i] = i;
+
+    Containers::StridedArrayView2D<int> src = Containers::StridedArrayView2D<int>{srcData, {data.size, data.size}}.transposed<0, 1>();
+    Containers::StridedArrayView2D<int> dst{dstData, {data.size, data.size}};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != data.size; ++i) {
+            Containers::StridedArrayView1D<int> srcRow = src[i];
+            Containers::StridedArrayView1D<int> dstRow = dst[i];
+            for(std::size_t j = 0; j != data.size; ++j)
+                dstRow[j] = srcRow[j];
+        }
+    }
+
+    CORRADE_COMPARE(dstData[1], data.size);
+    CORRADE_COMPARE(dstData[data.size], 1);
+}
+
+template<class T> void AlgorithmsTest::copyBenchmark2DTransposed() {
+    auto&& data = CopyBenchmarkSizeData[testCaseInstanceId()];
+    setTestCaseTemplateName(TypeName<T>::name());
+    setTestCaseDescription(data.name);
+
+    Containers::Array<T> srcData{Containers::NoInit, data.size*data.size};
+    Containers::Array<T> dstData{Containers::NoInit, data.size*data.size};
+    for(std::size_t i = 0; i != srcData.size(); ++i) srcData[i] = char(i);
+
+    Containers::StridedArrayView2D<T> src = Containers::StridedArrayView2D<T>{srcData, {data.size, data.size}}.template transposed<0, 1>();
+    Containers::StridedArrayView2D<T> dst{dstData, {data.size, data.size}};
+
+    CORRADE_BENCHMARK(1)
+        Utility::copy(src, dst);
+
+    CORRADE_COMPARE(dstData[data.size + 3], T(char(data.size*3 + 1)));
+}
+
+void AlgorithmsTest::copyBenchmark2DFlippedLoop() {
+    auto&& data = CopyBenchmarkSizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> srcData{Containers::NoInit, data.size*data.size};
+    Containers::Array<int> dstData{Containers::NoInit, data.size*data.size};
+    for(std::size_t i = 0; i != srcData.size(); ++i) srcData[i] = i;
+
+    Containers::StridedArrayView2D<int> src = Containers::StridedArrayView2D<int>{srcData, {data.size, data.size}}.flipped<1>();
+    Containers::StridedArrayView2D<int> dst{dstData, {data.size, data.size}};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != data.size; ++i) {
+            Containers::StridedArrayView1D<int> srcRow = src[i];
+            Containers::StridedArrayView1D<int> dstRow = dst[i];
+            for(std::size_t j = 0; j != data.size; ++j)
+                dstRow[j] = srcRow[j];
+        }
+    }
+
+    CORRADE_COMPARE(dstData[0], data.size - 1);
+    CORRADE_COMPARE(dstData[data.size], 2*data.size - 1);
+}
+
+void AlgorithmsTest::copyBenchmark2DFlipped() {
+    auto&& data = CopyBenchmarkSizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> srcData{Containers::NoInit, data.size*data.size};
+    Containers::Array<int> dstData{Containers::NoInit, data.size*data.size};
+    for(std::size_t i = 0; i != srcData.size(); ++i) srcData[i] = i;
+
+    Containers::StridedArrayView2D<int> src = Containers::StridedArrayView2D<int>{srcData, {data.size, data.size}}.flipped<1>();
+    Containers::StridedArrayView2D<int> dst{dstData, {data.size, data.size}};
+
+    CORRADE_BENCHMARK(1)
+        Utility::copy(src, dst);
+
+    CORRADE_COMPARE(dstData[0], data.size - 1);
+    CORRADE_COMPARE(dstData[data.size], 2*data.size - 1);
+}
+
+void AlgorithmsTest::copyBenchmark2DTransposedParallel() {
+    auto&& data = CopyParallelBenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> srcData{Containers::NoInit, data.size*data.size};
+    Containers::Array<int> dstData{Containers::NoInit, data.size*data.size};
+    for(std::size_t i = 0; i != srcData.size(); ++i) srcData[i] = i;
+
+    Containers::StridedArrayView2D<int> src = Containers::StridedArrayView2D<int>{srcData, {data.size, data.size}}.transposed<0, 1>();
+    Containers::StridedArrayView2D<int> dst{dstData, {data.size, data.size}};
+
+    CORRADE_BENCHMARK(1)
+        Utility::copy(src, dst, data.threadCount);
+
+    CORRADE_COMPARE(dstData[1], data.size);
+    CORRADE_COMPARE(dstData[data.size], 1);
+}
+
+void AlgorithmsTest::copyIndexedBenchmarkLoop() {
+    int src[Size*Size*Size];
+    std::uint32_t indices[Size*Size*Size];
+    int dst[Size*Size*Size];
+    for(std::size_t i = 0; i != Size*Size*Size; ++i) {
+        src[i] = i;
+        indices[i] = (i*97) % (Size*Size*Size);
+    }
+
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size*Size*Size; ++i)
+            dst[i] = src[indices[i]];
+    }
+
+    CORRADE_COMPARE(dst[1], 97);
+}
+
+void AlgorithmsTest::copyIndexedBenchmark() {
+    int src[Size*Size*Size];
+    std::uint32_t indices[Size*Size*Size];
+    int dst[Size*Size*Size];
+    for(std::size_t i = 0; i != Size*Size*Size; ++i) {
+        src[i] = i;
+        indices[i] = (i*97) % (Size*Size*Size);
+    }
+
+    CORRADE_BENCHMARK(10)
+        Utility::copy(Containers::stridedArrayView(src),
+                      Containers::stridedArrayView(indices),
+                      Containers::stridedArrayView(dst));
+
+    CORRADE_COMPARE(dst[1], 97);
+}
+
+void AlgorithmsTest::scatterBenchmarkLoop() {
+    int src[Size*Size*Size];
+    std::uint32_t indices[Size*Size*Size];
+    int dst[Size*Size*Size];
+    for(std::size_t i = 0; i != Size*Size*Size; ++i) {
+        src[i] = i;
+        indices[i] = (i*97) % (Size*Size*Size);
+    }
+
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size*Size*Size; ++i)
+            dst[indices[i]] = src[i];
+    }
+
+    CORRADE_COMPARE(dst[97], 1);
+}
+
+void AlgorithmsTest::scatterBenchmark() {
+    int src[Size*Size*Size];
+    std::uint32_t indices[Size*Size*Size];
+    int dst[Size*Size*Size];
+    for(std::size_t i = 0; i != Size*Size*Size; ++i) {
+        src[i] = i;
+        indices[i] = (i*97) % (Size*Size*Size);
+    }
+
+    CORRADE_BENCHMARK(10)
+        Utility::scatter(Containers::stridedArrayView(src),
+                         Containers::stridedArrayView(indices),
+                         Containers::stridedArrayView(dst));
+
+    CORRADE_COMPARE(dst[97], 1);
+}
+
+void AlgorithmsTest::fillBenchmarkLoop() {
+    int data[Size*Size*Size];
+    Containers::StridedArrayView1D<int> view = data;
+
+    int value = 0;
+    CORRADE_BENCHMARK(10) {
+        ++value;
+        for(std::size_t i = 0; i != Size*Size*Size; ++i)
+            view[i] = value;
+    }
+
+    CORRADE_COMPARE(data[Size*Size*Size - 1], 10);
+}
+
+void AlgorithmsTest::fillBenchmark() {
+    int data[Size*Size*Size];
+
+    int value = 0;
+    CORRADE_BENCHMARK(10)
+        Utility::fill(Containers::arrayView(data), ++value);
+
+    CORRADE_COMPARE(data[Size*Size*Size - 1], 10);
+}
+
+void AlgorithmsTest::fillBenchmarkStrided() {
+    int data[Size*Size*Size*2];
+    Containers::StridedArrayView3D<int> view{data, {Size, Size, Size},
+        {Size*Size*8, Size*8, 8}};
+
+    int value = 0;
+    CORRADE_BENCHMARK(10)
+        Utility::fill(view, ++value);
+
+    CORRADE_COMPARE(data[Size*Size*Size*2 - 2], 10);
+}
+
+namespace {
+    struct Vertex {
+        float position[3];
+        float normal[3];
+        std::uint32_t color;
+    };
+}
+
+void AlgorithmsTest::interleaveBenchmarkLoop() {
+    float positions[Size*Size*3];
+    float normals[Size*Size*3];
+    std::uint32_t colors[Size*Size];
+    for(std::size_t i = 0; i != Size*Size*3; ++i)
+        positions[i] = normals[i] = float(i);
+    for(std::size_t i = 0; i != Size*Size; ++i)
+        colors[i] = i;
+    Vertex vertices[Size*Size];
+
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Size*Size; ++i) {
+            for(std::size_t j = 0; j != 3; ++j) {
+                vertices[i].position[j] = positions[i*3 + j];
+                vertices[i].normal[j] = normals[i*3 + j];
+            }
+            vertices[i].color = colors[i];
+        }
+    }
+
+    CORRADE_COMPARE(vertices[Size*Size - 1].normal[2], Size*Size*3 - 1);
+    CORRADE_COMPARE(vertices[Size*Size - 1].color, Size*Size - 1);
+}
+
+void AlgorithmsTest::interleaveBenchmark() {
+    float positions[Size*Size*3];
+    float normals[Size*Size*3];
+    std::uint32_t colors[Size*Size];
+    for(std::size_t i = 0; i != Size*Size*3; ++i)
+        positions[i] = normals[i] = float(i);
+    for(std::size_t i = 0; i != Size*Size; ++i)
+        colors[i] = i;
+    Vertex vertices[Size*Size];
+
+    CORRADE_BENCHMARK(10)
+        Utility::interleave({
+            Containers::StridedArrayView2D<const char>{Containers::arrayCast<const char>(Containers::arrayView(positions)), {Size*Size, 12}},
+            Containers::StridedArrayView2D<const char>{Containers::arrayCast<const char>(Containers::arrayView(normals)), {Size*Size, 12}},
+            Containers::arrayCast<2, const char>(Containers::stridedArrayView(colors))
+        }, Containers::arrayCast<2, char>(Containers::stridedArrayView(vertices)));
+
+    CORRADE_COMPARE(vertices[Size*Size - 1].normal[2], Size*Size*3 - 1);
+    CORRADE_COMPARE(vertices[Size*Size - 1].color, Size*Size - 1);
+}
+
+void AlgorithmsTest::deinterleaveBenchmark() {
+    Vertex vertices[Size*Size];
+    for(std::size_t i = 0; i != Size*Size; ++i) {
+        for(std::size_t j = 0; j != 3; ++j)
+            vertices[i].position[j] = vertices[i].normal[j] = float(i*3 + j);
+        vertices[i].color = i;
+    }
+    float positions[Size*Size*3];
+    float normals[Size*Size*3];
+    std::uint32_t colors[Size*Size];
+
+    CORRADE_BENCHMARK(10)
+        Utility::deinterleave(Containers::arrayCast<2, const char>(Containers::stridedArrayView(vertices)), {
+            Containers::StridedArrayView2D<char>{Containers::arrayCast<char>(Containers::arrayView(positions)), {Size*Size, 12}},
+            Containers::StridedArrayView2D<char>{Containers::arrayCast<char>(Containers::arrayView(normals)), {Size*Size, 12}},
+            Containers::arrayCast<2, char>(Containers::stridedArrayView(colors))
+        });
+
+    CORRADE_COMPARE(normals[Size*Size*3 - 1], Size*Size*3 - 1);
+    CORRADE_COMPARE(colors[Size*Size - 1], Size*Size - 1);
+}
+
+void AlgorithmsTest::fillImplementationBenchmark() {
+    auto&& data = ImplementationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(Cpu::runtimeFeatures() >= data.features))
+        CORRADE_SKIP("Feature not supported by this CPU");
+
+    const Implementation::AlgorithmsFillFunction fill = data.fill();
+
+    int dst[Size*Size*Size];
+    int value = 0;
+    CORRADE_BENCHMARK(10) {
+        ++value;
+        fill(reinterpret_cast<char*>(dst), Size*Size*Size, 4, reinterpret_cast<const char*>(&value));
+    }
+
+    CORRADE_COMPARE(dst[Size*Size*Size - 1], 10);
+}
+
+void AlgorithmsTest::gatherImplementationBenchmark() {
+    auto&& data = ImplementationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(Cpu::runtimeFeatures() >= data.features))
+        CORRADE_SKIP("Feature not supported by this CPU");
+
+    const Implementation::AlgorithmsGatherFunction gather = data.gather();
+
+    int src[Size*Size*Size];
+    std::uint32_t indices[Size*Size*Size];
+    int dst[Size*Size*Size];
+    for(std::size_t i = 0; i != Size*Size*Size; ++i) {
+        src[i] = i;
+        indices[i] = (i*97) % (Size*Size*Size);
+    }
+
+    CORRADE_BENCHMARK(10)
+        gather(reinterpret_cast<const char*>(src), reinterpret_cast<const char*>(indices), 4, reinterpret_cast<char*>(dst), Size*Size*Size, 4);
+
+    CORRADE_COMPARE(dst[1], 97);
+}
+
+void AlgorithmsTest::interleaveImplementationBenchmark() {
+    auto&& data = ImplementationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(Cpu::runtimeFeatures() >= data.features))
+        CORRADE_SKIP("Feature not supported by this CPU");
+
+    const Implementation::AlgorithmsInterleaveFunction interleave = data.interleave();
+
+    /* Interleaving a single float into a 16-byte vertex */
+    float src[Size*Size*Size];
+    float dst[Size*Size*Size*4];
+    for(std::size_t i = 0; i != Size*Size*Size; ++i) src[i] = i;
+
+    CORRADE_BENCHMARK(10)
+        interleave(reinterpret_cast<const char*>(src), reinterpret_cast<char*>(dst), 16, Size*Size*Size, 4);
+
+    CORRADE_COMPARE(dst[4*97], 97.0f);
+}
+
+void AlgorithmsTest::deinterleaveImplementationBenchmark() {
+    auto&& data = ImplementationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(Cpu::runtimeFeatures() >= data.features))
+        CORRADE_SKIP("Feature not supported by this CPU");
+
+    const Implementation::AlgorithmsDeinterleaveFunction deinterleave = data.deinterleave();
+
+    /* Deinterleaving a single float from a 16-byte vertex */
+    float src[Size*Size*Size*4];
+    float dst[Size*Size*Size];
+    for(std::size_t i = 0; i != Size*Size*Size*4; ++i) src[i] = i;
+
+    CORRADE_BENCHMARK(10)
+        deinterleave(reinterpret_cast<const char*>(src), 16, reinterpret_cast<char*>(dst), Size*Size*Size, 4);
+
+    CORRADE_COMPARE(dst[97], 4*97.0f);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Corrade::Utility::Test::AlgorithmsTest)
@@ -0,0 +1,229 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Cpu.h"
+#include "Corrade/Utility/DebugStl.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef CORRADE_ENABLE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct CpuTest: TestSuite::Tester {
+    explicit CpuTest();
+
+    void tagHierarchy();
+    void defaultBase();
+    void features();
+
+    void dispatcher();
+    void dispatchedPointer();
+    void dispatchedIfunc();
+    void enableMacros();
+
+    void debugFeature();
+    void debugFeatures();
+};
+
+CpuTest::CpuTest() {
+    addTests({&CpuTest::tagHierarchy,
+              &CpuTest::defaultBase,
+              &CpuTest::features,
+
+              &CpuTest::dispatcher,
+              &CpuTest::dispatchedPointer,
+              &CpuTest::dispatchedIfunc,
+              &CpuTest::enableMacros,
+
+              &CpuTest::debugFeature,
+              &CpuTest::debugFeatures});
+}
+
+const char* tagName(Cpu::ScalarT) { return "Scalar"; }
+const char* tagName(Cpu::Sse2T) { return "Sse2"; }
+const char* tagName(Cpu::Ssse3T) { return "Ssse3"; }
+const char* tagName(Cpu::Avx2T) { return "Avx2"; }
+const char* tagName(Cpu::NeonT) { return "Neon"; }
+
+void CpuTest::tagHierarchy() {
+    /* Overload resolution should pick the closest base */
+    CORRADE_COMPARE(tagName(Cpu::Scalar), std::string{"Scalar"});
+    CORRADE_COMPARE(tagName(Cpu::Sse2), std::string{"Sse2"});
+    CORRADE_COMPARE(tagName(Cpu::Sse3), std::string{"Sse2"});
+    CORRADE_COMPARE(tagName(Cpu::Ssse3), std::string{"Ssse3"});
+    CORRADE_COMPARE(tagName(Cpu::Sse41), std::string{"Ssse3"});
+    CORRADE_COMPARE(tagName(Cpu::Sse42), std::string{"Ssse3"});
+    CORRADE_COMPARE(tagName(Cpu::Avx), std::string{"Ssse3"});
+    CORRADE_COMPARE(tagName(Cpu::Avx2), std::string{"Avx2"});
+    CORRADE_COMPARE(tagName(Cpu::Avx512f), std::string{"Avx2"});
+    CORRADE_COMPARE(tagName(Cpu::Neon), std::string{"Neon"});
+
+    /* The tags shouldn't be default-constructible or implicitly constructible
+       from anything else */
+    CORRADE_VERIFY(!std::is_default_constructible<Cpu::ScalarT>::value);
+    CORRADE_VERIFY(!std::is_default_constructible<Cpu::Avx2T>::value);
+    CORRADE_VERIFY(!(std::is_convertible<Cpu::ScalarT, Cpu::Sse2T>::value));
+}
+
+void CpuTest::defaultBase() {
+    #if defined(CORRADE_TARGET_AVX2)
+    CORRADE_VERIFY((std::is_base_of<Cpu::Avx2T, Cpu::DefaultBaseT>::value));
+    #elif defined(CORRADE_TARGET_SSE2)
+    CORRADE_VERIFY((std::is_base_of<Cpu::Sse2T, Cpu::DefaultBaseT>::value));
+    CORRADE_VERIFY((!std::is_base_of<Cpu::Avx2T, Cpu::DefaultBaseT>::value));
+    #elif defined(CORRADE_TARGET_NEON)
+    CORRADE_VERIFY((std::is_same<Cpu::NeonT, Cpu::DefaultBaseT>::value));
+    #else
+    CORRADE_VERIFY((std::is_same<Cpu::ScalarT, Cpu::DefaultBaseT>::value));
+    #endif
+
+    Debug{} << "Default base tag:" << tagName(Cpu::DefaultBase);
+}
+
+void CpuTest::features() {
+    const Cpu::Features runtime = Cpu::runtimeFeatures();
+    Debug{} << "Compiled:" << Cpu::compiledFeatures;
+    Debug{} << "Runtime:" << runtime;
+
+    /* Everything the code was compiled for has to be supported by the CPU,
+       otherwise we wouldn't even get here */
+    CORRADE_COMPARE(runtime & Cpu::compiledFeatures, Cpu::compiledFeatures);
+
+    #ifdef CORRADE_TARGET_X86
+    /* Consistency of the x86 chain. Not all combinations are checked, as
+       virtual machines sometimes mask out just some features. */
+    if(runtime & Cpu::Feature::Avx2) CORRADE_VERIFY(runtime & Cpu::Feature::Avx);
+    if(runtime & Cpu::Feature::Avx) CORRADE_VERIFY(runtime & Cpu::Feature::Sse2);
+    #endif
+}
+
+/* Each "implementation" returns a function that returns its name */
+typedef const char*(*NameFunction)();
+
+NameFunction nameImplementation(Cpu::ScalarT) {
+    return []() { return "Scalar"; };
+}
+NameFunction nameImplementation(Cpu::Sse2T) {
+    return []() { return "Sse2"; };
+}
+NameFunction nameImplementation(Cpu::Ssse3T) {
+    return []() { return "Ssse3"; };
+}
+NameFunction nameImplementation(Cpu::Avx2T) {
+    return []() { return "Avx2"; };
+}
+#ifdef CORRADE_TARGET_ARM
+NameFunction nameImplementation(Cpu::NeonT) {
+    return []() { return "Neon"; };
+}
+#endif
+
+CORRADE_CPU_DISPATCHER(nameDispatcher, nameImplementation)
+
+void CpuTest::dispatcher() {
+    CORRADE_COMPARE(nameDispatcher({})(), std::string{"Scalar"});
+
+    #ifdef CORRADE_TARGET_X86
+    CORRADE_COMPARE(nameDispatcher(Cpu::Feature::Sse2)(), std::string{"Sse2"});
+    CORRADE_COMPARE(nameDispatcher(Cpu::Feature::Sse2|Cpu::Feature::Sse3|Cpu::Feature::Ssse3)(), std::string{"Ssse3"});
+    CORRADE_COMPARE(nameDispatcher(Cpu::Feature::Sse2|Cpu::Feature::Sse3|Cpu::Feature::Ssse3|Cpu::Feature::Sse41|Cpu::Feature::Sse42|Cpu::Feature::Avx|Cpu::Feature::Avx2)(), std::string{"Avx2"});
+    CORRADE_COMPARE(nameDispatcher(Cpu::Feature::Sse2|Cpu::Feature::Sse3|Cpu::Feature::Ssse3|Cpu::Feature::Sse41|Cpu::Feature::Sse42|Cpu::Feature::Avx|Cpu::Feature::Avx2|Cpu::Feature::Avx512f)(), std::string{"Avx2"});
+
+    /* If some instruction set in the chain is missing, the more advanced
+       ones aren't used either */
+    CORRADE_COMPARE(nameDispatcher(Cpu::Feature::Sse2|Cpu::Feature::Ssse3)(), std::string{"Sse2"});
+    CORRADE_COMPARE(nameDispatcher(Cpu::Feature::Sse2|Cpu::Feature::Avx2)(), std::string{"Sse2"});
+    CORRADE_COMPARE(nameDispatcher(Cpu::Feature::Avx2)(), std::string{"Scalar"});
+    #elif defined(CORRADE_TARGET_ARM)
+    CORRADE_COMPARE(nameDispatcher(Cpu::Feature::Neon)(), std::string{"Neon"});
+    #endif
+}
+
+CORRADE_CPU_DISPATCHED_POINTER(nameDispatcher, NameFunction namePointer)
+
+void CpuTest::dispatchedPointer() {
+    CORRADE_COMPARE(namePointer(), std::string{nameDispatcher(Cpu::runtimeFeatures())()});
+    Debug{} << "Dispatched to" << namePointer();
+}
+
+#ifdef CORRADE_CPU_USE_IFUNC
+CORRADE_CPU_DISPATCHED_IFUNC(nameDispatcher, const char* nameIfunc())
+#endif
+
+void CpuTest::dispatchedIfunc() {
+    #ifndef CORRADE_CPU_USE_IFUNC
+    CORRADE_SKIP("CORRADE_CPU_USE_IFUNC not enabled");
+    #else
+    CORRADE_COMPARE(nameIfunc(), std::string{nameDispatcher(Cpu::runtimeFeatures())()});
+    #endif
+}
+
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_ENABLE_AVX2 int sumAvx2(const int* data) {
+    const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    const __m256i b = _mm256_add_epi32(a, _mm256_permute4x64_epi64(a, 0x4e));
+    int out[8];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), b);
+    return out[0] + out[1] + out[2] + out[3];
+}
+#endif
+
+void CpuTest::enableMacros() {
+    #ifndef CORRADE_ENABLE_AVX2
+    CORRADE_SKIP("CORRADE_ENABLE_AVX2 not available on this compiler or platform");
+    #else
+    if(!(Cpu::runtimeFeatures() & Cpu::Feature::Avx2))
+        CORRADE_SKIP("AVX2 not supported by this CPU");
+
+    /* The function compiles even if AVX2 isn't enabled for the whole file */
+    const int data[]{1, 2, 3, 4, 5, 6, 7, 8};
+    CORRADE_COMPARE(sumAvx2(data), 36);
+    #endif
+}
+
+void CpuTest::debugFeature() {
+    std::ostringstream out;
+    Debug{&out} << Cpu::Feature::Avx2 << Cpu::Feature(0xdead);
+    CORRADE_COMPARE(out.str(), "Utility::Cpu::Feature::Avx2 Utility::Cpu::Feature(0xdead)\n");
+}
+
+void CpuTest::debugFeatures() {
+    std::ostringstream out;
+    Debug{&out} << (Cpu::Feature::Sse2|Cpu::Feature::Sha) << Cpu::Features{};
+    CORRADE_COMPARE(out.str(), "Utility::Cpu::Feature::Sse2|Utility::Cpu::Feature::Sha Utility::Cpu::Features{}\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::CpuTest)
@@ -24,9 +24,12 @@
 */
 
 #include <cstdint>
+#include <sstream>
 
+#include "Corrade/Containers/Array.h"
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/Utility/DebugStl.h"
 #include "Corrade/Utility/Endianness.h"
 #include "Corrade/Utility/EndiannessBatch.h"
 
@@ -41,9 +44,41 @@ struct EndiannessTest: TestSuite::Tester {
     void inPlaceUnaligned();
     void inPlaceList();
     void inPlaceListUnaligned();
+    template<class T> void inPlaceListLarge();
+    template<class T> void inPlaceListLargeUnaligned();
+    void inPlaceListStrided();
     void enumClass();
+
+    void into();
+    template<class T> void intoLarge();
+    void intoStrided();
+    void intoMutableSource();
+    void intoInvalid();
+
+    void inPlaceBenchmarkLoop();
+    template<class T> void inPlaceBenchmark();
+    void intoBenchmarkLoop();
+    template<class T> void intoBenchmark();
+};
+
+template<class> struct TypeName;
+template<> struct TypeName<std::uint16_t> {
+    static const char* name() { return "std::uint16_t"; }
+};
+template<> struct TypeName<std::uint32_t> {
+    static const char* name() { return "std::uint32_t"; }
+};
+template<> struct TypeName<std::uint64_t> {
+    static const char* name() { return "std::uint64_t"; }
 };
 
+/* Large enough to go through the AVX2 and SSE blocks and the scalar
+   remainder for all sizes */
+constexpr std::size_t LargeSize = 67;
+
+/* 16 MB worth of data, similar to what a binary file loader would convert */
+constexpr std::size_t BenchmarkSize = 16*1024*1024;
+
 EndiannessTest::EndiannessTest() {
     addTests({&EndiannessTest::endianness,
               &EndiannessTest::floats,
@@ -51,7 +86,31 @@ EndiannessTest::EndiannessTest() {
               &EndiannessTest::inPlaceUnaligned,
               &EndiannessTest::inPlaceList,
               &EndiannessTest::inPlaceListUnaligned,
-              &EndiannessTest::enumClass});
+              &EndiannessTest::inPlaceListLarge<std::uint16_t>,
+              &EndiannessTest::inPlaceListLarge<std::uint32_t>,
+              &EndiannessTest::inPlaceListLarge<std::uint64_t>,
+              &EndiannessTest::inPlaceListLargeUnaligned<std::uint16_t>,
+              &EndiannessTest::inPlaceListLargeUnaligned<std::uint32_t>,
+              &EndiannessTest::inPlaceListLargeUnaligned<std::uint64_t>,
+              &EndiannessTest::inPlaceListStrided,
+              &EndiannessTest::enumClass,
+
+              &EndiannessTest::into,
+              &EndiannessTest::intoLarge<std::uint16_t>,
+              &EndiannessTest::intoLarge<std::uint32_t>,
+              &EndiannessTest::intoLarge<std::uint64_t>,
+              &EndiannessTest::intoStrided,
+              &EndiannessTest::intoMutableSource,
+              &EndiannessTest::intoInvalid});
+
+    addBenchmarks({&EndiannessTest::inPlaceBenchmarkLoop,
+                   &EndiannessTest::inPlaceBenchmark<std::uint16_t>,
+                   &EndiannessTest::inPlaceBenchmark<std::uint32_t>,
+                   &EndiannessTest::inPlaceBenchmark<std::uint64_t>,
+                   &EndiannessTest::intoBenchmarkLoop,
+                   &EndiannessTest::intoBenchmark<std::uint16_t>,
+                   &EndiannessTest::intoBenchmark<std::uint32_t>,
+                   &EndiannessTest::intoBenchmark<std::uint64_t>}, 10);
 }
 
 void EndiannessTest::endianness() {
@@ -243,6 +302,60 @@ void EndiannessTest::inPlaceListUnaligned() {
     CORRADE_COMPARE(data[8], '\x66');
 }
 
+template<class T> void EndiannessTest::inPlaceListLarge() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Bytes going 0x01, 0x02, 0x03, ... in memory */
+    T data[LargeSize];
+    T expected[LargeSize];
+    for(std::size_t i = 0; i != sizeof(data); ++i)
+        reinterpret_cast<std::uint8_t*>(data)[i] = i + 1;
+    for(std::size_t i = 0; i != LargeSize; ++i)
+        expected[i] = Endianness::swap(data[i]);
+
+    Endianness::swapInPlace(Containers::arrayView(data));
+    CORRADE_COMPARE_AS(Containers::arrayView(data),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void EndiannessTest::inPlaceListLargeUnaligned() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Same as above, but starting at an odd address */
+    CORRADE_ALIGNAS(8) char data[LargeSize*sizeof(T) + 1];
+    for(std::size_t i = 0; i != sizeof(data); ++i)
+        data[i] = i + 1;
+
+    Endianness::swapInPlace(Containers::arrayCast<T>(Containers::arrayView(data).suffix(1)));
+    CORRADE_COMPARE(data[0], '\x01');
+    for(std::size_t i = 0; i != LargeSize; ++i) {
+        CORRADE_ITERATION(i);
+        for(std::size_t j = 0; j != sizeof(T); ++j)
+            CORRADE_COMPARE(std::uint8_t(data[1 + i*sizeof(T) + j]), std::uint8_t(1 + (i + 1)*sizeof(T) - j));
+    }
+}
+
+void EndiannessTest::inPlaceListStrided() {
+    struct Data {
+        std::uint32_t a;
+        std::uint16_t b;
+    } data[]{
+        {0x11223344, 0x5566},
+        {0x778899aa, 0xbbcc},
+        {0xddeeff00, 0x1122}
+    };
+
+    Endianness::swapInPlace(Containers::stridedArrayView(data).slice(&Data::a));
+    Endianness::swapInPlace(Containers::stridedArrayView(data).slice(&Data::b).flipped<0>());
+    CORRADE_COMPARE(data[0].a, 0x44332211);
+    CORRADE_COMPARE(data[0].b, 0x6655);
+    CORRADE_COMPARE(data[1].a, 0xaa998877);
+    CORRADE_COMPARE(data[1].b, 0xccbb);
+    CORRADE_COMPARE(data[2].a, 0x00ffeedd);
+    CORRADE_COMPARE(data[2].b, 0x2211);
+}
+
 void EndiannessTest::enumClass() {
     #ifdef CORRADE_TARGET_BIG_ENDIAN
     #define other littleEndian
@@ -270,6 +383,231 @@ void EndiannessTest::enumClass() {
     #undef otherInPlace
 }
 
+void EndiannessTest::into() {
+    #ifdef CORRADE_TARGET_BIG_ENDIAN
+    #define currentInto bigEndianInto
+    #define otherInto littleEndianInto
+    #else
+    #define currentInto littleEndianInto
+    #define otherInto bigEndianInto
+    #endif
+
+    const std::int8_t a[]{0x11, 0x22};
+    const std::uint16_t b[]{0x1122, 0x3344};
+    const std::int32_t c[]{0x11223344, 0x55667700};
+    const std::uint64_t d[]{0x1122334455667700ull, 0x00aabbccddeeff11ull};
+    std::int8_t aOut[2];
+    std::uint16_t bOut[2];
+    std::int32_t cOut[2];
+    std::uint64_t dOut[2];
+
+    Endianness::currentInto(Containers::arrayView(a), Containers::arrayView(aOut));
+    Endianness::currentInto(Containers::arrayView(b), Containers::arrayView(bOut));
+    Endianness::currentInto(Containers::arrayView(c), Containers::arrayView(cOut));
+    Endianness::currentInto(Containers::arrayView(d), Containers::arrayView(dOut));
+    CORRADE_COMPARE_AS(Containers::arrayView(aOut),
+        Containers::arrayView(a),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(bOut),
+        Containers::arrayView(b),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(cOut),
+        Containers::arrayView(c),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(dOut),
+        Containers::arrayView(d),
+        TestSuite::Compare::Container);
+
+    Endianness::swapInto(Containers::arrayView(a), Containers::arrayView(aOut));
+    Endianness::swapInto(Containers::arrayView(b), Containers::arrayView(bOut));
+    Endianness::swapInto(Containers::arrayView(c), Containers::arrayView(cOut));
+    Endianness::swapInto(Containers::arrayView(d), Containers::arrayView(dOut));
+    CORRADE_COMPARE_AS(Containers::arrayView(aOut),
+        Containers::arrayView<std::int8_t>({
+            0x11, 0x22
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(bOut),
+        Containers::arrayView<std::uint16_t>({
+            0x2211, 0x4433
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(cOut),
+        Containers::arrayView<std::int32_t>({
+            0x44332211, 0x00776655
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(dOut),
+        Containers::arrayView<std::uint64_t>({
+            0x0077665544332211ull, 0x11ffeeddccbbaa00ull
+        }), TestSuite::Compare::Container);
+
+    /* Clear the outputs to verify they get written again */
+    for(std::int8_t& i: aOut) i = 0;
+    for(std::uint16_t& i: bOut) i = 0;
+    for(std::int32_t& i: cOut) i = 0;
+    for(std::uint64_t& i: dOut) i = 0;
+
+    Endianness::otherInto(Containers::arrayView(a), Containers::arrayView(aOut));
+    Endianness::otherInto(Containers::arrayView(b), Containers::arrayView(bOut));
+    Endianness::otherInto(Containers::arrayView(c), Containers::arrayView(cOut));
+    Endianness::otherInto(Containers::arrayView(d), Containers::arrayView(dOut));
+    CORRADE_COMPARE_AS(Containers::arrayView(aOut),
+        Containers::arrayView<std::int8_t>({
+            0x11, 0x22
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(bOut),
+        Containers::arrayView<std::uint16_t>({
+            0x2211, 0x4433
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(cOut),
+        Containers::arrayView<std::int32_t>({
+            0x44332211, 0x00776655
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(dOut),
+        Containers::arrayView<std::uint64_t>({
+            0x0077665544332211ull, 0x11ffeeddccbbaa00ull
+        }), TestSuite::Compare::Container);
+
+    #undef currentInto
+    #undef otherInto
+}
+
+template<class T> void EndiannessTest::intoLarge() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Bytes going 0x01, 0x02, 0x03, ... in memory, the destination starting
+       at an odd address to verify unaligned access works */
+    T src[LargeSize];
+    T expected[LargeSize];
+    for(std::size_t i = 0; i != sizeof(src); ++i)
+        reinterpret_cast<std::uint8_t*>(src)[i] = i + 1;
+    for(std::size_t i = 0; i != LargeSize; ++i)
+        expected[i] = Endianness::swap(src[i]);
+    CORRADE_ALIGNAS(8) char dst[LargeSize*sizeof(T) + 1];
+
+    Endianness::swapInto(Containers::arrayView(src), Containers::arrayCast<T>(Containers::arrayView(dst).suffix(1)));
+    CORRADE_COMPARE_AS(Containers::arrayView(dst).suffix(1),
+        Containers::arrayCast<const char>(Containers::arrayView(expected)),
+        TestSuite::Compare::Container);
+}
+
+void EndiannessTest::intoStrided() {
+    struct Data {
+        std::uint32_t a;
+        std::uint16_t b;
+    } src[]{
+        {0x11223344, 0x5566},
+        {0x778899aa, 0xbbcc},
+        {0xddeeff00, 0x1122}
+    };
+    std::uint32_t a[3];
+    std::uint16_t b[3];
+
+    Endianness::swapInto(Containers::stridedArrayView(src).slice(&Data::a), Containers::stridedArrayView(a));
+    Endianness::swapInto(Containers::stridedArrayView(src).slice(&Data::b), Containers::stridedArrayView(b).flipped<0>());
+    CORRADE_COMPARE_AS(Containers::arrayView(a),
+        Containers::arrayView<std::uint32_t>({
+            0x44332211, 0xaa998877, 0x00ffeedd
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(b),
+        Containers::arrayView<std::uint16_t>({
+            0x2211, 0xccbb, 0x6655
+        }), TestSuite::Compare::Container);
+}
+
+void EndiannessTest::intoMutableSource() {
+    /* The source type is in a non-deduced context, so it should accept a
+       mutable view as well */
+    std::uint32_t src[]{0x11223344, 0x55667788};
+    std::uint32_t dst[2];
+
+    Endianness::swapInto(Containers::arrayView(src), Containers::arrayView(dst));
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView<std::uint32_t>({
+            0x44332211, 0x88776655
+        }), TestSuite::Compare::Container);
+
+    Endianness::swapInto(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView<std::uint32_t>({
+            0x44332211, 0x88776655
+        }), TestSuite::Compare::Container);
+}
+
+void EndiannessTest::intoInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    const std::uint8_t a[3]{};
+    const std::uint32_t b[3]{};
+    std::uint8_t aOut[2];
+    std::uint32_t bOut[4];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Endianness::swapInto(Containers::arrayView(a), Containers::arrayView(aOut));
+    Endianness::swapInto(Containers::arrayView(b), Containers::arrayView(bOut));
+    Endianness::littleEndianInto(Containers::arrayView(b), Containers::arrayView(bOut));
+    Endianness::bigEndianInto(Containers::arrayView(b), Containers::arrayView(bOut));
+    #ifndef CORRADE_TARGET_BIG_ENDIAN
+    CORRADE_COMPARE(out.str(),
+        "Utility::Endianness::swapInto(): sizes 3 and 2 don't match\n"
+        "Utility::Endianness::swapInto(): sizes 3 and 4 don't match\n"
+        "Utility::Endianness::littleEndianInto(): sizes 3 and 4 don't match\n"
+        "Utility::Endianness::swapInto(): sizes 3 and 4 don't match\n");
+    #else
+    CORRADE_COMPARE(out.str(),
+        "Utility::Endianness::swapInto(): sizes 3 and 2 don't match\n"
+        "Utility::Endianness::swapInto(): sizes 3 and 4 don't match\n"
+        "Utility::Endianness::swapInto(): sizes 3 and 4 don't match\n"
+        "Utility::Endianness::bigEndianInto(): sizes 3 and 4 don't match\n");
+    #endif
+}
+
+void EndiannessTest::inPlaceBenchmarkLoop() {
+    Containers::Array<std::uint32_t> data{Containers::ValueInit, BenchmarkSize/4};
+
+    /* Same as what swapInPlace() did before it got SIMD kernels */
+    CORRADE_BENCHMARK(1)
+        for(std::uint32_t& i: Containers::stridedArrayView(data))
+            i = Endianness::swap(i);
+
+    CORRADE_COMPARE(data[0], 0);
+}
+
+template<class T> void EndiannessTest::inPlaceBenchmark() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Containers::Array<T> data{Containers::ValueInit, BenchmarkSize/sizeof(T)};
+
+    CORRADE_BENCHMARK(1)
+        Endianness::swapInPlace(Containers::arrayView(data));
+
+    CORRADE_COMPARE(data[0], 0);
+}
+
+void EndiannessTest::intoBenchmarkLoop() {
+    Containers::Array<std::uint32_t> src{Containers::ValueInit, BenchmarkSize/4};
+    Containers::Array<std::uint32_t> dst{Containers::NoInit, BenchmarkSize/4};
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != src.size(); ++i)
+            dst[i] = Endianness::swap(src[i]);
+
+    CORRADE_COMPARE(dst[0], 0);
+}
+
+template<class T> void EndiannessTest::intoBenchmark() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Containers::Array<T> src{Containers::ValueInit, BenchmarkSize/sizeof(T)};
+    Containers::Array<T> dst{Containers::NoInit, BenchmarkSize/sizeof(T)};
+
+    CORRADE_BENCHMARK(1)
+        Endianness::swapInto(Containers::arrayView(src), Containers::arrayView(dst));
+
+    CORRADE_COMPARE(dst[0], 0);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::Utility::Test::EndiannessTest)
@@ -23,10 +23,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <string>
 
+#include "Corrade/Containers/Array.h"
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/Utility/AbstractHash.h"
+#include "Corrade/Utility/DebugStl.h"
 #include "Corrade/Utility/MurmurHash2.h"
 
 namespace Corrade { namespace Utility { namespace Test { namespace {
@@ -37,12 +40,22 @@ struct MurmurHash2Test: TestSuite::Tester {
     void test32();
     void test64();
     void constructor();
+
+    void incremental();
+    void incrementalEmpty();
+    void incrementalReuse();
+    void incrementalInvalid();
 };
 
 MurmurHash2Test::MurmurHash2Test() {
     addTests({&MurmurHash2Test::test32,
               &MurmurHash2Test::test64,
-              &MurmurHash2Test::constructor});
+              &MurmurHash2Test::constructor,
+
+              &MurmurHash2Test::incremental,
+              &MurmurHash2Test::incrementalEmpty,
+              &MurmurHash2Test::incrementalReuse,
+              &MurmurHash2Test::incrementalInvalid});
 }
 
 void MurmurHash2Test::test32() {
@@ -59,6 +72,71 @@ void MurmurHash2Test::constructor() {
     /* All should give the same value */
     CORRADE_COMPARE(MurmurHash2()("hello"), MurmurHash2()("hello", 5));
     CORRADE_COMPARE(MurmurHash2()(std::string("hello")), MurmurHash2()("hello", 5));
+    CORRADE_COMPARE(MurmurHash2{}.seed(), 0);
+    CORRADE_COMPARE(MurmurHash2{23}.seed(), 23);
+}
+
+void MurmurHash2Test::incremental() {
+    Containers::Array<char> inputData{Containers::NoInit, 1000};
+    for(std::size_t i = 0; i != inputData.size(); ++i)
+        inputData[i] = char(i*7 + i/256);
+    const Containers::ArrayView<const char> input = inputData;
+
+    /* Various total sizes to hit all remainders, added in various chunk
+       sizes to hit all cases of buffering */
+    for(const std::size_t size: {1, 3, 4, 7, 8, 9, 15, 16, 17, 1000}) {
+        for(const std::size_t chunkSize: {1, 2, 3, 5, 8, 13, 64}) {
+            CORRADE_ITERATION(size << chunkSize);
+
+            MurmurHash2 hash{23};
+            hash.setDataSize(size);
+            CORRADE_COMPARE(hash.dataSize(), size);
+            for(std::size_t i = 0; i < size; i += chunkSize)
+                hash << input.slice(i, std::min(i + chunkSize, size));
+            CORRADE_COMPARE(hash.digest(), MurmurHash2{23}(input, size));
+        }
+    }
+}
+
+void MurmurHash2Test::incrementalEmpty() {
+    MurmurHash2 hash{23};
+    CORRADE_COMPARE(hash.dataSize(), 0);
+    CORRADE_COMPARE(hash.digest(), MurmurHash2{23}(""));
+
+    /* Adding empty views is fine too */
+    hash << Containers::ArrayView<const char>{} << std::string{};
+    CORRADE_COMPARE(hash.digest(), MurmurHash2{23}(""));
+}
+
+void MurmurHash2Test::incrementalReuse() {
+    /* The hash is reset after the digest is taken, keeping the seed */
+    MurmurHash2 hash{23};
+    hash.setDataSize(11) << std::string{"hello"} << std::string{" world"};
+    CORRADE_COMPARE(hash.digest(), MurmurHash2{23}("hello world"));
+    CORRADE_COMPARE(hash.dataSize(), 0);
+    CORRADE_COMPARE(hash.seed(), 23);
+
+    hash.setDataSize(4) << std::string{"four"};
+    CORRADE_COMPARE(hash.digest(), MurmurHash2{23}("four"));
+}
+
+void MurmurHash2Test::incrementalInvalid() {
+    #ifdef CORRADE_NO_ASSERT
+    CORRADE_SKIP("CORRADE_NO_ASSERT defined, can't test assertions");
+    #endif
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MurmurHash2 hash;
+    hash.setDataSize(5) << std::string{"hell"};
+    hash.setDataSize(3);
+    hash << std::string{"o!"};
+    hash.digest();
+    CORRADE_COMPARE(out.str(),
+        "Utility::MurmurHash2::setDataSize(): can't be called after data were added\n"
+        "Utility::MurmurHash2::operator<<(): adding 2 bytes to 4 would exceed the data size of 5 bytes\n"
+        "Utility::MurmurHash2::digest(): expected 5 bytes but got 4\n");
 }
 
 }}}}
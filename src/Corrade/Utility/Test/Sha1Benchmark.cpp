@@ -0,0 +1,171 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Arguments.h"
+#include "Corrade/Utility/Sha1.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct Sha1Benchmark: TestSuite::Tester {
+    explicit Sha1Benchmark();
+
+    void throughputBegin();
+    std::uint64_t throughputEnd();
+
+    void throughput();
+    void throughputManySmall();
+    void throughputManySmallBatch();
+
+    private:
+        Containers::Array<char> _data;
+        std::chrono::steady_clock::time_point _begin;
+        std::size_t _processed, _repeats;
+};
+
+/* The digests are of data generated in the constructor. Sorted by size, the
+   instances above 1 MB take too long for a regular test run, pass
+   `--sha1-max-size 1073741824` to run them as well. */
+const struct {
+    const char* name;
+    std::size_t size;
+    std::size_t repeats;
+    const char* digest;
+} ThroughputData[]{
+    {"64 B", 64, 65536, "1e17ae1fc093e5daca033553c97a5192ca164486"},
+    {"4 kB", 4096, 1024, "e3f92a7f0d923c8e43352f9cea7da0c26fb7829b"},
+    {"1 MB", 1024*1024, 4, "a7ccc30ac12dc8d83d6f612100bc4fc6ed0c5a12"},
+    {"64 MB", 64*1024*1024, 1, "3e1af1ae6221532d109b3d1fff1ca27592b6cf39"},
+    /* Streamed in 64 MB pieces to not need a gigabyte of memory */
+    {"1 GB", 1024*1024*1024, 1, "0c2ab5f5fe7860f4fd95eea73a6f61e446cc4299"},
+};
+
+const struct {
+    const char* name;
+    std::size_t size;
+} ManySmallData[]{
+    {"4k inputs, 64 B each", 64},
+    {"4k inputs, 1 kB each", 1024},
+};
+
+Sha1Benchmark::Sha1Benchmark(): TestSuite::Tester{TesterConfiguration{}.setSkippedArgumentPrefixes({"sha1"})} {
+    Utility::Arguments args{"sha1"};
+    args.addOption("max-size", "1048576").setHelp("max-size", "max size of data to benchmark with", "N")
+        .parse(arguments().first, arguments().second);
+    const std::size_t maxSize = args.value<std::size_t>("max-size");
+
+    std::size_t throughputInstanceCount = 0;
+    while(throughputInstanceCount != Containers::arraySize(ThroughputData) && ThroughputData[throughputInstanceCount].size <= maxSize)
+        ++throughputInstanceCount;
+
+    addCustomInstancedBenchmarks({&Sha1Benchmark::throughput}, 3,
+        throughputInstanceCount,
+        &Sha1Benchmark::throughputBegin,
+        &Sha1Benchmark::throughputEnd, BenchmarkUnits::Bytes);
+
+    addCustomInstancedBenchmarks({&Sha1Benchmark::throughputManySmall,
+                                  &Sha1Benchmark::throughputManySmallBatch}, 3,
+        Containers::arraySize(ManySmallData),
+        &Sha1Benchmark::throughputBegin,
+        &Sha1Benchmark::throughputEnd, BenchmarkUnits::Bytes);
+
+    _data = Containers::Array<char>{Containers::NoInit, 64*1024*1024};
+    for(std::size_t i = 0; i != _data.size(); ++i)
+        _data[i] = char(i*7 + i/256);
+}
+
+void Sha1Benchmark::throughputBegin() {
+    setBenchmarkName("bytes per second");
+    _processed = 0;
+    _begin = std::chrono::steady_clock::now();
+}
+
+std::uint64_t Sha1Benchmark::throughputEnd() {
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - _begin).count();
+    /* The result gets divided by the batch size, multiply to compensate */
+    return std::uint64_t(_processed/seconds*_repeats);
+}
+
+void Sha1Benchmark::throughput() {
+    auto&& data = ThroughputData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::ArrayView<const char> view = _data.prefix(std::min(data.size, _data.size()));
+
+    _repeats = data.repeats;
+    Sha1::Digest digest;
+    CORRADE_BENCHMARK(data.repeats) {
+        Sha1 hasher;
+        for(std::size_t i = 0; i < data.size; i += view.size())
+            hasher << view;
+        digest = hasher.digest();
+        _processed += data.size;
+    }
+
+    CORRADE_COMPARE(digest, Sha1::Digest::fromHexString(data.digest));
+}
+
+void Sha1Benchmark::throughputManySmall() {
+    auto&& data = ManySmallData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::ArrayView<const char> view = _data;
+    Containers::Array<Sha1::Digest> digests{4096};
+
+    _repeats = 10;
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != digests.size(); ++i)
+            digests[i] = (Sha1{} << view.slice(i*data.size, (i + 1)*data.size)).digest();
+        _processed += digests.size()*data.size;
+    }
+
+    CORRADE_COMPARE(digests[1], (Sha1{} << view.slice(data.size, data.size*2)).digest());
+}
+
+void Sha1Benchmark::throughputManySmallBatch() {
+    auto&& data = ManySmallData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Containers::ArrayView<const char>> inputs{4096};
+    for(std::size_t i = 0; i != inputs.size(); ++i)
+        inputs[i] = _data.slice(i*data.size, (i + 1)*data.size);
+
+    Containers::Array<Sha1::Digest> digests;
+
+    _repeats = 10;
+    CORRADE_BENCHMARK(10) {
+        digests = Sha1::digestBatch(inputs);
+        _processed += inputs.size()*data.size;
+    }
+
+    CORRADE_COMPARE(digests[1], (Sha1{} << inputs[1]).digest());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::Sha1Benchmark)
@@ -32,6 +32,7 @@
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/Utility/AbstractHash.h"
 #include "Corrade/Utility/Sha1.h"
+#include "Corrade/Utility/Implementation/sha1.h"
 
 namespace Corrade { namespace Utility { namespace Test { namespace {
 
@@ -46,6 +47,37 @@ struct Sha1Test: TestSuite::Tester {
 
     void iterative();
     void reuse();
+    void large();
+
+    void batch();
+    void batchImplementation();
+    void batchEmpty();
+};
+
+/* Each variant is tested directly as the dispatcher picks just one */
+const struct {
+    const char* name;
+    Cpu::Features features;
+    Implementation::Sha1DigestBatchFunction(*implementation)();
+} BatchImplementationData[]{
+    {"scalar", {}, [] {
+        return Implementation::sha1DigestBatchImplementation(Cpu::Scalar);
+    }},
+    #ifdef CORRADE_ENABLE_SSE2
+    {"SSE2", Cpu::Feature::Sse2, [] {
+        return Implementation::sha1DigestBatchImplementation(Cpu::Sse2);
+    }},
+    #endif
+    #ifdef CORRADE_ENABLE_AVX2
+    {"AVX2", Cpu::Feature::Avx2, [] {
+        return Implementation::sha1DigestBatchImplementation(Cpu::Avx2);
+    }},
+    #endif
+    #ifdef CORRADE_ENABLE_AVX512F
+    {"AVX-512", Cpu::Feature::Avx512f, [] {
+        return Implementation::sha1DigestBatchImplementation(Cpu::Avx512f);
+    }},
+    #endif
 };
 
 Sha1Test::Sha1Test() {
@@ -57,7 +89,15 @@ Sha1Test::Sha1Test() {
 
     addRepeatedTests({&Sha1Test::iterative}, 128);
 
-    addTests({&Sha1Test::reuse});
+    addTests({&Sha1Test::reuse,
+              &Sha1Test::large,
+
+              &Sha1Test::batch});
+
+    addInstancedTests({&Sha1Test::batchImplementation},
+        Containers::arraySize(BatchImplementationData));
+
+    addTests({&Sha1Test::batchEmpty});
 }
 
 void Sha1Test::emptyString() {
@@ -123,6 +163,79 @@ void Sha1Test::reuse() {
     CORRADE_COMPARE(hasher.digest(), Sha1::Digest::fromHexString("cd36b370758a259b34845084a6cc38473cb95e27"));
 }
 
+void Sha1Test::large() {
+    /* Goes through the bulk path processing many chunks at once, which may
+       be a different implementation than for the leftovers */
+    Containers::Array<char> data{Containers::NoInit, 1000003};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = char(i*7 + i/256);
+    const Containers::ArrayView<const char> view = data;
+
+    Sha1 hasher;
+    hasher << view;
+    CORRADE_COMPARE(hasher.digest(), Sha1::Digest::fromHexString("cd87c47848c3a95d6093422122dff27bf49799d3"));
+
+    /* Adding it in pieces that aren't a multiple of the chunk size gives the
+       same result */
+    for(std::size_t offset = 0; offset < view.size(); offset += 1000)
+        hasher << view.slice(offset, std::min(offset + 1000, view.size()));
+    CORRADE_COMPARE(hasher.digest(), Sha1::Digest::fromHexString("cd87c47848c3a95d6093422122dff27bf49799d3"));
+}
+
+void Sha1Test::batch() {
+    Containers::Array<char> data{Containers::NoInit, 1000003};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = char(i*7 + i/256);
+
+    /* Inputs of all sizes around the padding boundaries, at various offsets,
+       interleaved with a large one so the lanes finish at different times */
+    Containers::Array<Containers::ArrayView<const char>> inputs{Containers::ValueInit, 259};
+    for(std::size_t i = 0; i != inputs.size(); ++i)
+        inputs[i] = data.slice(i*3, i*4);
+    inputs[17] = data;
+
+    Containers::Array<Sha1::Digest> digests = Sha1::digestBatch(inputs);
+    CORRADE_COMPARE(digests.size(), inputs.size());
+    for(std::size_t i = 0; i != inputs.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(digests[i], (Sha1{} << inputs[i]).digest());
+    }
+
+    CORRADE_COMPARE(digests[0], Sha1::Digest::fromHexString("da39a3ee5e6b4b0d3255bfef95601890afd80709"));
+    CORRADE_COMPARE(digests[17], Sha1::Digest::fromHexString("cd87c47848c3a95d6093422122dff27bf49799d3"));
+}
+
+void Sha1Test::batchImplementation() {
+    auto&& data = BatchImplementationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(Cpu::runtimeFeatures() >= data.features))
+        CORRADE_SKIP("Feature not supported by this CPU");
+
+    Containers::Array<char> input{Containers::NoInit, 1000003};
+    for(std::size_t i = 0; i != input.size(); ++i)
+        input[i] = char(i*7 + i/256);
+
+    /* Same as in batch() above */
+    Containers::Array<Containers::ArrayView<const char>> inputs{Containers::ValueInit, 259};
+    for(std::size_t i = 0; i != inputs.size(); ++i)
+        inputs[i] = input.slice(i*3, i*4);
+    inputs[17] = input;
+
+    Containers::Array<Sha1::Digest> digests{inputs.size()};
+    data.implementation()(inputs, digests);
+    for(std::size_t i = 0; i != inputs.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(digests[i], (Sha1{} << inputs[i]).digest());
+    }
+
+    CORRADE_COMPARE(digests[17], Sha1::Digest::fromHexString("cd87c47848c3a95d6093422122dff27bf49799d3"));
+}
+
+void Sha1Test::batchEmpty() {
+    CORRADE_VERIFY(Sha1::digestBatch(nullptr).empty());
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::Utility::Test::Sha1Test)
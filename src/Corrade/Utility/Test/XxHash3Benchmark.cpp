@@ -0,0 +1,137 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/MurmurHash2.h"
+#include "Corrade/Utility/XxHash3.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct XxHash3Benchmark: TestSuite::Tester {
+    explicit XxHash3Benchmark();
+
+    void throughputBegin();
+    std::uint64_t throughputEnd();
+
+    void xxHash3();
+    void xxHash3Iterative();
+    void murmurHash2();
+
+    private:
+        Containers::Array<char> _data;
+        std::chrono::steady_clock::time_point _begin;
+        std::size_t _processed;
+        unsigned long long _result;
+};
+
+/* Each benchmark iteration hashes a megabyte of data split into inputs of
+   given size */
+const struct {
+    const char* name;
+    std::size_t size;
+} ThroughputData[]{
+    {"8 B", 8},
+    {"16 B", 16},
+    {"32 B", 32},
+    {"128 B", 128},
+    {"240 B", 240},
+    {"1 kB", 1024},
+    {"64 kB", 64*1024},
+    {"1 MB", 1024*1024}
+};
+
+XxHash3Benchmark::XxHash3Benchmark() {
+    addCustomInstancedBenchmarks({&XxHash3Benchmark::xxHash3,
+                                  &XxHash3Benchmark::xxHash3Iterative,
+                                  &XxHash3Benchmark::murmurHash2}, 3,
+        Containers::arraySize(ThroughputData),
+        &XxHash3Benchmark::throughputBegin,
+        &XxHash3Benchmark::throughputEnd, BenchmarkUnits::Bytes);
+
+    _data = Containers::Array<char>{Containers::NoInit, 1024*1024};
+    for(std::size_t i = 0; i != _data.size(); ++i)
+        _data[i] = char(i*7 + i/256);
+}
+
+void XxHash3Benchmark::throughputBegin() {
+    setBenchmarkName("bytes per second");
+    _processed = 0;
+    _result = 0;
+    _begin = std::chrono::steady_clock::now();
+}
+
+std::uint64_t XxHash3Benchmark::throughputEnd() {
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - _begin).count();
+    /* The result gets divided by the batch size, multiply to compensate */
+    return std::uint64_t(_processed/seconds*10);
+}
+
+void XxHash3Benchmark::xxHash3() {
+    auto&& data = ThroughputData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i + data.size <= _data.size(); i += data.size)
+            _result ^= Implementation::xxHash3(_data + i, data.size, 0);
+        _processed += _data.size();
+    }
+
+    CORRADE_VERIFY(_processed);
+}
+
+void XxHash3Benchmark::xxHash3Iterative() {
+    auto&& data = ThroughputData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::ArrayView<const char> view = _data;
+    XxHash3 hasher;
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i + data.size <= view.size(); i += data.size)
+            _result ^= (hasher << view.slice(i, i + data.size)).digest().byteArray()[0];
+        _processed += _data.size();
+    }
+
+    CORRADE_VERIFY(_processed);
+}
+
+void XxHash3Benchmark::murmurHash2() {
+    auto&& data = ThroughputData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i + data.size <= _data.size(); i += data.size)
+            _result ^= Implementation::MurmurHash2<sizeof(std::size_t)>{}(0, _data + i, data.size);
+        _processed += _data.size();
+    }
+
+    CORRADE_VERIFY(_processed);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::XxHash3Benchmark)
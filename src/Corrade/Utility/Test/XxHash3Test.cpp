@@ -0,0 +1,241 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/AbstractHash.h"
+#include "Corrade/Utility/Endianness.h"
+#include "Corrade/Utility/XxHash3.h"
+#include "Corrade/Utility/Implementation/xxHash3.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct XxHash3Test: TestSuite::Tester {
+    explicit XxHash3Test();
+
+    void emptyString();
+    void constructor();
+
+    void oneShot();
+    void oneShotSeed();
+    void iterative();
+    void iterativeSeed();
+    void implementation();
+
+    void reuse();
+};
+
+/* Reference values generated with the official xxHash implementation */
+const struct {
+    const char* name;
+    std::size_t size;
+    const char* digest;
+    const char* digestSeed;
+} Data[]{
+    {"empty", 0, "2d06800538d394c2", "e2bda2b8c0a330da"},
+    {"1 byte", 1, "c44bdff4074eecdb", "76761c489ed890a3"},
+    {"3 bytes", 3, "c3489259e968ad9e", "0e7db32aca16cdcf"},
+    {"4 bytes", 4, "d3d60c1519014e89", "c0b1cd48e852aed0"},
+    {"8 bytes", 8, "b88dee77f6bf6980", "198ebe7c127f3aea"},
+    {"9 bytes", 9, "03688dcad730d826", "43fb4b9c29b59671"},
+    {"16 bytes", 16, "9da23836adf2be1e", "fc13c9945044d91f"},
+    {"17 bytes", 17, "f34c3c9cf5a112d1", "041c7f534e453d49"},
+    {"64 bytes", 64, "6efb76ff16f37561", "e663af8242791e5f"},
+    {"65 bytes", 65, "2640848e9137156b", "4cbcfd9ddb8c8b93"},
+    {"128 bytes", 128, "65f3c2c00fa93185", "d117d67b53aa4422"},
+    {"129 bytes", 129, "28065c6ec25f5b25", "2a8f7947756dda63"},
+    {"240 bytes", 240, "4917a75c0ef8eed7", "5d4b92172daa63d0"},
+    {"241 bytes", 241, "541b19226f0052e8", "722da89a60f1b5cd"},
+    {"256 bytes", 256, "ff5a1cefade75bb9", "c4cb4c4f4386f7a6"},
+    {"257 bytes", 257, "84eb2acdd4c7b1a1", "1e87501754c76605"},
+    {"1024 bytes", 1024, "71bee625238addb4", "51def1d4ae5b36cf"},
+    {"1025 bytes", 1025, "d9b414f4e1bbf7ad", "50f91cd6bf08b797"},
+    {"1088 bytes", 1088, "b74e423e955e509d", "bcfa0c4d284ed8af"},
+    {"4096 bytes", 4096, "5c722d9ceb6f9064", "8ae55876ffe832e8"},
+    {"65539 bytes", 65539, "6ca3b7020700ac4b", "e4ec858a5f827139"}
+};
+
+constexpr unsigned long long Seed = 0xfedcba9876543210ull;
+
+/* Each variant is tested directly as the dispatcher picks just one */
+const struct {
+    const char* name;
+    Cpu::Features features;
+    Implementation::XxHash3ProcessStripesFunction(*implementation)();
+} ImplementationData[]{
+    {"scalar", {}, [] {
+        return Implementation::xxHash3ProcessStripesImplementation(Cpu::Scalar);
+    }},
+    #ifdef CORRADE_ENABLE_SSE2
+    {"SSE2", Cpu::Feature::Sse2, [] {
+        return Implementation::xxHash3ProcessStripesImplementation(Cpu::Sse2);
+    }},
+    #endif
+    #ifdef CORRADE_ENABLE_AVX2
+    {"AVX2", Cpu::Feature::Avx2, [] {
+        return Implementation::xxHash3ProcessStripesImplementation(Cpu::Avx2);
+    }},
+    #endif
+    #ifdef CORRADE_ENABLE_AVX512F
+    {"AVX-512", Cpu::Feature::Avx512f, [] {
+        return Implementation::xxHash3ProcessStripesImplementation(Cpu::Avx512f);
+    }},
+    #endif
+};
+
+/* Chunk sizes for iterative hashing, to hit all cases of buffering */
+constexpr std::size_t ChunkSizes[]{1, 13, 64, 100, 240, 255, 256, 257, 1000};
+
+XxHash3Test::XxHash3Test() {
+    addTests({&XxHash3Test::emptyString,
+              &XxHash3Test::constructor});
+
+    addInstancedTests({&XxHash3Test::oneShot,
+                       &XxHash3Test::oneShotSeed,
+                       &XxHash3Test::iterative,
+                       &XxHash3Test::iterativeSeed},
+        Containers::arraySize(Data));
+
+    addInstancedTests({&XxHash3Test::implementation},
+        Containers::arraySize(ImplementationData));
+
+    addTests({&XxHash3Test::reuse});
+}
+
+Containers::Array<char> testData(const std::size_t size) {
+    Containers::Array<char> data{Containers::NoInit, size};
+    for(std::size_t i = 0; i != size; ++i) data[i] = char(i*7 + i/256);
+    return data;
+}
+
+void XxHash3Test::emptyString() {
+    CORRADE_COMPARE(XxHash3::digest(""),
+                    XxHash3::Digest::fromHexString("2d06800538d394c2"));
+    CORRADE_COMPARE(XxHash3::digest("hello"),
+                    XxHash3::Digest::fromHexString("9555e8555c62dcfd"));
+}
+
+void XxHash3Test::constructor() {
+    /* All should give the same value */
+    CORRADE_COMPARE(XxHash3()("hello"), XxHash3()("hello", 5));
+    CORRADE_COMPARE(XxHash3()(std::string("hello")), XxHash3()("hello", 5));
+    CORRADE_COMPARE(XxHash3{}.seed(), 0ull);
+    CORRADE_COMPARE(XxHash3{Seed}.seed(), Seed);
+}
+
+void XxHash3Test::oneShot() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> input = testData(data.size);
+    CORRADE_COMPARE(XxHash3{}(input, input.size()),
+                    XxHash3::Digest::fromHexString(data.digest));
+}
+
+void XxHash3Test::oneShotSeed() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> input = testData(data.size);
+    CORRADE_COMPARE(XxHash3{Seed}(input, input.size()),
+                    XxHash3::Digest::fromHexString(data.digestSeed));
+}
+
+void XxHash3Test::iterative() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> inputData = testData(data.size);
+    const Containers::ArrayView<const char> input = inputData;
+    for(const std::size_t chunkSize: ChunkSizes) {
+        CORRADE_ITERATION(chunkSize);
+
+        XxHash3 hash;
+        for(std::size_t i = 0; i < input.size(); i += chunkSize)
+            hash << input.slice(i, std::min(i + chunkSize, input.size()));
+        CORRADE_COMPARE(hash.digest(),
+                        XxHash3::Digest::fromHexString(data.digest));
+    }
+}
+
+void XxHash3Test::iterativeSeed() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> inputData = testData(data.size);
+    const Containers::ArrayView<const char> input = inputData;
+    for(const std::size_t chunkSize: ChunkSizes) {
+        CORRADE_ITERATION(chunkSize);
+
+        XxHash3 hash{Seed};
+        for(std::size_t i = 0; i < input.size(); i += chunkSize)
+            hash << input.slice(i, std::min(i + chunkSize, input.size()));
+        CORRADE_COMPARE(hash.digest(),
+                        XxHash3::Digest::fromHexString(data.digestSeed));
+    }
+}
+
+void XxHash3Test::implementation() {
+    auto&& data = ImplementationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(Cpu::runtimeFeatures() >= data.features))
+        CORRADE_SKIP("Feature not supported by this CPU");
+
+    const Implementation::XxHash3ProcessStripesFunction processStripes = data.implementation();
+    Containers::Array<char> input = testData(Data[Containers::arraySize(Data) - 1].size);
+    for(auto&& i: Data) {
+        CORRADE_ITERATION(i.name);
+
+        /* The digest is stored big-endian */
+        const unsigned long long digest = Endianness::bigEndian(Implementation::xxHash3(input, i.size, 0, processStripes));
+        const unsigned long long digestSeed = Endianness::bigEndian(Implementation::xxHash3(input, i.size, Seed, processStripes));
+        CORRADE_COMPARE(XxHash3::Digest::fromByteArray(reinterpret_cast<const char*>(&digest)),
+                        XxHash3::Digest::fromHexString(i.digest));
+        CORRADE_COMPARE(XxHash3::Digest::fromByteArray(reinterpret_cast<const char*>(&digestSeed)),
+                        XxHash3::Digest::fromHexString(i.digestSeed));
+    }
+}
+
+void XxHash3Test::reuse() {
+    Containers::Array<char> inputData = testData(1025);
+    const Containers::ArrayView<const char> input = inputData;
+
+    /* The hash is reset after the digest is taken, keeping the seed */
+    XxHash3 hash{Seed};
+    hash << input;
+    CORRADE_COMPARE(hash.digest(),
+                    XxHash3::Digest::fromHexString("50f91cd6bf08b797"));
+    hash << input.prefix(9);
+    CORRADE_COMPARE(hash.digest(),
+                    XxHash3::Digest::fromHexString("43fb4b9c29b59671"));
+    CORRADE_COMPARE(hash.seed(), Seed);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::XxHash3Test)
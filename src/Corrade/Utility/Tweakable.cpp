@@ -27,8 +27,9 @@
 
 #include <cstring>
 #include <set>
-#include <unordered_map>
 
+#include "Corrade/Containers/HashMap.h"
+#include "Corrade/Containers/String.h"
 #include "Corrade/Containers/StringView.h"
 #include "Corrade/Containers/StringStl.h"
 #include "Corrade/Utility/Assert.h"
@@ -55,7 +56,7 @@ struct Tweakable::Data {
     explicit Data(const std::string& prefix, const std::string& replace): prefix{prefix}, replace{replace} {}
 
     std::string prefix, replace;
-    std::unordered_map<std::string, File> files;
+    Containers::HashMap<Containers::String, File> files;
 
     void(*currentScopeLambda)(void(*)(), void*) = nullptr;
     void(*currentScopeUserCall)() = nullptr;
@@ -102,12 +103,10 @@ void Tweakable::scopeInternal(void(*lambda)(void(*)(), void*), void(*userCall)()
 std::pair<bool, void*> Tweakable::registerVariable(const char* const file, const int line, const std::size_t variable, TweakableState(*parser)(Containers::StringView, Containers::StaticArrayView<Implementation::TweakableStorageSize, char>)) {
     CORRADE_INTERNAL_ASSERT(_data);
 
-    /* Find the file in the map */
-    /** @todo this allocates and copies the string. std::map::find() in C++14
-        has an overload that allows a zero-allocation lookup, but
-        std::unordered_map has that only since C++17. */
-    auto found = _data->files.find(file);
-    if(found == _data->files.end()) {
+    /* Find the file in the map. The lookup is done directly with the C
+       string, the key gets allocated only when inserting. */
+    File* found = _data->files.find(file);
+    if(!found) {
         /* Strip the directory prefix from the file. If that means the filename
            would then start with a slash, strip that too so Directory::join()
            works correctly -- but don't do that in case the directory prefix
@@ -123,15 +122,15 @@ std::pair<bool, void*> Tweakable::registerVariable(const char* const file, const
         /* Ignore errors and do not signal changes if the file is empty in
            order to make everything more robust -- editors are known to be
            doing both */
-        found = _data->files.emplace(file, File{watchPath, FileWatcher{watchPath, FileWatcher::Flag::IgnoreChangeIfEmpty|FileWatcher::Flag::IgnoreErrors}, {}}).first;
+        found = &_data->files.emplace(file, File{watchPath, FileWatcher{watchPath, FileWatcher::Flag::IgnoreChangeIfEmpty|FileWatcher::Flag::IgnoreErrors}, {}});
     }
 
     /* Extend the variable list to contain this one as well */
-    if(found->second.variables.size() <= variable)
-        found->second.variables.resize(variable + 1);
+    if(found->variables.size() <= variable)
+        found->variables.resize(variable + 1);
 
     /* Save the variable, if not already */
-    Implementation::TweakableVariable& v = found->second.variables[variable];
+    Implementation::TweakableVariable& v = found->variables[variable];
     bool initialized = true;
     if(!v.parser) {
         initialized = false;
@@ -615,24 +614,24 @@ TweakableState Tweakable::update() {
     TweakableState state = TweakableState::NoChange;
     for(auto& file: _data->files) {
         /** @todo suggest recompile if the watcher is not valid anymore */
-        if(!file.second.watcher.hasChanged()) continue;
+        if(!file.value().watcher.hasChanged()) continue;
 
         /* First go through all defines and search if there is any alias. There
            shouldn't be many. If no alias is found, assume CORRADE_TWEAKABLE. */
-        const std::string data = Directory::readString(file.second.watchPath);
+        const std::string data = Directory::readString(file.value().watchPath);
         std::string name = Implementation::findTweakableAlias(data);
 
         /* Print helpful message in case no alias was found. Don't do name ==
            "CORRADE_TWEAKABLE" to avoid a temporary allocation of std::string.
            (Ugh, why can't it have an overload for this?!) */
         if(name.compare("CORRADE_TWEAKABLE") == 0)
-            Warning{} << "Utility::Tweakable::update(): no alias found in" << file.first << Debug::nospace << ", fallback to looking for CORRADE_TWEAKABLE()";
+            Warning{} << "Utility::Tweakable::update(): no alias found in" << file.key() << Debug::nospace << ", fallback to looking for CORRADE_TWEAKABLE()";
         else
-            Debug{} << "Utility::Tweakable::update(): looking for updated" << name << Debug::nospace << "() macros in" << file.first;
+            Debug{} << "Utility::Tweakable::update(): looking for updated" << name << Debug::nospace << "() macros in" << file.key();
 
         /* Now find all annotated constants and update them. If there's a
            problem, exit immediately, otherwise just accumulate the state. */
-        const TweakableState fileState = Implementation::parseTweakables(name, file.first, data, file.second.variables, scopes);
+        const TweakableState fileState = Implementation::parseTweakables(name, file.key(), data, file.value().variables, scopes);
         if(fileState == TweakableState::NoChange)
             continue;
         else if(fileState == TweakableState::Success)
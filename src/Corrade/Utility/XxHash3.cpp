@@ -0,0 +1,518 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2019 Jonathan Hale <squareys@googlemail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "XxHash3.h"
+
+#include <cstring>
+
+#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Utility/Cpu.h"
+#include "Corrade/Utility/Endianness.h"
+#include "Corrade/Utility/Implementation/xxHash3.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(CORRADE_ENABLE_AVX2) || defined(CORRADE_ENABLE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace Corrade { namespace Utility {
+
+namespace {
+
+constexpr unsigned int Prime32_1 = 0x9e3779b1u;
+constexpr unsigned int Prime32_2 = 0x85ebca77u;
+constexpr unsigned int Prime32_3 = 0xc2b2ae3du;
+constexpr unsigned long long Prime64_1 = 0x9e3779b185ebca87ull;
+constexpr unsigned long long Prime64_2 = 0xc2b2ae3d27d4eb4full;
+constexpr unsigned long long Prime64_3 = 0x165667b19e3779f9ull;
+constexpr unsigned long long Prime64_4 = 0x85ebca77c2b2ae63ull;
+constexpr unsigned long long Prime64_5 = 0x27d4eb2f165667c5ull;
+constexpr unsigned long long PrimeMx1 = 0x165667919e3779f9ull;
+constexpr unsigned long long PrimeMx2 = 0x9fb21c651e98df25ull;
+
+/* Bytes [128, 192) are used for scrambling the accumulators, the last stripe
+   uses bytes [121, 185) and merging the accumulators bytes [11, 75) */
+alignas(64) constexpr char DefaultSecret[192]{
+    '\xb8', '\xfe', '\x6c', '\x39', '\x23', '\xa4', '\x4b', '\xbe', '\x7c', '\x01', '\x81', '\x2c', '\xf7', '\x21', '\xad', '\x1c',
+    '\xde', '\xd4', '\x6d', '\xe9', '\x83', '\x90', '\x97', '\xdb', '\x72', '\x40', '\xa4', '\xa4', '\xb7', '\xb3', '\x67', '\x1f',
+    '\xcb', '\x79', '\xe6', '\x4e', '\xcc', '\xc0', '\xe5', '\x78', '\x82', '\x5a', '\xd0', '\x7d', '\xcc', '\xff', '\x72', '\x21',
+    '\xb8', '\x08', '\x46', '\x74', '\xf7', '\x43', '\x24', '\x8e', '\xe0', '\x35', '\x90', '\xe6', '\x81', '\x3a', '\x26', '\x4c',
+    '\x3c', '\x28', '\x52', '\xbb', '\x91', '\xc3', '\x00', '\xcb', '\x88', '\xd0', '\x65', '\x8b', '\x1b', '\x53', '\x2e', '\xa3',
+    '\x71', '\x64', '\x48', '\x97', '\xa2', '\x0d', '\xf9', '\x4e', '\x38', '\x19', '\xef', '\x46', '\xa9', '\xde', '\xac', '\xd8',
+    '\xa8', '\xfa', '\x76', '\x3f', '\xe3', '\x9c', '\x34', '\x3f', '\xf9', '\xdc', '\xbb', '\xc7', '\xc7', '\x0b', '\x4f', '\x1d',
+    '\x8a', '\x51', '\xe0', '\x4b', '\xcd', '\xb4', '\x59', '\x31', '\xc8', '\x9f', '\x7e', '\xc9', '\xd9', '\x78', '\x73', '\x64',
+    '\xea', '\xc5', '\xac', '\x83', '\x34', '\xd3', '\xeb', '\xc3', '\xc5', '\x81', '\xa0', '\xff', '\xfa', '\x13', '\x63', '\xeb',
+    '\x17', '\x0d', '\xdd', '\x51', '\xb7', '\xf0', '\xda', '\x49', '\xd3', '\x16', '\x55', '\x26', '\x29', '\xd4', '\x68', '\x9e',
+    '\x2b', '\x16', '\xbe', '\x58', '\x7d', '\x47', '\xa1', '\xfc', '\x8f', '\xf8', '\xb8', '\xd1', '\x7a', '\xd0', '\x31', '\xce',
+    '\x45', '\xcb', '\x3a', '\x8f', '\x95', '\x16', '\x04', '\x28', '\xaf', '\xd7', '\xfb', '\xca', '\xbb', '\x4b', '\x40', '\x7e'
+};
+
+constexpr unsigned long long InitialAccumulators[8]{
+    Prime32_3, Prime64_1, Prime64_2, Prime64_3,
+    Prime64_4, Prime32_2, Prime64_5, Prime32_1
+};
+
+/* Going through memcpy() to not need any alignment */
+inline unsigned int read32(const char* const data) {
+    unsigned int value;
+    std::memcpy(&value, data, 4);
+    return Endianness::littleEndian(value);
+}
+
+inline unsigned long long read64(const char* const data) {
+    unsigned long long value;
+    std::memcpy(&value, data, 8);
+    return Endianness::littleEndian(value);
+}
+
+inline void write64(char* const data, unsigned long long value) {
+    value = Endianness::littleEndian(value);
+    std::memcpy(data, &value, 8);
+}
+
+inline unsigned long long rotateLeft(const unsigned long long value, const int shift) {
+    return value << shift | value >> (64 - shift);
+}
+
+#ifdef __SIZEOF_INT128__
+/* Without __extension__ -pedantic complains that it's not standard */
+__extension__ typedef unsigned __int128 UnsignedInt128;
+#endif
+
+/* Full 128-bit product of a and b with the upper half XORed into the lower */
+inline unsigned long long multiplyFold(const unsigned long long a, const unsigned long long b) {
+    #ifdef __SIZEOF_INT128__
+    const UnsignedInt128 product = UnsignedInt128(a)*b;
+    return static_cast<unsigned long long>(product) ^ static_cast<unsigned long long>(product >> 64);
+    #else
+    const unsigned long long lolo = (a & 0xffffffffull)*(b & 0xffffffffull);
+    const unsigned long long hilo = (a >> 32)*(b & 0xffffffffull);
+    const unsigned long long lohi = (a & 0xffffffffull)*(b >> 32);
+    const unsigned long long hihi = (a >> 32)*(b >> 32);
+    const unsigned long long cross = (lolo >> 32) + (hilo & 0xffffffffull) + lohi;
+    const unsigned long long upper = (hilo >> 32) + (cross >> 32) + hihi;
+    const unsigned long long lower = (cross << 32) | (lolo & 0xffffffffull);
+    return lower ^ upper;
+    #endif
+}
+
+inline unsigned long long avalanche(unsigned long long h) {
+    h ^= h >> 37;
+    h *= PrimeMx1;
+    return h ^ (h >> 32);
+}
+
+/* The XXH64 final mix */
+inline unsigned long long avalancheXxh64(unsigned long long h) {
+    h ^= h >> 33;
+    h *= Prime64_2;
+    h ^= h >> 29;
+    h *= Prime64_3;
+    return h ^ (h >> 32);
+}
+
+inline unsigned long long mix16(const char* const data, const char* const secret, const unsigned long long seed) {
+    return multiplyFold(read64(data) ^ (read64(secret) + seed),
+                        read64(data + 8) ^ (read64(secret + 8) - seed));
+}
+
+/* Inputs up to 240 bytes, with a separate path for each size range. These
+   always use the default secret, the seed is applied directly. */
+unsigned long long hashShort(const char* const data, const std::size_t size, unsigned long long seed) {
+    const char* const secret = DefaultSecret;
+
+    if(size <= 16) {
+        if(size > 8) {
+            const unsigned long long low = read64(data) ^ ((read64(secret + 24) ^ read64(secret + 32)) + seed);
+            const unsigned long long high = read64(data + size - 8) ^ ((read64(secret + 40) ^ read64(secret + 48)) - seed);
+            return avalanche(size + Endianness::swap(low) + high + multiplyFold(low, high));
+        }
+
+        if(size >= 4) {
+            seed ^= static_cast<unsigned long long>(Endianness::swap(static_cast<unsigned int>(seed))) << 32;
+            const unsigned long long input = read32(data + size - 4) + (static_cast<unsigned long long>(read32(data)) << 32);
+            unsigned long long h = input ^ ((read64(secret + 8) ^ read64(secret + 16)) - seed);
+            h ^= rotateLeft(h, 49) ^ rotateLeft(h, 24);
+            h *= PrimeMx2;
+            h ^= (h >> 35) + size;
+            h *= PrimeMx2;
+            return h ^ (h >> 28);
+        }
+
+        if(size) {
+            const unsigned int combined =
+                static_cast<unsigned int>(static_cast<unsigned char>(data[0])) << 16 |
+                static_cast<unsigned int>(static_cast<unsigned char>(data[size >> 1])) << 24 |
+                static_cast<unsigned int>(static_cast<unsigned char>(data[size - 1])) |
+                static_cast<unsigned int>(size) << 8;
+            return avalancheXxh64(combined ^ ((read32(secret) ^ read32(secret + 4)) + seed));
+        }
+
+        return avalancheXxh64(seed ^ read64(secret + 56) ^ read64(secret + 64));
+    }
+
+    unsigned long long h = size*Prime64_1;
+
+    if(size <= 128) {
+        if(size > 32) {
+            if(size > 64) {
+                if(size > 96) {
+                    h += mix16(data + 48, secret + 96, seed);
+                    h += mix16(data + size - 64, secret + 112, seed);
+                }
+                h += mix16(data + 32, secret + 64, seed);
+                h += mix16(data + size - 48, secret + 80, seed);
+            }
+            h += mix16(data + 16, secret + 32, seed);
+            h += mix16(data + size - 32, secret + 48, seed);
+        }
+        h += mix16(data, secret, seed);
+        h += mix16(data + size - 16, secret + 16, seed);
+        return avalanche(h);
+    }
+
+    for(std::size_t i = 0; i != 8; ++i)
+        h += mix16(data + 16*i, secret + 16*i, seed);
+    h = avalanche(h);
+    for(std::size_t i = 8; i != size/16; ++i)
+        h += mix16(data + 16*i, secret + 16*(i - 8) + 3, seed);
+    h += mix16(data + size - 16, secret + 119, seed);
+    return avalanche(h);
+}
+
+/* Longer inputs are processed in 64-byte stripes, each of them mixed into
+   eight accumulators using a secret offset by 8 bytes for every stripe.
+   After every 16 stripes, the accumulators are scrambled. */
+inline void accumulateScalar(unsigned long long* const accumulators, const char* const data, const char* const secret) {
+    for(std::size_t i = 0; i != 8; ++i) {
+        const unsigned long long value = read64(data + 8*i);
+        const unsigned long long key = value ^ read64(secret + 8*i);
+        accumulators[i ^ 1] += value;
+        accumulators[i] += (key & 0xffffffffull)*(key >> 32);
+    }
+}
+
+inline void scrambleScalar(unsigned long long* const accumulators, const char* const secret) {
+    for(std::size_t i = 0; i != 8; ++i) {
+        unsigned long long a = accumulators[i];
+        a ^= a >> 47;
+        a ^= read64(secret + 8*i);
+        accumulators[i] = a*Prime32_1;
+    }
+}
+
+/* Processes count stripes of data, stripeCount is the position in the
+   current block of 16 stripes */
+void processStripesScalar(unsigned long long* const accumulators, std::size_t& stripeCount, const char* data, std::size_t count, const char* const secret) {
+    for(; count; --count, data += 64) {
+        accumulateScalar(accumulators, data, secret + stripeCount*8);
+        if(++stripeCount == 16) {
+            scrambleScalar(accumulators, secret + 128);
+            stripeCount = 0;
+        }
+    }
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_ENABLE_SSE2 void processStripesSse2(unsigned long long* const accumulators, std::size_t& stripeCount, const char* data, std::size_t count, const char* const secret) {
+    __m128i a[4];
+    for(std::size_t i = 0; i != 4; ++i)
+        a[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulators) + i);
+
+    for(; count; --count, data += 64) {
+        const __m128i* const key = reinterpret_cast<const __m128i*>(secret + stripeCount*8);
+        for(std::size_t i = 0; i != 4; ++i) {
+            /* Multiply the low and high 32 bits of each data ^ key and add
+               the data with the two 64-bit halves swapped */
+            const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data) + i);
+            const __m128i valueKey = _mm_xor_si128(value, _mm_loadu_si128(key + i));
+            const __m128i product = _mm_mul_epu32(valueKey, _mm_shuffle_epi32(valueKey, _MM_SHUFFLE(0, 3, 0, 1)));
+            a[i] = _mm_add_epi64(product, _mm_add_epi64(a[i], _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        if(++stripeCount == 16) {
+            const __m128i prime = _mm_set1_epi32(int(Prime32_1));
+            for(std::size_t i = 0; i != 4; ++i) {
+                const __m128i valueKey = _mm_xor_si128(_mm_xor_si128(a[i], _mm_srli_epi64(a[i], 47)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret + 128) + i));
+                /* 64-bit multiplication by a 32-bit value */
+                const __m128i productLow = _mm_mul_epu32(valueKey, prime);
+                const __m128i productHigh = _mm_mul_epu32(_mm_shuffle_epi32(valueKey, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+                a[i] = _mm_add_epi64(productLow, _mm_slli_epi64(productHigh, 32));
+            }
+            stripeCount = 0;
+        }
+    }
+
+    for(std::size_t i = 0; i != 4; ++i)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(accumulators) + i, a[i]);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+/* Same as the SSE2 variant, just with two 256-bit registers */
+CORRADE_ENABLE_AVX2 void processStripesAvx2(unsigned long long* const accumulators, std::size_t& stripeCount, const char* data, std::size_t count, const char* const secret) {
+    __m256i a[2];
+    for(std::size_t i = 0; i != 2; ++i)
+        a[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(accumulators) + i);
+
+    for(; count; --count, data += 64) {
+        const __m256i* const key = reinterpret_cast<const __m256i*>(secret + stripeCount*8);
+        for(std::size_t i = 0; i != 2; ++i) {
+            const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data) + i);
+            const __m256i valueKey = _mm256_xor_si256(value, _mm256_loadu_si256(key + i));
+            const __m256i product = _mm256_mul_epu32(valueKey, _mm256_shuffle_epi32(valueKey, _MM_SHUFFLE(0, 3, 0, 1)));
+            a[i] = _mm256_add_epi64(product, _mm256_add_epi64(a[i], _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        if(++stripeCount == 16) {
+            const __m256i prime = _mm256_set1_epi32(int(Prime32_1));
+            for(std::size_t i = 0; i != 2; ++i) {
+                const __m256i valueKey = _mm256_xor_si256(_mm256_xor_si256(a[i], _mm256_srli_epi64(a[i], 47)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret + 128) + i));
+                const __m256i productLow = _mm256_mul_epu32(valueKey, prime);
+                const __m256i productHigh = _mm256_mul_epu32(_mm256_shuffle_epi32(valueKey, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+                a[i] = _mm256_add_epi64(productLow, _mm256_slli_epi64(productHigh, 32));
+            }
+            stripeCount = 0;
+        }
+    }
+
+    for(std::size_t i = 0; i != 2; ++i)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators) + i, a[i]);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+/* Same as the SSE2 variant, with all accumulators in a single register. The
+   zero-masked variants with all lanes enabled are the same instructions, but
+   unlike the unmasked shuffle, shift and multiply intrinsics they don't go
+   through _mm512_undefined_epi32(), which triggers -Wmaybe-uninitialized on
+   GCC 12. */
+CORRADE_ENABLE_AVX512F void processStripesAvx512f(unsigned long long* const accumulators, std::size_t& stripeCount, const char* data, std::size_t count, const char* const secret) {
+    __m512i a = _mm512_loadu_si512(accumulators);
+
+    for(; count; --count, data += 64) {
+        const __m512i value = _mm512_loadu_si512(data);
+        const __m512i valueKey = _mm512_xor_si512(value, _mm512_loadu_si512(secret + stripeCount*8));
+        const __m512i product = _mm512_maskz_mul_epu32(0xff, valueKey, _mm512_maskz_srli_epi64(0xff, valueKey, 32));
+        a = _mm512_add_epi64(product, _mm512_add_epi64(a, _mm512_maskz_shuffle_epi32(0xffff, value, _MM_PERM_ENUM(_MM_SHUFFLE(1, 0, 3, 2)))));
+
+        if(++stripeCount == 16) {
+            const __m512i prime = _mm512_set1_epi32(int(Prime32_1));
+            /* 0x96 is a three-way XOR */
+            const __m512i valueKey = _mm512_ternarylogic_epi64(a, _mm512_maskz_srli_epi64(0xff, a, 47), _mm512_loadu_si512(secret + 128), 0x96);
+            const __m512i productLow = _mm512_maskz_mul_epu32(0xff, valueKey, prime);
+            const __m512i productHigh = _mm512_maskz_mul_epu32(0xff, _mm512_maskz_srli_epi64(0xff, valueKey, 32), prime);
+            a = _mm512_add_epi64(productLow, _mm512_maskz_slli_epi64(0xff, productHigh, 32));
+            stripeCount = 0;
+        }
+    }
+
+    _mm512_storeu_si512(accumulators, a);
+}
+#endif
+
+}
+
+namespace Implementation {
+
+XxHash3ProcessStripesFunction xxHash3ProcessStripesImplementation(Cpu::ScalarT) {
+    return processStripesScalar;
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+XxHash3ProcessStripesFunction xxHash3ProcessStripesImplementation(Cpu::Sse2T) {
+    return processStripesSse2;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+XxHash3ProcessStripesFunction xxHash3ProcessStripesImplementation(Cpu::Avx2T) {
+    return processStripesAvx2;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+XxHash3ProcessStripesFunction xxHash3ProcessStripesImplementation(Cpu::Avx512fT) {
+    return processStripesAvx512f;
+}
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+CORRADE_CPU_DISPATCHER(processStripesDispatcher, Utility::Implementation::xxHash3ProcessStripesImplementation)
+#ifdef CORRADE_CPU_USE_IFUNC
+CORRADE_CPU_DISPATCHED_IFUNC(processStripesDispatcher, void processStripes(unsigned long long*, std::size_t&, const char*, std::size_t, const char*))
+#else
+CORRADE_CPU_DISPATCHED_POINTER(processStripesDispatcher, Implementation::XxHash3ProcessStripesFunction processStripes)
+#endif
+#else
+void processStripes(unsigned long long* const accumulators, std::size_t& stripeCount, const char* const data, const std::size_t count, const char* const secret) {
+    Implementation::xxHash3ProcessStripesImplementation(Cpu::DefaultBase)(accumulators, stripeCount, data, count, secret);
+}
+#endif
+
+/* The stripes are regular stripes only if there's at least one byte after
+   them, the last 64 bytes are always processed with a different offset into
+   the secret, even if they overlap with already processed data */
+unsigned long long hashLongFinish(unsigned long long* const accumulators, const char* const lastStripe, const char* const secret, const unsigned long long size) {
+    accumulateScalar(accumulators, lastStripe, secret + 192 - 64 - 7);
+
+    unsigned long long h = size*Prime64_1;
+    for(std::size_t i = 0; i != 4; ++i)
+        h += multiplyFold(accumulators[2*i] ^ read64(secret + 11 + 16*i),
+                          accumulators[2*i + 1] ^ read64(secret + 11 + 16*i + 8));
+    return avalanche(h);
+}
+
+unsigned long long hashLong(const Implementation::XxHash3ProcessStripesFunction processStripes, const char* const data, const std::size_t size, const char* const secret) {
+    unsigned long long accumulators[8];
+    std::memcpy(accumulators, InitialAccumulators, sizeof(accumulators));
+    std::size_t stripeCount = 0;
+    processStripes(accumulators, stripeCount, data, (size - 1)/64, secret);
+    return hashLongFinish(accumulators, data + size - 64, secret, size);
+}
+
+/* Longer inputs with a seed use the default secret with the seed added to
+   and subtracted from alternating 64-bit values */
+void deriveSecret(char* const out, const unsigned long long seed) {
+    for(std::size_t i = 0; i != sizeof(DefaultSecret); i += 16) {
+        write64(out + i, read64(DefaultSecret + i) + seed);
+        write64(out + i + 8, read64(DefaultSecret + i + 8) - seed);
+    }
+}
+
+XxHash3::Digest canonicalDigest(unsigned long long hash) {
+    hash = Endianness::bigEndian(hash);
+    return XxHash3::Digest::fromByteArray(reinterpret_cast<const char*>(&hash));
+}
+
+}
+
+namespace Implementation {
+
+unsigned long long xxHash3(const char* const data, const std::size_t size, const unsigned long long seed, const XxHash3ProcessStripesFunction processStripes) {
+    if(size <= 240) return hashShort(data, size, seed);
+    if(!seed) return hashLong(processStripes, data, size, DefaultSecret);
+
+    alignas(64) char secret[sizeof(DefaultSecret)];
+    deriveSecret(secret, seed);
+    return hashLong(processStripes, data, size, secret);
+}
+
+unsigned long long xxHash3(const char* const data, const std::size_t size, const unsigned long long seed) {
+    return xxHash3(data, size, seed, processStripes);
+}
+
+}
+
+XxHash3::XxHash3(const unsigned long long seed): _seed{seed}, _bufferSize{}, _stripeCount{}, _dataSize{} {
+    std::memcpy(_accumulators, InitialAccumulators, sizeof(_accumulators));
+    deriveSecret(_secret, seed);
+}
+
+XxHash3::Digest XxHash3::operator()(const char* const data, const std::size_t size) const {
+    return canonicalDigest(Implementation::xxHash3(data, size, _seed));
+}
+
+XxHash3& XxHash3::operator<<(const Containers::ArrayView<const char> data) {
+    const char* begin = data.begin();
+    const char* const end = data.end();
+    _dataSize += data.size();
+
+    /* Not large enough, keep it for later */
+    if(_bufferSize + data.size() <= sizeof(_buffer)) {
+        std::memcpy(_buffer + _bufferSize, begin, data.size());
+        _bufferSize += data.size();
+        return *this;
+    }
+
+    /* There's more than 240 bytes in total, so the long variant will be used.
+       Fill the buffer and process it whole, as there's at least one more
+       byte after it. Its end then contains the last 64 processed bytes. */
+    if(_bufferSize) {
+        const std::size_t fill = sizeof(_buffer) - _bufferSize;
+        std::memcpy(_buffer + _bufferSize, begin, fill);
+        begin += fill;
+        processStripes(_accumulators, _stripeCount, _buffer, sizeof(_buffer)/64, _secret);
+    }
+
+    /* Process as much as possible directly, leaving at least one byte, and
+       save the last 64 processed bytes at the end of the buffer */
+    if(std::size_t(end - begin) > sizeof(_buffer)) {
+        const std::size_t count = (end - begin - 1)/64;
+        processStripes(_accumulators, _stripeCount, begin, count, _secret);
+        begin += count*64;
+        std::memcpy(_buffer + sizeof(_buffer) - 64, begin - 64, 64);
+    }
+
+    /* Keep the rest for later. If it overwrites the saved 64 bytes, it's
+       more than 64 bytes and so they aren't needed anymore. */
+    _bufferSize = end - begin;
+    std::memcpy(_buffer, begin, _bufferSize);
+    return *this;
+}
+
+XxHash3& XxHash3::operator<<(const std::string& data) {
+    return *this << Containers::arrayView(data.data(), data.size());
+}
+
+XxHash3::Digest XxHash3::digest() {
+    unsigned long long hash;
+    if(_dataSize <= 240) {
+        hash = hashShort(_buffer, _dataSize, _seed);
+    } else {
+        /* Process the remaining regular stripes. If there's less than 64
+           bytes left, the last stripe is partially made of the already
+           processed bytes saved at the end of the buffer. */
+        char lastStripe[64];
+        const char* last;
+        if(_bufferSize >= 64) {
+            processStripes(_accumulators, _stripeCount, _buffer, (_bufferSize - 1)/64, _secret);
+            last = _buffer + _bufferSize - 64;
+        } else {
+            const std::size_t previous = 64 - _bufferSize;
+            std::memcpy(lastStripe, _buffer + sizeof(_buffer) - previous, previous);
+            std::memcpy(lastStripe + previous, _buffer, _bufferSize);
+            last = lastStripe;
+        }
+
+        hash = hashLongFinish(_accumulators, last, _secret, _dataSize);
+    }
+
+    /* Clear data and return */
+    std::memcpy(_accumulators, InitialAccumulators, sizeof(_accumulators));
+    _bufferSize = 0;
+    _stripeCount = 0;
+    _dataSize = 0;
+    return canonicalDigest(hash);
+}
+
+}}
@@ -0,0 +1,148 @@
+#ifndef Corrade_Utility_XxHash3_h
+#define Corrade_Utility_XxHash3_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Utility::XxHash3
+ * @m_since_latest
+ */
+
+#include <cstddef>
+#include <string>
+
+#include "Corrade/Containers/Containers.h"
+#include "Corrade/Utility/AbstractHash.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Utility {
+
+namespace Implementation {
+    CORRADE_UTILITY_EXPORT unsigned long long xxHash3(const char* data, std::size_t size, unsigned long long seed);
+}
+
+/**
+@brief XXH3
+@m_since_latest
+
+The 64-bit variant of the XXH3 algorithm from the
+[xxHash](https://github.com/Cyan4973/xxHash) family, a fast non-cryptographic
+hash. The digest is the same as produced by the reference implementation, and
+is stored in the canonical big-endian representation, which means
+@ref HashDigest::hexString() gives the same value as `xxhsum -H3`.
+
+Inputs up to 240 bytes are hashed with dedicated code paths for each size
+range, longer inputs go through a loop processing 64 bytes at a time, which
+uses SSE2, AVX2 or AVX-512 if available. With
+@ref CORRADE_BUILD_CPU_RUNTIME_DISPATCH enabled the implementation is picked
+at runtime based on @ref Cpu::runtimeFeatures().
+
+Similarly to @ref MurmurHash2, the hash can be computed at once using
+@ref operator()(). Alternatively, the data can be added piece by piece as with
+@ref Sha1 and the digest retrieved at the end, giving the same result:
+
+@snippet Utility.cpp XxHash3-usage
+
+This hash is used by @ref Containers::Hash for strings.
+*/
+class CORRADE_UTILITY_EXPORT XxHash3: public AbstractHash<8> {
+    public:
+        /**
+         * @brief Digest of given data
+         *
+         * Computes digest using default zero seed. This function is here for
+         * consistency with other @ref AbstractHash subclasses.
+         */
+        static Digest digest(const std::string& data) {
+            return XxHash3()(data);
+        }
+
+        /**
+         * @brief Constructor
+         * @param seed      Seed to initialize the hash
+         */
+        explicit XxHash3(unsigned long long seed = 0);
+
+        /** @brief Seed */
+        unsigned long long seed() const { return _seed; }
+
+        /**
+         * @brief Compute digest of given data
+         *
+         * Uses the seed passed in the constructor, doesn't affect any data
+         * added using @ref operator<<().
+         */
+        Digest operator()(const std::string& data) const {
+            return operator()(data.data(), data.size());
+        }
+
+        /** @copydoc operator()(const std::string&) const */
+        template<std::size_t size> Digest operator()(const char(&data)[size]) const {
+            return operator()(data, size - 1);
+        }
+
+        /** @copydoc operator()(const std::string&) const */
+        Digest operator()(const char* data, std::size_t size) const;
+
+        /** @brief Add data for digesting */
+        XxHash3& operator<<(Containers::ArrayView<const char> data);
+
+        /** @overload */
+        XxHash3& operator<<(const std::string& data);
+
+        /**
+         * @brief @cpp operator<< @ce with C strings is not allowed
+         *
+         * To clarify your intent with handling the @cpp '\0' @ce delimiter,
+         * cast to @ref Containers::ArrayView or @ref std::string instead.
+         */
+        XxHash3& operator<<(const char*) = delete;
+
+        /**
+         * @brief Digest of all added data
+         *
+         * Afterwards the hash is reset to the initial state, keeping the
+         * seed.
+         */
+        Digest digest();
+
+    private:
+        unsigned long long _seed;
+        unsigned long long _accumulators[8];
+        /* Inputs up to 240 bytes are hashed differently, so the data are
+           buffered until there's more. Afterwards, the last 64 bytes of
+           already processed data are kept at the end to be able to hash the
+           last 64 bytes of the input as a whole. */
+        char _buffer[256];
+        /* Derived from the seed, stays at the default if it's zero */
+        char _secret[192];
+        std::size_t _bufferSize;
+        std::size_t _stripeCount;
+        unsigned long long _dataSize;
+};
+
+}}
+
+#endif
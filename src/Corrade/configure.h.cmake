@@ -33,6 +33,8 @@
 #cmakedefine CORRADE_BUILD_STATIC
 #cmakedefine CORRADE_BUILD_STATIC_UNIQUE_GLOBALS
 #cmakedefine CORRADE_BUILD_MULTITHREADED
+#cmakedefine CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+#cmakedefine CORRADE_CPU_USE_IFUNC
 
 #cmakedefine CORRADE_TARGET_APPLE
 #cmakedefine CORRADE_TARGET_IOS
@@ -170,11 +172,47 @@
 #define CORRADE_BIG_ENDIAN
 #endif
 
-/* SIMD extensions. Not much here yet. */
+/* SIMD extensions */
 #ifdef CORRADE_TARGET_GCC
 #ifdef __SSE2__
 #define CORRADE_TARGET_SSE2
 #endif
+#ifdef __SSE3__
+#define CORRADE_TARGET_SSE3
+#endif
+#ifdef __SSSE3__
+#define CORRADE_TARGET_SSSE3
+#endif
+#ifdef __SSE4_1__
+#define CORRADE_TARGET_SSE41
+#endif
+#ifdef __SSE4_2__
+#define CORRADE_TARGET_SSE42
+#endif
+#ifdef __AVX__
+#define CORRADE_TARGET_AVX
+#endif
+#ifdef __AVX2__
+#define CORRADE_TARGET_AVX2
+#endif
+#ifdef __AVX512F__
+#define CORRADE_TARGET_AVX512F
+#endif
+#ifdef __POPCNT__
+#define CORRADE_TARGET_POPCNT
+#endif
+#ifdef __LZCNT__
+#define CORRADE_TARGET_LZCNT
+#endif
+#ifdef __BMI__
+#define CORRADE_TARGET_BMI1
+#endif
+#ifdef __BMI2__
+#define CORRADE_TARGET_BMI2
+#endif
+#ifdef __SHA__
+#define CORRADE_TARGET_SHA
+#endif
 
 #elif defined(CORRADE_TARGET_MSVC)
 /* _M_IX86_FP is defined only on 32bit, 64bit has SSE2 always (so we need to
@@ -182,6 +220,33 @@
 #if (defined(_M_IX86_FP) && _M_IX86_FP == 2) || defined(_M_AMD64) || defined(_M_X64)
 #define CORRADE_TARGET_SSE2
 #endif
+/* MSVC has no macros for SSE3 to SSE4.2 and POPCNT, the closest is
+   /arch:AVX, which implies them */
+#ifdef __AVX__
+#define CORRADE_TARGET_SSE3
+#define CORRADE_TARGET_SSSE3
+#define CORRADE_TARGET_SSE41
+#define CORRADE_TARGET_SSE42
+#define CORRADE_TARGET_POPCNT
+#define CORRADE_TARGET_AVX
+#endif
+/* MSVC defines __AVX2__ with /arch:AVX2 as well. There's no dedicated macro
+   for LZCNT and BMI, but all CPUs with AVX2 have them. */
+#ifdef __AVX2__
+#define CORRADE_TARGET_AVX2
+#define CORRADE_TARGET_LZCNT
+#define CORRADE_TARGET_BMI1
+#define CORRADE_TARGET_BMI2
+#endif
+#ifdef __AVX512F__
+#define CORRADE_TARGET_AVX512F
+#endif
+#endif
+
+/* NEON is always present on 64-bit ARM, MSVC doesn't define __ARM_NEON
+   there */
+#if defined(__ARM_NEON) || (defined(CORRADE_TARGET_MSVC) && defined(_M_ARM64))
+#define CORRADE_TARGET_NEON
 #endif
 
 /* Documented in Utility/TypeTraits.h */